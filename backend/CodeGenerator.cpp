@@ -33,7 +33,8 @@ bool CodeGenerator::run(std::string outFileName)
     // 这里主要便于C语言学习的学生
     if (!outFileName.empty()) {
         // 指定文件非空时，则创建文件
-        fp = fopen(outFileName.c_str(), "w");
+        // 按二进制方式打开，目标文件等二进制内容不会被转换换行符
+        fp = fopen(outFileName.c_str(), "wb");
         if (nullptr == fp) {
             printf("open file(%s) failed", outFileName.c_str());
             return false;
@@ -2,8 +2,8 @@
 /// @file CodeGenerator.h
 /// @brief 代码生成器共同类的头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>增加并行产生代码的线程数
 /// </table>
 ///
 #pragma once
@@ -45,6 +46,24 @@ public:
         this->showLinearIR = show;
     }
 
+    ///
+    /// @brief 设置是否进行指令调度
+    /// @param schedule true：调度，false：不调度
+    ///
+    void setInstSchedule(bool schedule)
+    {
+        this->instSchedule = schedule;
+    }
+
+    ///
+    /// @brief 设置并行产生代码的线程数，目前只有ARM32汇编按函数并行
+    /// @param _jobs 线程数，0表示按CPU核数
+    ///
+    void setJobs(unsigned _jobs)
+    {
+        this->jobs = _jobs;
+    }
+
 protected:
     /// @brief 代码产生器运行，结果保存到指定的文件中
     /// @param fp 输出内容所在文件的指针
@@ -63,4 +82,14 @@ protected:
     /// @brief 显示IR指令内容
     ///
     bool showLinearIR = false;
+
+    ///
+    /// @brief 是否进行基本块内的指令调度
+    ///
+    bool instSchedule = false;
+
+    ///
+    /// @brief 并行产生代码的线程数
+    ///
+    unsigned jobs = 1;
 };
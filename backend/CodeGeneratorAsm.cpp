@@ -14,9 +14,13 @@
 /// </table>
 ///
 #include "CodeGenerator.h"
+#include <set>
+#include <unordered_map>
+
 #include "CodeGeneratorAsm.h"
 #include "Module.h"
 #include "Function.h"
+#include "ConstInt.h"
 
 /// @brief 构造函数
 CodeGeneratorAsm::CodeGeneratorAsm(Module * _module) : CodeGenerator(_module)
@@ -39,6 +43,109 @@ void CodeGeneratorAsm::genCodeSection()
     }
 }
 
+/// @brief 分析所有函数的指令，找出可能被修改的全局变量，结果保存在writtenGlobals中。
+/// 直接赋值、通过由其地址计算得到的指针赋值，或者地址作为实参传递给函数，都认为被修改
+void CodeGeneratorAsm::collectWrittenGlobals()
+{
+    writtenGlobals.clear();
+
+    // 值可能指向的全局变量，全局变量本身指向自己
+    std::unordered_map<Value *, std::set<GlobalVariable *>> roots;
+    for (auto var: module->getGlobalVariables()) {
+        roots[var].insert(var);
+    }
+
+    // 由全局变量地址计算得到的指针，以及保存这些指针的变量，迭代到不再变化为止
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (auto func: module->getFunctionList()) {
+            for (auto inst: func->getInterCode().getInsts()) {
+
+                Value * dst;
+                if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+                    // 指针的复制，dst = src
+                    dst = inst->getOperand(0);
+                    if (!dst->getType()->isPointerType() || !inst->getOperand(1)->getType()->isPointerType()) {
+                        continue;
+                    }
+                } else if (inst->hasResultValue() && inst->getType()->isPointerType()) {
+                    // 地址计算
+                    dst = inst;
+                } else {
+                    continue;
+                }
+
+                std::set<GlobalVariable *> & dstRoots = roots[dst];
+                size_t oldSize = dstRoots.size();
+
+                for (auto operand: inst->getOperands()) {
+                    auto pIter = roots.find(operand->getUsee());
+                    if ((pIter != roots.end()) && (pIter->first != dst)) {
+                        dstRoots.insert(pIter->second.begin(), pIter->second.end());
+                    }
+                }
+
+                changed |= dstRoots.size() != oldSize;
+            }
+        }
+    }
+
+    for (auto func: module->getFunctionList()) {
+        for (auto inst: func->getInterCode().getInsts()) {
+
+            if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+
+                Value * dst = inst->getOperand(0);
+                Value * src = inst->getOperand(1);
+
+                if (Instanceof(var, GlobalVariable *, dst)) {
+                    // 直接赋值，@g = %t0
+                    writtenGlobals.insert(var);
+                } else if (dst->getType()->isPointerType() && !src->getType()->isPointerType()) {
+                    // 通过指针赋值，*%t1 = %t0
+                    auto pIter = roots.find(dst);
+                    if (pIter != roots.end()) {
+                        writtenGlobals.insert(pIter->second.begin(), pIter->second.end());
+                    }
+                }
+            } else if (inst->getOp() == IRInstOperator::IRINST_OP_FUNC_CALL) {
+
+                // 地址作为实参传递，被调函数可能修改
+                for (auto operand: inst->getOperands()) {
+                    Value * arg = operand->getUsee();
+                    if (!arg->getType()->isPointerType() && !arg->getType()->isArrayType()) {
+                        continue;
+                    }
+
+                    auto pIter = roots.find(arg);
+                    if (pIter != roots.end()) {
+                        writtenGlobals.insert(pIter->second.begin(), pIter->second.end());
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// @brief 获取全局变量的初值，按4字节的字展开，没有初值的部分为0
+/// @param var 全局变量
+/// @param words 初值
+void CodeGeneratorAsm::getInitWords(GlobalVariable * var, std::vector<int32_t> & words)
+{
+    words.assign((var->getType()->getSize() + 3) / 4, 0);
+
+    Constant * initializer = var->getInitializer();
+
+    if (Instanceof(constVal, ConstInt *, initializer)) {
+        // 标量的初值
+        if (!words.empty()) {
+            words[0] = constVal->getVal();
+        }
+    }
+}
+
 /// @brief 产生汇编文件
 /// @param fp 要输出的文件
 /// @return true:成功，false:失败
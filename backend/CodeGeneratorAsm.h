@@ -2,8 +2,8 @@
 /// @file CodeGeneratorAsm.h
 /// @brief 后端汇编代码生成器接口的头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,12 +11,18 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>代码段的产生可由具体的后端重写
 /// </table>
 ///
+#pragma once
+
 #include <cstdio>
 #include <cstring>
+#include <unordered_set>
+#include <vector>
 
 #include "CodeGenerator.h"
+#include "GlobalVariable.h"
 
 /// @brief 生成汇编的代码生成器共同类
 class CodeGeneratorAsm : public CodeGenerator {
@@ -52,7 +58,21 @@ protected:
     bool run() override;
 
     /// @brief 汇编指令生成，放到.text代码段中
-    void genCodeSection();
+    virtual void genCodeSection();
+
+    /// @brief 分析所有函数的指令，找出可能被修改的全局变量，结果保存在writtenGlobals中。
+    /// 直接赋值、通过由其地址计算得到的指针赋值，或者地址作为实参传递给函数，都认为被修改
+    void collectWrittenGlobals();
+
+    /// @brief 获取全局变量的初值，按4字节的字展开，没有初值的部分为0
+    /// @param var 全局变量
+    /// @param words 初值
+    static void getInitWords(GlobalVariable * var, std::vector<int32_t> & words);
+
+    ///
+    /// @brief 可能被修改的全局变量，其余的全局变量可放在只读数据段
+    ///
+    std::unordered_set<GlobalVariable *> writtenGlobals;
 
     ///
     /// @brief Label索引编号，要求文件级别的编号，而不是函数级别的编号
@@ -0,0 +1,594 @@
+///
+/// @file ArmEncoder.cpp
+/// @brief ARM32机器指令的二进制编码，供直接输出目标文件使用
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cctype>
+#include <string>
+
+#include "ArmEncoder.h"
+#include "Common.h"
+
+/// @brief 数据处理指令的操作码，位于指令的24-21位
+#define DP_SUB 0x2
+#define DP_RSB 0x3
+#define DP_ADD 0x4
+#define DP_CMP 0xA
+#define DP_CMN 0xB
+#define DP_MOV 0xD
+#define DP_MVN 0xF
+
+/// @brief 是否为数字局部标签，如1
+/// @param name 标签名
+static bool isNumericLabel(const std::string & name)
+{
+    if (name.empty()) {
+        return false;
+    }
+
+    for (auto ch: name) {
+        if (!isdigit((unsigned char) ch)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/// @brief 是否为对数字局部标签的引用，如1f、1b
+/// @param name 引用的名字
+static bool isNumericLabelRef(const std::string & name)
+{
+    if ((name.size() < 2) || ((name.back() != 'f') && (name.back() != 'b'))) {
+        return false;
+    }
+
+    return isNumericLabel(name.substr(0, name.size() - 1));
+}
+
+/// @brief 编码指令序列
+/// @param code 指令序列
+/// @return true：成功，false：有不支持的指令、超出范围的偏移或者不存在的标签
+bool ArmEncoder::encode(const std::list<ArmInst *> & code)
+{
+    if (!layout(code)) {
+        return false;
+    }
+
+    for (auto arm: code) {
+
+        if (arm->dead) {
+            continue;
+        }
+
+        switch (arm->opcode) {
+            case ArmOp::LABEL:
+            case ArmOp::COMMENT:
+            case ArmOp::NOP:
+            case ArmOp::MAX:
+                break;
+
+            case ArmOp::LTORG:
+                emitPool(pools[arm]);
+                break;
+
+            default: {
+                uint32_t word;
+                if (!encodeInst(arm, (uint32_t) bytes.size(), word)) {
+                    minic_log(LOG_ERROR, "ARM指令(%s)无法编码", arm->outPut().c_str());
+                    return false;
+                }
+
+                emitWord(word);
+                break;
+            }
+        }
+    }
+
+    emitPool(tailPool);
+
+    return true;
+}
+
+/// @brief 第一遍：计算标签、文字池常量的地址
+/// @param code 指令序列
+/// @return true：成功
+bool ArmEncoder::layout(const std::list<ArmInst *> & code)
+{
+    uint32_t addr = 0;
+
+    // 当前文字池中的常量，与placeLiteralPools一样相同的常量只保留一份
+    std::vector<Literal> pending;
+    std::unordered_map<std::string, uint32_t> pendingIndex;
+    std::vector<std::pair<const ArmInst *, uint32_t>> users;
+
+    // 数字局部标签可重复定义，1f引用之后最近的1，1b引用之前最近的1
+    std::unordered_map<std::string, std::vector<const ArmInst *>> forwardRefs;
+    std::unordered_map<std::string, uint32_t> backwardLabels;
+
+    // 文字池放置在当前位置
+    auto flush = [&](std::vector<Literal> & pool) {
+        for (auto & [user, index]: users) {
+            literalAddrs[user] = addr + index * 4;
+        }
+
+        addr += (uint32_t) pending.size() * 4;
+        pool.swap(pending);
+        pending.clear();
+        pendingIndex.clear();
+        users.clear();
+    };
+
+    for (auto arm: code) {
+
+        if (arm->dead) {
+            continue;
+        }
+
+        switch (arm->opcode) {
+            case ArmOp::LABEL:
+                if (isNumericLabel(arm->symbol)) {
+                    for (auto ref: forwardRefs[arm->symbol]) {
+                        localTargets[ref] = addr;
+                    }
+                    forwardRefs.erase(arm->symbol);
+                    backwardLabels[arm->symbol] = addr;
+                } else {
+                    labels[arm->symbol] = addr;
+                }
+                break;
+
+            case ArmOp::COMMENT:
+            case ArmOp::NOP:
+            case ArmOp::MAX:
+                break;
+
+            case ArmOp::LTORG:
+                flush(pools[arm]);
+                break;
+
+            default:
+                if ((arm->opcode == ArmOp::B) && isNumericLabelRef(arm->symbol)) {
+
+                    std::string name = arm->symbol.substr(0, arm->symbol.size() - 1);
+                    if (arm->symbol.back() == 'f') {
+                        forwardRefs[name].push_back(arm);
+                    } else {
+                        auto pIter = backwardLabels.find(name);
+                        if (pIter == backwardLabels.end()) {
+                            minic_log(LOG_ERROR, "标签(%s)不存在", arm->symbol.c_str());
+                            return false;
+                        }
+                        localTargets[arm] = pIter->second;
+                    }
+                }
+
+                if (arm->isLiteralLoad()) {
+
+                    std::string key;
+                    Literal literal{arm->arg1.imm, ""};
+                    if (arm->arg1.kind == ArmOperandKind::LIT_SYM) {
+                        key = "=" + arm->symbol;
+                        literal = Literal{0, arm->symbol};
+                    } else {
+                        key = std::to_string(arm->arg1.imm);
+                    }
+
+                    auto pIter = pendingIndex.find(key);
+                    if (pIter == pendingIndex.end()) {
+                        pIter = pendingIndex.emplace(key, (uint32_t) pending.size()).first;
+                        pending.push_back(literal);
+                    }
+
+                    users.emplace_back(arm, pIter->second);
+                }
+
+                addr += 4;
+                break;
+        }
+    }
+
+    // 正常情况下placeLiteralPools已在函数末尾放置了.ltorg
+    if (!pending.empty()) {
+        flush(tailPool);
+    }
+
+    if (!forwardRefs.empty()) {
+        minic_log(LOG_ERROR, "标签(%sf)不存在", forwardRefs.begin()->first.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief 输出文字池中的常量，符号地址留下重定位
+/// @param pool 文字池
+void ArmEncoder::emitPool(const std::vector<Literal> & pool)
+{
+    for (auto & literal: pool) {
+
+        if (literal.symbol.empty()) {
+            emitWord((uint32_t) literal.value, true);
+        } else {
+            // REL格式的重定位，加数保存在被重定位的字中
+            relocations.push_back({(uint32_t) bytes.size(), R_ARM_ABS32, literal.symbol});
+            emitWord(0, true);
+        }
+    }
+}
+
+/// @brief 输出一个字
+/// @param word 字
+/// @param isData 是否为数据
+void ArmEncoder::emitWord(uint32_t word, bool isData)
+{
+    // 代码与数据交替时记录分界，第一个字总是记录
+    if (bytes.empty() || (isData != inData)) {
+        mappings.emplace_back((uint32_t) bytes.size(), isData);
+        inData = isData;
+    }
+
+    for (int k = 0; k < 4; k++) {
+        bytes.push_back((uint8_t) (word >> (8 * k)));
+    }
+}
+
+/// @brief 条件码的编码
+/// @param cond 条件码
+/// @return 指令的31-28位
+uint32_t ArmEncoder::condBits(ArmCond cond)
+{
+    switch (cond) {
+        case ArmCond::EQ:
+            return 0x0u << 28;
+        case ArmCond::NE:
+            return 0x1u << 28;
+        case ArmCond::GE:
+            return 0xAu << 28;
+        case ArmCond::LT:
+            return 0xBu << 28;
+        case ArmCond::GT:
+            return 0xCu << 28;
+        case ArmCond::LE:
+            return 0xDu << 28;
+        default:
+            return 0xEu << 28;
+    }
+}
+
+/// @brief 8位数循环右移偶数位的立即数编码
+/// @param value 立即数
+/// @param encoded 编码结果，rotate与imm8
+/// @return true：可以编码
+bool ArmEncoder::encodeRotatedImm(uint32_t value, uint32_t & encoded)
+{
+    for (uint32_t rotate = 0; rotate < 16; rotate++) {
+
+        // value为imm8循环右移2*rotate位，反过来循环左移即得到imm8
+        uint32_t shift = 2 * rotate;
+        uint32_t imm8 = shift ? ((value << shift) | (value >> (32 - shift))) : value;
+
+        if (imm8 <= 0xFF) {
+            encoded = (rotate << 8) | imm8;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 编码数据处理指令
+/// @param cond 条件码
+/// @param op 操作码，MOV、MVN、ADD、SUB、RSB或CMP
+/// @param rd 目的寄存器
+/// @param rn 第一源寄存器
+/// @param opnd2 第二源操作数，寄存器或立即数
+/// @param word 编码结果
+/// @return true：成功，false：立即数无法编码
+bool ArmEncoder::encodeDataProc(uint32_t cond,
+                                ArmOp op,
+                                int32_t rd,
+                                int32_t rn,
+                                const ArmOperand & opnd2,
+                                uint32_t & word)
+{
+    uint32_t opcode;
+    switch (op) {
+        case ArmOp::MOV:
+            opcode = DP_MOV;
+            break;
+        case ArmOp::MVN:
+            opcode = DP_MVN;
+            break;
+        case ArmOp::ADD:
+            opcode = DP_ADD;
+            break;
+        case ArmOp::SUB:
+            opcode = DP_SUB;
+            break;
+        case ArmOp::RSB:
+            opcode = DP_RSB;
+            break;
+        case ArmOp::CMP:
+            opcode = DP_CMP;
+            break;
+        default:
+            return false;
+    }
+
+    uint32_t operand2;
+    uint32_t immBit = 0;
+
+    if (opnd2.kind == ArmOperandKind::REG) {
+        operand2 = (uint32_t) opnd2.reg;
+    } else if (opnd2.kind == ArmOperandKind::IMM) {
+
+        uint32_t value = (uint32_t) opnd2.imm;
+
+        if (!encodeRotatedImm(value, operand2)) {
+
+            // 与汇编器一样换成等价的指令，如add r0,r0,#-4换成sub r0,r0,#4，mov r0,#-2换成mvn r0,#1
+            switch (opcode) {
+                case DP_MOV:
+                    opcode = DP_MVN;
+                    value = ~value;
+                    break;
+                case DP_MVN:
+                    opcode = DP_MOV;
+                    value = ~value;
+                    break;
+                case DP_ADD:
+                    opcode = DP_SUB;
+                    value = 0u - value;
+                    break;
+                case DP_SUB:
+                    opcode = DP_ADD;
+                    value = 0u - value;
+                    break;
+                case DP_CMP:
+                    opcode = DP_CMN;
+                    value = 0u - value;
+                    break;
+                default:
+                    return false;
+            }
+
+            if (!encodeRotatedImm(value, operand2)) {
+                return false;
+            }
+        }
+
+        immBit = 1u << 25;
+    } else {
+        return false;
+    }
+
+    // 比较指令总是设置条件标志，且没有目的寄存器
+    uint32_t sBit = ((opcode == DP_CMP) || (opcode == DP_CMN)) ? (1u << 20) : 0;
+
+    word = cond | immBit | (opcode << 21) | sBit | ((uint32_t) rn << 16) | ((uint32_t) rd << 12) | operand2;
+
+    return true;
+}
+
+/// @brief 编码访存指令
+/// @param inst 指令
+/// @param addr 指令的地址
+/// @param word 编码结果
+/// @return true：成功
+bool ArmEncoder::encodeMemory(const ArmInst * inst, uint32_t addr, uint32_t & word)
+{
+    uint32_t cond = condBits(inst->cond);
+    bool load = inst->opcode == ArmOp::LDR;
+    uint32_t rd = (uint32_t) inst->result.reg;
+
+    if (inst->result.kind != ArmOperandKind::REG) {
+        return false;
+    }
+
+    int32_t offset;
+    uint32_t rn;
+
+    if (inst->arg1.isLiteral()) {
+
+        // 文字池寻址，ldr r0,[pc,#off]，PC领先当前指令8字节
+        auto pIter = literalAddrs.find(inst);
+        if (pIter == literalAddrs.end()) {
+            return false;
+        }
+
+        offset = (int32_t) pIter->second - (int32_t) (addr + 8);
+        rn = 15;
+    } else if (inst->arg1.kind == ArmOperandKind::MEM) {
+
+        rn = (uint32_t) inst->arg1.reg;
+
+        if (inst->arg1.index != -1) {
+            // [base,index]，寄存器偏移
+            word = cond | (load ? 0x07900000u : 0x07800000u) | (rn << 16) | (rd << 12) | (uint32_t) inst->arg1.index;
+            return true;
+        }
+
+        offset = inst->arg1.imm;
+    } else {
+        return false;
+    }
+
+    // 12位的偏移，U位给出加还是减
+    if ((offset <= -4096) || (offset >= 4096)) {
+        return false;
+    }
+
+    uint32_t upBit = (offset >= 0) ? (1u << 23) : 0;
+    uint32_t imm12 = (uint32_t) ((offset >= 0) ? offset : -offset);
+
+    word = cond | (load ? 0x05100000u : 0x05000000u) | upBit | (rn << 16) | (rd << 12) | imm12;
+
+    return true;
+}
+
+/// @brief 查找跳转目标的地址
+/// @param inst 跳转指令
+/// @param addr 目标地址
+/// @return true：找到
+bool ArmEncoder::branchTarget(const ArmInst * inst, uint32_t & addr)
+{
+    auto localIter = localTargets.find(inst);
+    if (localIter != localTargets.end()) {
+        addr = localIter->second;
+        return true;
+    }
+
+    auto pIter = labels.find(inst->symbol);
+    if (pIter != labels.end()) {
+        addr = pIter->second;
+        return true;
+    }
+
+    return false;
+}
+
+/// @brief 编码一条指令
+/// @param inst 指令
+/// @param addr 指令的地址
+/// @param word 编码结果
+/// @return true：成功
+bool ArmEncoder::encodeInst(const ArmInst * inst, uint32_t addr, uint32_t & word)
+{
+    uint32_t cond = condBits(inst->cond);
+
+    const ArmOperand & result = inst->result;
+    const ArmOperand & arg1 = inst->arg1;
+    const ArmOperand & arg2 = inst->arg2;
+
+    switch (inst->opcode) {
+        case ArmOp::MOV:
+        case ArmOp::MVN:
+            // mov r0,r1 mov r0,#1
+            if (result.kind != ArmOperandKind::REG) {
+                return false;
+            }
+            return encodeDataProc(cond, inst->opcode, result.reg, 0, arg1, word);
+
+        case ArmOp::ADD:
+        case ArmOp::SUB:
+        case ArmOp::RSB:
+            // add r0,r1,r2 add r0,r1,#1
+            if ((result.kind != ArmOperandKind::REG) || (arg1.kind != ArmOperandKind::REG)) {
+                return false;
+            }
+            return encodeDataProc(cond, inst->opcode, result.reg, arg1.reg, arg2, word);
+
+        case ArmOp::CMP:
+            // cmp r0,r1 cmp r0,#0，第一个操作数在result中
+            if (result.kind != ArmOperandKind::REG) {
+                return false;
+            }
+            return encodeDataProc(cond, inst->opcode, 0, result.reg, arg1, word);
+
+        case ArmOp::MOVW:
+        case ArmOp::MOVT: {
+            if (result.kind != ArmOperandKind::REG) {
+                return false;
+            }
+
+            uint32_t imm16 = 0;
+            if (arg1.kind == ArmOperandKind::IMM) {
+                imm16 = (uint32_t) arg1.imm & 0xFFFF;
+            } else if ((arg1.kind == ArmOperandKind::SYM_LO16) || (arg1.kind == ArmOperandKind::SYM_HI16)) {
+                uint8_t type = (arg1.kind == ArmOperandKind::SYM_LO16) ? R_ARM_MOVW_ABS_NC : R_ARM_MOVT_ABS;
+                relocations.push_back({addr, type, inst->symbol});
+            } else {
+                return false;
+            }
+
+            word = cond | ((inst->opcode == ArmOp::MOVW) ? 0x03000000u : 0x03400000u) | ((imm16 >> 12) << 16) |
+                   ((uint32_t) result.reg << 12) | (imm16 & 0xFFF);
+            return true;
+        }
+
+        case ArmOp::MUL:
+            // mul rd,rm,rs
+            if ((arg1.kind != ArmOperandKind::REG) || (arg2.kind != ArmOperandKind::REG)) {
+                return false;
+            }
+            word = cond | 0x00000090u | ((uint32_t) result.reg << 16) | ((uint32_t) arg2.reg << 8) |
+                   (uint32_t) arg1.reg;
+            return true;
+
+        case ArmOp::SDIV:
+            // sdiv rd,rn,rm
+            if ((arg1.kind != ArmOperandKind::REG) || (arg2.kind != ArmOperandKind::REG)) {
+                return false;
+            }
+            word = cond | 0x0710F010u | ((uint32_t) result.reg << 16) | ((uint32_t) arg2.reg << 8) |
+                   (uint32_t) arg1.reg;
+            return true;
+
+        case ArmOp::LDR:
+        case ArmOp::STR:
+            return encodeMemory(inst, addr, word);
+
+        case ArmOp::B: {
+            uint32_t target;
+            if (!branchTarget(inst, target)) {
+                return false;
+            }
+
+            // 24位的字偏移，PC领先当前指令8字节
+            int32_t offset = ((int32_t) target - (int32_t) (addr + 8)) >> 2;
+            if ((offset < -(1 << 23)) || (offset >= (1 << 23))) {
+                return false;
+            }
+
+            word = cond | 0x0A000000u | ((uint32_t) offset & 0x00FFFFFF);
+            return true;
+        }
+
+        case ArmOp::BL:
+            // 被调函数的地址由链接器确定，加数-8保存在偏移中
+            relocations.push_back({addr, R_ARM_CALL, inst->symbol});
+            word = cond | 0x0B000000u | 0x00FFFFFEu;
+            return true;
+
+        case ArmOp::BX:
+            if (result.kind != ArmOperandKind::REG) {
+                return false;
+            }
+            word = cond | 0x012FFF10u | (uint32_t) result.reg;
+            return true;
+
+        case ArmOp::PUSH:
+        case ArmOp::POP: {
+            uint32_t mask = (uint32_t) result.imm & 0xFFFF;
+            bool push = inst->opcode == ArmOp::PUSH;
+
+            // 只有一个寄存器时与汇编器一样采用str rX,[sp,#-4]!与ldr rX,[sp],#4
+            if ((mask != 0) && ((mask & (mask - 1)) == 0)) {
+                uint32_t reg_no = 0;
+                while (!(mask & (1u << reg_no))) {
+                    reg_no++;
+                }
+                word = cond | (push ? 0x052D0004u : 0x049D0004u) | (reg_no << 12);
+                return true;
+            }
+
+            // stmdb sp!,{...} ldmia sp!,{...}
+            word = cond | (push ? 0x092D0000u : 0x08BD0000u) | mask;
+            return true;
+        }
+
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,175 @@
+///
+/// @file ArmEncoder.h
+/// @brief ARM32机器指令的二进制编码，供直接输出目标文件使用
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ArmInst.h"
+
+/// @brief ARM的重定位类型，R_ARM_ABS32
+#define R_ARM_ABS32 2
+
+/// @brief ARM的重定位类型，R_ARM_CALL，bl指令的24位偏移
+#define R_ARM_CALL 28
+
+/// @brief ARM的重定位类型，R_ARM_MOVW_ABS_NC，movw的低16位
+#define R_ARM_MOVW_ABS_NC 43
+
+/// @brief ARM的重定位类型，R_ARM_MOVT_ABS，movt的高16位
+#define R_ARM_MOVT_ABS 44
+
+/// @brief 把一个函数的ArmInst序列编码成A32机器码
+///
+/// 分两遍进行：第一遍计算每条指令、标签与文字池常量的地址，第二遍编码。
+/// 函数内的标签直接解析，全局变量与函数调用留下重定位，由目标文件输出时处理。
+class ArmEncoder {
+
+public:
+    /// @brief 重定位
+    struct Relocation {
+        /// @brief 在函数机器码中的偏移
+        uint32_t offset;
+
+        /// @brief 重定位类型
+        uint8_t type;
+
+        /// @brief 引用的符号名
+        std::string symbol;
+    };
+
+    /// @brief 编码指令序列
+    /// @param code 指令序列
+    /// @return true：成功，false：有不支持的指令、超出范围的偏移或者不存在的标签
+    bool encode(const std::list<ArmInst *> & code);
+
+    /// @brief 获取机器码
+    /// @return 机器码
+    const std::vector<uint8_t> & getBytes() const
+    {
+        return bytes;
+    }
+
+    /// @brief 获取重定位
+    /// @return 重定位列表
+    const std::vector<Relocation> & getRelocations() const
+    {
+        return relocations;
+    }
+
+    /// @brief 获取代码与数据的分界，用于输出$a与$d映射符号
+    /// @return 偏移及其后是否为数据（文字池）
+    const std::vector<std::pair<uint32_t, bool>> & getMappings() const
+    {
+        return mappings;
+    }
+
+protected:
+    /// @brief 文字池中的常量
+    struct Literal {
+        /// @brief 整数常量的值
+        int32_t value;
+
+        /// @brief 符号地址的符号名，整数常量时为空
+        std::string symbol;
+    };
+
+    /// @brief 第一遍：计算标签、文字池常量的地址
+    /// @param code 指令序列
+    /// @return true：成功
+    bool layout(const std::list<ArmInst *> & code);
+
+    /// @brief 输出文字池中的常量，符号地址留下重定位
+    /// @param pool 文字池
+    void emitPool(const std::vector<Literal> & pool);
+
+    /// @brief 编码一条指令
+    /// @param inst 指令
+    /// @param addr 指令的地址
+    /// @param word 编码结果
+    /// @return true：成功
+    bool encodeInst(const ArmInst * inst, uint32_t addr, uint32_t & word);
+
+    /// @brief 编码数据处理指令
+    /// @param cond 条件码
+    /// @param op 操作码，MOV、MVN、ADD、SUB、RSB或CMP
+    /// @param rd 目的寄存器
+    /// @param rn 第一源寄存器
+    /// @param opnd2 第二源操作数，寄存器或立即数
+    /// @param word 编码结果
+    /// @return true：成功，false：立即数无法编码
+    bool encodeDataProc(uint32_t cond, ArmOp op, int32_t rd, int32_t rn, const ArmOperand & opnd2, uint32_t & word);
+
+    /// @brief 编码访存指令
+    /// @param inst 指令
+    /// @param addr 指令的地址
+    /// @param word 编码结果
+    /// @return true：成功
+    bool encodeMemory(const ArmInst * inst, uint32_t addr, uint32_t & word);
+
+    /// @brief 查找跳转目标的地址
+    /// @param inst 跳转指令
+    /// @param addr 目标地址
+    /// @return true：找到
+    bool branchTarget(const ArmInst * inst, uint32_t & addr);
+
+    /// @brief 8位数循环右移偶数位的立即数编码
+    /// @param value 立即数
+    /// @param encoded 编码结果，rotate与imm8
+    /// @return true：可以编码
+    static bool encodeRotatedImm(uint32_t value, uint32_t & encoded);
+
+    /// @brief 条件码的编码
+    /// @param cond 条件码
+    /// @return 指令的31-28位
+    static uint32_t condBits(ArmCond cond);
+
+    /// @brief 输出一个字
+    /// @param word 字
+    /// @param isData 是否为数据
+    void emitWord(uint32_t word, bool isData = false);
+
+private:
+    /// @brief 机器码
+    std::vector<uint8_t> bytes;
+
+    /// @brief 重定位
+    std::vector<Relocation> relocations;
+
+    /// @brief 代码与数据的分界
+    std::vector<std::pair<uint32_t, bool>> mappings;
+
+    /// @brief 标签的地址
+    std::unordered_map<std::string, uint32_t> labels;
+
+    /// @brief 跳转到数字局部标签（如b 1f）的指令的目标地址
+    std::unordered_map<const ArmInst *, uint32_t> localTargets;
+
+    /// @brief 从文字池加载的指令所引用常量的地址
+    std::unordered_map<const ArmInst *, uint32_t> literalAddrs;
+
+    /// @brief 每个.ltorg处放置的常量
+    std::unordered_map<const ArmInst *, std::vector<Literal>> pools;
+
+    /// @brief 函数末尾没有.ltorg时剩余的常量
+    std::vector<Literal> tailPool;
+
+    /// @brief 当前输出的是否为数据
+    bool inData = false;
+};
@@ -0,0 +1,431 @@
+///
+/// @file ArmInst.cpp
+/// @brief ARM32的机器指令表示（MIR）及其汇编输出
+/// @author zenglj (zenglj@live.com)
+/// @version 1.1
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>字符串型指令改为类型化的机器指令
+/// </table>
+///
+#include <string>
+
+#include "ArmInst.h"
+#include "PlatformArm32.h"
+
+/// @brief 寄存器操作数
+ArmOperand ArmOperand::makeReg(int32_t reg_no)
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::REG;
+    opnd.reg = (int8_t) reg_no;
+    return opnd;
+}
+
+/// @brief 立即数操作数
+ArmOperand ArmOperand::makeImm(int32_t value)
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::IMM;
+    opnd.imm = value;
+    return opnd;
+}
+
+/// @brief 基址+立即数偏移的内存操作数
+ArmOperand ArmOperand::makeMem(int32_t base_reg_no, int32_t disp)
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::MEM;
+    opnd.reg = (int8_t) base_reg_no;
+    opnd.imm = disp;
+    return opnd;
+}
+
+/// @brief 基址+变址寄存器的内存操作数
+ArmOperand ArmOperand::makeMemIndex(int32_t base_reg_no, int32_t index_reg_no)
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::MEM;
+    opnd.reg = (int8_t) base_reg_no;
+    opnd.index = (int8_t) index_reg_no;
+    return opnd;
+}
+
+/// @brief 寄存器列表操作数
+ArmOperand ArmOperand::makeRegList(uint32_t mask)
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::REGLIST;
+    opnd.imm = (int32_t) mask;
+    return opnd;
+}
+
+/// @brief 符号地址的低16位或高16位
+ArmOperand ArmOperand::makeSymbol(bool high)
+{
+    ArmOperand opnd;
+    opnd.kind = high ? ArmOperandKind::SYM_HI16 : ArmOperandKind::SYM_LO16;
+    return opnd;
+}
+
+/// @brief 标签操作数
+ArmOperand ArmOperand::makeLabel()
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::LABEL;
+    return opnd;
+}
+
+/// @brief 文字池中的整数常量操作数
+ArmOperand ArmOperand::makeLiteral(int32_t value)
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::LIT_IMM;
+    opnd.imm = value;
+    return opnd;
+}
+
+/// @brief 文字池中的符号地址操作数
+ArmOperand ArmOperand::makeLiteralSymbol()
+{
+    ArmOperand opnd;
+    opnd.kind = ArmOperandKind::LIT_SYM;
+    return opnd;
+}
+
+/// @brief 操作数读取的寄存器位图，寄存器与内存寻址的基址、变址寄存器
+uint32_t ArmOperand::regMask() const
+{
+    uint32_t mask = 0;
+
+    if (kind == ArmOperandKind::REG) {
+        mask |= 1u << reg;
+    } else if (kind == ArmOperandKind::MEM) {
+        mask |= 1u << reg;
+        if (index != -1) {
+            mask |= 1u << index;
+        }
+    } else if (kind == ArmOperandKind::REGLIST) {
+        mask |= (uint32_t) imm;
+    }
+
+    return mask;
+}
+
+ArmInst::ArmInst(ArmOp _opcode, ArmOperand _result, ArmOperand _arg1, ArmOperand _arg2, ArmCond _cond)
+    : opcode(_opcode), cond(_cond), result(_result), arg1(_arg1), arg2(_arg2)
+{}
+
+/*
+    指令内容替换
+*/
+void ArmInst::replace(ArmOp _opcode, ArmOperand _result, ArmOperand _arg1, ArmOperand _arg2, ArmCond _cond)
+{
+    opcode = _opcode;
+    result = _result;
+    arg1 = _arg1;
+    arg2 = _arg2;
+    cond = _cond;
+}
+
+/*
+    设置为无效指令
+*/
+void ArmInst::setDead()
+{
+    dead = true;
+}
+
+/// @brief 执行后是否不会顺序执行下一条指令，如b、bx lr、pop {...,pc}
+bool ArmInst::noFallThrough() const
+{
+    if (dead || (cond != ArmCond::AL)) {
+        return false;
+    }
+
+    switch (opcode) {
+        case ArmOp::B:
+        case ArmOp::BX:
+            return true;
+        case ArmOp::POP:
+            return (result.regMask() & (1u << 15)) != 0;
+        default:
+            return false;
+    }
+}
+
+/// @brief 指令定值的寄存器位图，条件标志位为第ARM_FLAGS_BIT位
+uint32_t ArmInst::defRegs() const
+{
+    if (dead) {
+        return 0;
+    }
+
+    switch (opcode) {
+        case ArmOp::MOV:
+        case ArmOp::MVN:
+        case ArmOp::MOVW:
+        case ArmOp::MOVT:
+        case ArmOp::ADD:
+        case ArmOp::SUB:
+        case ArmOp::RSB:
+        case ArmOp::MUL:
+        case ArmOp::SDIV:
+        case ArmOp::LDR:
+            return result.regMask();
+        case ArmOp::CMP:
+            return 1u << ARM_FLAGS_BIT;
+        case ArmOp::BL:
+            // 调用者保护的寄存器r0-r3、ip、lr与条件标志都可能被改写
+            return 0x500Fu | (1u << ARM_FLAGS_BIT);
+        case ArmOp::PUSH:
+            return 1u << 13;
+        case ArmOp::POP:
+            return result.regMask() | (1u << 13);
+        default:
+            return 0;
+    }
+}
+
+/// @brief 指令使用的寄存器位图，条件标志位为第ARM_FLAGS_BIT位
+uint32_t ArmInst::useRegs() const
+{
+    if (dead) {
+        return 0;
+    }
+
+    uint32_t mask = 0;
+
+    switch (opcode) {
+        case ArmOp::MOVT:
+            // movt只修改高16位，低16位保持不变
+            mask |= result.regMask();
+            break;
+        case ArmOp::CMP:
+        case ArmOp::STR:
+        case ArmOp::BX:
+            mask |= result.regMask();
+            break;
+        case ArmOp::BL:
+            // 前四个实参通过r0-r3传递
+            mask |= 0x000Fu | (1u << 13);
+            break;
+        case ArmOp::PUSH:
+            mask |= result.regMask() | (1u << 13);
+            break;
+        case ArmOp::POP:
+            mask |= 1u << 13;
+            break;
+        default:
+            break;
+    }
+
+    mask |= arg1.regMask() | arg2.regMask();
+
+    if (cond != ArmCond::AL) {
+        // 条件执行的指令依赖条件标志，并且条件不满足时结果寄存器保持原值
+        mask |= (1u << ARM_FLAGS_BIT) | result.regMask();
+    }
+
+    return mask;
+}
+
+/// @brief 操作码的助记符
+const char * ArmInst::opName(ArmOp op)
+{
+    switch (op) {
+        case ArmOp::MOV:
+            return "mov";
+        case ArmOp::MVN:
+            return "mvn";
+        case ArmOp::MOVW:
+            return "movw";
+        case ArmOp::MOVT:
+            return "movt";
+        case ArmOp::ADD:
+            return "add";
+        case ArmOp::SUB:
+            return "sub";
+        case ArmOp::RSB:
+            return "rsb";
+        case ArmOp::MUL:
+            return "mul";
+        case ArmOp::SDIV:
+            return "sdiv";
+        case ArmOp::CMP:
+            return "cmp";
+        case ArmOp::LDR:
+            return "ldr";
+        case ArmOp::STR:
+            return "str";
+        case ArmOp::B:
+            return "b";
+        case ArmOp::BL:
+            return "bl";
+        case ArmOp::BX:
+            return "bx";
+        case ArmOp::PUSH:
+            return "push";
+        case ArmOp::POP:
+            return "pop";
+        default:
+            return "";
+    }
+}
+
+/// @brief 条件码的后缀，AL为空串
+const char * ArmInst::condName(ArmCond cond)
+{
+    switch (cond) {
+        case ArmCond::EQ:
+            return "eq";
+        case ArmCond::NE:
+            return "ne";
+        case ArmCond::GT:
+            return "gt";
+        case ArmCond::GE:
+            return "ge";
+        case ArmCond::LT:
+            return "lt";
+        case ArmCond::LE:
+            return "le";
+        default:
+            return "";
+    }
+}
+
+/// @brief 条件码取反，如GT变为LE
+ArmCond ArmInst::invertCond(ArmCond cond)
+{
+    switch (cond) {
+        case ArmCond::EQ:
+            return ArmCond::NE;
+        case ArmCond::NE:
+            return ArmCond::EQ;
+        case ArmCond::GT:
+            return ArmCond::LE;
+        case ArmCond::GE:
+            return ArmCond::LT;
+        case ArmCond::LT:
+            return ArmCond::GE;
+        case ArmCond::LE:
+            return ArmCond::GT;
+        default:
+            return ArmCond::AL;
+    }
+}
+
+/// @brief 操作数输出
+/// @param opnd 操作数
+/// @param str 追加输出的字符串
+void ArmInst::outPutOperand(const ArmOperand & opnd, std::string & str) const
+{
+    switch (opnd.kind) {
+        case ArmOperandKind::REG:
+            str += PlatformArm32::regName[opnd.reg];
+            break;
+        case ArmOperandKind::IMM:
+            str += "#" + std::to_string(opnd.imm);
+            break;
+        case ArmOperandKind::MEM:
+            // [fp] [fp,#-16] [fp,r8]
+            str += "[" + PlatformArm32::regName[opnd.reg];
+            if (opnd.index != -1) {
+                str += "," + PlatformArm32::regName[opnd.index];
+            } else if (opnd.imm) {
+                str += ",#" + std::to_string(opnd.imm);
+            }
+            str += "]";
+            break;
+        case ArmOperandKind::SYM_LO16:
+            str += "#:lower16:" + symbol;
+            break;
+        case ArmOperandKind::SYM_HI16:
+            str += "#:upper16:" + symbol;
+            break;
+        case ArmOperandKind::REGLIST: {
+            // 寄存器编号从小到大输出，{r4,fp,lr}
+            bool first = true;
+            str += "{";
+            for (int32_t k = 0; k < PlatformArm32::maxRegNum; ++k) {
+                if (opnd.imm & (1u << k)) {
+                    if (!first) {
+                        str += ",";
+                    }
+                    str += PlatformArm32::regName[k];
+                    first = false;
+                }
+            }
+            str += "}";
+            break;
+        }
+        case ArmOperandKind::LABEL:
+            str += symbol;
+            break;
+        case ArmOperandKind::LIT_IMM:
+            str += "=" + std::to_string(opnd.imm);
+            break;
+        case ArmOperandKind::LIT_SYM:
+            str += "=" + symbol;
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+    输出函数
+*/
+std::string ArmInst::outPut() const
+{
+    // 无用代码，什么都不输出
+    if (dead) {
+        return "";
+    }
+
+    switch (opcode) {
+        case ArmOp::NOP:
+        case ArmOp::MAX:
+            // 占位指令，不输出
+            return "";
+        case ArmOp::LABEL:
+            // .L1:
+            return symbol + ":";
+        case ArmOp::COMMENT:
+            // @ 注释内容
+            return "@ " + symbol;
+        case ArmOp::LTORG:
+            return ".ltorg";
+        default:
+            break;
+    }
+
+    std::string ret = opName(opcode);
+    ret += condName(cond);
+
+    // 结果输出
+    if (result.valid()) {
+        ret += " ";
+        outPutOperand(result, ret);
+    }
+
+    // 第一元参数输出
+    if (arg1.valid()) {
+        ret += ",";
+        outPutOperand(arg1, ret);
+    }
+
+    // 第二元参数输出
+    if (arg2.valid()) {
+        ret += ",";
+        outPutOperand(arg2, ret);
+    }
+
+    return ret;
+}
@@ -0,0 +1,277 @@
+///
+/// @file ArmInst.h
+/// @brief ARM32的机器指令表示（MIR），操作码、条件码与操作数均为类型化描述
+/// @author zenglj (zenglj@live.com)
+/// @version 1.1
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>字符串型指令改为类型化的机器指令
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/// @brief ARM32机器指令操作码
+enum class ArmOp : std::uint8_t {
+    /// @brief 标签伪指令，名字保存在symbol中
+    LABEL,
+    /// @brief 注释伪指令，内容保存在symbol中
+    COMMENT,
+    /// @brief 空操作，不输出任何内容
+    NOP,
+
+    /// @brief 数据传送
+    MOV,
+    MVN,
+    MOVW,
+    MOVT,
+
+    /// @brief 算术运算
+    ADD,
+    SUB,
+    RSB,
+    MUL,
+    SDIV,
+
+    /// @brief 比较
+    CMP,
+
+    /// @brief 访存
+    LDR,
+    STR,
+
+    /// @brief 转移
+    B,
+    BL,
+    BX,
+
+    /// @brief 多寄存器入栈与出栈
+    PUSH,
+    POP,
+
+    /// @brief 文字池伪指令.ltorg，在此处输出之前ldr rX,=const引用的常量
+    LTORG,
+
+    /// @brief 无效操作码
+    MAX
+};
+
+/// @brief ARM32条件码，AL为无条件执行
+enum class ArmCond : std::uint8_t {
+    AL,
+    EQ,
+    NE,
+    GT,
+    GE,
+    LT,
+    LE,
+};
+
+/// @brief 操作数类别
+enum class ArmOperandKind : std::uint8_t {
+    /// @brief 无此操作数
+    NONE,
+    /// @brief 寄存器
+    REG,
+    /// @brief 立即数，输出时带#
+    IMM,
+    /// @brief 内存寻址：[base]、[base,#disp]或[base,index]
+    MEM,
+    /// @brief 符号地址的低16位，即#:lower16:sym，符号名在指令的symbol中
+    SYM_LO16,
+    /// @brief 符号地址的高16位，即#:upper16:sym，符号名在指令的symbol中
+    SYM_HI16,
+    /// @brief 寄存器列表{r4,fp,lr}，用于push与pop，imm保存寄存器位图
+    REGLIST,
+    /// @brief 标签或函数名，名字在指令的symbol中
+    LABEL,
+    /// @brief 文字池中的整数常量，即ldr r0,=100中的=100，值在imm中
+    LIT_IMM,
+    /// @brief 文字池中的符号地址，即ldr r0,=g中的=g，符号名在指令的symbol中
+    LIT_SYM,
+};
+
+/// @brief 寄存器位图中代表条件标志位(CPSR)的位
+#define ARM_FLAGS_BIT 16
+
+/// @brief 机器指令的操作数，不含任何字符串，可直接拷贝
+struct ArmOperand {
+
+    /// @brief 操作数类别
+    ArmOperandKind kind = ArmOperandKind::NONE;
+
+    /// @brief 寄存器编号，MEM时为基址寄存器
+    int8_t reg = -1;
+
+    /// @brief MEM时的变址寄存器，-1表示采用立即数偏移
+    int8_t index = -1;
+
+    /// @brief 立即数、MEM的偏移或者REGLIST的位图
+    int32_t imm = 0;
+
+    /// @brief 寄存器操作数
+    static ArmOperand makeReg(int32_t reg_no);
+
+    /// @brief 立即数操作数
+    static ArmOperand makeImm(int32_t value);
+
+    /// @brief 基址+立即数偏移的内存操作数
+    static ArmOperand makeMem(int32_t base_reg_no, int32_t disp = 0);
+
+    /// @brief 基址+变址寄存器的内存操作数
+    static ArmOperand makeMemIndex(int32_t base_reg_no, int32_t index_reg_no);
+
+    /// @brief 寄存器列表操作数
+    static ArmOperand makeRegList(uint32_t mask);
+
+    /// @brief 符号地址的低16位或高16位
+    static ArmOperand makeSymbol(bool high);
+
+    /// @brief 标签操作数
+    static ArmOperand makeLabel();
+
+    /// @brief 文字池中的整数常量操作数
+    static ArmOperand makeLiteral(int32_t value);
+
+    /// @brief 文字池中的符号地址操作数
+    static ArmOperand makeLiteralSymbol();
+
+    /// @brief 是否是文字池中的常量或符号地址
+    bool isLiteral() const
+    {
+        return kind == ArmOperandKind::LIT_IMM || kind == ArmOperandKind::LIT_SYM;
+    }
+
+    /// @brief 是否是有效的操作数
+    bool valid() const
+    {
+        return kind != ArmOperandKind::NONE;
+    }
+
+    /// @brief 操作数是否是指定的寄存器
+    bool isReg(int32_t reg_no) const
+    {
+        return kind == ArmOperandKind::REG && reg == reg_no;
+    }
+
+    /// @brief 操作数读取的寄存器位图，寄存器与内存寻址的基址、变址寄存器
+    uint32_t regMask() const;
+};
+
+/// @brief 底层汇编指令：ARM32
+struct ArmInst {
+
+    /// @brief 操作码
+    ArmOp opcode;
+
+    /// @brief 条件
+    ArmCond cond = ArmCond::AL;
+
+    /// @brief 标识指令是否无效
+    bool dead = false;
+
+    /// @brief 结果
+    ArmOperand result;
+
+    /// @brief 源操作数1
+    ArmOperand arg1;
+
+    /// @brief 源操作数2
+    ArmOperand arg2;
+
+    /// @brief 标签名、函数名、全局符号名或注释内容，只有用到时才非空
+    std::string symbol;
+
+    /// @brief 构造函数
+    /// @param op 操作码
+    /// @param rs 结果操作数
+    /// @param s1 源操作数1
+    /// @param s2 源操作数2
+    /// @param _cond 条件码
+    ArmInst(ArmOp op,
+            ArmOperand rs = ArmOperand(),
+            ArmOperand s1 = ArmOperand(),
+            ArmOperand s2 = ArmOperand(),
+            ArmCond _cond = ArmCond::AL);
+
+    /// @brief 指令更新
+    /// @param op 操作码
+    /// @param rs 结果操作数
+    /// @param s1 源操作数1
+    /// @param s2 源操作数2
+    /// @param _cond 条件码
+    void replace(ArmOp op,
+                 ArmOperand rs = ArmOperand(),
+                 ArmOperand s1 = ArmOperand(),
+                 ArmOperand s2 = ArmOperand(),
+                 ArmCond _cond = ArmCond::AL);
+
+    /// @brief 设置死指令
+    void setDead();
+
+    /// @brief 是否是标签伪指令
+    bool isLabel() const
+    {
+        return opcode == ArmOp::LABEL;
+    }
+
+    /// @brief 是否是转移指令（不含函数调用）
+    bool isBranch() const
+    {
+        return opcode == ArmOp::B || opcode == ArmOp::BX;
+    }
+
+    /// @brief 是否是从文字池加载常量或符号地址的ldr rX,=const指令
+    bool isLiteralLoad() const
+    {
+        return opcode == ArmOp::LDR && arg1.isLiteral();
+    }
+
+    /// @brief 执行后是否不会顺序执行下一条指令，如b、bx lr、pop {...,pc}
+    bool noFallThrough() const;
+
+    /// @brief 指令定值的寄存器位图，条件标志位为第ARM_FLAGS_BIT位
+    uint32_t defRegs() const;
+
+    /// @brief 指令使用的寄存器位图，条件标志位为第ARM_FLAGS_BIT位
+    uint32_t useRegs() const;
+
+    /// @brief 是否读内存
+    bool readsMem() const
+    {
+        return opcode == ArmOp::LDR || opcode == ArmOp::POP;
+    }
+
+    /// @brief 是否写内存
+    bool writesMem() const
+    {
+        return opcode == ArmOp::STR || opcode == ArmOp::PUSH;
+    }
+
+    /// @brief 指令字符串输出函数
+    /// @return 汇编指令文本，死指令或空操作时为空串
+    std::string outPut() const;
+
+    /// @brief 操作码的助记符
+    static const char * opName(ArmOp op);
+
+    /// @brief 条件码的后缀，AL为空串
+    static const char * condName(ArmCond cond);
+
+    /// @brief 条件码取反，如GT变为LE
+    static ArmCond invertCond(ArmCond cond);
+
+private:
+    /// @brief 操作数输出
+    /// @param opnd 操作数
+    /// @param str 追加输出的字符串
+    void outPutOperand(const ArmOperand & opnd, std::string & str) const;
+};
@@ -2,8 +2,8 @@
 /// @file CodeGeneratorArm32.cpp
 /// @brief ARM32的后端处理实现
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,8 +11,10 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>按函数并行产生汇编
 /// </table>
 ///
+#include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <string>
@@ -24,12 +26,14 @@
 #include "PlatformArm32.h"
 #include "CodeGeneratorArm32.h"
 #include "InstSelectorArm32.h"
+#include "InstSchedulerArm32.h"
 #include "SimpleRegisterAllocator.h"
 #include "ILocArm32.h"
 #include "RegVariable.h"
 #include "FuncCallInstruction.h"
 #include "ArgInstruction.h"
 #include "MoveInstruction.h"
+#include "WorkStealingPool.h"
 
 /// @brief 构造函数
 /// @param tab 符号表
@@ -56,24 +60,81 @@ void CodeGeneratorArm32::genDataSection()
 
     // 可直接操作文件指针fp进行写操作
 
-    // 目前不支持全局变量和静态变量，以及字符串常量
-    // 全局变量分两种情况：初始化的全局变量和未初始化的全局变量
-    // TODO 这里先处理未初始化的全局变量
+    // 目前不支持静态变量，以及字符串常量
+    // 全局变量分三种情况：
+    // (1) 未初始化或初值全为0的全局变量，放在BSS段
+    // (2) 有初值并且可能被修改的全局变量，放在.data段
+    // (3) 有初值但从不被修改的全局变量，放在.rodata段
+    collectWrittenGlobals();
+
+    std::vector<GlobalVariable *> dataVars;
+    std::vector<GlobalVariable *> rodataVars;
+    std::vector<int32_t> words;
+
     for (auto var: module->getGlobalVariables()) {
 
-        if (var->isInBSSSection()) {
+        getInitWords(var, words);
+        bool allZero = std::all_of(words.begin(), words.end(), [](int32_t word) { return word == 0; });
+
+        if (var->isInBSSSection() || allZero) {
 
             // 在BSS段的全局变量，可以包含初值全是0的变量
             fprintf(fp, ".comm %s, %d, %d\n", var->getName().c_str(), var->getType()->getSize(), var->getAlignment());
+        } else if (writtenGlobals.count(var)) {
+            dataVars.push_back(var);
         } else {
+            rodataVars.push_back(var);
+        }
+    }
+
+    if (!dataVars.empty()) {
+        fprintf(fp, ".data\n");
+        for (auto var: dataVars) {
+            genGlobalVarData(var);
+        }
+    }
+
+    if (!rodataVars.empty()) {
+        fprintf(fp, ".section .rodata\n");
+        for (auto var: rodataVars) {
+            genGlobalVarData(var);
+        }
+    }
+
+    // 函数在代码段
+    if (!dataVars.empty() || !rodataVars.empty()) {
+        fprintf(fp, ".text\n");
+    }
+}
+
+/// @brief 输出有初值的全局变量的定义及初值，连续的0合并为.zero
+/// @param var 全局变量
+void CodeGeneratorArm32::genGlobalVarData(GlobalVariable * var)
+{
+    fprintf(fp, ".global %s\n", var->getName().c_str());
+    fprintf(fp, ".balign %d\n", var->getAlignment());
+    fprintf(fp, ".type %s, %%object\n", var->getName().c_str());
+    fprintf(fp, ".size %s, %d\n", var->getName().c_str(), var->getType()->getSize());
+    fprintf(fp, "%s:\n", var->getName().c_str());
+
+    std::vector<int32_t> words;
+    getInitWords(var, words);
+
+    for (size_t k = 0; k < words.size();) {
+
+        if (words[k] == 0) {
+            // .zero 400
+            size_t end = k;
+            while ((end < words.size()) && (words[end] == 0)) {
+                end++;
+            }
 
-            // 有初值的全局变量
-            fprintf(fp, ".global %s\n", var->getName().c_str());
-            fprintf(fp, ".data\n");
-            fprintf(fp, ".align %d\n", var->getAlignment());
-            fprintf(fp, ".type %s, %%object\n", var->getName().c_str());
-            fprintf(fp, "%s\n", var->getName().c_str());
-            // TODO 后面设置初始化的值，具体请参考ARM的汇编
+            fprintf(fp, "\t.zero %d\n", (int) (end - k) * 4);
+            k = end;
+        } else {
+            // .word 100
+            fprintf(fp, "\t.word %d\n", words[k]);
+            k++;
         }
     }
 }
@@ -105,8 +166,36 @@ void CodeGeneratorArm32::getIRValueStr(Value * val, std::string & str)
         // 寄存器
         str += "\t@ " + showName + ":" + PlatformArm32::regName[regId];
     } else if (val->getMemoryAddr(&baseRegId, &offset)) {
-        // 栈内寻址，[fp,#4]
-        str += "\t@ " + showName + ":[" + PlatformArm32::regName[baseRegId] + ",#" + std::to_string(offset) + "]";
+        // 栈内寻址，[fp,#4]，栈传递的形参显示为相对实参区的偏移，[args,#4]
+        std::string baseName = (baseRegId == ARM32_ARG_AREA_REG_NO) ? "args" : PlatformArm32::regName[baseRegId];
+        str += "\t@ " + showName + ":[" + baseName + ",#" + std::to_string(offset) + "]";
+    }
+}
+
+/// @brief 汇编指令生成，放到.text代码段中
+void CodeGeneratorArm32::genCodeSection()
+{
+    // 重新设置为0
+    labelIndex = 0;
+
+    // 串行准备，Label按函数的次序编号，每个函数占用连续的一段编号，与逐个函数产生时相同
+    std::vector<Function *> funcs;
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            prepareFunction(func);
+            funcs.push_back(func);
+        }
+    }
+
+    // 每个函数的汇编文本放在各自的缓冲中，并行产生
+    std::vector<std::string> texts(funcs.size());
+
+    WorkStealingPool pool(WorkStealingPool::clampThreads(jobs, funcs.size()));
+    pool.parallelFor(funcs.size(), [&](size_t i) { genFunctionText(funcs[i], texts[i]); });
+
+    // 按函数的次序输出，与线程数无关
+    for (auto & text: texts) {
+        fwrite(text.data(), 1, text.size(), fp);
     }
 }
 
@@ -114,35 +203,31 @@ void CodeGeneratorArm32::getIRValueStr(Value * val, std::string & str)
 /// @param func 要处理的函数
 void CodeGeneratorArm32::genCodeSection(Function * func)
 {
-    // 寄存器分配以及栈内局部变量的站内地址重新分配
-    registerAllocation(func);
+    prepareFunction(func);
 
-    // 获取函数的指令列表
-    std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
+    std::string text;
+    genFunctionText(func, text);
 
-    // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
-    for (auto inst: IrInsts) {
-        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
-            inst->setName(IR_LABEL_PREFIX + std::to_string(labelIndex++));
-        }
-    }
+    fwrite(text.data(), 1, text.size(), fp);
+}
 
+/// @brief 产生函数的汇编文本，不同函数之间可并行执行
+/// @param func 要处理的函数，须先经过prepareFunction
+/// @param text 追加汇编文本的字符串
+void CodeGeneratorArm32::genFunctionText(Function * func, std::string & text)
+{
     // ILOC代码序列
     ILocArm32 iloc(module);
 
-    // 指令选择生成汇编指令
-    InstSelectorArm32 instSelector(IrInsts, iloc, func, simpleRegisterAllocator);
-    instSelector.setShowLinearIR(this->showLinearIR);
-    instSelector.run();
-
-    // 删除无用的Label指令
-    iloc.deleteUnusedLabel();
+    // 指令选择、指令调度以及文字池的放置
+    selectInstructions(func, iloc);
 
     // ILOC代码输出为汇编代码
-    fprintf(fp, ".align %d\n", func->getAlignment());
-    fprintf(fp, ".global %s\n", func->getName().c_str());
-    fprintf(fp, ".type %s, %%function\n", func->getName().c_str());
-    fprintf(fp, "%s:\n", func->getName().c_str());
+    const std::string & name = func->getName();
+    text += ".align " + std::to_string(func->getAlignment()) + "\n";
+    text += ".global " + name + "\n";
+    text += ".type " + name + ", %function\n";
+    text += name + ":\n";
 
     // 开启时输出IR指令作为注释
     if (this->showLinearIR) {
@@ -152,7 +237,7 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
             std::string str;
             getIRValueStr(localVar, str);
             if (!str.empty()) {
-                fprintf(fp, "%s\n", str.c_str());
+                text += str + "\n";
             }
         }
 
@@ -162,13 +247,57 @@ void CodeGeneratorArm32::genCodeSection(Function * func)
                 std::string str;
                 getIRValueStr(inst, str);
                 if (!str.empty()) {
-                    fprintf(fp, "%s\n", str.c_str());
+                    text += str + "\n";
                 }
             }
         }
     }
 
-    iloc.outPut(fp);
+    iloc.outPut(text);
+}
+
+/// @brief 指令选择前的准备：寄存器分配、栈空间分配以及Label命名
+/// @param func 要处理的函数
+void CodeGeneratorArm32::prepareFunction(Function * func)
+{
+    // 寄存器分配以及栈内局部变量的站内地址重新分配
+    registerAllocation(func);
+
+    // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            inst->setName(IR_LABEL_PREFIX + std::to_string(labelIndex++));
+        }
+    }
+}
+
+/// @brief 对函数进行指令选择与调度，产生的机器指令放到iloc中
+/// @param func 要处理的函数
+/// @param iloc 机器指令序列
+void CodeGeneratorArm32::selectInstructions(Function * func, ILocArm32 & iloc)
+{
+    // 获取函数的指令列表
+    std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
+
+    // 每个函数各用一个寄存器分配器，函数之间互不影响
+    SimpleRegisterAllocator simpleRegisterAllocator;
+
+    // 指令选择生成汇编指令
+    InstSelectorArm32 instSelector(IrInsts, iloc, func, simpleRegisterAllocator);
+    instSelector.setShowLinearIR(this->showLinearIR);
+    instSelector.run();
+
+    // 删除无用的Label指令
+    iloc.deleteUnusedLabel();
+
+    // 基本块内的指令调度，隐藏ldr、mul等长延迟指令的等待
+    if (this->instSchedule) {
+        InstSchedulerArm32 scheduler(iloc);
+        scheduler.run();
+    }
+
+    // 文字池放置在ldr可寻址的范围内
+    iloc.placeLiteralPools();
 }
 
 /// @brief 寄存器分配
@@ -194,14 +323,9 @@ void CodeGeneratorArm32::registerAllocation(Function * func)
     //  (2) LX寄存器用于函数调用，即R14。没有函数调用的函数可不用保护lx寄存器
     //  (3) R10寄存器用于立即数过大时要通过寄存器寻址，这里简化处理进行预留
 
-    // 至少有FP和LX寄存器需要保护
-    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
-    protectedRegNo.clear();
-    protectedRegNo.push_back(ARM32_TMP_REG_NO);
-    protectedRegNo.push_back(ARM32_FP_REG_NO);
-    if (func->getExistFuncCall()) {
-        protectedRegNo.push_back(ARM32_LX_REG_NO);
-    }
+    // 需要保护的寄存器在指令选择后根据函数体实际定值的寄存器确定，见InstSelectorArm32::genPrologueEpilogue
+    // 栈帧不大时省略帧指针FP，栈内变量都采用SP+非负偏移寻址，这样FP也不需要保护
+    func->getProtectedReg().clear();
 
     // 调整函数调用指令，主要是前四个寄存器传值，后面用栈传递
     // 为了更好的进行寄存器分配，可以进行对函数调用的指令进行预处理
@@ -240,13 +364,14 @@ void CodeGeneratorArm32::adjustFormalParamInsts(Function * func)
     }
 
     // 根据ARM版C语言的调用约定，除前4个外的实参进行值传递，逆序入栈
-    int64_t fp_esp = func->getProtectedReg().size() * 4;
+    // 以实参区的伪基址寄存器寻址，偏移相对于实参区的起始位置，指令选择后再改为fp或sp寻址
+    int64_t fp_esp = 0;
     for (int k = 4; k < (int) params.size(); k++) {
 
-        params[k]->setMemoryAddr(ARM32_FP_REG_NO, fp_esp);
+        params[k]->setMemoryAddr(ARM32_ARG_AREA_REG_NO, fp_esp);
 
-        // 增加4字节，目前只支持int类型
-        fp_esp += params[k]->getType()->getSize();
+        // 调用者为每个实参压栈4字节，数组形参传递的是地址
+        fp_esp += 4;
     }
 }
 
@@ -390,10 +515,8 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
 
             // 该变量没有分配寄存器
 
-            int32_t size = var->getType()->getSize();
-
-            // 32位ARM平台按照4字节的大小整数倍分配局部变量
-            size = (size + 3) & ~3;
+            // 32位ARM平台按照4字节的大小整数倍分配局部变量，数组形参与指针占4字节
+            int32_t size = PlatformArm32::stackSlotSize(var->getType());
 
             // 累计当前作用域大小
             sp_esp += size;
@@ -414,10 +537,8 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
         if (inst->hasResultValue() && (inst->getRegId() == -1)) {
             // 有值，并且没有分配寄存器
 
-            int32_t size = inst->getType()->getSize();
-
-            // 32位ARM平台按照4字节的大小整数倍分配局部变量
-            size = (size + 3) & ~3;
+            // 32位ARM平台按照4字节的大小整数倍分配局部变量，指针占4字节
+            int32_t size = PlatformArm32::stackSlotSize(inst->getType());
 
             // 累计当前作用域大小
             sp_esp += size;
@@ -443,4 +564,36 @@ void CodeGeneratorArm32::stackAlloc(Function * func)
 
     // 设置函数的最大栈帧深度，没有考虑寄存器保护的空间大小
     func->setMaxDep(sp_esp);
+
+    // 栈帧大小在编译时确定，栈内变量可直接用SP寻址。只有栈传递的形参加上最多的保护寄存器与对齐填充后
+    // 超出了ldr/str的偏移范围时，才保留帧指针FP
+    int32_t stackParamSize = 0;
+    if (func->getParams().size() > 4) {
+        stackParamSize = (int32_t) (func->getParams().size() - 4) * 4;
+    }
+
+    bool needFramePointer = !PlatformArm32::isDisp(sp_esp + (PlatformArm32::maxRegNum + 1) * 4 + stackParamSize);
+    func->setNeedFramePointer(needFramePointer);
+
+    if (!needFramePointer) {
+
+        // FP为负偏移的变量改为SP的非负偏移，SP与FP相差整个栈帧。栈帧内的变量偏移都为负
+        auto rebase = [sp_esp](auto * val) {
+            int32_t baseRegId = -1;
+            int64_t offset = 0;
+            if (val->getMemoryAddr(&baseRegId, &offset) && (baseRegId == ARM32_FP_REG_NO) && (offset < 0)) {
+                val->setMemoryAddr(ARM32_SP_REG_NO, offset + sp_esp);
+            }
+        };
+
+        for (auto var: func->getVarValues()) {
+            rebase(var);
+        }
+
+        for (auto inst: func->getInterCode().getInsts()) {
+            if (inst->hasResultValue()) {
+                rebase(inst);
+            }
+        }
+    }
 }
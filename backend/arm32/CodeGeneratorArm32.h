@@ -2,8 +2,8 @@
 /// @file CodeGeneratorArm32.h
 /// @brief ARM32的后端处理头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,9 +11,13 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>按函数并行产生汇编
 /// </table>
 ///
+#pragma once
+
 #include "CodeGeneratorAsm.h"
+#include "ILocArm32.h"
 #include "SimpleRegisterAllocator.h"
 
 class CodeGeneratorArm32 : public CodeGeneratorAsm {
@@ -33,10 +37,34 @@ protected:
     /// @brief 全局变量Section，主要包含初始化的和未初始化过的
     void genDataSection() override;
 
+    /// @brief 输出有初值的全局变量的定义及初值，连续的0合并为.zero
+    /// @param var 全局变量
+    void genGlobalVarData(GlobalVariable * var);
+
+    /// @brief 汇编指令生成，放到.text代码段中。修改IR的准备工作按函数的次序串行执行，
+    /// 指令选择、调度与汇编文本的产生按函数并行执行，最后按函数的次序输出
+    void genCodeSection() override;
+
     /// @brief 针对函数进行汇编指令生成，放到.text代码段中
     /// @param func 要处理的函数
     void genCodeSection(Function * func) override;
 
+    /// @brief 指令选择前的准备：寄存器分配、栈空间分配以及Label命名。
+    /// 会创建IR指令、修改常量与全局变量等共用Value的使用列表，必须按函数的次序串行执行
+    /// @param func 要处理的函数
+    void prepareFunction(Function * func);
+
+    /// @brief 对函数进行指令选择与调度，产生的机器指令放到iloc中。
+    /// 使用函数自己的寄存器分配器，不修改其它函数与共用的Value，不同函数之间可并行执行
+    /// @param func 要处理的函数，须先经过prepareFunction
+    /// @param iloc 机器指令序列
+    void selectInstructions(Function * func, ILocArm32 & iloc);
+
+    /// @brief 产生函数的汇编文本，不同函数之间可并行执行
+    /// @param func 要处理的函数，须先经过prepareFunction
+    /// @param text 追加汇编文本的字符串
+    void genFunctionText(Function * func, std::string & text);
+
     /// @brief 寄存器分配
     /// @param func 要处理的函数
     void registerAllocation(Function * func) override;
@@ -58,10 +86,4 @@ protected:
     /// @param str
     ///
     void getIRValueStr(Value * val, std::string & str);
-
-private:
-    ///
-    /// @brief 简单的朴素寄存器分配方法
-    ///
-    SimpleRegisterAllocator simpleRegisterAllocator;
 };
@@ -0,0 +1,358 @@
+///
+/// @file CodeGeneratorArm32Obj.cpp
+/// @brief ARM32的目标文件输出，不经过汇编器直接产生ELF32可重定位目标文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ArmEncoder.h"
+#include "CodeGeneratorArm32Obj.h"
+#include "Common.h"
+#include "Function.h"
+#include "ILocArm32.h"
+#include "Module.h"
+
+/// @brief 输出的节，下标即节头表中的下标
+enum ElfSectionIndex : uint16_t {
+    SEC_NULL,
+    SEC_TEXT,
+    SEC_REL_TEXT,
+    SEC_DATA,
+    SEC_RODATA,
+    SEC_ATTRIBUTES,
+    SEC_NOTE_STACK,
+    SEC_SYMTAB,
+    SEC_STRTAB,
+    SEC_SHSTRTAB,
+    SEC_NUM
+};
+
+/// @brief ELF常量，与elf.h中的定义相同，不依赖于宿主的头文件
+#define ET_REL 1
+#define EM_ARM 40
+#define EF_ARM_EABI_VER5 0x05000000
+#define EF_ARM_ABI_FLOAT_HARD 0x00000400
+#define SHT_PROGBITS 1
+#define SHT_SYMTAB 2
+#define SHT_STRTAB 3
+#define SHT_REL 9
+#define SHT_ARM_ATTRIBUTES 0x70000003
+#define SHF_WRITE 0x1
+#define SHF_ALLOC 0x2
+#define SHF_EXECINSTR 0x4
+#define SHF_INFO_LINK 0x40
+#define STB_LOCAL 0
+#define STB_GLOBAL 1
+#define STT_NOTYPE 0
+#define STT_OBJECT 1
+#define STT_FUNC 2
+#define SHN_UNDEF 0
+#define SHN_COMMON 0xfff2
+
+/// @brief 按小端追加16位整数
+static void put16(std::vector<uint8_t> & buf, uint32_t val)
+{
+    buf.push_back((uint8_t) val);
+    buf.push_back((uint8_t) (val >> 8));
+}
+
+/// @brief 按小端追加32位整数
+static void put32(std::vector<uint8_t> & buf, uint32_t val)
+{
+    for (int k = 0; k < 4; k++) {
+        buf.push_back((uint8_t) (val >> (8 * k)));
+    }
+}
+
+/// @brief 按指定字节对齐，不足的部分补0
+static void alignTo(std::vector<uint8_t> & buf, uint32_t alignment)
+{
+    while (buf.size() % alignment) {
+        buf.push_back(0);
+    }
+}
+
+/// @brief 字符串加入字符串表
+/// @return 在字符串表中的偏移
+static uint32_t addString(std::vector<uint8_t> & strtab, const std::string & str)
+{
+    uint32_t offset = (uint32_t) strtab.size();
+    strtab.insert(strtab.end(), str.begin(), str.end());
+    strtab.push_back(0);
+    return offset;
+}
+
+/// @brief 构造函数
+/// @param _module 符号表
+CodeGeneratorArm32Obj::CodeGeneratorArm32Obj(Module * _module) : CodeGeneratorArm32(_module)
+{}
+
+/// @brief 析构函数
+CodeGeneratorArm32Obj::~CodeGeneratorArm32Obj()
+{}
+
+/// @brief 产生目标文件
+/// @return true：成功，false：有无法编码的指令
+bool CodeGeneratorArm32Obj::run()
+{
+    genDataObjects();
+
+    if (!genTextObjects()) {
+        return false;
+    }
+
+    writeElf();
+
+    return true;
+}
+
+/// @brief 全局变量放到.data、.rodata节或者作为COMMON符号
+void CodeGeneratorArm32Obj::genDataObjects()
+{
+    // 与genDataSection的划分相同
+    collectWrittenGlobals();
+
+    std::vector<int32_t> words;
+
+    for (auto var: module->getGlobalVariables()) {
+
+        uint32_t size = (uint32_t) var->getType()->getSize();
+
+        getInitWords(var, words);
+        bool allZero = std::all_of(words.begin(), words.end(), [](int32_t word) { return word == 0; });
+
+        if (var->isInBSSSection() || allZero) {
+            // .comm，COMMON符号的值为对齐字节数
+            symbols.push_back({var->getName(), (uint32_t) var->getAlignment(), size, STT_OBJECT, SHN_COMMON});
+            continue;
+        }
+
+        bool written = writtenGlobals.count(var) != 0;
+        std::vector<uint8_t> & section = written ? data : rodata;
+
+        alignTo(section, (uint32_t) var->getAlignment());
+        uint32_t offset = (uint32_t) section.size();
+
+        for (auto word: words) {
+            put32(section, (uint32_t) word);
+        }
+        section.resize(offset + size);
+
+        symbols.push_back({var->getName(), offset, size, STT_OBJECT, (uint16_t) (written ? SEC_DATA : SEC_RODATA)});
+    }
+}
+
+/// @brief 所有函数编码后放到.text节
+/// @return true：成功
+bool CodeGeneratorArm32Obj::genTextObjects()
+{
+    labelIndex = 0;
+
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        // 与输出汇编相同的准备、指令选择、调度与文字池放置
+        prepareFunction(func);
+        ILocArm32 iloc(module);
+        selectInstructions(func, iloc);
+
+        ArmEncoder encoder;
+        if (!encoder.encode(iloc.getCode())) {
+            minic_log(LOG_ERROR, "函数(%s)的机器码产生失败", func->getName().c_str());
+            return false;
+        }
+
+        alignTo(text, 4);
+        uint32_t base = (uint32_t) text.size();
+
+        const std::vector<uint8_t> & bytes = encoder.getBytes();
+        text.insert(text.end(), bytes.begin(), bytes.end());
+
+        for (auto & reloc: encoder.getRelocations()) {
+            textRelocs.push_back({base + reloc.offset, reloc.type, reloc.symbol});
+        }
+
+        for (auto & [offset, isData]: encoder.getMappings()) {
+            mappings.emplace_back(base + offset, isData);
+        }
+
+        symbols.push_back({func->getName(), base, (uint32_t) bytes.size(), STT_FUNC, SEC_TEXT});
+    }
+
+    return true;
+}
+
+/// @brief 按ELF32格式输出到文件
+void CodeGeneratorArm32Obj::writeElf()
+{
+    // 符号表：空符号、映射符号等局部符号在前，之后为定义的全局符号与引用的未定义符号
+    std::vector<uint8_t> strtab(1, 0);
+    std::vector<uint8_t> symtab;
+
+    auto addSymbol = [&](const std::string & name, uint32_t value, uint32_t size, uint8_t info, uint16_t shndx) {
+        put32(symtab, name.empty() ? 0 : addString(strtab, name));
+        put32(symtab, value);
+        put32(symtab, size);
+        symtab.push_back(info);
+        symtab.push_back(0);
+        put16(symtab, shndx);
+    };
+
+    addSymbol("", 0, 0, 0, SHN_UNDEF);
+
+    for (auto & [offset, isData]: mappings) {
+        addSymbol(isData ? "$d" : "$a", offset, 0, (STB_LOCAL << 4) | STT_NOTYPE, SEC_TEXT);
+    }
+
+    uint32_t firstGlobal = (uint32_t) (symtab.size() / 16);
+
+    std::unordered_map<std::string, uint32_t> symbolIndex;
+    for (auto & sym: symbols) {
+        symbolIndex[sym.name] = (uint32_t) (symtab.size() / 16);
+        addSymbol(sym.name, sym.value, sym.size, (STB_GLOBAL << 4) | sym.type, sym.section);
+    }
+
+    // 重定位，引用的符号没有定义时加入未定义符号，如内置函数
+    std::vector<uint8_t> relText;
+    for (auto & reloc: textRelocs) {
+
+        auto pIter = symbolIndex.find(reloc.symbol);
+        if (pIter == symbolIndex.end()) {
+            pIter = symbolIndex.emplace(reloc.symbol, (uint32_t) (symtab.size() / 16)).first;
+            addSymbol(reloc.symbol, 0, 0, (STB_GLOBAL << 4) | STT_NOTYPE, SHN_UNDEF);
+        }
+
+        put32(relText, reloc.offset);
+        put32(relText, (pIter->second << 8) | reloc.type);
+    }
+
+    // 与.arch armv7ve、.fpu vfpv4对应的属性，格式为'A'、子节长度、"aeabi"、Tag_File及其属性
+    std::vector<uint8_t> attrs = {
+        6,  10,  // Tag_CPU_arch: v7
+        7,  'A', // Tag_CPU_arch_profile: Application
+        8,  1,   // Tag_ARM_ISA_use: Yes
+        9,  2,   // Tag_THUMB_ISA_use: Thumb-2
+        10, 5,   // Tag_FP_arch: VFPv4
+        44, 2,   // Tag_DIV_use: 允许sdiv
+    };
+
+    std::vector<uint8_t> attributes = {'A'};
+    put32(attributes, (uint32_t) (4 + 6 + 1 + 4 + attrs.size()));
+    attributes.insert(attributes.end(), {'a', 'e', 'a', 'b', 'i', 0});
+    attributes.push_back(1);
+    put32(attributes, (uint32_t) (1 + 4 + attrs.size()));
+    attributes.insert(attributes.end(), attrs.begin(), attrs.end());
+
+    // 节头的名字
+    std::vector<uint8_t> shstrtab(1, 0);
+
+    struct SectionHeader {
+        uint32_t name = 0;
+        uint32_t type = 0;
+        uint32_t flags = 0;
+        uint32_t offset = 0;
+        uint32_t size = 0;
+        uint32_t link = 0;
+        uint32_t info = 0;
+        uint32_t align = 0;
+        uint32_t entsize = 0;
+        const std::vector<uint8_t> * content = nullptr;
+    };
+
+    const std::vector<uint8_t> empty;
+
+    SectionHeader headers[SEC_NUM];
+    auto setHeader = [&](ElfSectionIndex index,
+                         const char * name,
+                         uint32_t type,
+                         uint32_t flags,
+                         const std::vector<uint8_t> & content,
+                         uint32_t align) {
+        headers[index].name = addString(shstrtab, name);
+        headers[index].type = type;
+        headers[index].flags = flags;
+        headers[index].align = align;
+        headers[index].content = &content;
+    };
+
+    setHeader(SEC_TEXT, ".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR, text, 4);
+    setHeader(SEC_REL_TEXT, ".rel.text", SHT_REL, SHF_INFO_LINK, relText, 4);
+    setHeader(SEC_DATA, ".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE, data, 4);
+    setHeader(SEC_RODATA, ".rodata", SHT_PROGBITS, SHF_ALLOC, rodata, 4);
+    setHeader(SEC_ATTRIBUTES, ".ARM.attributes", SHT_ARM_ATTRIBUTES, 0, attributes, 1);
+    setHeader(SEC_NOTE_STACK, ".note.GNU-stack", SHT_PROGBITS, 0, empty, 1);
+    setHeader(SEC_SYMTAB, ".symtab", SHT_SYMTAB, 0, symtab, 4);
+    setHeader(SEC_STRTAB, ".strtab", SHT_STRTAB, 0, strtab, 1);
+    setHeader(SEC_SHSTRTAB, ".shstrtab", SHT_STRTAB, 0, shstrtab, 1);
+
+    headers[SEC_REL_TEXT].link = SEC_SYMTAB;
+    headers[SEC_REL_TEXT].info = SEC_TEXT;
+    headers[SEC_REL_TEXT].entsize = 8;
+    headers[SEC_SYMTAB].link = SEC_STRTAB;
+    headers[SEC_SYMTAB].info = firstGlobal;
+    headers[SEC_SYMTAB].entsize = 16;
+
+    // 文件内容：ELF头、各节的内容、节头表
+    std::vector<uint8_t> file(52, 0);
+
+    for (int index = SEC_TEXT; index < SEC_NUM; index++) {
+        alignTo(file, std::max(headers[index].align, 1u));
+        headers[index].offset = (uint32_t) file.size();
+        headers[index].size = (uint32_t) headers[index].content->size();
+        file.insert(file.end(), headers[index].content->begin(), headers[index].content->end());
+    }
+
+    alignTo(file, 4);
+    uint32_t shoff = (uint32_t) file.size();
+
+    for (int index = 0; index < SEC_NUM; index++) {
+        put32(file, headers[index].name);
+        put32(file, headers[index].type);
+        put32(file, headers[index].flags);
+        put32(file, 0);
+        put32(file, headers[index].offset);
+        put32(file, headers[index].size);
+        put32(file, headers[index].link);
+        put32(file, headers[index].info);
+        put32(file, headers[index].align);
+        put32(file, headers[index].entsize);
+    }
+
+    // ELF头：32位、小端、ARM的可重定位文件，EABI版本5，硬件浮点调用约定
+    std::vector<uint8_t> header = {0x7f, 'E', 'L', 'F', 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    put16(header, ET_REL);
+    put16(header, EM_ARM);
+    put32(header, 1);
+    put32(header, 0);
+    put32(header, 0);
+    put32(header, shoff);
+    put32(header, EF_ARM_EABI_VER5 | EF_ARM_ABI_FLOAT_HARD);
+    put16(header, 52);
+    put16(header, 0);
+    put16(header, 0);
+    put16(header, 40);
+    put16(header, SEC_NUM);
+    put16(header, SEC_SHSTRTAB);
+
+    std::copy(header.begin(), header.end(), file.begin());
+
+    fwrite(file.data(), 1, file.size(), fp);
+}
@@ -0,0 +1,103 @@
+///
+/// @file CodeGeneratorArm32Obj.h
+/// @brief ARM32的目标文件输出，不经过汇编器直接产生ELF32可重定位目标文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "CodeGeneratorArm32.h"
+
+/// @brief ARM32的集成汇编器
+///
+/// 指令选择、调度与文字池的放置与输出汇编时完全相同，之后由ArmEncoder编码成机器码，
+/// 与全局变量一起写成ELF32的.o文件，可直接用arm-linux-gnueabihf-gcc链接。
+/// 全局变量的划分与汇编输出一致：BSS段的变量为COMMON符号，其余放在.data或.rodata节。
+class CodeGeneratorArm32Obj : public CodeGeneratorArm32 {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    CodeGeneratorArm32Obj(Module * module);
+
+    /// @brief 析构函数
+    ~CodeGeneratorArm32Obj() override;
+
+protected:
+    /// @brief 产生目标文件
+    /// @return true：成功，false：有无法编码的指令
+    bool run() override;
+
+    /// @brief 全局变量放到.data、.rodata节或者作为COMMON符号
+    void genDataObjects();
+
+    /// @brief 所有函数编码后放到.text节
+    /// @return true：成功
+    bool genTextObjects();
+
+    /// @brief 按ELF32格式输出到文件
+    void writeElf();
+
+private:
+    /// @brief 定义的符号
+    struct Symbol {
+        /// @brief 符号名
+        std::string name;
+
+        /// @brief 节内偏移，COMMON符号时为对齐字节数
+        uint32_t value;
+
+        /// @brief 大小
+        uint32_t size;
+
+        /// @brief 符号类型，STT_OBJECT或STT_FUNC
+        uint8_t type;
+
+        /// @brief 所在节的下标
+        uint16_t section;
+    };
+
+    /// @brief .text节的重定位
+    struct Relocation {
+        /// @brief 节内偏移
+        uint32_t offset;
+
+        /// @brief 重定位类型
+        uint8_t type;
+
+        /// @brief 引用的符号名
+        std::string symbol;
+    };
+
+    /// @brief .text节的内容
+    std::vector<uint8_t> text;
+
+    /// @brief .data节的内容
+    std::vector<uint8_t> data;
+
+    /// @brief .rodata节的内容
+    std::vector<uint8_t> rodata;
+
+    /// @brief .text节的重定位
+    std::vector<Relocation> textRelocs;
+
+    /// @brief .text节中代码与文字池的分界，用于输出$a与$d映射符号
+    std::vector<std::pair<uint32_t, bool>> mappings;
+
+    /// @brief 定义的全局符号
+    std::vector<Symbol> symbols;
+};
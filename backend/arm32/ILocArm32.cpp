@@ -2,8 +2,8 @@
 /// @file ILocArm32.cpp
 /// @brief 指令序列管理的实现，ILOC的全称为Intermediate Language for Optimizing Compilers
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,108 +11,31 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>汇编可输出到字符串
 /// </table>
 ///
 #include <cstdio>
+#include <algorithm>
+#include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
+#include "ArmInst.h"
 #include "ILocArm32.h"
 #include "Common.h"
 #include "Function.h"
 #include "PlatformArm32.h"
 #include "Module.h"
 
-ArmInst::ArmInst(std::string _opcode,
-                 std::string _result,
-                 std::string _arg1,
-                 std::string _arg2,
-                 std::string _cond,
-                 std::string _addition)
-    : opcode(_opcode), cond(_cond), result(_result), arg1(_arg1), arg2(_arg2), addition(_addition), dead(false)
-{}
-
-/*
-    指令内容替换
-*/
-void ArmInst::replace(std::string _opcode,
-                      std::string _result,
-                      std::string _arg1,
-                      std::string _arg2,
-                      std::string _cond,
-                      std::string _addition)
-{
-    opcode = _opcode;
-    result = _result;
-    arg1 = _arg1;
-    arg2 = _arg2;
-    cond = _cond;
-    addition = _addition;
-
-#if 0
-    // 空操作，则设置为dead
-    if (op == "") {
-        dead = true;
-    }
-#endif
-}
-
-/*
-    设置为无效指令
-*/
-void ArmInst::setDead()
-{
-    dead = true;
-}
-
-/*
-    输出函数
-*/
-std::string ArmInst::outPut()
-{
-    // 无用代码，什么都不输出
-    if (dead) {
-        return "";
-    }
-
-    // 占位指令,可能需要输出一个空操作，看是否支持 FIXME
-    if (opcode.empty()) {
-        return "";
-    }
-
-    std::string ret = opcode;
-
-    if (!cond.empty()) {
-        ret += cond;
-    }
-
-    // 结果输出
-    if (!result.empty()) {
-        if (result == ":") {
-            ret += result;
-        } else {
-            ret += " " + result;
-        }
-    }
-
-    // 第一元参数输出
-    if (!arg1.empty()) {
-        ret += "," + arg1;
-    }
-
-    // 第二元参数输出
-    if (!arg2.empty()) {
-        ret += "," + arg2;
-    }
+#define emit(...) code.push_back(new ArmInst(__VA_ARGS__))
 
-    // 其他附加信息输出
-    if (!addition.empty()) {
-        ret += "," + addition;
-    }
+/// @brief 寄存器操作数
+#define REG(no) ArmOperand::makeReg(no)
 
-    return ret;
-}
-
-#define emit(...) code.push_back(new ArmInst(__VA_ARGS__))
+/// @brief 立即数操作数
+#define IMM(num) ArmOperand::makeImm(num)
 
 /// @brief 构造函数
 /// @param _module 符号表
@@ -136,7 +59,7 @@ void ILocArm32::deleteUnusedLabel()
 {
     std::list<ArmInst *> labelInsts;
     for (ArmInst * arm: code) {
-        if ((!arm->dead) && (arm->opcode[0] == '.') && (arm->result == ":")) {
+        if ((!arm->dead) && arm->isLabel()) {
             labelInsts.push_back(arm);
         }
     }
@@ -147,8 +70,7 @@ void ILocArm32::deleteUnusedLabel()
         bool labelUsed = false;
 
         for (ArmInst * arm: code) {
-            // TODO 转移语句的指令标识符根据定义修改判断
-            if ((!arm->dead) && (arm->opcode[0] == 'b') && (arm->result == labelArm->opcode)) {
+            if ((!arm->dead) && (arm->opcode == ArmOp::B) && (arm->symbol == labelArm->symbol)) {
                 labelUsed = true;
                 break;
             }
@@ -160,25 +82,272 @@ void ILocArm32::deleteUnusedLabel()
     }
 }
 
+/// @brief 寄存器rX在指定位置之后直到基本块结束是否不再被使用
+/// @param pIter 开始检查的位置
+/// @param reg_no 寄存器编号
+/// @return true：肯定不再使用，false：可能被使用
+bool ILocArm32::regDeadAfter(std::list<ArmInst *>::iterator pIter, int reg_no)
+{
+    for (; pIter != code.end(); ++pIter) {
+
+        ArmInst * arm = *pIter;
+        if (arm->dead) {
+            continue;
+        }
+
+        if (arm->useRegs() & (1u << reg_no)) {
+            return false;
+        }
+
+        if (arm->defRegs() & (1u << reg_no)) {
+            return true;
+        }
+
+        // 基本块结束，保守认为还会被使用
+        if (arm->isLabel() || arm->isBranch() || (arm->opcode == ArmOp::BL) || (arm->opcode == ArmOp::POP)) {
+            return false;
+        }
+    }
+
+    return false;
+}
+
+/// @brief 多次使用或循环内使用的全局变量地址，在函数入口处一次性加载到空闲的被调用者保护寄存器中，
+/// 函数内对该全局变量的访问直接使用该寄存器作为基址。需在插入函数序言之前执行
+void ILocArm32::hoistSymbolAddress()
+{
+    std::vector<ArmInst *> insts;
+    uint32_t usedMask = 0;
+
+    for (auto arm: code) {
+        if (!arm->dead) {
+            insts.push_back(arm);
+            usedMask |= arm->defRegs() | arm->useRegs();
+        }
+    }
+
+    // 标签的位置，用于识别循环
+    std::unordered_map<std::string, int> labelPos;
+    for (int k = 0; k < (int) insts.size(); ++k) {
+        if (insts[k]->isLabel()) {
+            labelPos[insts[k]->symbol] = k;
+        }
+    }
+
+    // 向回跳转的b指令与其目标标签之间的指令在循环内，加载的开销按执行次数较多估算
+    std::vector<int> weight(insts.size(), 1);
+    for (int k = 0; k < (int) insts.size(); ++k) {
+        if (insts[k]->opcode == ArmOp::B) {
+            auto pIter = labelPos.find(insts[k]->symbol);
+            if ((pIter != labelPos.end()) && (pIter->second < k)) {
+                for (int m = pIter->second; m <= k; ++m) {
+                    weight[m] = std::min(weight[m] * 8, 1024);
+                }
+            }
+        }
+    }
+
+    // 各符号地址的加载收益，std::map保证分配次序确定
+    std::map<std::string, int> benefit;
+    for (int k = 0; k < (int) insts.size(); ++k) {
+        if (insts[k]->isLiteralLoad() && (insts[k]->arg1.kind == ArmOperandKind::LIT_SYM)) {
+            benefit[insts[k]->symbol] += weight[k];
+        }
+    }
+
+    std::vector<std::pair<std::string, int>> candidates(benefit.begin(), benefit.end());
+    std::stable_sort(candidates.begin(), candidates.end(), [](auto & a, auto & b) { return a.second > b.second; });
+
+    // 函数内没有用到的r4-r9可以用来保存符号地址，r10为临时寄存器不使用
+    std::map<std::string, int> symbolReg;
+    int32_t reg_no = 4;
+    for (auto & cand: candidates) {
+
+        // 只加载一次的符号没有必要
+        if (cand.second < 2) {
+            break;
+        }
+
+        while ((reg_no < ARM32_TMP_REG_NO) && (usedMask & (1u << reg_no))) {
+            reg_no++;
+        }
+
+        if (reg_no >= ARM32_TMP_REG_NO) {
+            break;
+        }
+
+        symbolReg[cand.first] = reg_no++;
+    }
+
+    if (symbolReg.empty()) {
+        return;
+    }
+
+    for (auto pIter = code.begin(); pIter != code.end(); ++pIter) {
+
+        ArmInst * arm = *pIter;
+        if (arm->dead || !arm->isLiteralLoad() || (arm->arg1.kind != ArmOperandKind::LIT_SYM)) {
+            continue;
+        }
+
+        auto regIter = symbolReg.find(arm->symbol);
+        if (regIter == symbolReg.end()) {
+            continue;
+        }
+
+        int32_t addr_reg_no = arm->result.reg;
+
+        // 紧随其后的访存指令若以该地址为基址，并且之后该地址不再使用，则直接改用保存地址的寄存器
+        auto nextIter = std::next(pIter);
+        while ((nextIter != code.end()) && (*nextIter)->dead) {
+            ++nextIter;
+        }
+
+        if (nextIter != code.end()) {
+
+            ArmInst * next = *nextIter;
+
+            bool baseOnly = ((next->opcode == ArmOp::LDR) || (next->opcode == ArmOp::STR)) &&
+                            (next->arg1.kind == ArmOperandKind::MEM) && (next->arg1.reg == addr_reg_no) &&
+                            (next->arg1.index == -1) && (next->cond == ArmCond::AL);
+
+            if (baseOnly && (next->opcode == ArmOp::STR) && next->result.isReg(addr_reg_no)) {
+                baseOnly = false;
+            }
+
+            if (baseOnly &&
+                ((next->opcode == ArmOp::LDR && next->result.isReg(addr_reg_no)) ||
+                 regDeadAfter(std::next(nextIter), addr_reg_no))) {
+
+                // ldr r0,[r4]
+                next->arg1.reg = (int8_t) regIter->second;
+                arm->setDead();
+                continue;
+            }
+        }
+
+        // mov r10,r4
+        arm->replace(ArmOp::MOV, REG(addr_reg_no), REG(regIter->second));
+        arm->symbol.clear();
+    }
+
+    // 函数入口处加载符号地址，序言会插入到这些指令之前
+    for (auto & sym: symbolReg) {
+        ArmInst * arm = new ArmInst(ArmOp::LDR, REG(sym.second), ArmOperand::makeLiteralSymbol());
+        arm->symbol = sym.first;
+        code.push_front(arm);
+    }
+}
+
+/// @brief 在文字池的常量离引用的ldr指令不超出4KB的位置插入.ltorg
+/// 尽量放在b、bx lr等之后不会顺序执行到的位置，否则跳过文字池
+void ILocArm32::placeLiteralPools()
+{
+    // ldr文字池寻址的偏移为12位，PC领先当前指令8字节，留出余量
+    const int32_t softLimit = 3072;
+    const int32_t hardLimit = 4000;
+
+    // 当前文字池中的常量，相同常量汇编器只保留一份
+    std::set<std::string> entries;
+
+    // 第一条引用当前文字池的指令的位置，以及当前指令的位置，单位为字节
+    int32_t firstUse = 0;
+    int32_t pos = 0;
+
+    for (auto pIter = code.begin(); pIter != code.end(); ++pIter) {
+
+        ArmInst * arm = *pIter;
+
+        if (arm->dead || arm->isLabel() || (arm->opcode == ArmOp::COMMENT) || (arm->opcode == ArmOp::NOP)) {
+            continue;
+        }
+
+        if (arm->isLiteralLoad()) {
+            if (entries.empty()) {
+                firstUse = pos;
+            }
+
+            if (arm->arg1.kind == ArmOperandKind::LIT_SYM) {
+                entries.insert("=" + arm->symbol);
+            } else {
+                entries.insert(std::to_string(arm->arg1.imm));
+            }
+        }
+
+        pos += 4;
+
+        if (entries.empty()) {
+            continue;
+        }
+
+        int32_t span = pos - firstUse + (int32_t) entries.size() * 4;
+
+        if (arm->noFallThrough() && (span >= softLimit)) {
+
+            // 之后的位置不会顺序执行到，直接放置文字池
+            pIter = code.insert(std::next(pIter), new ArmInst(ArmOp::LTORG));
+        } else if (span >= hardLimit) {
+
+            // 必须放置文字池了，跳过它继续执行
+            // b 1f
+            // .ltorg
+            // 1:
+            ArmInst * jump = new ArmInst(ArmOp::B, ArmOperand::makeLabel());
+            jump->symbol = "1f";
+            ArmInst * over = new ArmInst(ArmOp::LABEL);
+            over->symbol = "1";
+
+            pIter = code.insert(std::next(pIter), jump);
+            pIter = code.insert(std::next(pIter), new ArmInst(ArmOp::LTORG));
+            pIter = code.insert(std::next(pIter), over);
+            pos += 4;
+        } else {
+            continue;
+        }
+
+        pos += (int32_t) entries.size() * 4;
+        entries.clear();
+    }
+
+    // 函数末尾肯定是返回指令，剩余的常量放在函数之后
+    if (!entries.empty()) {
+        emit(ArmOp::LTORG);
+    }
+}
+
 /// @brief 输出汇编
 /// @param file 输出的文件指针
 /// @param outputEmpty 是否输出空语句
 void ILocArm32::outPut(FILE * file, bool outputEmpty)
+{
+    std::string text;
+    outPut(text, outputEmpty);
+
+    fwrite(text.data(), 1, text.size(), file);
+}
+
+/// @brief 输出汇编到字符串的尾部
+/// @param text 输出的字符串
+/// @param outputEmpty 是否输出空语句
+void ILocArm32::outPut(std::string & text, bool outputEmpty)
 {
     for (auto arm: code) {
 
         std::string s = arm->outPut();
 
-        if (arm->result == ":") {
+        if (arm->isLabel() && !s.empty()) {
             // Label指令，不需要Tab输出
-            fprintf(file, "%s\n", s.c_str());
+            text += s;
+            text += '\n';
             continue;
         }
 
         if (!s.empty()) {
-            fprintf(file, "\t%s\n", s.c_str());
+            text += '\t';
+            text += s;
+            text += '\n';
         } else if ((outputEmpty)) {
-            fprintf(file, "\n");
+            text += '\n';
         }
     }
 }
@@ -190,56 +359,62 @@ std::list<ArmInst *> & ILocArm32::getCode()
     return code;
 }
 
-/**
- * 数字变字符串，若flag为真，则变为立即数寻址（加#）
- */
-std::string ILocArm32::toStr(int num, bool flag)
-{
-    std::string ret;
-
-    if (flag) {
-        ret = "#";
-    }
-
-    ret += std::to_string(num);
-
-    return ret;
-}
-
 /*
     产生标签
 */
 void ILocArm32::label(std::string name)
 {
     // .L1:
-    emit(name, ":");
+    ArmInst * arm = new ArmInst(ArmOp::LABEL);
+    arm->symbol = name;
+    code.push_back(arm);
 }
 
-/// @brief 0个源操作数指令
+/// @brief 产生一条机器指令
 /// @param op 操作码
-/// @param rs 操作数
-void ILocArm32::inst(std::string op, std::string rs)
+/// @param rs 结果操作数
+/// @param arg1 源操作数1
+/// @param arg2 源操作数2
+/// @param cond 条件码
+/// @return 产生的指令
+ArmInst * ILocArm32::inst(ArmOp op, ArmOperand rs, ArmOperand arg1, ArmOperand arg2, ArmCond cond)
 {
-    emit(op, rs);
+    ArmInst * arm = new ArmInst(op, rs, arg1, arg2, cond);
+    code.push_back(arm);
+    return arm;
 }
 
-/// @brief 一个操作数指令
+/// @brief 三寄存器指令，如add r0,r1,r2
 /// @param op 操作码
-/// @param rs 操作数
-/// @param arg1 源操作数
-void ILocArm32::inst(std::string op, std::string rs, std::string arg1)
+/// @param rs_reg_no 结果寄存器
+/// @param src1_reg_no 源寄存器1
+/// @param src2_reg_no 源寄存器2
+void ILocArm32::inst_reg(ArmOp op, int rs_reg_no, int src1_reg_no, int src2_reg_no)
 {
-    emit(op, rs, arg1);
+    emit(op, REG(rs_reg_no), REG(src1_reg_no), REG(src2_reg_no));
 }
 
-/// @brief 一个操作数指令
-/// @param op 操作码
-/// @param rs 操作数
-/// @param arg1 源操作数
-/// @param arg2 源操作数
-void ILocArm32::inst(std::string op, std::string rs, std::string arg1, std::string arg2)
+/// @brief 条件跳转或无条件跳转到标签
+/// @param cond 条件码
+/// @param label 目标Label名称
+void ILocArm32::branch(ArmCond cond, std::string label)
 {
-    emit(op, rs, arg1, arg2);
+    ArmInst * arm = inst(ArmOp::B, ArmOperand::makeLabel(), ArmOperand(), ArmOperand(), cond);
+    arm->symbol = label;
+}
+
+/// @brief 寄存器入栈 push {r4,fp,lr}
+/// @param mask 寄存器位图
+void ILocArm32::push(uint32_t mask)
+{
+    emit(ArmOp::PUSH, ArmOperand::makeRegList(mask));
+}
+
+/// @brief 寄存器出栈 pop {r4,fp,lr}
+/// @param mask 寄存器位图
+void ILocArm32::pop(uint32_t mask)
+{
+    emit(ArmOp::POP, ArmOperand::makeRegList(mask));
 }
 
 ///
@@ -247,7 +422,9 @@ void ILocArm32::inst(std::string op, std::string rs, std::string arg1, std::stri
 ///
 void ILocArm32::comment(std::string str)
 {
-    emit("@", str);
+    ArmInst * arm = new ArmInst(ArmOp::COMMENT);
+    arm->symbol = str;
+    code.push_back(arm);
 }
 
 /*
@@ -255,15 +432,18 @@ void ILocArm32::comment(std::string str)
 */
 void ILocArm32::load_imm(int rs_reg_no, int constant)
 {
-    // movw:把 16 位立即数放到寄存器的低16位，高16位清0
-    // movt:把 16 位立即数放到寄存器的高16位，低 16位不影响
-    if (0 == ((constant >> 16) & 0xFFFF)) {
-        // 如果高16位本来就为0，直接movw
-        emit("movw", PlatformArm32::regName[rs_reg_no], "#:lower16:" + std::to_string(constant));
+    if (PlatformArm32::isRotatedImm(constant)) {
+        // 8位数字循环右移偶数位可得到，mov r0,#256
+        emit(ArmOp::MOV, REG(rs_reg_no), IMM(constant));
+    } else if (PlatformArm32::isRotatedImm(~constant)) {
+        // 按位取反后可得到，mvn r0,#0即-1
+        emit(ArmOp::MVN, REG(rs_reg_no), IMM(~constant));
+    } else if (0 == (constant & ~0xFFFF)) {
+        // movw:把 16 位立即数放到寄存器的低16位，高16位清0
+        emit(ArmOp::MOVW, REG(rs_reg_no), IMM(constant));
     } else {
-        // 如果高16位不为0，先movw，然后movt
-        emit("movw", PlatformArm32::regName[rs_reg_no], "#:lower16:" + std::to_string(constant));
-        emit("movt", PlatformArm32::regName[rs_reg_no], "#:upper16:" + std::to_string(constant));
+        // 其它的32位常量放到文字池中，一条ldr即可，ldr r0,=305419896
+        emit(ArmOp::LDR, REG(rs_reg_no), ArmOperand::makeLiteral(constant));
     }
 }
 
@@ -272,10 +452,9 @@ void ILocArm32::load_imm(int rs_reg_no, int constant)
 /// @param name 符号名
 void ILocArm32::load_symbol(int rs_reg_no, std::string name)
 {
-    // movw r10, #:lower16:a
-    // movt r10, #:upper16:a
-    emit("movw", PlatformArm32::regName[rs_reg_no], "#:lower16:" + name);
-    emit("movt", PlatformArm32::regName[rs_reg_no], "#:upper16:" + name);
+    // 符号地址放到文字池中，ldr r10,=a
+    ArmInst * arm = inst(ArmOp::LDR, REG(rs_reg_no), ArmOperand::makeLiteralSymbol());
+    arm->symbol = name;
 }
 
 /// @brief 基址寻址 ldr r0,[fp,#100]
@@ -284,30 +463,23 @@ void ILocArm32::load_symbol(int rs_reg_no, std::string name)
 /// @param offset 偏移
 void ILocArm32::load_base(int rs_reg_no, int base_reg_no, int offset)
 {
-    std::string rsReg = PlatformArm32::regName[rs_reg_no];
-    std::string base = PlatformArm32::regName[base_reg_no];
+    ArmOperand mem;
 
     if (PlatformArm32::isDisp(offset)) {
-        // 有效的偏移常量
-        if (offset) {
-            // [fp,#-16] [fp]
-            base += "," + toStr(offset);
-        }
+        // 有效的偏移常量，[fp,#-16] [fp]
+        mem = ArmOperand::makeMem(base_reg_no, offset);
     } else {
 
         // ldr r8,=-4096
         load_imm(rs_reg_no, offset);
 
-        // fp,r8
-        base += "," + rsReg;
+        // [fp,r8]
+        mem = ArmOperand::makeMemIndex(base_reg_no, rs_reg_no);
     }
 
-    // 内存寻址
-    base = "[" + base + "]";
-
     // ldr r8,[fp,#-16]
     // ldr r8,[fp,r8]
-    emit("ldr", rsReg, base);
+    emit(ArmOp::LDR, REG(rs_reg_no), mem);
 }
 
 /// @brief 基址寻址 str r0,[fp,#100]
@@ -317,32 +489,27 @@ void ILocArm32::load_base(int rs_reg_no, int base_reg_no, int offset)
 /// @param tmp_reg_no 可能需要临时寄存器编号
 void ILocArm32::store_base(int src_reg_no, int base_reg_no, int disp, int tmp_reg_no)
 {
-    std::string base = PlatformArm32::regName[base_reg_no];
+    ArmOperand mem;
 
     if (PlatformArm32::isDisp(disp)) {
         // 有效的偏移常量
 
         // 若disp为0，则直接采用基址，否则采用基址+偏移
         // [fp,#-16] [fp]
-        if (disp) {
-            base += "," + toStr(disp);
-        }
+        mem = ArmOperand::makeMem(base_reg_no, disp);
     } else {
         // 先把立即数赋值给指定的寄存器tmpReg，然后采用基址+寄存器的方式进行
 
         // ldr r9,=-4096
         load_imm(tmp_reg_no, disp);
 
-        // fp,r9
-        base += "," + PlatformArm32::regName[tmp_reg_no];
+        // [fp,r9]
+        mem = ArmOperand::makeMemIndex(base_reg_no, tmp_reg_no);
     }
 
-    // 内存间接寻址
-    base = "[" + base + "]";
-
     // str r8,[fp,#-16]
     // str r8,[fp,r9]
-    emit("str", PlatformArm32::regName[src_reg_no], base);
+    emit(ArmOp::STR, REG(src_reg_no), mem);
 }
 
 /// @brief 寄存器Mov操作
@@ -350,7 +517,7 @@ void ILocArm32::store_base(int src_reg_no, int base_reg_no, int disp, int tmp_re
 /// @param src_reg_no 源寄存器
 void ILocArm32::mov_reg(int rs_reg_no, int src_reg_no)
 {
-    emit("mov", PlatformArm32::regName[rs_reg_no], PlatformArm32::regName[src_reg_no]);
+    emit(ArmOp::MOV, REG(rs_reg_no), REG(src_reg_no));
 }
 
 /// @brief 加载变量到寄存器，保证将变量放到reg中
@@ -373,7 +540,7 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
         if (src_regId != rs_reg_no) {
 
             // mov r8,r2 | 这里有优化空间——消除r8
-            emit("mov", PlatformArm32::regName[rs_reg_no], PlatformArm32::regName[src_regId]);
+            emit(ArmOp::MOV, REG(rs_reg_no), REG(src_regId));
         }
     } else if (Instanceof(globalVar, GlobalVariable *, src_var)) {
         // 全局变量
@@ -384,7 +551,7 @@ void ILocArm32::load_var(int rs_reg_no, Value * src_var)
         load_symbol(rs_reg_no, globalVar->getName());
 
         // ldr r8, [r8]
-        emit("ldr", PlatformArm32::regName[rs_reg_no], "[" + PlatformArm32::regName[rs_reg_no] + "]");
+        emit(ArmOp::LDR, REG(rs_reg_no), ArmOperand::makeMem(rs_reg_no));
 
     } else {
 
@@ -449,7 +616,7 @@ void ILocArm32::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
         if (src_reg_no != dest_reg_id) {
 
             // mov r2,r8 | 这里有优化空间——消除r8
-            emit("mov", PlatformArm32::regName[dest_reg_id], PlatformArm32::regName[src_reg_no]);
+            emit(ArmOp::MOV, REG(dest_reg_id), REG(src_reg_no));
         }
 
     } else if (Instanceof(globalVar, GlobalVariable *, dest_var)) {
@@ -459,7 +626,7 @@ void ILocArm32::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
         load_symbol(tmp_reg_no, globalVar->getName());
 
         // str r8, [r10]
-        emit("str", PlatformArm32::regName[src_reg_no], "[" + PlatformArm32::regName[tmp_reg_no] + "]");
+        emit(ArmOp::STR, REG(src_reg_no), ArmOperand::makeMem(tmp_reg_no));
 
     } else {
 
@@ -488,18 +655,15 @@ void ILocArm32::store_var(int src_reg_no, Value * dest_var, int tmp_reg_no)
 /// @param off 偏移
 void ILocArm32::leaStack(int rs_reg_no, int base_reg_no, int off)
 {
-    std::string rs_reg_name = PlatformArm32::regName[rs_reg_no];
-    std::string base_reg_name = PlatformArm32::regName[base_reg_no];
-
     if (PlatformArm32::constExpr(off))
         // add r8,fp,#-16
-        emit("add", rs_reg_name, base_reg_name, toStr(off));
+        emit(ArmOp::ADD, REG(rs_reg_no), REG(base_reg_no), IMM(off));
     else {
         // ldr r8,=-257
         load_imm(rs_reg_no, off);
 
         // add r8,fp,r8
-        emit("add", rs_reg_name, base_reg_name, rs_reg_name);
+        emit(ArmOp::ADD, REG(rs_reg_no), REG(base_reg_no), REG(rs_reg_no));
     }
 }
 
@@ -508,6 +672,11 @@ void ILocArm32::leaStack(int rs_reg_no, int base_reg_no, int off)
 /// @param tmp_reg_No
 void ILocArm32::allocStack(Function * func, int tmp_reg_no)
 {
+    // 需要帧指针时，保存SP寄存器到FP寄存器中
+    if (func->getNeedFramePointer()) {
+        mov_reg(ARM32_FP_REG_NO, ARM32_SP_REG_NO);
+    }
+
     // 计算栈帧大小
     int off = func->getMaxDep();
 
@@ -516,18 +685,43 @@ void ILocArm32::allocStack(Function * func, int tmp_reg_no)
         return;
     }
 
-    // 保存SP寄存器到FP寄存器中
-    mov_reg(ARM32_FP_REG_NO, ARM32_SP_REG_NO);
-
     if (PlatformArm32::constExpr(off)) {
         // sub sp,sp,#16
-        emit("sub", "sp", "sp", toStr(off));
+        emit(ArmOp::SUB, REG(ARM32_SP_REG_NO), REG(ARM32_SP_REG_NO), IMM(off));
     } else {
         // ldr r8,=257
         load_imm(tmp_reg_no, off);
 
         // sub sp,sp,r8
-        emit("sub", "sp", "sp", PlatformArm32::regName[tmp_reg_no]);
+        emit(ArmOp::SUB, REG(ARM32_SP_REG_NO), REG(ARM32_SP_REG_NO), REG(tmp_reg_no));
+    }
+}
+
+/// @brief 函数返回前释放栈帧，与allocStack对应
+/// @param func 函数
+/// @param tmp_reg_no 栈帧过大时使用的临时寄存器
+void ILocArm32::freeStack(Function * func, int tmp_reg_no)
+{
+    if (func->getNeedFramePointer()) {
+        // 恢复栈空间，mov sp,fp
+        mov_reg(ARM32_SP_REG_NO, ARM32_FP_REG_NO);
+        return;
+    }
+
+    int off = func->getMaxDep();
+    if (0 == off) {
+        return;
+    }
+
+    if (PlatformArm32::constExpr(off)) {
+        // add sp,sp,#16
+        emit(ArmOp::ADD, REG(ARM32_SP_REG_NO), REG(ARM32_SP_REG_NO), IMM(off));
+    } else {
+        // ldr r8,=257
+        load_imm(tmp_reg_no, off);
+
+        // add sp,sp,r8
+        emit(ArmOp::ADD, REG(ARM32_SP_REG_NO), REG(ARM32_SP_REG_NO), REG(tmp_reg_no));
     }
 }
 
@@ -536,14 +730,15 @@ void ILocArm32::allocStack(Function * func, int tmp_reg_no)
 void ILocArm32::call_fun(std::string name)
 {
     // 函数返回值在r0,不需要保护
-    emit("bl", name);
+    ArmInst * arm = inst(ArmOp::BL, ArmOperand::makeLabel());
+    arm->symbol = name;
 }
 
 /// @brief NOP操作
 void ILocArm32::nop()
 {
-    // FIXME 无操作符，要确认是否用nop指令
-    emit("");
+    // 占位指令，不输出任何内容
+    emit(ArmOp::NOP);
 }
 
 ///
@@ -552,5 +747,5 @@ void ILocArm32::nop()
 ///
 void ILocArm32::jump(std::string label)
 {
-    emit("b", label);
+    branch(ArmCond::AL, label);
 }
@@ -2,8 +2,8 @@
 /// @file ILocArm32.h
 /// @brief 指令序列管理的头文件，ILOC的全称为Intermediate Language for Optimizing Compilers
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>汇编可输出到字符串
 /// </table>
 ///
 #pragma once
@@ -18,68 +19,11 @@
 #include <list>
 #include <string>
 
+#include "ArmInst.h"
 #include "Module.h"
 
 #define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
 
-/// @brief 底层汇编指令：ARM32
-struct ArmInst {
-
-    /// @brief 操作码
-    std::string opcode;
-
-    /// @brief 条件
-    std::string cond;
-
-    /// @brief 结果
-    std::string result;
-
-    /// @brief 源操作数1
-    std::string arg1;
-
-    /// @brief 源操作数2
-    std::string arg2;
-
-    /// @brief 附加信息
-    std::string addition;
-
-    /// @brief 标识指令是否无效
-    bool dead;
-
-    /// @brief 构造函数
-    /// @param op
-    /// @param rs
-    /// @param s1
-    /// @param s2
-    /// @param add
-    ArmInst(std::string op,
-            std::string rs = "",
-            std::string s1 = "",
-            std::string s2 = "",
-            std::string cond = "",
-            std::string extra = "");
-
-    /// @brief 指令更新
-    /// @param op
-    /// @param rs
-    /// @param s1
-    /// @param s2
-    /// @param add
-    void replace(std::string op,
-                 std::string rs = "",
-                 std::string s1 = "",
-                 std::string s2 = "",
-                 std::string cond = "",
-                 std::string extra = "");
-
-    /// @brief 设置死指令
-    void setDead();
-
-    /// @brief 指令字符串输出函数
-    /// @return
-    std::string outPut();
-};
-
 /// @brief 底层汇编序列-ARM32
 class ILocArm32 {
 
@@ -89,6 +33,12 @@ class ILocArm32 {
     /// @brief 符号表
     Module * module;
 
+    /// @brief 寄存器在指定位置之后直到基本块结束是否不再被使用
+    /// @param pIter 开始检查的位置
+    /// @param reg_no 寄存器编号
+    /// @return true：肯定不再使用，false：可能被使用
+    bool regDeadAfter(std::list<ArmInst *>::iterator pIter, int reg_no);
+
     /// @brief 加载立即数 ldr r0,=#100
     /// @param rs_reg_no 结果寄存器号
     /// @param num 立即数
@@ -119,12 +69,6 @@ public:
     ///
     void comment(std::string str);
 
-    /// @brief 数字变字符串，若flag为真，则变为立即数寻址（加#）
-    /// @param num 立即数
-    /// @param flag 是否家#
-    /// @return 字符串
-    std::string toStr(int num, bool flag = true);
-
     /// @brief 获取当前的代码序列
     /// @return 代码序列
     std::list<ArmInst *> & getCode();
@@ -146,23 +90,38 @@ public:
     /// @param name
     void label(std::string name);
 
-    /// @brief 一个操作数指令
+    /// @brief 产生一条机器指令
     /// @param op 操作码
-    /// @param rs 操作数
-    void inst(std::string op, std::string rs);
-
-    /// @brief 一个操作数指令
+    /// @param rs 结果操作数
+    /// @param arg1 源操作数1
+    /// @param arg2 源操作数2
+    /// @param cond 条件码
+    /// @return 产生的指令
+    ArmInst * inst(ArmOp op,
+                   ArmOperand rs = ArmOperand(),
+                   ArmOperand arg1 = ArmOperand(),
+                   ArmOperand arg2 = ArmOperand(),
+                   ArmCond cond = ArmCond::AL);
+
+    /// @brief 三寄存器指令，如add r0,r1,r2
     /// @param op 操作码
-    /// @param rs 操作数
-    /// @param arg1 源操作数
-    void inst(std::string op, std::string rs, std::string arg1);
+    /// @param rs_reg_no 结果寄存器
+    /// @param src1_reg_no 源寄存器1
+    /// @param src2_reg_no 源寄存器2
+    void inst_reg(ArmOp op, int rs_reg_no, int src1_reg_no, int src2_reg_no);
 
-    /// @brief 一个操作数指令
-    /// @param op 操作码
-    /// @param rs 操作数
-    /// @param arg1 源操作数
-    /// @param arg2 源操作数
-    void inst(std::string op, std::string rs, std::string arg1, std::string arg2);
+    /// @brief 条件跳转或无条件跳转到标签
+    /// @param cond 条件码
+    /// @param label 目标Label名称
+    void branch(ArmCond cond, std::string label);
+
+    /// @brief 寄存器入栈 push {r4,fp,lr}
+    /// @param mask 寄存器位图
+    void push(uint32_t mask);
+
+    /// @brief 寄存器出栈 pop {r4,fp,lr}
+    /// @param mask 寄存器位图
+    void pop(uint32_t mask);
 
     /// @brief 加载变量到寄存器
     /// @param rs_reg_no 结果寄存器
@@ -194,6 +153,11 @@ public:
     /// @param tmp_reg_No
     void allocStack(Function * func, int tmp_reg_No);
 
+    /// @brief 释放栈帧
+    /// @param func 函数
+    /// @param tmp_reg_no 栈帧过大时使用的临时寄存器
+    void freeStack(Function * func, int tmp_reg_no);
+
     /// @brief 加载函数的参数到寄存器
     /// @param fun
     void ldr_args(Function * fun);
@@ -212,6 +176,18 @@ public:
     /// @param outputEmpty 是否输出空语句
     void outPut(FILE * file, bool outputEmpty = false);
 
+    /// @brief 输出汇编到字符串的尾部
+    /// @param text 输出的字符串
+    /// @param outputEmpty 是否输出空语句
+    void outPut(std::string & text, bool outputEmpty = false);
+
     /// @brief 删除无用的Label指令
     void deleteUnusedLabel();
+
+    /// @brief 多次使用或循环内使用的全局变量地址，在函数入口处一次性加载到空闲的被调用者保护寄存器中，
+    /// 函数内对该全局变量的访问直接使用该寄存器作为基址。需在插入函数序言之前执行
+    void hoistSymbolAddress();
+
+    /// @brief 在文字池的常量离引用的ldr指令不超出4KB的位置插入.ltorg
+    void placeLiteralPools();
 };
@@ -0,0 +1,220 @@
+///
+/// @file InstSchedulerArm32.cpp
+/// @brief 基本块内的表调度(List Scheduling)的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#include <algorithm>
+#include <cstdlib>
+
+#include "InstSchedulerArm32.h"
+#include "PlatformArm32.h"
+
+/// @brief 构造函数
+/// @param _iloc 要调度的指令序列
+InstSchedulerArm32::InstSchedulerArm32(ILocArm32 & _iloc) : iloc(_iloc)
+{}
+
+/// @brief 指令是否是调度的边界，边界指令保持原位置
+/// @param arm 指令
+/// @return true：是边界
+bool InstSchedulerArm32::isBarrier(ArmInst * arm)
+{
+    switch (arm->opcode) {
+        case ArmOp::LABEL:
+        case ArmOp::COMMENT:
+        case ArmOp::NOP:
+        case ArmOp::B:
+        case ArmOp::BL:
+        case ArmOp::BX:
+        case ArmOp::PUSH:
+        case ArmOp::POP:
+        case ArmOp::LTORG:
+            return true;
+        default:
+            break;
+    }
+
+    // 修改sp或fp的指令属于栈帧的建立与撤销，栈内变量的寻址都依赖它们
+    const uint32_t frameRegs = (1u << ARM32_SP_REG_NO) | (1u << ARM32_FP_REG_NO);
+
+    return (arm->defRegs() & frameRegs) != 0;
+}
+
+/// @brief 两条访存指令是否可能访问同一内存单元
+/// @param first 在前的指令
+/// @param second 在后的指令
+/// @return true：可能，false：肯定不会
+bool InstSchedulerArm32::mayAlias(ArmInst * first, ArmInst * second)
+{
+    const ArmOperand & m1 = first->arg1;
+    const ArmOperand & m2 = second->arg1;
+
+    // 文字池只读，不会被store改写
+    if (m1.isLiteral() || m2.isLiteral()) {
+        return false;
+    }
+
+    if ((m1.kind != ArmOperandKind::MEM) || (m2.kind != ArmOperandKind::MEM)) {
+        return true;
+    }
+
+    // 块内fp与sp不会被修改，同一基址的不同偏移肯定不会重叠，目前只有4字节的访存
+    bool frameBase = (m1.reg == ARM32_FP_REG_NO) || (m1.reg == ARM32_SP_REG_NO);
+    if (frameBase && (m1.reg == m2.reg) && (m1.index == -1) && (m2.index == -1)) {
+        return std::abs(m1.imm - m2.imm) < 4;
+    }
+
+    return true;
+}
+
+/// @brief 对指令序列的每个基本块进行调度
+void InstSchedulerArm32::run()
+{
+    std::list<ArmInst *> & code = iloc.getCode();
+
+    std::list<ArmInst *> newCode;
+    std::vector<ArmInst *> block;
+
+    for (auto arm: code) {
+
+        if (arm->dead) {
+            // 死指令不输出，不参与调度
+            newCode.push_back(arm);
+        } else if (isBarrier(arm)) {
+            // 遇到边界，之前的指令构成一个基本块
+            scheduleBlock(block, newCode);
+            block.clear();
+
+            newCode.push_back(arm);
+        } else {
+            block.push_back(arm);
+        }
+    }
+
+    scheduleBlock(block, newCode);
+
+    code.swap(newCode);
+}
+
+/// @brief 对一个基本块进行调度，结果追加到out中
+/// @param block 基本块内的指令，原始次序
+/// @param out 调度后的指令序列
+void InstSchedulerArm32::scheduleBlock(std::vector<ArmInst *> & block, std::list<ArmInst *> & out)
+{
+    const int n = (int) block.size();
+
+    if (n <= 2) {
+        out.insert(out.end(), block.begin(), block.end());
+        return;
+    }
+
+    std::vector<std::vector<DepEdge>> succs(n);
+    std::vector<int> predCount(n, 0);
+
+    // 建立依赖图：写后读、读后写、写后写的寄存器依赖以及内存依赖
+    for (int i = 0; i < n; ++i) {
+
+        ArmInst * second = block[i];
+        uint32_t secondDef = second->defRegs();
+        uint32_t secondUse = second->useRegs();
+
+        for (int j = 0; j < i; ++j) {
+
+            ArmInst * first = block[j];
+            uint32_t firstDef = first->defRegs();
+            uint32_t firstUse = first->useRegs();
+
+            int latency = -1;
+
+            if (firstDef & secondUse) {
+                // 写后读，需等待前一条指令的结果
+                latency = PlatformArm32::latency(first->opcode);
+            } else if (firstDef & secondDef) {
+                // 写后写
+                latency = 1;
+            } else if (firstUse & secondDef) {
+                // 读后写，只需保持次序
+                latency = 0;
+            }
+
+            bool memDep = (first->writesMem() && (second->readsMem() || second->writesMem())) ||
+                          (first->readsMem() && second->writesMem());
+            if (memDep && mayAlias(first, second)) {
+                latency = std::max(latency, first->writesMem() ? 1 : 0);
+            }
+
+            if (latency >= 0) {
+                succs[j].push_back({i, latency});
+                predCount[i]++;
+            }
+        }
+    }
+
+    // 优先级：到块尾的最长延迟路径，关键路径上的指令优先发射
+    std::vector<int> height(n, 0);
+    for (int i = n - 1; i >= 0; --i) {
+        height[i] = PlatformArm32::latency(block[i]->opcode);
+        for (auto & edge: succs[i]) {
+            height[i] = std::max(height[i], edge.latency + height[edge.succ]);
+        }
+    }
+
+    // 各指令最早可以发射的周期
+    std::vector<int> earliest(n, 0);
+    std::vector<bool> done(n, false);
+
+    int cycle = 0;
+    for (int scheduled = 0; scheduled < n;) {
+
+        int pick = -1;
+        int nextCycle = -1;
+
+        for (int i = 0; i < n; ++i) {
+
+            if (done[i] || predCount[i]) {
+                continue;
+            }
+
+            if (earliest[i] > cycle) {
+                // 操作数尚未就绪
+                if ((nextCycle == -1) || (earliest[i] < nextCycle)) {
+                    nextCycle = earliest[i];
+                }
+                continue;
+            }
+
+            // 同等优先级时保持原始次序
+            if ((pick == -1) || (height[i] > height[pick])) {
+                pick = i;
+            }
+        }
+
+        if (pick == -1) {
+            // 当前周期没有可发射的指令，流水线停顿到最早就绪的周期
+            cycle = nextCycle;
+            continue;
+        }
+
+        done[pick] = true;
+        scheduled++;
+        out.push_back(block[pick]);
+
+        for (auto & edge: succs[pick]) {
+            earliest[edge.succ] = std::max(earliest[edge.succ], cycle + edge.latency);
+            predCount[edge.succ]--;
+        }
+
+        // 单发射
+        cycle++;
+    }
+}
@@ -0,0 +1,68 @@
+///
+/// @file InstSchedulerArm32.h
+/// @brief 基本块内的表调度(List Scheduling)，面向顺序执行的ARM32处理器
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新建
+/// </table>
+///
+#pragma once
+
+#include <list>
+#include <vector>
+
+#include "ArmInst.h"
+#include "ILocArm32.h"
+
+///
+/// @brief 指令调度器。以标签、转移、函数调用等为边界划分基本块，
+/// 在块内建立依赖图后按关键路径优先的次序重排指令，使ldr、mul等长延迟指令尽早发射，
+/// 从而减少顺序执行流水线上的load-use停顿
+///
+class InstSchedulerArm32 {
+
+public:
+    /// @brief 构造函数
+    /// @param _iloc 要调度的指令序列
+    explicit InstSchedulerArm32(ILocArm32 & _iloc);
+
+    /// @brief 对指令序列的每个基本块进行调度
+    void run();
+
+protected:
+    /// @brief 依赖图中的边
+    struct DepEdge {
+        /// @brief 后继结点在块内的序号
+        int succ;
+
+        /// @brief 后继最早可以发射的周期差
+        int latency;
+    };
+
+    /// @brief 指令是否是调度的边界，边界指令保持原位置
+    /// @param arm 指令
+    /// @return true：是边界
+    static bool isBarrier(ArmInst * arm);
+
+    /// @brief 两条访存指令是否可能访问同一内存单元
+    /// @param first 在前的指令
+    /// @param second 在后的指令
+    /// @return true：可能，false：肯定不会
+    static bool mayAlias(ArmInst * first, ArmInst * second);
+
+    /// @brief 对一个基本块进行调度，结果追加到out中
+    /// @param block 基本块内的指令，原始次序
+    /// @param out 调度后的指令序列
+    void scheduleBlock(std::vector<ArmInst *> & block, std::list<ArmInst *> & out);
+
+private:
+    /// @brief 指令序列
+    ILocArm32 & iloc;
+};
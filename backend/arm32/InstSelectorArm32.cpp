@@ -2,8 +2,8 @@
 /// @file InstSelectorArm32.cpp
 /// @brief 指令选择器-ARM32的实现
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>函数调用的传参不再创建临时的赋值指令，不修改共用的Value
 /// </table>
 ///
 #include <cstdio>
@@ -27,7 +28,6 @@
 #include "LabelInstruction.h"
 #include "GotoInstruction.h"
 #include "FuncCallInstruction.h"
-#include "MoveInstruction.h"
 #include "BranchInstruction.h"
 #include "NegInstruction.h"
 
@@ -67,6 +67,15 @@ InstSelectorArm32::InstSelectorArm32(vector<Instruction *> & _irCode,
 
     translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorArm32::translate_call;
     translator_handlers[IRInstOperator::IRINST_OP_ARG] = &InstSelectorArm32::translate_arg;
+
+    // 条件分支与按名字跳转的goto指令引用的是IR中的标签名，这里记录其对应的Label指令
+    for (auto inst: ir) {
+        if (Instanceof(labelInst, LabelInstruction *, inst)) {
+            if (labelInst->getLabel() != 0) {
+                labelInsts[labelInst->getLabel()] = labelInst;
+            }
+        }
+    }
 }
 
 ///
@@ -85,6 +94,12 @@ void InstSelectorArm32::run()
             translate(inst);
         }
     }
+
+    // 全局变量的地址尽量只加载一次，会占用空闲的被调用者保护寄存器
+    iloc.hoistSymbolAddress();
+
+    // 被调用者保护的寄存器需在函数体的指令确定后才能得知
+    genPrologueEpilogue();
 }
 
 /// @brief 指令翻译成ARM32汇编
@@ -122,6 +137,22 @@ void InstSelectorArm32::outputIRInstruction(Instruction * inst)
     }
 }
 
+///
+/// @brief 根据IR中的标签名称获取汇编中的标签名
+/// @param irLabel IR标签名称
+/// @return std::string 汇编标签名
+///
+std::string InstSelectorArm32::getAsmLabel(Symbol irLabel)
+{
+    auto pIter = labelInsts.find(irLabel);
+    if (pIter == labelInsts.end()) {
+        minic_log(LOG_ERROR, "标签(%s)不存在", symbolName(irLabel).data());
+        return std::string(symbolName(irLabel));
+    }
+
+    return pIter->second->getName();
+}
+
 /// @brief NOP翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_nop(Instruction * inst)
@@ -145,34 +176,20 @@ void InstSelectorArm32::translate_goto(Instruction * inst)
 {
     Instanceof(gotoInst, GotoInstruction *, inst);
 
-    // 无条件跳转
-    iloc.jump(gotoInst->getTarget()->getName());
+    // 无条件跳转，目标可能是Label指令，也可能是标签名称
+    if (gotoInst->getTarget()) {
+        iloc.jump(gotoInst->getTarget()->getName());
+    } else {
+        iloc.jump(getAsmLabel(gotoInst->getLabel()));
+    }
 }
 
 /// @brief 函数入口指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_entry(Instruction * inst)
 {
-    // 查看保护的寄存器
-    auto & protectedRegNo = func->getProtectedReg();
-    auto & protectedRegStr = func->getProtectedRegStr();
-
-    bool first = true;
-    for (auto regno: protectedRegNo) {
-        if (first) {
-            protectedRegStr = PlatformArm32::regName[regno];
-            first = false;
-        } else {
-            protectedRegStr += "," + PlatformArm32::regName[regno];
-        }
-    }
-
-    if (!protectedRegStr.empty()) {
-        iloc.inst("push", "{" + protectedRegStr + "}");
-    }
-
-    // 为fun分配栈帧，含局部变量、函数调用值传递的空间等
-    iloc.allocStack(func, ARM32_TMP_REG_NO);
+    // 寄存器保护与栈帧分配在指令选择完成后由genPrologueEpilogue插入
+    (void) inst;
 }
 
 /// @brief 函数出口指令翻译成ARM32汇编
@@ -187,25 +204,96 @@ void InstSelectorArm32::translate_exit(Instruction * inst)
         iloc.load_var(0, retVal);
     }
 
-    // 恢复栈空间
-    iloc.inst("mov", "sp", "fp");
+    // 栈空间恢复、寄存器恢复以及返回由genPrologueEpilogue追加
+}
 
-    // 保护寄存器的恢复
-    auto & protectedRegStr = func->getProtectedRegStr();
-    if (!protectedRegStr.empty()) {
-        iloc.inst("pop", "{" + protectedRegStr + "}");
+/// @brief 指令选择完成后，根据实际定值的寄存器插入函数的序言与尾声
+void InstSelectorArm32::genPrologueEpilogue()
+{
+    std::list<ArmInst *> & code = iloc.getCode();
+
+    // 函数体内定值过的被调用者保护寄存器才需要保护，有函数调用时bl会改写lr
+    uint32_t defMask = 0;
+    for (auto arm: code) {
+        defMask |= arm->defRegs();
+    }
+
+    uint32_t protectedMask = defMask & ARM32_CALLEE_SAVED_MASK;
+    if (func->getNeedFramePointer()) {
+        protectedMask |= 1u << ARM32_FP_REG_NO;
     }
 
-    iloc.inst("bx", "lr");
+    std::vector<int32_t> & protectedRegNo = func->getProtectedReg();
+    protectedRegNo.clear();
+    for (int32_t regno = 0; regno < PlatformArm32::maxRegNum; ++regno) {
+        if (protectedMask & (1u << regno)) {
+            protectedRegNo.push_back(regno);
+        }
+    }
+
+    int32_t protectedSize = (int32_t) protectedRegNo.size() * 4;
+
+    // 有函数调用时，保证调用时的sp按8字节对齐，填充的空间位于局部变量之上，不影响其sp偏移
+    int32_t frameSize = func->getMaxDep();
+    if (func->getExistFuncCall()) {
+        frameSize = ((frameSize + protectedSize + 7) & ~7) - protectedSize;
+        func->setMaxDep(frameSize);
+    }
+
+    // 栈传递的形参按照相对实参区起始位置的伪基址寄存器进行了寻址，这里修正为实际的基址与偏移
+    // 采用帧指针时fp指向保护寄存器区的底部，否则改用sp寻址，还需越过整个栈帧
+    int32_t paramDelta = protectedSize;
+    if (!func->getNeedFramePointer()) {
+        paramDelta += frameSize;
+    }
+
+    for (auto arm: code) {
+        ArmOperand & mem = arm->arg1;
+        if ((mem.kind == ArmOperandKind::MEM) && (mem.reg == ARM32_ARG_AREA_REG_NO)) {
+            mem.reg = func->getNeedFramePointer() ? ARM32_FP_REG_NO : ARM32_SP_REG_NO;
+            mem.imm += paramDelta;
+        }
+    }
+
+    // 序言先追加到末尾，再整体移动到函数体的前面
+    size_t bodySize = code.size();
+
+    if (protectedMask) {
+        iloc.push(protectedMask);
+    }
+
+    // 为fun分配栈帧，含局部变量、函数调用值传递的空间等，栈帧过大时借助ip寄存器
+    iloc.allocStack(func, ARM32_IP_REG_NO);
+
+    code.splice(code.begin(), code, std::next(code.begin(), (long) bodySize), code.end());
+
+    // 恢复栈空间
+    iloc.freeStack(func, ARM32_IP_REG_NO);
+
+    if (protectedMask & (1u << ARM32_LX_REG_NO)) {
+        // lr直接恢复到pc，同时完成返回，pop {r4,fp,pc}
+        iloc.pop((protectedMask & ~(1u << ARM32_LX_REG_NO)) | (1u << ARM32_PC_REG_NO));
+    } else {
+        if (protectedMask) {
+            iloc.pop(protectedMask);
+        }
+
+        iloc.inst(ArmOp::BX, ArmOperand::makeReg(ARM32_LX_REG_NO));
+    }
 }
 
 /// @brief 赋值指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_assign(Instruction * inst)
 {
-    Value * result = inst->getOperand(0);
-    Value * arg1 = inst->getOperand(1);
+    genAssign(inst->getOperand(0), inst->getOperand(1));
+}
 
+/// @brief 产生result = arg1的赋值汇编，不需要创建IR指令
+/// @param result 目的操作数
+/// @param arg1 源操作数
+void InstSelectorArm32::genAssign(Value * result, Value * arg1)
+{
     int32_t arg1_regId = arg1->getRegId();
     int32_t result_regId = result->getRegId();
 
@@ -236,11 +324,8 @@ void InstSelectorArm32::translate_assign(Instruction * inst)
 
 /// @brief 二元操作指令翻译成ARM32汇编
 /// @param inst IR指令
-/// @param operator_name 操作码
-/// @param rs_reg_no 结果寄存器号
-/// @param op1_reg_no 源操作数1寄存器号
-/// @param op2_reg_no 源操作数2寄存器号
-void InstSelectorArm32::translate_two_operator(Instruction * inst, string operator_name)
+/// @param op 操作码
+void InstSelectorArm32::translate_two_operator(Instruction * inst, ArmOp op)
 {
     Value * result = inst;
     Value * arg1 = inst->getOperand(0);
@@ -284,10 +369,7 @@ void InstSelectorArm32::translate_two_operator(Instruction * inst, string operat
     }
 
     // r8 + r9 -> r10
-    iloc.inst(operator_name,
-              PlatformArm32::regName[load_result_reg_no],
-              PlatformArm32::regName[load_arg1_reg_no],
-              PlatformArm32::regName[load_arg2_reg_no]);
+    iloc.inst_reg(op, load_result_reg_no, load_arg1_reg_no, load_arg2_reg_no);
 
     // 结果不是寄存器，则需要把rs_reg_name保存到结果变量中
     if (result_reg_no == -1) {
@@ -308,21 +390,21 @@ void InstSelectorArm32::translate_two_operator(Instruction * inst, string operat
 /// @param inst IR指令
 void InstSelectorArm32::translate_add_int32(Instruction * inst)
 {
-    translate_two_operator(inst, "add");
+    translate_two_operator(inst, ArmOp::ADD);
 }
 
 /// @brief 整数减法指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_sub_int32(Instruction * inst)
 {
-    translate_two_operator(inst, "sub");
+    translate_two_operator(inst, ArmOp::SUB);
 }
 
 /// @brief 整数乘法指令翻译成ARM32汇编
 /// @param inst IR指令
 void InstSelectorArm32::translate_mul_int32(Instruction * inst)
 {
-    translate_two_operator(inst, "mul");
+    translate_two_operator(inst, ArmOp::MUL);
 }
 
 /// @brief 整数除法指令翻译成ARM32汇编
@@ -331,7 +413,7 @@ void InstSelectorArm32::translate_div_int32(Instruction * inst)
 {
     // ARM汇编中没有直接的整数除法指令，通常使用库函数或特殊指令序列
     // 这里简化处理，使用sdiv指令（在ARMv7-A架构及以上支持）
-    translate_two_operator(inst, "sdiv");
+    translate_two_operator(inst, ArmOp::SDIV);
 }
 
 /// @brief 整数求余指令翻译成ARM32汇编
@@ -383,22 +465,13 @@ void InstSelectorArm32::translate_mod_int32(Instruction * inst)
     temp_reg_no = simpleRegisterAllocator.Allocate();
     
     // r8 / r9 -> temp_reg （计算arg1 / arg2）
-    iloc.inst("sdiv", 
-              PlatformArm32::regName[temp_reg_no], 
-              PlatformArm32::regName[load_arg1_reg_no], 
-              PlatformArm32::regName[load_arg2_reg_no]);
+    iloc.inst_reg(ArmOp::SDIV, temp_reg_no, load_arg1_reg_no, load_arg2_reg_no);
     
     // temp_reg * r9 -> temp_reg （计算(arg1 / arg2) * arg2）
-    iloc.inst("mul", 
-              PlatformArm32::regName[temp_reg_no], 
-              PlatformArm32::regName[temp_reg_no], 
-              PlatformArm32::regName[load_arg2_reg_no]);
+    iloc.inst_reg(ArmOp::MUL, temp_reg_no, temp_reg_no, load_arg2_reg_no);
     
     // r8 - temp_reg -> r10 （计算arg1 - (arg1 / arg2) * arg2）
-    iloc.inst("sub", 
-              PlatformArm32::regName[load_result_reg_no], 
-              PlatformArm32::regName[load_arg1_reg_no], 
-              PlatformArm32::regName[temp_reg_no]);
+    iloc.inst_reg(ArmOp::SUB, load_result_reg_no, load_arg1_reg_no, temp_reg_no);
     
     // 结果不是寄存器，则需要把rs_reg_name保存到结果变量中
     if (result_reg_no == -1) {
@@ -415,8 +488,8 @@ void InstSelectorArm32::translate_mod_int32(Instruction * inst)
 
 /// @brief 通用比较函数，生成比较指令
 /// @param inst IR指令
-/// @param condition 条件代码 (eq, ne, gt, ge, lt, le)
-void InstSelectorArm32::translate_compare(Instruction * inst, const string & condition)
+/// @param condition 条件码
+void InstSelectorArm32::translate_compare(Instruction * inst, ArmCond condition)
 {
     Value * result = inst;
     Value * arg1 = inst->getOperand(0);
@@ -451,19 +524,17 @@ void InstSelectorArm32::translate_compare(Instruction * inst, const string & con
     }
     
     // 先置0
-    iloc.inst("mov", 
-              PlatformArm32::regName[load_result_reg_no], 
-              "#0");
-    
+    iloc.inst(ArmOp::MOV, ArmOperand::makeReg(load_result_reg_no), ArmOperand::makeImm(0));
+
     // 比较两个操作数
-    iloc.inst("cmp", 
-              PlatformArm32::regName[load_arg1_reg_no], 
-              PlatformArm32::regName[load_arg2_reg_no]);
-    
+    iloc.inst(ArmOp::CMP, ArmOperand::makeReg(load_arg1_reg_no), ArmOperand::makeReg(load_arg2_reg_no));
+
     // 根据条件设置结果为1
-    iloc.inst("mov" + condition, 
-              PlatformArm32::regName[load_result_reg_no], 
-              "#1");
+    iloc.inst(ArmOp::MOV,
+              ArmOperand::makeReg(load_result_reg_no),
+              ArmOperand::makeImm(1),
+              ArmOperand(),
+              condition);
     
     // 存储结果
     if (result_reg_no == -1) {
@@ -481,7 +552,7 @@ void InstSelectorArm32::translate_compare(Instruction * inst, const string & con
 void InstSelectorArm32::translate_gt_int32(Instruction * inst)
 {
     // 大于比较: ARM32中使用CMP+GT条件
-    translate_compare(inst, "gt");
+    translate_compare(inst, ArmCond::GT);
 }
 
 /// @brief 大于等于比较指令翻译成ARM32汇编
@@ -489,7 +560,7 @@ void InstSelectorArm32::translate_gt_int32(Instruction * inst)
 void InstSelectorArm32::translate_ge_int32(Instruction * inst)
 {
     // 大于等于比较: ARM32中使用CMP+GE条件
-    translate_compare(inst, "ge");
+    translate_compare(inst, ArmCond::GE);
 }
 
 /// @brief 小于比较指令翻译成ARM32汇编
@@ -497,7 +568,7 @@ void InstSelectorArm32::translate_ge_int32(Instruction * inst)
 void InstSelectorArm32::translate_lt_int32(Instruction * inst)
 {
     // 小于比较: ARM32中使用CMP+LT条件
-    translate_compare(inst, "lt");
+    translate_compare(inst, ArmCond::LT);
 }
 
 /// @brief 小于等于比较指令翻译成ARM32汇编
@@ -505,7 +576,7 @@ void InstSelectorArm32::translate_lt_int32(Instruction * inst)
 void InstSelectorArm32::translate_le_int32(Instruction * inst)
 {
     // 小于等于比较: ARM32中使用CMP+LE条件
-    translate_compare(inst, "le");
+    translate_compare(inst, ArmCond::LE);
 }
 
 /// @brief 等于比较指令翻译成ARM32汇编
@@ -513,7 +584,7 @@ void InstSelectorArm32::translate_le_int32(Instruction * inst)
 void InstSelectorArm32::translate_eq_int32(Instruction * inst)
 {
     // 等于比较: ARM32中使用CMP+EQ条件
-    translate_compare(inst, "eq");
+    translate_compare(inst, ArmCond::EQ);
 }
 
 /// @brief 不等于比较指令翻译成ARM32汇编
@@ -521,7 +592,7 @@ void InstSelectorArm32::translate_eq_int32(Instruction * inst)
 void InstSelectorArm32::translate_ne_int32(Instruction * inst)
 {
     // 不等于比较: ARM32中使用CMP+NE条件
-    translate_compare(inst, "ne");
+    translate_compare(inst, ArmCond::NE);
 }
 
 /// @brief 条件分支指令翻译成ARM32汇编
@@ -538,8 +609,8 @@ void InstSelectorArm32::translate_bc(Instruction * inst)
     
     // 获取条件变量和标签名称
     Value * condVar = inst->getOperand(0);
-    std::string trueLabelName = branchInst->getTrueLabel();
-    std::string falseLabelName = branchInst->getFalseLabel();
+    std::string trueLabelName = getAsmLabel(branchInst->getTrueLabel());
+    std::string falseLabelName = getAsmLabel(branchInst->getFalseLabel());
     if (!condVar) {
         minic_log(LOG_ERROR, "获取失败");
         return;
@@ -554,14 +625,13 @@ void InstSelectorArm32::translate_bc(Instruction * inst)
 		
     } else {
         loadCondReg = condReg;
-		minic_log(LOG_ERROR, "1");
     }
     
     // 比较条件变量与0
-    iloc.inst("cmp", PlatformArm32::regName[loadCondReg], "#0");
-    
+    iloc.inst(ArmOp::CMP, ArmOperand::makeReg(loadCondReg), ArmOperand::makeImm(0));
+
     // 条件为真时跳转到真标签
-    iloc.inst("bne", trueLabelName);
+    iloc.branch(ArmCond::NE, trueLabelName);
     
     // 条件为假时跳转到假标签
     iloc.jump(falseLabelName);
@@ -609,12 +679,8 @@ void InstSelectorArm32::translate_call(Instruction * inst)
             newVal->setMemoryAddr(ARM32_SP_REG_NO, esp);
             esp += 4;
 
-            Instruction * assignInst = new MoveInstruction(func, newVal, arg);
-
-            // 翻译赋值指令
-            translate_assign(assignInst);
-
-            delete assignInst;
+            // 翻译赋值，不创建临时的赋值指令，以免修改实参(可能是常量或全局变量)的使用列表
+            genAssign(newVal, arg);
         }
 
         for (int32_t k = 0; k < operandNum && k < 4; k++) {
@@ -625,12 +691,8 @@ void InstSelectorArm32::translate_call(Instruction * inst)
             // 如果是临时变量，该变量可更改为寄存器变量即可，或者设置寄存器号
             // 如果不是，则必须开辟一个寄存器变量，然后赋值即可
 
-            Instruction * assignInst = new MoveInstruction(func, PlatformArm32::intRegVal[k], arg);
-
-            // 翻译赋值指令
-            translate_assign(assignInst);
-
-            delete assignInst;
+            // 翻译赋值
+            genAssign(PlatformArm32::intRegVal[k], arg);
         }
     }
 
@@ -646,13 +708,8 @@ void InstSelectorArm32::translate_call(Instruction * inst)
     // 赋值指令
     if (callInst->hasResultValue()) {
 
-        // 新建一个赋值操作
-        Instruction * assignInst = new MoveInstruction(func, callInst, PlatformArm32::intRegVal[0]);
-
-        // 翻译赋值指令
-        translate_assign(assignInst);
-
-        delete assignInst;
+        // 翻译赋值
+        genAssign(callInst, PlatformArm32::intRegVal[0]);
     }
 
     // 函数调用后清零，使得下次可正常统计
@@ -711,7 +768,10 @@ void InstSelectorArm32::translate_neg_int32(Instruction * inst)
     iloc.load_var(operand_reg, operand);
 
     // 生成指令: 使用rsb (reverse subtract) 实现0-操作数
-    iloc.inst("rsb", PlatformArm32::regName[result_reg], PlatformArm32::regName[operand_reg], "#0");
+    iloc.inst(ArmOp::RSB,
+              ArmOperand::makeReg(result_reg),
+              ArmOperand::makeReg(operand_reg),
+              ArmOperand::makeImm(0));
 
     // 如果需要保存结果
     if (negInst->hasResultValue()) {
@@ -2,8 +2,8 @@
 /// @file InstSelectorArm32.h
 /// @brief 指令选择器-ARM32
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,16 +11,19 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>函数调用的传参不再创建临时的赋值指令，不修改共用的Value
 /// </table>
 ///
 #pragma once
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "Function.h"
 #include "ILocArm32.h"
 #include "Instruction.h"
+#include "StringInterner.h"
 #include "PlatformArm32.h"
 #include "SimpleRegisterAllocator.h"
 #include "RegVariable.h"
@@ -56,10 +59,18 @@ protected:
     /// @param inst IR指令
     void translate_exit(Instruction * inst);
 
+    /// @brief 指令选择完成后，根据实际定值的寄存器插入函数的序言与尾声
+    void genPrologueEpilogue();
+
     /// @brief 赋值指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_assign(Instruction * inst);
 
+    /// @brief 产生result = arg1的赋值汇编，不需要创建IR指令
+    /// @param result 目的操作数
+    /// @param arg1 源操作数
+    void genAssign(Value * result, Value * arg1);
+
     /// @brief Label指令指令翻译成ARM32汇编
     /// @param inst IR指令
     void translate_label(Instruction * inst);
@@ -123,12 +134,12 @@ protected:
     /// @brief 通用比较函数，生成比较指令
     /// @param inst IR指令
     /// @param condition 条件代码 (eq, ne, gt, ge, lt, le)
-    void translate_compare(Instruction * inst, const string & condition);
+    void translate_compare(Instruction * inst, ArmCond condition);
 
     /// @brief 二元操作指令翻译成ARM32汇编
     /// @param inst IR指令
-    /// @param operator_name 操作码
-    void translate_two_operator(Instruction * inst, string operator_name);
+    /// @param op 操作码
+    void translate_two_operator(Instruction * inst, ArmOp op);
 
     /// @brief 函数调用指令翻译成ARM32汇编
     /// @param inst IR指令
@@ -145,6 +156,13 @@ protected:
     ///
     void outputIRInstruction(Instruction * inst);
 
+    ///
+    /// @brief 根据IR中的标签名称获取汇编中的标签名
+    /// @param irLabel IR标签名称的驻留编号
+    /// @return std::string 汇编标签名
+    ///
+    std::string getAsmLabel(Symbol irLabel);
+
     /// @brief IR翻译动作函数原型
     typedef void (InstSelectorArm32::*translate_handler)(Instruction *);
 
@@ -164,6 +182,11 @@ protected:
     /// @brief 累计的实参个数
     int32_t realArgCount = 0;
 
+    ///
+    /// @brief IR标签名称到Label指令的映射，Label指令的名字为文件级唯一的汇编标签名
+    ///
+    std::unordered_map<Symbol, Instruction *> labelInsts;
+
     ///
     /// @brief 显示IR指令内容
     ///
@@ -2,8 +2,8 @@
 /// @file PlatformArm32.cpp
 /// @brief  ARM32平台相关实现
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>寄存器Value改为每线程一份
 /// </table>
 ///
 #include "PlatformArm32.h"
@@ -37,7 +38,8 @@ const std::string PlatformArm32::regName[PlatformArm32::maxRegNum] = {
     "pc", // r15，程序计数器。PC 存储着下一条将要执行的指令的地址。在执行分支指令时，PC会更新为新的地址。
 };
 
-RegVariable * PlatformArm32::intRegVal[PlatformArm32::maxRegNum] = {
+// 每个线程首次使用时创建，线程内的指令对它们的使用记录互不影响
+thread_local RegVariable * PlatformArm32::intRegVal[PlatformArm32::maxRegNum] = {
     new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[0], 0),
     new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[1], 1),
     new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[2], 2),
@@ -56,6 +58,43 @@ RegVariable * PlatformArm32::intRegVal[PlatformArm32::maxRegNum] = {
     new RegVariable(IntegerType::getTypeInt(), PlatformArm32::regName[15], 15),
 };
 
+// 顺序执行核上，load-use与乘法的延迟是流水线停顿的主要来源
+const int PlatformArm32::opLatency[(int) ArmOp::MAX] = {
+    0,  // LABEL
+    0,  // COMMENT
+    0,  // NOP
+    1,  // MOV
+    1,  // MVN
+    1,  // MOVW
+    1,  // MOVT
+    1,  // ADD
+    1,  // SUB
+    1,  // RSB
+    3,  // MUL
+    12, // SDIV
+    1,  // CMP
+    3,  // LDR
+    1,  // STR
+    1,  // B
+    1,  // BL
+    1,  // BX
+    1,  // PUSH
+    3,  // POP
+    0,  // LTORG
+};
+
+/// @brief 指令的结果可被后继指令使用所需的周期数
+/// @param op 操作码
+/// @return 周期数
+int PlatformArm32::latency(ArmOp op)
+{
+    if (op >= ArmOp::MAX) {
+        return 1;
+    }
+
+    return opLatency[(int) op];
+}
+
 /// @brief 循环左移两位
 /// @param num
 void PlatformArm32::roundLeftShiftTwoBit(unsigned int & num)
@@ -88,6 +127,14 @@ bool PlatformArm32::__constExpr(int num)
     return false;
 }
 
+/// @brief 是否可直接作为mov等指令的立即数，不考虑取负
+/// @param num
+/// @return
+bool PlatformArm32::isRotatedImm(int num)
+{
+    return __constExpr(num);
+}
+
 /// @brief 同时处理正数和负数
 /// @param num
 /// @return
@@ -104,6 +151,21 @@ bool PlatformArm32::isDisp(int num)
     return num < 4096 && num > -4096;
 }
 
+/// @brief 变量在栈内占用的空间，4字节的整数倍
+/// @param type 变量的类型
+/// @return 字节数
+int32_t PlatformArm32::stackSlotSize(Type * type)
+{
+    int32_t size = type->getSize();
+
+    // 指针与数组形参保存的是地址，ARM32上为4字节。指针类型没有大小，数组形参的大小为0或按64位计算
+    if (type->isPointerType() || type->isArrayParameterType() || (size <= 0)) {
+        return 4;
+    }
+
+    return (size + 3) & ~3;
+}
+
 /// @brief 判断是否是合法的寄存器名
 /// @param s 寄存器名字
 /// @return 是否是
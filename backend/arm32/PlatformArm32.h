@@ -2,8 +2,8 @@
 /// @file PlatformArm32.h
 /// @brief  ARM32平台相关头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,12 +11,14 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>寄存器Value改为每线程一份
 /// </table>
 ///
 #pragma once
 
 #include <string>
 
+#include "ArmInst.h"
 #include "RegVariable.h"
 
 // 在操作过程中临时借助的寄存器为ARM32_TMP_REG_NO
@@ -26,9 +28,21 @@
 #define ARM32_SP_REG_NO 13
 #define ARM32_FP_REG_NO 11
 
+// 栈传递形参所在区域（调用者的实参区）的伪基址寄存器，序言产生后改为fp或sp寻址，不会出现在输出的指令中
+#define ARM32_ARG_AREA_REG_NO 16
+
+// 过程内调用的临时寄存器IP，不需要保护
+#define ARM32_IP_REG_NO 12
+
 // 函数跳转寄存器LX
 #define ARM32_LX_REG_NO 14
 
+// 程序计数器PC
+#define ARM32_PC_REG_NO 15
+
+// 被调用者保护的寄存器r4-r11以及lr的位图
+#define ARM32_CALLEE_SAVED_MASK 0x4FF0u
+
 /// @brief ARM32平台信息
 class PlatformArm32 {
 
@@ -47,11 +61,21 @@ public:
     /// @return
     static bool constExpr(int num);
 
+    /// @brief 是否可直接作为mov等指令的立即数，不考虑取负
+    /// @param num
+    /// @return
+    static bool isRotatedImm(int num);
+
     /// @brief 判定是否是合法的偏移
     /// @param num
     /// @return
     static bool isDisp(int num);
 
+    /// @brief 变量在栈内占用的空间，4字节的整数倍
+    /// @param type 变量的类型
+    /// @return 字节数
+    static int32_t stackSlotSize(Type * type);
+
     /// @brief 判断是否是合法的寄存器名
     /// @param name 寄存器名字
     /// @return 是否是
@@ -66,6 +90,15 @@ public:
     /// @brief 寄存器的名字，r0-r15
     static const std::string regName[maxRegNum];
 
-    /// @brief 对寄存器R0分配Value，记录位置
-    static RegVariable * intRegVal[PlatformArm32::maxRegNum];
+    /// @brief 对寄存器R0分配Value，记录位置。Value记录了使用它的指令，多线程编译时每个线程一份
+    static thread_local RegVariable * intRegVal[PlatformArm32::maxRegNum];
+
+    /// @brief 指令的结果可被后继指令使用所需的周期数，按Cortex-A7/A53等顺序执行核的流水线估算
+    /// @param op 操作码
+    /// @return 周期数
+    static int latency(ArmOp op);
+
+private:
+    /// @brief 各操作码的指令延迟，按ArmOp的次序排列
+    static const int opLatency[(int) ArmOp::MAX];
 };
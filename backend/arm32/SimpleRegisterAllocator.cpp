@@ -2,8 +2,8 @@
 /// @file SimpleRegisterAllocator.cpp
 /// @brief 简单或朴素的寄存器分配器
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,10 +11,12 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>变量占用的寄存器记录在分配器内，不再写入Value
 /// </table>
 ///
 #include <algorithm>
 #include "SimpleRegisterAllocator.h"
+#include "ConstInt.h"
 
 ///
 /// @brief Construct a new Simple Register Allocator object
@@ -29,9 +31,10 @@ SimpleRegisterAllocator::SimpleRegisterAllocator()
 ///
 int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
 {
-    if (var && (var->getLoadRegId() != -1)) {
+    auto pIter = find(var);
+    if (pIter != regValues.end()) {
         // 该变量已经分配了Load寄存器了，不需要再次分配
-        return var->getLoadRegId();
+        return pIter->no;
     }
 
     int32_t regno = -1;
@@ -66,23 +69,25 @@ int SimpleRegisterAllocator::Allocate(Value * var, int32_t no)
 
         // 没有可用的寄存器分配，需要溢出一个变量的寄存器
 
-        // 溢出的策略：选择最迟加入队列的变量
-        Value * oldestVar = regValues.front();
-
-        // 获取Load寄存器编号，设置该变量不再占用Load寄存器
-        regno = oldestVar->getLoadRegId();
+        // 溢出的策略：优先选择常量，常量再次使用时重新生成即可，不需要从内存加载
+        // 没有常量时选择最迟加入队列的变量
+        auto victimIter = std::find_if(regValues.begin(), regValues.end(), [](const RegValue & val) {
+            return dynamic_cast<ConstInt *>(val.var) != nullptr;
+        });
+        if (victimIter == regValues.end()) {
+            victimIter = regValues.begin();
+        }
 
-        // 设置该变量不再占用寄存器
-        oldestVar->setLoadRegId(-1);
+        // 获取Load寄存器编号，该变量不再占用Load寄存器
+        regno = victimIter->no;
 
         // 从队列中删除
-        regValues.erase(regValues.begin());
+        regValues.erase(victimIter);
     }
 
     if (var) {
         // 加入新的变量
-        var->setLoadRegId(regno);
-        regValues.push_back(var);
+        regValues.push_back({var, regno});
     }
 
     return regno;
@@ -112,12 +117,12 @@ void SimpleRegisterAllocator::Allocate(int32_t no)
 ///
 void SimpleRegisterAllocator::free(Value * var)
 {
-    if (var && (var->getLoadRegId() != -1)) {
+    auto pIter = find(var);
+    if (pIter != regValues.end()) {
 
         // 清除该索引的寄存器，变得可使用
-        regBitmap.reset(var->getLoadRegId());
-        regValues.erase(std::find(regValues.begin(), regValues.end(), var));
-        var->setLoadRegId(-1);
+        regBitmap.reset(pIter->no);
+        regValues.erase(pIter);
     }
 }
 
@@ -136,17 +141,30 @@ void SimpleRegisterAllocator::free(int32_t no)
     regBitmap.reset(no);
 
     // 查找寄存器编号
-    auto pIter = std::find_if(regValues.begin(), regValues.end(), [=](auto val) {
-        return val->getLoadRegId() == no; // 存器编号与 no 匹配
+    auto pIter = std::find_if(regValues.begin(), regValues.end(), [=](const RegValue & val) {
+        return val.no == no; // 存器编号与 no 匹配
     });
 
     if (pIter != regValues.end()) {
-        // 查找到，则清除，并设置为-1
-        (*pIter)->setLoadRegId(-1);
+        // 查找到，则清除
         regValues.erase(pIter);
     }
 }
 
+///
+/// @brief 查找变量占用的寄存器
+/// @param var 变量
+/// @return 变量在regValues中的位置，没有占用时为end()
+///
+std::vector<SimpleRegisterAllocator::RegValue>::iterator SimpleRegisterAllocator::find(Value * var)
+{
+    if (var == nullptr) {
+        return regValues.end();
+    }
+
+    return std::find_if(regValues.begin(), regValues.end(), [=](const RegValue & val) { return val.var == var; });
+}
+
 ///
 /// @brief 寄存器被置位，使用过的寄存器被置位
 /// @param no
@@ -2,8 +2,8 @@
 /// @file SimpleRegisterAllocator.h
 /// @brief 简单或朴素的寄存器分配器
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>变量占用的寄存器记录在分配器内，不再写入Value
 /// </table>
 ///
 #pragma once
@@ -21,6 +22,10 @@
 #include "Value.h"
 #include "PlatformArm32.h"
 
+///
+/// @brief 简单的寄存器分配器，变量占用的寄存器只记录在分配器内，
+/// 不同函数各用一个分配器时可并行分配，全局变量、常量等共用的Value不会被修改
+///
 class SimpleRegisterAllocator {
 
 public:
@@ -57,12 +62,27 @@ public:
     void free(int32_t);
 
 protected:
+    ///
+    /// @brief 变量及其占用的Load寄存器
+    ///
+    struct RegValue {
+        Value * var;
+        int32_t no;
+    };
+
     ///
     /// @brief 寄存器被置位，使用过的寄存器被置位
     /// @param no
     ///
     void bitmapSet(int32_t no);
 
+    ///
+    /// @brief 查找变量占用的寄存器
+    /// @param var 变量
+    /// @return 变量在regValues中的位置，没有占用时为end()
+    ///
+    std::vector<RegValue>::iterator find(Value * var);
+
 protected:
     ///
     /// @brief 寄存器位图：1已被占用，0未被使用
@@ -72,7 +92,7 @@ protected:
     ///
     /// @brief 寄存器被那个Value占用。按照时间次序加入
     ///
-    std::vector<Value *> regValues;
+    std::vector<RegValue> regValues;
 
     ///
     /// @brief 使用过的所有寄存器编号
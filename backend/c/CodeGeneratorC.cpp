@@ -0,0 +1,536 @@
+///
+/// @file CodeGeneratorC.cpp
+/// @brief 把DragonIR翻译回可移植的C语言源文件，由宿主的C编译器编译执行
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include "Common.h"
+#include "CodeGeneratorC.h"
+#include "Function.h"
+#include "Module.h"
+
+#include "ArrayParameterType.h"
+#include "ArrayType.h"
+#include "PointerType.h"
+
+#include "ConstInt.h"
+#include "GlobalVariable.h"
+
+#include "BranchInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+
+/// @brief 值是否为数组形参或其对应的局部变量，保存的是数组的地址
+/// @param type 值的类型
+/// @return true：是地址
+static bool isPointerValue(const Type * type)
+{
+    if (type->isPointerType() || type->isArrayParameterType()) {
+        return true;
+    }
+
+    // 数组形参对应的局部变量，其第一维为0
+    Instanceof(arrayType, const ArrayType *, type);
+
+    return arrayType && (arrayType->getDimensionCount() > 0) && (arrayType->getDimensionSize(0) == 0);
+}
+
+/// @brief 值是否是数组本身，其值为数组的首地址
+/// @param type 值的类型
+/// @return true：是数组
+static bool isArrayStorage(const Type * type)
+{
+    return type->isArrayType() && !isPointerValue(type);
+}
+
+/// @brief 构造函数
+/// @param _module 符号表
+CodeGeneratorC::CodeGeneratorC(Module * _module) : CodeGenerator(_module)
+{}
+
+/// @brief 产生C语言源文件
+/// @return true：成功，false：有不能翻译的指令
+bool CodeGeneratorC::run()
+{
+    fprintf(fp, "/* %s: DragonIR translated to C */\n\n", module->getName().c_str());
+
+    for (auto var: module->getGlobalVariables()) {
+        globalNames.insert(var->getName());
+    }
+    for (auto func: module->getFunctionList()) {
+        globalNames.insert(func->getName());
+    }
+
+    genPrototypes();
+
+    genGlobals();
+
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        if (!genFunction(func)) {
+            return false;
+        }
+
+        fputs(body.c_str(), fp);
+    }
+
+    return true;
+}
+
+/// @brief 函数的声明，内置函数与用户函数都在文件开头声明
+void CodeGeneratorC::genPrototypes()
+{
+    for (auto func: module->getFunctionList()) {
+        fprintf(fp, "%s;\n", funcHeader(func, false).c_str());
+    }
+
+    fprintf(fp, "\n");
+}
+
+/// @brief 全局变量的定义，与汇编输出一致只有标量有初值
+void CodeGeneratorC::genGlobals()
+{
+    for (auto var: module->getGlobalVariables()) {
+
+        std::string str = declare(var->getType(), var->getName());
+
+        if (Instanceof(constVal, ConstInt *, var->getInitializer())) {
+            if (!isArrayStorage(var->getType())) {
+                str += " = " + operand(constVal);
+            }
+        }
+
+        fprintf(fp, "%s;\n", str.c_str());
+    }
+
+    if (!module->getGlobalVariables().empty()) {
+        fprintf(fp, "\n");
+    }
+}
+
+/// @brief 函数的定义
+/// @param func 函数
+/// @return true：成功
+bool CodeGeneratorC::genFunction(Function * func)
+{
+    curFunc = func;
+    body.clear();
+    names.clear();
+    namedLabels.clear();
+    unnamedLabels.clear();
+    labelIndex = 0;
+
+    int32_t index = 0;
+    for (auto param: func->getParams()) {
+        names[param] = localName(param, "a", index++);
+    }
+
+    body = funcHeader(func, true) + "\n{\n";
+
+    // 局部变量与指令的结果都在函数开头声明
+    index = 0;
+    for (auto var: func->getVarValues()) {
+        std::string name = localName(var, "l", index++);
+        names[var] = name;
+        body += "    " + declare(var->getType(), name) + ";";
+        if (!var->getName().empty()) {
+            body += " /* " + var->getName() + " */";
+        }
+        body += "\n";
+    }
+
+    auto & insts = func->getInterCode().getInsts();
+
+    index = 0;
+    for (auto inst: insts) {
+        if (!inst->isDead() && inst->hasResultValue()) {
+            std::string name = localName(inst, "t", index++);
+            names[inst] = name;
+            body += "    " + declare(inst->getType(), name) + ";\n";
+        }
+    }
+
+    body += "\n";
+
+    for (auto inst: insts) {
+
+        if (inst->isDead()) {
+            continue;
+        }
+
+        if (showLinearIR) {
+            std::string str;
+            inst->toString(str);
+            if (!str.empty()) {
+                body += "    /* " + str + " */\n";
+            }
+        }
+
+        if (!genInst(inst)) {
+            return false;
+        }
+    }
+
+    // 没有exit指令时也能正常返回
+    if (!func->getReturnType()->isVoidType()) {
+        body += "    return 0;\n";
+    }
+
+    body += "}\n\n";
+
+    return true;
+}
+
+/// @brief 翻译一条指令
+/// @param inst 指令
+/// @return true：成功
+bool CodeGeneratorC::genInst(Instruction * inst)
+{
+    // 加减乘按无符号数进行，溢出时回绕
+    static const std::unordered_map<int, std::string> wrapOps = {
+        {(int) IRInstOperator::IRINST_OP_ADD_I, "+"},
+        {(int) IRInstOperator::IRINST_OP_SUB_I, "-"},
+        {(int) IRInstOperator::IRINST_OP_MUL_I, "*"},
+    };
+
+    static const std::unordered_map<int, std::string> binaryOps = {
+        {(int) IRInstOperator::IRINST_OP_DIV_I, "/"},
+        {(int) IRInstOperator::IRINST_OP_MOD_I, "%"},
+        {(int) IRInstOperator::IRINST_OP_AND_I, "&&"},
+        {(int) IRInstOperator::IRINST_OP_OR_I, "||"},
+        {(int) IRInstOperator::IRINST_OP_LT_I, "<"},
+        {(int) IRInstOperator::IRINST_OP_LE_I, "<="},
+        {(int) IRInstOperator::IRINST_OP_GT_I, ">"},
+        {(int) IRInstOperator::IRINST_OP_GE_I, ">="},
+        {(int) IRInstOperator::IRINST_OP_EQ_I, "=="},
+        {(int) IRInstOperator::IRINST_OP_NE_I, "!="},
+    };
+
+    std::string stmt;
+
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_ENTRY:
+        case IRInstOperator::IRINST_OP_ARG:
+            return true;
+
+        case IRInstOperator::IRINST_OP_LABEL: {
+            Instanceof(labelInst, LabelInstruction *, inst);
+            // 标签后必须有语句，函数末尾的标签也是如此
+            body += labelName(labelInst->getLabelName(), inst) + ":;\n";
+            return true;
+        }
+
+        case IRInstOperator::IRINST_OP_GOTO: {
+            Instanceof(gotoInst, GotoInstruction *, inst);
+            stmt = "goto " + labelName(gotoInst->getLabelName(), gotoInst->getTarget()) + ";";
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_BC: {
+            Instanceof(branchInst, BranchInstruction *, inst);
+            stmt = "if (" + operand(inst->getOperand(0)) + ") goto " + labelName(branchInst->getTrueLabelName()) +
+                   "; else goto " + labelName(branchInst->getFalseLabelName()) + ";";
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_EXIT: {
+            if (curFunc->getReturnType()->isVoidType() || (inst->getOperandsNum() == 0)) {
+                stmt = curFunc->getReturnType()->isVoidType() ? "return;" : "return 0;";
+            } else {
+                stmt = "return " + operand(inst->getOperand(0)) + ";";
+            }
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_ASSIGN: {
+            Value * dst = inst->getOperand(0);
+            Value * src = inst->getOperand(1);
+
+            if (dst->getType()->isPointerType() && !isPointerValue(src->getType())) {
+                // *%t = x
+                stmt = "*" + operand(dst) + " = " + operand(src) + ";";
+            } else {
+                std::string name = target(dst);
+                if (name.empty() || isArrayStorage(dst->getType())) {
+                    minic_log(LOG_ERROR, "函数(%s)中对数组整体赋值，不能翻译成C语言", curFunc->getName().c_str());
+                    return false;
+                }
+
+                if (src->getType()->isPointerType() && !isPointerValue(dst->getType())) {
+                    // x = *%t
+                    stmt = name + " = *" + operand(src) + ";";
+                } else {
+                    stmt = name + " = " + operand(src) + ";";
+                }
+            }
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_NEG_I:
+            stmt = target(inst) + " = (int) (0u - (unsigned) " + operand(inst->getOperand(0)) + ");";
+            break;
+
+        case IRInstOperator::IRINST_OP_NOT_I:
+            stmt = target(inst) + " = !" + operand(inst->getOperand(0)) + ";";
+            break;
+
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+        case IRInstOperator::IRINST_OP_MUL_I: {
+            Value * src1 = inst->getOperand(0);
+            Value * src2 = inst->getOperand(1);
+
+            if (inst->getType()->isPointerType()) {
+                // 地址计算，偏移为字节数
+                if (!isPointerValue(src1->getType()) && !isArrayStorage(src1->getType())) {
+                    std::swap(src1, src2);
+                }
+                stmt = target(inst) + " = (" + valueType(inst->getType()) + ") ((char *) " + operand(src1) + " " +
+                       wrapOps.at((int) inst->getOp()) + " " + operand(src2) + ");";
+            } else {
+                stmt = target(inst) + " = (int) ((unsigned) " + operand(src1) + " " + wrapOps.at((int) inst->getOp()) +
+                       " (unsigned) " + operand(src2) + ");";
+            }
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+        case IRInstOperator::IRINST_OP_AND_I:
+        case IRInstOperator::IRINST_OP_OR_I:
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I:
+            stmt = target(inst) + " = " + operand(inst->getOperand(0)) + " " + binaryOps.at((int) inst->getOp()) +
+                   " " + operand(inst->getOperand(1)) + ";";
+            break;
+
+        case IRInstOperator::IRINST_OP_GEP: {
+            // 按C的数组下标取元素的地址，数组形参先转换成指向数组的指针
+            Value * base = inst->getOperand(0);
+            std::string array;
+
+            if (isArrayStorage(base->getType())) {
+                array = target(base);
+            } else if (Instanceof(paramType, ArrayParameterType *, base->getType())) {
+                std::string dims;
+                for (size_t k = 1; k < paramType->getDimensionSizes().size(); k++) {
+                    dims += "[" + std::to_string(paramType->getDimensionSizes()[k]) + "]";
+                }
+                array = dims.empty() ? operand(base) : ("((int (*)" + dims + ") " + operand(base) + ")");
+            } else if (Instanceof(arrayType, ArrayType *, base->getType())) {
+                std::string dims;
+                for (int32_t k = 1; k < arrayType->getDimensionCount(); k++) {
+                    dims += "[" + std::to_string(arrayType->getDimensionSize(k)) + "]";
+                }
+                array = dims.empty() ? operand(base) : ("((int (*)" + dims + ") " + operand(base) + ")");
+            } else {
+                array = operand(base);
+            }
+
+            for (int32_t k = 1; k < inst->getOperandsNum(); k++) {
+                array += "[" + operand(inst->getOperand(k)) + "]";
+            }
+
+            stmt = target(inst) + " = (" + valueType(inst->getType()) + ") &" + array + ";";
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_FUNC_CALL: {
+            Instanceof(callInst, FuncCallInstruction *, inst);
+
+            std::string call = callInst->getCalledName() + "(";
+            for (int32_t k = 0; k < callInst->getOperandsNum(); k++) {
+                call += (k > 0 ? ", " : "") + operand(callInst->getOperand(k));
+            }
+            call += ")";
+
+            stmt = callInst->hasResultValue() ? (target(inst) + " = " + call + ";") : (call + ";");
+            break;
+        }
+
+        default:
+            minic_log(LOG_ERROR,
+                      "函数(%s)中的指令(%d)不能翻译成C语言",
+                      curFunc->getName().c_str(),
+                      (int) inst->getOp());
+            return false;
+    }
+
+    body += "    " + stmt + "\n";
+
+    return true;
+}
+
+/// @brief 获取函数头，不含末尾的分号或者函数体
+/// @param func 函数
+/// @param withNames 形参是否带名字
+/// @return 函数头
+std::string CodeGeneratorC::funcHeader(Function * func, bool withNames)
+{
+    std::string str = valueType(func->getReturnType()) + " " + func->getName() + "(";
+
+    auto & params = func->getParams();
+    if (params.empty()) {
+        str += "void";
+    }
+
+    for (size_t k = 0; k < params.size(); k++) {
+        if (k > 0) {
+            str += ", ";
+        }
+        str += withNames ? declare(params[k]->getType(), names[params[k]]) : valueType(params[k]->getType());
+    }
+
+    return str + ")";
+}
+
+/// @brief 获取值的C类型，数组的值为首元素的指针
+/// @param type DragonIR的类型
+/// @return C的类型
+std::string CodeGeneratorC::valueType(Type * type)
+{
+    if (Instanceof(arrayType, ArrayType *, type)) {
+        return valueType(arrayType->getElementType()) + " *";
+    } else if (Instanceof(paramType, ArrayParameterType *, type)) {
+        return valueType(paramType->getElementType()) + " *";
+    } else if (Instanceof(ptrType, PointerType *, type)) {
+        return valueType(const_cast<Type *>(ptrType->getPointeeType())) + " *";
+    } else if (type->isVoidType()) {
+        return "void";
+    }
+
+    // i1与i32都用int表示
+    return "int";
+}
+
+/// @brief 获取变量的声明，数组按C的数组声明
+/// @param type DragonIR的类型
+/// @param name 变量名
+/// @return 声明的文本
+std::string CodeGeneratorC::declare(Type * type, const std::string & name)
+{
+    if (isArrayStorage(type)) {
+        Instanceof(arrayType, ArrayType *, type);
+
+        std::string str = valueType(arrayType->getElementType()) + " " + name;
+        for (auto dim: arrayType->getDimensions()) {
+            str += "[" + std::to_string(dim) + "]";
+        }
+
+        return str;
+    }
+
+    return valueType(type) + " " + name;
+}
+
+/// @brief 获取值作为操作数的表达式
+/// @param val 值
+/// @return 表达式
+std::string CodeGeneratorC::operand(Value * val)
+{
+    if (Instanceof(constVal, ConstInt *, val)) {
+        int32_t num = constVal->getVal();
+        if (num == INT32_MIN) {
+            return "(-2147483647 - 1)";
+        }
+        return (num < 0) ? ("(" + std::to_string(num) + ")") : std::to_string(num);
+    }
+
+    std::string name = target(val);
+    if (name.empty()) {
+        return "0";
+    }
+
+    // 数组的值为首元素的地址，多维数组需要转换
+    if (isArrayStorage(val->getType())) {
+        return "(" + valueType(val->getType()) + ") " + name;
+    }
+
+    return name;
+}
+
+/// @brief 获取赋值目标的名字
+/// @param val 值
+/// @return 名字，没有名字时为空串
+std::string CodeGeneratorC::target(Value * val)
+{
+    if (Instanceof(globalVar, GlobalVariable *, val)) {
+        return globalVar->getName();
+    }
+
+    auto pIter = names.find(val);
+
+    return (pIter != names.end()) ? pIter->second : "";
+}
+
+/// @brief 获取不与全局变量、函数重名的局部名字，IR已命名时沿用IR的名字
+/// @param val 形参、局部变量或者指令
+/// @param prefix 前缀
+/// @param index 编号
+/// @return 名字
+std::string CodeGeneratorC::localName(Value * val, const std::string & prefix, int32_t index)
+{
+    std::string irName = val->getIRName();
+    std::string name = (irName.size() > 1) ? irName.substr(1) : (prefix + std::to_string(index));
+
+    while (globalNames.count(name)) {
+        name += "_";
+    }
+
+    return name;
+}
+
+/// @brief 获取标签的名字
+/// @param name DragonIR中的标签名
+/// @param inst 标签指令，没有名字时使用
+/// @return C的标签名
+std::string CodeGeneratorC::labelName(std::string_view name, Instruction * inst)
+{
+    std::string key(name);
+
+    if (key.empty() && inst) {
+        Instanceof(labelInst, LabelInstruction *, inst);
+        if (labelInst) {
+            key = labelInst->getLabel() == 0 ? labelInst->getIRName() : std::string(labelInst->getLabelName());
+        }
+    }
+
+    // 标签与变量的名字空间不同，不会与局部变量冲突。有名字的标签去掉开头的.，如.L7为L7
+    if (key.empty()) {
+        auto pIter = unnamedLabels.find(inst);
+        if (pIter == unnamedLabels.end()) {
+            pIter = unnamedLabels.emplace(inst, "L_" + std::to_string(labelIndex++)).first;
+        }
+        return pIter->second;
+    }
+
+    auto pIter = namedLabels.find(key);
+    if (pIter == namedLabels.end()) {
+        std::string name = (key[0] == '.') ? key.substr(1) : key;
+        pIter = namedLabels.emplace(key, name).first;
+    }
+
+    return pIter->second;
+}
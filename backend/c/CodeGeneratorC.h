@@ -0,0 +1,125 @@
+///
+/// @file CodeGeneratorC.h
+/// @brief 把DragonIR翻译回可移植的C语言源文件，由宿主的C编译器编译执行
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "CodeGenerator.h"
+#include "Instruction.h"
+
+/// @brief C语言源文件的产生器
+///
+/// 每条IR指令翻译成一条C语句：局部变量与指令的结果都是函数开头声明的显式临时变量，
+/// 标签与跳转翻译成C的标签与goto，数组翻译成C的数组。
+/// 地址计算的偏移为字节数，按char *进行；加减乘按无符号数进行，保持与其它后端一样的回绕语义，
+/// 避免宿主编译器按有符号溢出未定义进行优化。
+/// 内置函数只给出声明，与汇编输出一样链接时由std.c提供。
+class CodeGeneratorC : public CodeGenerator {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    CodeGeneratorC(Module * module);
+
+    /// @brief 析构函数
+    ~CodeGeneratorC() override = default;
+
+protected:
+    /// @brief 产生C语言源文件
+    /// @return true：成功，false：有不能翻译的指令
+    bool run() override;
+
+    /// @brief 函数的声明，内置函数与用户函数都在文件开头声明
+    void genPrototypes();
+
+    /// @brief 全局变量的定义
+    void genGlobals();
+
+    /// @brief 函数的定义
+    /// @param func 函数
+    /// @return true：成功
+    bool genFunction(Function * func);
+
+    /// @brief 翻译一条指令
+    /// @param inst 指令
+    /// @return true：成功
+    bool genInst(Instruction * inst);
+
+    /// @brief 获取函数头，不含末尾的分号或者函数体
+    /// @param func 函数
+    /// @param withNames 形参是否带名字
+    /// @return 函数头
+    std::string funcHeader(Function * func, bool withNames);
+
+    /// @brief 获取值的C类型，数组的值为首元素的指针
+    /// @param type DragonIR的类型
+    /// @return C的类型
+    static std::string valueType(Type * type);
+
+    /// @brief 获取变量的声明，数组按C的数组声明
+    /// @param type DragonIR的类型
+    /// @param name 变量名
+    /// @return 声明的文本
+    static std::string declare(Type * type, const std::string & name);
+
+    /// @brief 获取值作为操作数的表达式
+    /// @param val 值
+    /// @return 表达式
+    std::string operand(Value * val);
+
+    /// @brief 获取赋值目标的名字
+    /// @param val 值
+    /// @return 名字，没有名字时为空串
+    std::string target(Value * val);
+
+    /// @brief 获取不与全局变量、函数重名的局部名字，IR已命名时沿用IR的名字
+    /// @param val 形参、局部变量或者指令
+    /// @param prefix 前缀
+    /// @param index 编号
+    /// @return 名字
+    std::string localName(Value * val, const std::string & prefix, int32_t index);
+
+    /// @brief 获取标签的名字
+    /// @param name DragonIR中的标签名
+    /// @param inst 标签指令，没有名字时使用
+    /// @return C的标签名
+    std::string labelName(std::string_view name, Instruction * inst = nullptr);
+
+private:
+    /// @brief 当前函数
+    Function * curFunc = nullptr;
+
+    /// @brief 函数体的文本
+    std::string body;
+
+    /// @brief 形参、局部变量与指令结果的名字
+    std::unordered_map<Value *, std::string> names;
+
+    /// @brief 有名字的标签
+    std::unordered_map<std::string, std::string> namedLabels;
+
+    /// @brief 没有名字的标签
+    std::unordered_map<Instruction *, std::string> unnamedLabels;
+
+    /// @brief 全局变量与函数的名字，局部名字不能与之相同
+    std::unordered_set<std::string> globalNames;
+
+    /// @brief 标签的编号
+    int32_t labelIndex = 0;
+};
@@ -0,0 +1,775 @@
+///
+/// @file CodeGeneratorLlvm.cpp
+/// @brief 把DragonIR翻译成文本形式的LLVM IR，可交给llc、lli或clang继续处理
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include "Common.h"
+#include "CodeGeneratorLlvm.h"
+#include "Function.h"
+#include "Module.h"
+
+#include "ArrayParameterType.h"
+#include "ArrayType.h"
+#include "PointerType.h"
+
+#include "ConstInt.h"
+#include "GlobalVariable.h"
+
+#include "BranchInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+
+/// @brief 值是否为数组形参或其对应的局部变量，保存的是数组的地址
+/// @param type 值的类型
+/// @return true：是地址
+static bool isPointerValue(const Type * type)
+{
+    if (type->isPointerType() || type->isArrayParameterType()) {
+        return true;
+    }
+
+    // 数组形参对应的局部变量，其第一维为0
+    Instanceof(arrayType, const ArrayType *, type);
+
+    return arrayType && (arrayType->getDimensionCount() > 0) && (arrayType->getDimensionSize(0) == 0);
+}
+
+/// @brief 值是否是数组本身，其值为数组的首地址
+/// @param type 值的类型
+/// @return true：是数组
+static bool isArrayStorage(const Type * type)
+{
+    return type->isArrayType() && !isPointerValue(type);
+}
+
+/// @brief LLVM类型是否为指针
+/// @param type LLVM类型
+/// @return true：是指针
+static bool isPointerText(const std::string & type)
+{
+    return !type.empty() && (type.back() == '*');
+}
+
+/// @brief 去掉指针类型末尾的*
+/// @param type LLVM的指针类型
+/// @return 指向的类型
+static std::string pointeeText(const std::string & type)
+{
+    return type.substr(0, type.size() - 1);
+}
+
+/// @brief 由数组的若干维构造LLVM的数组类型
+/// @param dims 各维的大小
+/// @param from 开始的维
+/// @param elem 元素的LLVM类型
+/// @return LLVM类型，没有剩余的维时为元素类型
+static std::string nestedArray(const std::vector<int32_t> & dims, size_t from, const std::string & elem)
+{
+    std::string str = elem;
+
+    for (size_t k = dims.size(); k > from; k--) {
+        str = "[" + std::to_string(dims[k - 1]) + " x " + str + "]";
+    }
+
+    return str;
+}
+
+/// @brief 构造函数
+/// @param _module 符号表
+CodeGeneratorLlvm::CodeGeneratorLlvm(Module * _module) : CodeGenerator(_module)
+{}
+
+/// @brief 产生LLVM IR文件
+/// @return true：成功，false：有不能翻译的指令
+bool CodeGeneratorLlvm::run()
+{
+    fprintf(fp, "; ModuleID = '%s'\n", module->getName().c_str());
+    fprintf(fp, "source_filename = \"%s\"\n\n", module->getName().c_str());
+
+    genGlobals();
+
+    for (auto func: module->getFunctionList()) {
+
+        if (func->isBuiltin()) {
+            continue;
+        }
+
+        if (!genFunction(func)) {
+            return false;
+        }
+
+        fputs(body.c_str(), fp);
+    }
+
+    genDeclarations();
+
+    return true;
+}
+
+/// @brief 全局变量的定义，与汇编输出一致只有标量有初值
+void CodeGeneratorLlvm::genGlobals()
+{
+    for (auto var: module->getGlobalVariables()) {
+
+        std::string init;
+
+        if (isArrayStorage(var->getType())) {
+            init = storageType(var->getType()) + " zeroinitializer";
+        } else {
+            int32_t val = 0;
+            if (Instanceof(constVal, ConstInt *, var->getInitializer())) {
+                val = constVal->getVal();
+            }
+            init = valueType(var->getType()) + " " + std::to_string(val);
+        }
+
+        fprintf(fp, "@%s = global %s, align %d\n", var->getName().c_str(), init.c_str(), var->getAlignment());
+    }
+
+    if (!module->getGlobalVariables().empty()) {
+        fprintf(fp, "\n");
+    }
+}
+
+/// @brief 内置函数的声明
+void CodeGeneratorLlvm::genDeclarations()
+{
+    for (auto func: module->getFunctionList()) {
+
+        if (!func->isBuiltin()) {
+            continue;
+        }
+
+        std::string str = "declare " + valueType(func->getReturnType()) + " @" + func->getName() + "(";
+
+        bool first = true;
+        for (auto param: func->getParams()) {
+            if (!first) {
+                str += ", ";
+            }
+            first = false;
+            str += valueType(param->getType());
+        }
+
+        fprintf(fp, "%s)\n", str.c_str());
+    }
+}
+
+/// @brief 函数的定义
+/// @param func 函数
+/// @return true：成功
+bool CodeGeneratorLlvm::genFunction(Function * func)
+{
+    curFunc = func;
+    body.clear();
+    regs.clear();
+    slots.clear();
+    namedLabels.clear();
+    unnamedLabels.clear();
+    assigned.clear();
+    tempIndex = 0;
+    terminated = false;
+
+    auto & insts = func->getInterCode().getInsts();
+
+    // 赋值的目标保存在栈中，指针赋值是store，不算在内
+    for (auto inst: insts) {
+        if (!inst->isDead() && (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN)) {
+            Value * dst = inst->getOperand(0);
+            if (!(dst->getType()->isPointerType() && !isPointerValue(inst->getOperand(1)->getType()))) {
+                assigned.insert(dst);
+            }
+        }
+    }
+
+    std::string header = "define " + valueType(func->getReturnType()) + " @" + func->getName() + "(";
+    std::string allocas;
+
+    int32_t index = 0;
+    for (auto param: func->getParams()) {
+
+        std::string type = valueType(param->getType());
+        std::string name = "%a" + std::to_string(index);
+
+        if (index > 0) {
+            header += ", ";
+        }
+        header += type + " " + name;
+
+        if (assigned.count(param)) {
+            std::string slot = "%p" + std::to_string(index);
+            slots[param] = slot;
+            allocas += "  " + slot + " = alloca " + type + "\n";
+            allocas += "  store " + type + " " + name + ", " + type + "* " + slot + "\n";
+        } else {
+            regs[param] = name;
+        }
+
+        index++;
+    }
+
+    header += ") {\nentry:\n";
+
+    // 数组在栈中分配，其值为首元素的地址；标量及数组形参的副本在栈中保存
+    index = 0;
+    for (auto var: func->getVarValues()) {
+
+        std::string name = "%l" + std::to_string(index++);
+
+        if (isArrayStorage(var->getType())) {
+            std::string type = storageType(var->getType());
+            allocas += "  " + name + ".mem = alloca " + type + "\n";
+            allocas += "  " + name + " = bitcast " + type + "* " + name + ".mem to " + valueType(var->getType()) + "\n";
+            regs[var] = name;
+        } else {
+            allocas += "  " + name + " = alloca " + valueType(var->getType()) + "\n";
+            slots[var] = name;
+        }
+    }
+
+    // 指令的结果作为SSA值，被赋值的保存在栈中
+    index = 0;
+    for (auto inst: insts) {
+
+        if (inst->isDead() || !inst->hasResultValue()) {
+            continue;
+        }
+
+        std::string name = "%t" + std::to_string(index++);
+
+        if (assigned.count(inst)) {
+            allocas += "  " + name + " = alloca " + valueType(inst->getType()) + "\n";
+            slots[inst] = name;
+        } else {
+            regs[inst] = name;
+        }
+    }
+
+    body = header + allocas;
+
+    for (auto inst: insts) {
+
+        if (inst->isDead()) {
+            continue;
+        }
+
+        if (!genInst(inst)) {
+            return false;
+        }
+    }
+
+    // 没有exit指令时也能正常返回
+    if (!terminated) {
+        std::string retType = valueType(func->getReturnType());
+        terminate((retType == "void") ? "ret void" : ("ret " + retType + " 0"));
+    }
+
+    body += "}\n\n";
+
+    return true;
+}
+
+/// @brief 翻译一条指令
+/// @param inst 指令
+/// @return true：成功
+bool CodeGeneratorLlvm::genInst(Instruction * inst)
+{
+    static const std::unordered_map<int, std::string> binaryOps = {
+        {(int) IRInstOperator::IRINST_OP_ADD_I, "add"},
+        {(int) IRInstOperator::IRINST_OP_SUB_I, "sub"},
+        {(int) IRInstOperator::IRINST_OP_MUL_I, "mul"},
+        {(int) IRInstOperator::IRINST_OP_DIV_I, "sdiv"},
+        {(int) IRInstOperator::IRINST_OP_MOD_I, "srem"},
+        {(int) IRInstOperator::IRINST_OP_AND_I, "and"},
+        {(int) IRInstOperator::IRINST_OP_OR_I, "or"},
+    };
+
+    static const std::unordered_map<int, std::string> cmpOps = {
+        {(int) IRInstOperator::IRINST_OP_LT_I, "slt"},
+        {(int) IRInstOperator::IRINST_OP_LE_I, "sle"},
+        {(int) IRInstOperator::IRINST_OP_GT_I, "sgt"},
+        {(int) IRInstOperator::IRINST_OP_GE_I, "sge"},
+        {(int) IRInstOperator::IRINST_OP_EQ_I, "eq"},
+        {(int) IRInstOperator::IRINST_OP_NE_I, "ne"},
+    };
+
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_ENTRY:
+        case IRInstOperator::IRINST_OP_ARG:
+            break;
+
+        case IRInstOperator::IRINST_OP_LABEL: {
+            Instanceof(labelInst, LabelInstruction *, inst);
+            std::string label = labelName(labelInst->getLabelName(), inst);
+
+            // LLVM的基本块不能直接落入下一个基本块
+            if (!terminated) {
+                body += "  br label %" + label + "\n";
+            }
+            body += label + ":\n";
+            terminated = false;
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_GOTO: {
+            Instanceof(gotoInst, GotoInstruction *, inst);
+            terminate("br label %" + labelName(gotoInst->getLabelName(), gotoInst->getTarget()));
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_BC: {
+            Instanceof(branchInst, BranchInstruction *, inst);
+            std::string cond = use(inst->getOperand(0), "i1");
+            terminate("br i1 " + cond + ", label %" + labelName(branchInst->getTrueLabelName()) + ", label %" +
+                      labelName(branchInst->getFalseLabelName()));
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_EXIT: {
+            std::string retType = valueType(curFunc->getReturnType());
+            if ((retType == "void") || (inst->getOperandsNum() == 0)) {
+                terminate((retType == "void") ? "ret void" : ("ret " + retType + " 0"));
+            } else {
+                std::string val = use(inst->getOperand(0), retType);
+                terminate("ret " + retType + " " + val);
+            }
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_ASSIGN: {
+            Value * dst = inst->getOperand(0);
+            Value * src = inst->getOperand(1);
+
+            if (dst->getType()->isPointerType() && !isPointerValue(src->getType())) {
+                // *%t = x
+                std::string ptrType = valueType(dst->getType());
+                std::string addr = use(dst, ptrType);
+                std::string val = use(src, pointeeText(ptrType));
+                emit("store " + pointeeText(ptrType) + " " + val + ", " + ptrType + " " + addr);
+            } else if (src->getType()->isPointerType() && !isPointerValue(dst->getType())) {
+                // x = *%t
+                std::string ptrType = valueType(src->getType());
+                std::string addr = use(src, ptrType);
+                std::string reg = newTemp();
+                emit(reg + " = load " + pointeeText(ptrType) + ", " + ptrType + " " + addr);
+                if (!define(dst, reg, pointeeText(ptrType))) {
+                    return false;
+                }
+            } else {
+                std::string type = valueType(dst->getType());
+                if (!define(dst, use(src, type), type)) {
+                    return false;
+                }
+            }
+            break;
+        }
+
+        case IRInstOperator::IRINST_OP_NEG_I: {
+            std::string val = use(inst->getOperand(0), "i32");
+            std::string reg = result(inst);
+            emit(reg + " = sub i32 0, " + val);
+            return define(inst, reg, "i32");
+        }
+
+        case IRInstOperator::IRINST_OP_NOT_I: {
+            std::string val = use(inst->getOperand(0), "i1");
+            std::string reg = (valueType(inst->getType()) == "i1") ? result(inst) : newTemp();
+            emit(reg + " = xor i1 " + val + ", true");
+            return define(inst, reg, "i1");
+        }
+
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+        case IRInstOperator::IRINST_OP_AND_I:
+        case IRInstOperator::IRINST_OP_OR_I: {
+            // 结果为指针时是地址计算
+            if (inst->getType()->isPointerType()) {
+                return genPointerArith(inst);
+            }
+
+            std::string type = valueType(inst->getType());
+            std::string src1 = use(inst->getOperand(0), type);
+            std::string src2 = use(inst->getOperand(1), type);
+            std::string reg = result(inst);
+            emit(reg + " = " + binaryOps.at((int) inst->getOp()) + " " + type + " " + src1 + ", " + src2);
+            return define(inst, reg, type);
+        }
+
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I: {
+            // 地址的比较按指针类型进行，其余按32位整数
+            std::string type = "i32";
+            for (int32_t k = 0; k < 2; k++) {
+                const Type * opType = inst->getOperand(k)->getType();
+                if (isPointerValue(opType) || isArrayStorage(opType)) {
+                    type = valueType(inst->getOperand(k)->getType());
+                }
+            }
+
+            std::string src1 = use(inst->getOperand(0), type);
+            std::string src2 = use(inst->getOperand(1), type);
+            std::string reg = (valueType(inst->getType()) == "i1") ? result(inst) : newTemp();
+            emit(reg + " = icmp " + cmpOps.at((int) inst->getOp()) + " " + type + " " + src1 + ", " + src2);
+            return define(inst, reg, "i1");
+        }
+
+        case IRInstOperator::IRINST_OP_GEP:
+            return genGetElementPtr(inst);
+
+        case IRInstOperator::IRINST_OP_FUNC_CALL: {
+            Instanceof(callInst, FuncCallInstruction *, inst);
+
+            Function * callee = module->findFunction(callInst->getCalledName());
+            if (!callee) {
+                minic_log(LOG_ERROR, "函数(%s)没有定义", callInst->getCalledName().c_str());
+                return false;
+            }
+
+            auto & params = callee->getParams();
+
+            std::string args;
+            for (int32_t k = 0; k < callInst->getOperandsNum(); k++) {
+                Value * arg = callInst->getOperand(k);
+                std::string type = valueType((k < (int32_t) params.size()) ? params[k]->getType() : arg->getType());
+                std::string val = use(arg, type);
+                args += (k > 0 ? ", " : "") + type + " " + val;
+            }
+
+            std::string retType = valueType(callee->getReturnType());
+            std::string call = "call " + retType + " @" + callee->getName() + "(" + args + ")";
+
+            if ((retType == "void") || !callInst->hasResultValue()) {
+                emit(call);
+            } else {
+                std::string reg = result(inst);
+                emit(reg + " = " + call);
+                return define(inst, reg, retType);
+            }
+            break;
+        }
+
+        default:
+            minic_log(LOG_ERROR,
+                      "函数(%s)中的指令(%d)不能翻译成LLVM IR",
+                      curFunc->getName().c_str(),
+                      (int) inst->getOp());
+            return false;
+    }
+
+    return true;
+}
+
+/// @brief 翻译指针加减，偏移为字节数，按i8类型进行getelementptr
+/// @param inst 加法或者减法指令
+/// @return true：成功
+bool CodeGeneratorLlvm::genPointerArith(Instruction * inst)
+{
+    Value * base = inst->getOperand(0);
+    Value * offset = inst->getOperand(1);
+
+    auto isAddress = [](Value * val) {
+        return isPointerValue(val->getType()) || isArrayStorage(val->getType());
+    };
+
+    if (!isAddress(base) && isAddress(offset) && (inst->getOp() == IRInstOperator::IRINST_OP_ADD_I)) {
+        std::swap(base, offset);
+    }
+
+    if (!isAddress(base) || ((inst->getOp() != IRInstOperator::IRINST_OP_ADD_I) &&
+                             (inst->getOp() != IRInstOperator::IRINST_OP_SUB_I))) {
+        minic_log(LOG_ERROR, "函数(%s)中的地址计算不能翻译成LLVM IR", curFunc->getName().c_str());
+        return false;
+    }
+
+    std::string baseType = valueType(base->getType());
+    std::string addr = convert(use(base, baseType), baseType, "i8*");
+    std::string bytes = use(offset, "i32");
+
+    if (inst->getOp() == IRInstOperator::IRINST_OP_SUB_I) {
+        std::string neg = newTemp();
+        emit(neg + " = sub i32 0, " + bytes);
+        bytes = neg;
+    }
+
+    std::string reg = newTemp();
+    emit(reg + " = getelementptr inbounds i8, i8* " + addr + ", i32 " + bytes);
+
+    return define(inst, reg, "i8*");
+}
+
+/// @brief 翻译getelementptr指令，索引按元素计数，数组本身先加上0号索引
+/// @param inst 指令
+/// @return true：成功
+bool CodeGeneratorLlvm::genGetElementPtr(Instruction * inst)
+{
+    Value * base = inst->getOperand(0);
+    const Type * baseType = base->getType();
+
+    std::vector<int32_t> dims;
+    std::string elem;
+    bool storage = isArrayStorage(baseType);
+
+    if (Instanceof(arrayType, const ArrayType *, baseType)) {
+        dims = arrayType->getDimensions();
+        elem = valueType(arrayType->getElementType());
+    } else if (Instanceof(paramType, const ArrayParameterType *, baseType)) {
+        dims = paramType->getDimensionSizes();
+        elem = valueType(paramType->getElementType());
+    } else if (baseType->isPointerType()) {
+        elem = pointeeText(valueType(base->getType()));
+    } else {
+        minic_log(LOG_ERROR, "函数(%s)中getelementptr的基址不是地址", curFunc->getName().c_str());
+        return false;
+    }
+
+    // 数组形参的第一维大小未知，按首元素的指针访问
+    size_t from = storage ? 0 : std::min<size_t>(1, dims.size());
+    std::string sourceType = nestedArray(dims, from, elem);
+
+    std::string ptrType = valueType(base->getType());
+    std::string addr = convert(use(base, ptrType), ptrType, sourceType + "*");
+
+    std::string indices = storage ? ", i32 0" : "";
+    int32_t indexCount = inst->getOperandsNum() - 1;
+    for (int32_t k = 1; k <= indexCount; k++) {
+        indices += ", i32 " + use(inst->getOperand(k), "i32");
+    }
+
+    // 结果的类型：除第一个索引外，每个索引去掉一维
+    size_t consumed = from + (size_t) indexCount - (storage ? 0 : 1);
+    std::string resultType = nestedArray(dims, std::min(consumed, dims.size()), elem) + "*";
+
+    std::string reg = newTemp();
+    emit(reg + " = getelementptr inbounds " + sourceType + ", " + sourceType + "* " + addr + indices);
+
+    return define(inst, reg, resultType);
+}
+
+/// @brief 获取值的LLVM类型，数组为其首元素的指针
+/// @param type DragonIR的类型
+/// @return LLVM的类型
+std::string CodeGeneratorLlvm::valueType(Type * type)
+{
+    if (Instanceof(arrayType, ArrayType *, type)) {
+        return valueType(arrayType->getElementType()) + "*";
+    } else if (Instanceof(paramType, ArrayParameterType *, type)) {
+        return valueType(paramType->getElementType()) + "*";
+    } else if (Instanceof(ptrType, PointerType *, type)) {
+        return valueType(const_cast<Type *>(ptrType->getPointeeType())) + "*";
+    } else if (type->isVoidType()) {
+        return "void";
+    } else if (type->isInt1Byte()) {
+        return "i1";
+    }
+
+    return "i32";
+}
+
+/// @brief 获取数组存储空间的LLVM类型
+/// @param type DragonIR的类型
+/// @return LLVM的类型，如[2 x [3 x i32]]
+std::string CodeGeneratorLlvm::storageType(Type * type)
+{
+    Instanceof(arrayType, ArrayType *, type);
+
+    return nestedArray(arrayType->getDimensions(), 0, valueType(arrayType->getElementType()));
+}
+
+/// @brief 读取值，必要时进行类型转换
+/// @param val 值
+/// @param type 需要的LLVM类型
+/// @return 操作数的文本
+std::string CodeGeneratorLlvm::use(Value * val, const std::string & type)
+{
+    if (Instanceof(constVal, ConstInt *, val)) {
+        if (type == "i1") {
+            return constVal->getVal() ? "true" : "false";
+        } else if (isPointerText(type)) {
+            return convert(std::to_string(constVal->getVal()), "i32", type);
+        }
+        return std::to_string(constVal->getVal());
+    }
+
+    std::string valType = valueType(val->getType());
+    std::string reg;
+
+    if (Instanceof(globalVar, GlobalVariable *, val)) {
+        if (isArrayStorage(val->getType())) {
+            // 常量表达式，全局数组的首元素地址
+            reg = "bitcast (" + storageType(val->getType()) + "* @" + globalVar->getName() + " to " + valType + ")";
+        } else {
+            reg = newTemp();
+            emit(reg + " = load " + valType + ", " + valType + "* @" + globalVar->getName());
+        }
+    } else if (slots.count(val)) {
+        reg = newTemp();
+        emit(reg + " = load " + valType + ", " + valType + "* " + slots[val]);
+    } else if (regs.count(val)) {
+        reg = regs[val];
+    } else {
+        return "undef";
+    }
+
+    return convert(reg, valType, type);
+}
+
+/// @brief 获取指令结果的名字，结果保存在栈中时为临时名字，之后由define写回
+/// @param val 指令或变量
+/// @return 名字
+std::string CodeGeneratorLlvm::result(Value * val)
+{
+    auto pIter = regs.find(val);
+
+    return (pIter != regs.end()) ? pIter->second : newTemp();
+}
+
+/// @brief 结果写到变量中
+/// @param val 指令或变量
+/// @param reg 结果所在的名字
+/// @param type 结果的LLVM类型
+/// @return true：成功，false：数组本身不能被赋值
+bool CodeGeneratorLlvm::define(Value * val, const std::string & reg, const std::string & type)
+{
+    std::string valType = valueType(val->getType());
+
+    if (isArrayStorage(val->getType())) {
+        minic_log(LOG_ERROR, "函数(%s)中对数组整体赋值，不能翻译成LLVM IR", curFunc->getName().c_str());
+        return false;
+    }
+
+    if (Instanceof(globalVar, GlobalVariable *, val)) {
+        std::string src = convert(reg, type, valType);
+        emit("store " + valType + " " + src + ", " + valType + "* @" + globalVar->getName());
+    } else if (slots.count(val)) {
+        std::string src = convert(reg, type, valType);
+        emit("store " + valType + " " + src + ", " + valType + "* " + slots[val]);
+    } else if (regs.count(val) && (regs[val] != reg)) {
+        // 类型不同的结果转换后以指令的名字定义
+        std::string name = regs[val];
+        if (type == valType) {
+            emit(name + " = bitcast " + type + " " + reg + " to " + valType);
+        } else if (type == "i1") {
+            emit(name + " = zext i1 " + reg + " to " + valType);
+        } else if (valType == "i1") {
+            emit(name + " = icmp ne " + type + " " + reg + ", " + (isPointerText(type) ? "null" : "0"));
+        } else if (isPointerText(type) && isPointerText(valType)) {
+            emit(name + " = bitcast " + type + " " + reg + " to " + valType);
+        } else if (isPointerText(type)) {
+            emit(name + " = ptrtoint " + type + " " + reg + " to " + valType);
+        } else {
+            emit(name + " = inttoptr " + type + " " + reg + " to " + valType);
+        }
+    }
+
+    return true;
+}
+
+/// @brief 类型转换
+/// @param reg 值
+/// @param from 值的LLVM类型
+/// @param to 需要的LLVM类型
+/// @return 转换后的值
+std::string CodeGeneratorLlvm::convert(const std::string & reg, const std::string & from, const std::string & to)
+{
+    if (from == to) {
+        return reg;
+    }
+
+    std::string tmp = newTemp();
+
+    if (from == "i1") {
+        emit(tmp + " = zext i1 " + reg + " to " + to);
+    } else if (to == "i1") {
+        emit(tmp + " = icmp ne " + from + " " + reg + ", " + (isPointerText(from) ? "null" : "0"));
+    } else if (isPointerText(from) && isPointerText(to)) {
+        emit(tmp + " = bitcast " + from + " " + reg + " to " + to);
+    } else if (isPointerText(from)) {
+        emit(tmp + " = ptrtoint " + from + " " + reg + " to " + to);
+    } else {
+        emit(tmp + " = inttoptr " + from + " " + reg + " to " + to);
+    }
+
+    return tmp;
+}
+
+/// @brief 获取标签的名字
+/// @param name DragonIR中的标签名
+/// @param target 标签指令，没有名字时使用
+/// @return LLVM的标签名
+std::string CodeGeneratorLlvm::labelName(std::string_view name, Instruction * target)
+{
+    std::string key(name);
+
+    if (key.empty() && target) {
+        Instanceof(labelInst, LabelInstruction *, target);
+        if (labelInst) {
+            key = labelInst->getLabelName();
+        }
+    }
+
+    if (key.empty()) {
+        auto pIter = unnamedLabels.find(target);
+        if (pIter == unnamedLabels.end()) {
+            pIter = unnamedLabels.emplace(target, "L" + std::to_string(tempIndex++)).first;
+        }
+        return pIter->second;
+    }
+
+    auto pIter = namedLabels.find(key);
+    if (pIter == namedLabels.end()) {
+        pIter = namedLabels.emplace(key, "L" + std::to_string(tempIndex++)).first;
+    }
+
+    return pIter->second;
+}
+
+/// @brief 新建一个临时值的名字
+/// @return 名字
+std::string CodeGeneratorLlvm::newTemp()
+{
+    return "%v" + std::to_string(tempIndex++);
+}
+
+/// @brief 输出一条指令，当前基本块已结束时先开始一个新的基本块
+/// @param line 指令文本
+void CodeGeneratorLlvm::emit(const std::string & line)
+{
+    // 跳转之后不可达的指令放到新的基本块中
+    if (terminated) {
+        body += "L" + std::to_string(tempIndex++) + ":\n";
+        terminated = false;
+    }
+
+    body += "  " + line + "\n";
+}
+
+/// @brief 输出基本块的结束指令
+/// @param line 指令文本
+void CodeGeneratorLlvm::terminate(const std::string & line)
+{
+    emit(line);
+    terminated = true;
+}
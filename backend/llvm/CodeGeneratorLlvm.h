@@ -0,0 +1,154 @@
+///
+/// @file CodeGeneratorLlvm.h
+/// @brief 把DragonIR翻译成文本形式的LLVM IR，可交给llc、lli或clang继续处理
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "CodeGenerator.h"
+#include "Instruction.h"
+
+/// @brief 文本LLVM IR的产生器，不依赖LLVM的库
+///
+/// 局部变量用alloca分配，读写时load/store，由LLVM的mem2reg提升为SSA形式；
+/// 指令的结果只定义一次，直接作为SSA值。指针类型的赋值翻译成load/store，
+/// 地址计算的偏移为字节数，按i8类型进行getelementptr。
+/// 指针采用LLVM 14及之前默认的带类型指针的写法，如i32*。
+/// 内置函数只给出声明，与汇编输出一样链接时由std.c提供。
+class CodeGeneratorLlvm : public CodeGenerator {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    CodeGeneratorLlvm(Module * module);
+
+    /// @brief 析构函数
+    ~CodeGeneratorLlvm() override = default;
+
+protected:
+    /// @brief 产生LLVM IR文件
+    /// @return true：成功，false：有不能翻译的指令
+    bool run() override;
+
+    /// @brief 全局变量的定义
+    void genGlobals();
+
+    /// @brief 内置函数的声明
+    void genDeclarations();
+
+    /// @brief 函数的定义
+    /// @param func 函数
+    /// @return true：成功
+    bool genFunction(Function * func);
+
+    /// @brief 翻译一条指令
+    /// @param inst 指令
+    /// @return true：成功
+    bool genInst(Instruction * inst);
+
+    /// @brief 翻译指针加减，偏移为字节数
+    /// @param inst 加法或者减法指令
+    /// @return true：成功
+    bool genPointerArith(Instruction * inst);
+
+    /// @brief 翻译getelementptr指令
+    /// @param inst 指令
+    /// @return true：成功
+    bool genGetElementPtr(Instruction * inst);
+
+    /// @brief 获取值的LLVM类型，数组为其首元素的指针
+    /// @param type DragonIR的类型
+    /// @return LLVM的类型
+    static std::string valueType(Type * type);
+
+    /// @brief 获取数组存储空间的LLVM类型
+    /// @param type DragonIR的类型
+    /// @return LLVM的类型，如[2 x [3 x i32]]
+    static std::string storageType(Type * type);
+
+    /// @brief 读取值，必要时进行类型转换
+    /// @param val 值
+    /// @param type 需要的LLVM类型
+    /// @return 操作数的文本
+    std::string use(Value * val, const std::string & type);
+
+    /// @brief 获取指令结果的名字，结果保存在栈中时为临时名字，之后由define写回
+    /// @param val 指令或变量
+    /// @return 名字
+    std::string result(Value * val);
+
+    /// @brief 结果写到变量中
+    /// @param val 指令或变量
+    /// @param reg 结果所在的名字，由result获取
+    /// @param type 结果的LLVM类型
+    /// @return true：成功，false：数组本身不能被赋值
+    bool define(Value * val, const std::string & reg, const std::string & type);
+
+    /// @brief 类型转换
+    /// @param reg 值
+    /// @param from 值的LLVM类型
+    /// @param to 需要的LLVM类型
+    /// @return 转换后的值
+    std::string convert(const std::string & reg, const std::string & from, const std::string & to);
+
+    /// @brief 获取标签的名字
+    /// @param name DragonIR中的标签名
+    /// @param target 标签指令，没有名字时使用
+    /// @return LLVM的标签名
+    std::string labelName(std::string_view name, Instruction * target = nullptr);
+
+    /// @brief 新建一个临时值的名字
+    /// @return 名字
+    std::string newTemp();
+
+    /// @brief 输出一条指令，当前基本块已结束时先开始一个新的基本块
+    /// @param line 指令文本
+    void emit(const std::string & line);
+
+    /// @brief 输出基本块的结束指令
+    /// @param line 指令文本
+    void terminate(const std::string & line);
+
+private:
+    /// @brief 当前函数
+    Function * curFunc = nullptr;
+
+    /// @brief 函数体的文本
+    std::string body;
+
+    /// @brief 直接作为SSA值的指令结果及形参的名字
+    std::unordered_map<Value *, std::string> regs;
+
+    /// @brief 保存在栈中的变量，值为alloca的地址
+    std::unordered_map<Value *, std::string> slots;
+
+    /// @brief 有名字的标签
+    std::unordered_map<std::string, std::string> namedLabels;
+
+    /// @brief 没有名字的标签
+    std::unordered_map<Instruction *, std::string> unnamedLabels;
+
+    /// @brief 作为赋值目标的值，需要保存在栈中
+    std::unordered_set<Value *> assigned;
+
+    /// @brief 临时值与标签的编号
+    int32_t tempIndex = 0;
+
+    /// @brief 当前基本块是否已经结束
+    bool terminated = false;
+};
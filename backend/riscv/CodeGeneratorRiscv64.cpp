@@ -0,0 +1,296 @@
+///
+/// @file CodeGeneratorRiscv64.cpp
+/// @brief RISC-V 64位的后端处理实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Function.h"
+#include "Module.h"
+#include "PlatformRiscv64.h"
+#include "CodeGeneratorRiscv64.h"
+#include "InstSelectorRiscv64.h"
+#include "ILocRiscv64.h"
+#include "LinearScanRegisterAllocator.h"
+
+/// @brief 构造函数
+/// @param tab 符号表
+CodeGeneratorRiscv64::CodeGeneratorRiscv64(Module * _module) : CodeGeneratorAsm(_module)
+{}
+
+/// @brief 析构函数
+CodeGeneratorRiscv64::~CodeGeneratorRiscv64()
+{}
+
+/// @brief 产生汇编头部分
+void CodeGeneratorRiscv64::genHeader()
+{
+    // la展开为pc相对寻址，可链接为位置无关的可执行程序
+    fprintf(fp, "%s\n", ".option nopic");
+}
+
+/// @brief 全局变量Section，主要包含初始化的和未初始化过的
+void CodeGeneratorRiscv64::genDataSection()
+{
+    // 生成代码段
+    fprintf(fp, ".text\n");
+
+    // 与ARM32一样，全局变量分为BSS段、.data段与.rodata段三种情况
+    collectWrittenGlobals();
+
+    std::vector<GlobalVariable *> dataVars;
+    std::vector<GlobalVariable *> rodataVars;
+    std::vector<int32_t> words;
+
+    for (auto var: module->getGlobalVariables()) {
+
+        getInitWords(var, words);
+        bool allZero = std::all_of(words.begin(), words.end(), [](int32_t word) { return word == 0; });
+
+        if (var->isInBSSSection() || allZero) {
+
+            // 在BSS段的全局变量，可以包含初值全是0的变量
+            fprintf(fp, ".comm %s, %d, %d\n", var->getName().c_str(), var->getType()->getSize(), var->getAlignment());
+        } else if (writtenGlobals.count(var)) {
+            dataVars.push_back(var);
+        } else {
+            rodataVars.push_back(var);
+        }
+    }
+
+    if (!dataVars.empty()) {
+        fprintf(fp, ".data\n");
+        for (auto var: dataVars) {
+            genGlobalVarData(var);
+        }
+    }
+
+    if (!rodataVars.empty()) {
+        fprintf(fp, ".section .rodata\n");
+        for (auto var: rodataVars) {
+            genGlobalVarData(var);
+        }
+    }
+
+    // 函数在代码段
+    if (!dataVars.empty() || !rodataVars.empty()) {
+        fprintf(fp, ".text\n");
+    }
+}
+
+/// @brief 输出有初值的全局变量的定义及初值，连续的0合并为.zero
+/// @param var 全局变量
+void CodeGeneratorRiscv64::genGlobalVarData(GlobalVariable * var)
+{
+    fprintf(fp, ".globl %s\n", var->getName().c_str());
+    fprintf(fp, ".balign %d\n", var->getAlignment());
+    fprintf(fp, ".type %s, @object\n", var->getName().c_str());
+    fprintf(fp, ".size %s, %d\n", var->getName().c_str(), var->getType()->getSize());
+    fprintf(fp, "%s:\n", var->getName().c_str());
+
+    std::vector<int32_t> words;
+    getInitWords(var, words);
+
+    for (size_t k = 0; k < words.size();) {
+
+        if (words[k] == 0) {
+            // .zero 400
+            size_t end = k;
+            while ((end < words.size()) && (words[end] == 0)) {
+                end++;
+            }
+
+            fprintf(fp, "\t.zero %d\n", (int) (end - k) * 4);
+            k = end;
+        } else {
+            // .word 100
+            fprintf(fp, "\t.word %d\n", words[k]);
+            k++;
+        }
+    }
+}
+
+/// @brief 针对函数进行汇编指令生成，放到.text代码段中
+/// @param func 要处理的函数
+void CodeGeneratorRiscv64::genCodeSection(Function * func)
+{
+    // 寄存器分配以及栈内变量的地址分配
+    registerAllocation(func);
+
+    // 获取函数的指令列表
+    std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
+
+    // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
+    for (auto inst: IrInsts) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            inst->setName(IR_LABEL_PREFIX + std::to_string(labelIndex++));
+        }
+    }
+
+    // ILOC代码序列
+    ILocRiscv64 iloc(module);
+
+    // 指令选择生成汇编指令
+    InstSelectorRiscv64 instSelector(IrInsts, iloc, func, savedRegs, savedAreaOffset);
+    instSelector.setShowLinearIR(this->showLinearIR);
+    instSelector.run();
+
+    // 删除无用的Label指令
+    iloc.deleteUnusedLabel();
+
+    // ILOC代码输出为汇编代码
+    fprintf(fp, ".p2align 2\n");
+    fprintf(fp, ".globl %s\n", func->getName().c_str());
+    fprintf(fp, ".type %s, @function\n", func->getName().c_str());
+    fprintf(fp, "%s:\n", func->getName().c_str());
+
+    // 开启时输出寄存器分配的结果作为注释
+    if (this->showLinearIR) {
+        auto showAlloc = [this](Value * val) {
+            if (val->getRegId() != -1) {
+                fprintf(fp,
+                        "\t# %s:%s\n",
+                        val->getIRName().c_str(),
+                        PlatformRiscv64::regName[val->getRegId()].c_str());
+            }
+        };
+
+        for (auto param: func->getParams()) {
+            showAlloc(param);
+        }
+
+        for (auto var: func->getVarValues()) {
+            showAlloc(var);
+        }
+
+        for (auto inst: IrInsts) {
+            if (inst->hasResultValue()) {
+                showAlloc(inst);
+            }
+        }
+    }
+
+    iloc.outPut(fp);
+
+    fprintf(fp, ".size %s, .-%s\n", func->getName().c_str(), func->getName().c_str());
+}
+
+/// @brief 寄存器分配
+/// @param func 函数指针
+void CodeGeneratorRiscv64::registerAllocation(Function * func)
+{
+    // 内置函数不需要处理
+    if (func->isBuiltin()) {
+        return;
+    }
+
+    // RISC-V有31个通用寄存器，形参、局部变量与临时变量通过线性扫描分配寄存器：
+    // (1) s0-s11可分配给任意的值，用到的在序言中保存
+    // (2) t3-t5可分配给不跨越函数调用的值
+    // (3) t0-t2、t6留给指令选择时的溢出值与地址计算，a0-a7只用于传参与返回值
+    LinearScanRegisterAllocator allocator(func);
+    allocator.run();
+
+    // 需要保护的寄存器
+    savedRegs.clear();
+    if (allocator.hasFuncCall()) {
+        savedRegs.push_back(RISCV_RA_REG_NO);
+    }
+
+    for (auto reg: allocator.getUsedCalleeSavedRegs()) {
+        savedRegs.push_back(reg);
+    }
+
+    func->getProtectedReg().clear();
+    for (auto reg: savedRegs) {
+        func->getProtectedReg().push_back(reg);
+    }
+
+    // 溢出的值与数组在栈内分配空间
+    stackAlloc(func, allocator);
+}
+
+/// @brief 栈空间分配，溢出的值与数组采用sp+非负偏移寻址
+/// @param func 要处理的函数
+/// @param allocator 寄存器分配的结果
+void CodeGeneratorRiscv64::stackAlloc(Function * func, const LinearScanRegisterAllocator & allocator)
+{
+    // 栈帧空间（低地址在前，高地址在后）
+    // --------------------- sp
+    // 栈传递的实参（第9个及之后），每个8字节
+    // ---------------------
+    // 保护寄存器的空间，每个8字节
+    // ---------------------
+    // 溢出的值、数组的空间
+    // --------------------- sp + frame
+    // 调用者通过栈传递的实参
+    // ---------------------
+
+    int32_t sp_esp = 0;
+
+    int maxFuncCallArgCnt = func->getMaxFuncCallArgCnt();
+    if (maxFuncCallArgCnt > PlatformRiscv64::maxArgRegNum) {
+        sp_esp += (maxFuncCallArgCnt - PlatformRiscv64::maxArgRegNum) * 8;
+    }
+
+    savedAreaOffset = sp_esp;
+    sp_esp += (int32_t) savedRegs.size() * 8;
+
+    // 按大小对齐后分配，返回非负偏移
+    auto alloc = [&sp_esp](Type * type) {
+        int32_t size = PlatformRiscv64::slotSize(type);
+        int32_t align = (size >= 8) ? 8 : 4;
+        int32_t offset = (sp_esp + align - 1) & ~(align - 1);
+        sp_esp = offset + size;
+        return offset;
+    };
+
+    auto & params = func->getParams();
+    auto isStackParam = [&params](Value * val) {
+        for (int k = PlatformRiscv64::maxArgRegNum; k < (int) params.size(); k++) {
+            if (params[k] == val) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // 溢出的值，栈传递的形参直接使用调用者栈中的空间
+    for (auto val: allocator.getSpilledValues()) {
+        if (!isStackParam(val)) {
+            val->setMemoryAddr(RISCV_SP_REG_NO, alloc(val->getType()));
+        }
+    }
+
+    // 数组
+    for (auto var: func->getVarValues()) {
+        if (PlatformRiscv64::isArrayStorage(var->getType())) {
+            var->setMemoryAddr(RISCV_SP_REG_NO, alloc(var->getType()));
+        }
+    }
+
+    // 栈按16字节对齐
+    sp_esp = (sp_esp + 15) & ~15;
+
+    func->setMaxDep(sp_esp);
+
+    for (int k = PlatformRiscv64::maxArgRegNum; k < (int) params.size(); k++) {
+        if (params[k]->getRegId() == -1) {
+            params[k]->setMemoryAddr(RISCV_SP_REG_NO, sp_esp + (k - PlatformRiscv64::maxArgRegNum) * 8);
+        }
+    }
+}
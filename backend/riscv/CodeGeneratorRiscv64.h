@@ -0,0 +1,64 @@
+///
+/// @file CodeGeneratorRiscv64.h
+/// @brief RISC-V 64位的后端处理头文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <vector>
+
+#include "CodeGeneratorAsm.h"
+#include "LinearScanRegisterAllocator.h"
+
+/// @brief RISC-V 64位（RV64IM）的后端，采用线性扫描寄存器分配
+class CodeGeneratorRiscv64 : public CodeGeneratorAsm {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    CodeGeneratorRiscv64(Module * module);
+
+    /// @brief 析构函数
+    ~CodeGeneratorRiscv64() override;
+
+protected:
+    /// @brief 产生汇编头部分
+    void genHeader() override;
+
+    /// @brief 全局变量Section，主要包含初始化的和未初始化过的
+    void genDataSection() override;
+
+    /// @brief 输出有初值的全局变量的定义及初值，连续的0合并为.zero
+    /// @param var 全局变量
+    void genGlobalVarData(GlobalVariable * var);
+
+    /// @brief 针对函数进行汇编指令生成，放到.text代码段中
+    /// @param func 要处理的函数
+    void genCodeSection(Function * func) override;
+
+    /// @brief 寄存器分配
+    /// @param func 要处理的函数
+    void registerAllocation(Function * func) override;
+
+    /// @brief 栈空间分配，溢出的值与数组采用sp+非负偏移寻址
+    /// @param func 要处理的函数
+    /// @param allocator 寄存器分配的结果
+    void stackAlloc(Function * func, const LinearScanRegisterAllocator & allocator);
+
+private:
+    /// @brief 当前函数需要在序言中保存的寄存器，含ra
+    std::vector<int> savedRegs;
+
+    /// @brief 保存寄存器区相对sp的偏移
+    int32_t savedAreaOffset = 0;
+};
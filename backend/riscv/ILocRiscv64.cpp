@@ -0,0 +1,268 @@
+///
+/// @file ILocRiscv64.cpp
+/// @brief RISC-V指令序列管理的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <unordered_set>
+
+#include "Common.h"
+#include "ILocRiscv64.h"
+#include "PlatformRiscv64.h"
+#include "GlobalVariable.h"
+
+/// @brief 构造函数
+/// @param _module 符号表-模块
+ILocRiscv64::ILocRiscv64(Module * _module) : module(_module)
+{}
+
+/// @brief 析构函数
+ILocRiscv64::~ILocRiscv64()
+{
+    for (auto inst: code) {
+        delete inst;
+    }
+}
+
+/// @brief 获取当前的代码序列
+/// @return 代码序列
+std::list<RiscvInst *> & ILocRiscv64::getCode()
+{
+    return code;
+}
+
+/// @brief 产生一条指令
+/// @param op 操作码
+/// @param rd 目的寄存器
+/// @param rs1 第一个源寄存器
+/// @param rs2 第二个源寄存器
+/// @param imm 立即数
+/// @return 新产生的指令
+RiscvInst * ILocRiscv64::inst(RiscvOp op, int rd, int rs1, int rs2, int32_t imm)
+{
+    RiscvInst * rv = new RiscvInst(op, rd, rs1, rs2, imm);
+    code.push_back(rv);
+    return rv;
+}
+
+/// @brief 注释指令
+/// @param str 注释内容
+void ILocRiscv64::comment(std::string str)
+{
+    inst(RiscvOp::COMMENT)->symbol = str;
+}
+
+/// @brief 标签指令
+/// @param name 标签名
+void ILocRiscv64::label(std::string name)
+{
+    inst(RiscvOp::LABEL)->symbol = name;
+}
+
+/// @brief 无条件跳转指令
+/// @param label 目标标签名
+void ILocRiscv64::jump(std::string label)
+{
+    inst(RiscvOp::J)->symbol = label;
+}
+
+/// @brief 寄存器不为0时跳转
+/// @param reg_no 条件寄存器
+/// @param label 目标标签名
+void ILocRiscv64::branch_nez(int reg_no, std::string label)
+{
+    inst(RiscvOp::BNEZ, -1, reg_no)->symbol = label;
+}
+
+/// @brief 函数调用指令
+/// @param name 函数名
+void ILocRiscv64::call_fun(std::string name)
+{
+    inst(RiscvOp::CALL)->symbol = name;
+}
+
+/// @brief 加载立即数，li会由汇编器展开为lui/addi等
+/// @param rd 目的寄存器
+/// @param num 立即数
+void ILocRiscv64::load_imm(int rd, int32_t num)
+{
+    if (num == 0) {
+        // mv rd,zero
+        inst(RiscvOp::MV, rd, RISCV_ZERO_REG_NO);
+    } else {
+        inst(RiscvOp::LI, rd, -1, -1, num);
+    }
+}
+
+/// @brief 寄存器间的复制，相同寄存器时不产生指令
+/// @param rd 目的寄存器
+/// @param rs 源寄存器
+void ILocRiscv64::mov_reg(int rd, int rs)
+{
+    if (rd != rs) {
+        inst(RiscvOp::MV, rd, rs);
+    }
+}
+
+/// @brief rd = rs + imm，立即数超出12位时借助t6
+/// @param rd 目的寄存器
+/// @param rs 源寄存器
+/// @param imm 立即数
+void ILocRiscv64::add_imm(int rd, int rs, int64_t imm)
+{
+    if (PlatformRiscv64::isImm12(imm)) {
+        // addi rd,rs,imm
+        inst(RiscvOp::ADDI, rd, rs, -1, (int32_t) imm);
+    } else {
+        // li t6,imm; add rd,rs,t6
+        load_imm(RISCV_TMP_REG_NO, (int32_t) imm);
+        inst(RiscvOp::ADD, rd, rs, RISCV_TMP_REG_NO);
+    }
+}
+
+/// @brief 基址寻址的读，偏移超出12位时借助t6
+/// @param rd 目的寄存器
+/// @param base_reg_no 基址寄存器
+/// @param disp 偏移
+/// @param wide true：ld读8字节，false：lw读4字节
+void ILocRiscv64::load_base(int rd, int base_reg_no, int64_t disp, bool wide)
+{
+    RiscvOp op = wide ? RiscvOp::LD : RiscvOp::LW;
+
+    if (PlatformRiscv64::isImm12(disp)) {
+        // lw rd,disp(base)
+        inst(op, rd, base_reg_no, -1, (int32_t) disp);
+    } else {
+        // li t6,disp; add t6,base,t6; lw rd,0(t6)
+        add_imm(RISCV_TMP_REG_NO, base_reg_no, disp);
+        inst(op, rd, RISCV_TMP_REG_NO);
+    }
+}
+
+/// @brief 基址寻址的写，偏移超出12位时借助t6
+/// @param rs 要保存的寄存器
+/// @param base_reg_no 基址寄存器
+/// @param disp 偏移
+/// @param wide true：sd写8字节，false：sw写4字节
+void ILocRiscv64::store_base(int rs, int base_reg_no, int64_t disp, bool wide)
+{
+    RiscvOp op = wide ? RiscvOp::SD : RiscvOp::SW;
+
+    if (PlatformRiscv64::isImm12(disp)) {
+        // sw rs,disp(base)
+        inst(op, -1, base_reg_no, rs, (int32_t) disp);
+    } else {
+        // li t6,disp; add t6,base,t6; sw rs,0(t6)
+        add_imm(RISCV_TMP_REG_NO, base_reg_no, disp);
+        inst(op, -1, RISCV_TMP_REG_NO, rs);
+    }
+}
+
+/// @brief 变量的值加载到寄存器：整数为32位符号扩展，指针为64位，数组则取其首地址
+/// @param rd 目的寄存器
+/// @param var 变量，可能已分配寄存器
+void ILocRiscv64::load_var(int rd, Value * var)
+{
+    bool wide = PlatformRiscv64::isPointerValue(var->getType());
+    int32_t base_reg_no;
+    int64_t offset;
+
+    if (Instanceof(constVal, ConstInt *, var)) {
+        // li rd,100
+        load_imm(rd, constVal->getVal());
+    } else if (var->getRegId() != -1) {
+        // mv rd,s1
+        mov_reg(rd, var->getRegId());
+    } else if (Instanceof(globalVar, GlobalVariable *, var)) {
+        // la rd,g 数组取地址即可，否则还要读取
+        inst(RiscvOp::LA, rd)->symbol = globalVar->getName();
+
+        if (!PlatformRiscv64::isArrayStorage(var->getType())) {
+            inst(wide ? RiscvOp::LD : RiscvOp::LW, rd, rd);
+        }
+    } else if (var->getMemoryAddr(&base_reg_no, &offset)) {
+        if (PlatformRiscv64::isArrayStorage(var->getType())) {
+            // addi rd,sp,off
+            add_imm(rd, base_reg_no, offset);
+        } else {
+            // lw rd,off(sp)
+            load_base(rd, base_reg_no, offset, wide);
+        }
+    } else {
+        minic_log(LOG_ERROR, "变量(%s)没有分配寄存器或栈空间", var->getIRName().c_str());
+    }
+}
+
+/// @brief 寄存器的值保存到变量中，宽度由变量类型决定
+/// @param rs 源寄存器
+/// @param var 变量，可能已分配寄存器
+void ILocRiscv64::store_var(int rs, Value * var)
+{
+    bool wide = PlatformRiscv64::isPointerValue(var->getType());
+    int32_t base_reg_no;
+    int64_t offset;
+
+    if (var->getRegId() != -1) {
+        // mv s1,rs
+        mov_reg(var->getRegId(), rs);
+    } else if (Instanceof(globalVar, GlobalVariable *, var)) {
+        // la t6,g; sw rs,0(t6)
+        inst(RiscvOp::LA, RISCV_TMP_REG_NO)->symbol = globalVar->getName();
+        inst(wide ? RiscvOp::SD : RiscvOp::SW, -1, RISCV_TMP_REG_NO, rs);
+    } else if (var->getMemoryAddr(&base_reg_no, &offset)) {
+        // sw rs,off(sp)
+        store_base(rs, base_reg_no, offset, wide);
+    } else {
+        minic_log(LOG_ERROR, "变量(%s)没有分配寄存器或栈空间", var->getIRName().c_str());
+    }
+}
+
+/// @brief 删除无用的Label指令
+void ILocRiscv64::deleteUnusedLabel()
+{
+    // 被跳转指令引用的标签
+    std::unordered_set<std::string> usedLabels;
+    for (RiscvInst * rv: code) {
+        if ((!rv->dead) && ((rv->opcode == RiscvOp::J) || (rv->opcode == RiscvOp::BNEZ))) {
+            usedLabels.insert(rv->symbol);
+        }
+    }
+
+    for (RiscvInst * rv: code) {
+        if ((!rv->dead) && rv->isLabel() && !usedLabels.count(rv->symbol)) {
+            rv->setDead();
+        }
+    }
+}
+
+/// @brief 输出汇编
+/// @param file 输出的文件指针
+/// @param outputEmpty 是否输出空语句
+void ILocRiscv64::outPut(FILE * file, bool outputEmpty)
+{
+    for (auto rv: code) {
+
+        std::string s = rv->outPut();
+
+        if (rv->isLabel() && !s.empty()) {
+            // Label指令，不需要Tab输出
+            fprintf(file, "%s\n", s.c_str());
+            continue;
+        }
+
+        if (!s.empty()) {
+            fprintf(file, "\t%s\n", s.c_str());
+        } else if ((outputEmpty)) {
+            fprintf(file, "\n");
+        }
+    }
+}
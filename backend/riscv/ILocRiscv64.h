@@ -0,0 +1,125 @@
+///
+/// @file ILocRiscv64.h
+/// @brief RISC-V指令序列管理的头文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdio>
+#include <list>
+#include <string>
+
+#include "RiscvInst.h"
+#include "Module.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+/// @brief 底层汇编序列-RISC-V
+class ILocRiscv64 {
+
+    /// @brief RISC-V汇编序列
+    std::list<RiscvInst *> code;
+
+    /// @brief 符号表
+    Module * module;
+
+public:
+    /// @brief 构造函数
+    /// @param _module 符号表-模块
+    ILocRiscv64(Module * _module);
+
+    /// @brief 析构函数
+    ~ILocRiscv64();
+
+    /// @brief 获取当前的代码序列
+    /// @return 代码序列
+    std::list<RiscvInst *> & getCode();
+
+    /// @brief 产生一条指令
+    /// @param op 操作码
+    /// @param rd 目的寄存器
+    /// @param rs1 第一个源寄存器
+    /// @param rs2 第二个源寄存器
+    /// @param imm 立即数
+    /// @return 新产生的指令
+    RiscvInst * inst(RiscvOp op, int rd = -1, int rs1 = -1, int rs2 = -1, int32_t imm = 0);
+
+    /// @brief 注释指令
+    /// @param str 注释内容
+    void comment(std::string str);
+
+    /// @brief 标签指令
+    /// @param name 标签名
+    void label(std::string name);
+
+    /// @brief 无条件跳转指令
+    /// @param label 目标标签名
+    void jump(std::string label);
+
+    /// @brief 寄存器不为0时跳转
+    /// @param reg_no 条件寄存器
+    /// @param label 目标标签名
+    void branch_nez(int reg_no, std::string label);
+
+    /// @brief 函数调用指令
+    /// @param name 函数名
+    void call_fun(std::string name);
+
+    /// @brief 加载立即数，li会由汇编器展开为lui/addi等
+    /// @param rd 目的寄存器
+    /// @param num 立即数
+    void load_imm(int rd, int32_t num);
+
+    /// @brief 寄存器间的复制，相同寄存器时不产生指令
+    /// @param rd 目的寄存器
+    /// @param rs 源寄存器
+    void mov_reg(int rd, int rs);
+
+    /// @brief rd = rs + imm，立即数超出12位时借助t6
+    /// @param rd 目的寄存器
+    /// @param rs 源寄存器
+    /// @param imm 立即数
+    void add_imm(int rd, int rs, int64_t imm);
+
+    /// @brief 基址寻址的读，偏移超出12位时借助t6
+    /// @param rd 目的寄存器
+    /// @param base_reg_no 基址寄存器
+    /// @param disp 偏移
+    /// @param wide true：ld读8字节，false：lw读4字节
+    void load_base(int rd, int base_reg_no, int64_t disp, bool wide);
+
+    /// @brief 基址寻址的写，偏移超出12位时借助t6
+    /// @param rs 要保存的寄存器
+    /// @param base_reg_no 基址寄存器
+    /// @param disp 偏移
+    /// @param wide true：sd写8字节，false：sw写4字节
+    void store_base(int rs, int base_reg_no, int64_t disp, bool wide);
+
+    /// @brief 变量的值加载到寄存器：整数为32位符号扩展，指针为64位，数组则取其首地址
+    /// @param rd 目的寄存器
+    /// @param var 变量，可能已分配寄存器
+    void load_var(int rd, Value * var);
+
+    /// @brief 寄存器的值保存到变量中，宽度由变量类型决定
+    /// @param rs 源寄存器
+    /// @param var 变量，可能已分配寄存器
+    void store_var(int rs, Value * var);
+
+    /// @brief 删除无用的Label指令
+    void deleteUnusedLabel();
+
+    /// @brief 输出汇编
+    /// @param file 输出的文件指针
+    /// @param outputEmpty 是否输出空语句
+    void outPut(FILE * file, bool outputEmpty = false);
+};
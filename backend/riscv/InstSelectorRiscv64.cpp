@@ -0,0 +1,507 @@
+///
+/// @file InstSelectorRiscv64.cpp
+/// @brief 指令选择器-RISC-V的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cstdio>
+
+#include "Common.h"
+#include "ILocRiscv64.h"
+#include "InstSelectorRiscv64.h"
+#include "PlatformRiscv64.h"
+
+#include "Function.h"
+
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "FuncCallInstruction.h"
+#include "BranchInstruction.h"
+
+/// @brief 构造函数
+/// @param _irCode 指令
+/// @param _iloc ILoc
+/// @param _func 函数
+/// @param _savedRegs 需要保存的寄存器
+/// @param _savedAreaOffset 保存寄存器区相对sp的偏移
+InstSelectorRiscv64::InstSelectorRiscv64(std::vector<Instruction *> & _irCode,
+                                         ILocRiscv64 & _iloc,
+                                         Function * _func,
+                                         const std::vector<int> & _savedRegs,
+                                         int32_t _savedAreaOffset)
+    : ir(_irCode), iloc(_iloc), func(_func), savedRegs(_savedRegs), savedAreaOffset(_savedAreaOffset)
+{
+    translator_handlers[IRInstOperator::IRINST_OP_ENTRY] = &InstSelectorRiscv64::translate_entry;
+    translator_handlers[IRInstOperator::IRINST_OP_EXIT] = &InstSelectorRiscv64::translate_exit;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LABEL] = &InstSelectorRiscv64::translate_label;
+    translator_handlers[IRInstOperator::IRINST_OP_GOTO] = &InstSelectorRiscv64::translate_goto;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ASSIGN] = &InstSelectorRiscv64::translate_assign;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_I] = &InstSelectorRiscv64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_SUB_I] = &InstSelectorRiscv64::translate_sub_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MUL_I] = &InstSelectorRiscv64::translate_mul_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_DIV_I] = &InstSelectorRiscv64::translate_div_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MOD_I] = &InstSelectorRiscv64::translate_mod_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NEG_I] = &InstSelectorRiscv64::translate_neg_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_GT_I] = &InstSelectorRiscv64::translate_gt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GE_I] = &InstSelectorRiscv64::translate_ge_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LT_I] = &InstSelectorRiscv64::translate_lt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LE_I] = &InstSelectorRiscv64::translate_le_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_EQ_I] = &InstSelectorRiscv64::translate_eq_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NE_I] = &InstSelectorRiscv64::translate_ne_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_BC] = &InstSelectorRiscv64::translate_bc;
+
+    translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorRiscv64::translate_call;
+
+    // 条件分支与按名字跳转的goto指令引用的是IR中的标签名，这里记录其对应的Label指令
+    for (auto inst: ir) {
+        if (Instanceof(labelInst, LabelInstruction *, inst)) {
+            if (labelInst->getLabel() != 0) {
+                labelInsts[labelInst->getLabel()] = labelInst;
+            }
+        }
+    }
+}
+
+///
+/// @brief 析构函数
+///
+InstSelectorRiscv64::~InstSelectorRiscv64()
+{}
+
+/// @brief 指令选择执行
+void InstSelectorRiscv64::run()
+{
+    for (auto inst: ir) {
+
+        // 逐个指令进行翻译
+        if (!inst->isDead()) {
+            translate(inst);
+        }
+    }
+}
+
+/// @brief 指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate(Instruction * inst)
+{
+    // 操作符
+    IRInstOperator op = inst->getOp();
+
+    auto pIter = translator_handlers.find(op);
+    if (pIter == translator_handlers.end()) {
+        // 没有找到，则说明当前不支持
+        minic_log(LOG_ERROR, "Translate: Operator(%d) not support", (int) op);
+        return;
+    }
+
+    // 开启时输出IR指令作为注释
+    if (showLinearIR) {
+        outputIRInstruction(inst);
+    }
+
+    (this->*(pIter->second))(inst);
+}
+
+///
+/// @brief 输出IR指令
+///
+void InstSelectorRiscv64::outputIRInstruction(Instruction * inst)
+{
+    std::string irStr;
+    inst->toString(irStr);
+    if (!irStr.empty()) {
+        iloc.comment(irStr);
+    }
+}
+
+///
+/// @brief 根据IR中的标签名称获取汇编中的标签名
+/// @param irLabel IR标签名称
+/// @return std::string 汇编标签名
+///
+std::string InstSelectorRiscv64::getAsmLabel(Symbol irLabel)
+{
+    auto pIter = labelInsts.find(irLabel);
+    if (pIter == labelInsts.end()) {
+        minic_log(LOG_ERROR, "标签(%s)不存在", symbolName(irLabel).data());
+        return std::string(symbolName(irLabel));
+    }
+
+    return pIter->second->getName();
+}
+
+/// @brief 获取值所在的寄存器，没有分配寄存器时加载到临时寄存器中
+/// @param val 值
+/// @param scratch 临时寄存器
+/// @return 寄存器编号
+int InstSelectorRiscv64::useReg(Value * val, int scratch)
+{
+    if (Instanceof(constVal, ConstInt *, val)) {
+        if (constVal->getVal() == 0) {
+            // 0直接用zero寄存器
+            return RISCV_ZERO_REG_NO;
+        }
+    } else if (val->getRegId() != -1) {
+        return val->getRegId();
+    }
+
+    iloc.load_var(scratch, val);
+
+    return scratch;
+}
+
+/// @brief 获取保存结果的寄存器，没有分配寄存器时使用临时寄存器，之后需writeBack
+/// @param val 结果值
+/// @param scratch 临时寄存器
+/// @return 寄存器编号
+int InstSelectorRiscv64::defReg(Value * val, int scratch)
+{
+    return (val->getRegId() != -1) ? val->getRegId() : scratch;
+}
+
+/// @brief 没有分配寄存器的结果写回到栈中
+/// @param val 结果值
+/// @param reg_no 结果所在的寄存器
+void InstSelectorRiscv64::writeBack(Value * val, int reg_no)
+{
+    if (val->getRegId() != reg_no) {
+        iloc.store_var(reg_no, val);
+    }
+}
+
+/// @brief Label指令指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_label(Instruction * inst)
+{
+    iloc.label(inst->getName());
+}
+
+/// @brief goto指令指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_goto(Instruction * inst)
+{
+    Instanceof(gotoInst, GotoInstruction *, inst);
+
+    // 无条件跳转，目标可能是Label指令，也可能是标签名称
+    if (gotoInst->getTarget()) {
+        iloc.jump(gotoInst->getTarget()->getName());
+    } else {
+        iloc.jump(getAsmLabel(gotoInst->getLabel()));
+    }
+}
+
+/// @brief 函数入口指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_entry(Instruction * inst)
+{
+    (void) inst;
+
+    int32_t frameSize = func->getMaxDep();
+
+    // addi sp,sp,-frame
+    if (frameSize) {
+        iloc.add_imm(RISCV_SP_REG_NO, RISCV_SP_REG_NO, -frameSize);
+    }
+
+    // 保存ra与用到的被调用者保存寄存器
+    for (size_t k = 0; k < savedRegs.size(); k++) {
+        iloc.store_base(savedRegs[k], RISCV_SP_REG_NO, savedAreaOffset + (int32_t) k * 8, true);
+    }
+
+    // 寄存器传递的形参复制到分配的寄存器或栈中，a0-a7不参与分配，复制时不会相互覆盖
+    auto & params = func->getParams();
+    for (int k = 0; k < (int) params.size(); k++) {
+
+        if (k < PlatformRiscv64::maxArgRegNum) {
+            iloc.store_var(PlatformRiscv64::argRegNo[k], params[k]);
+        } else if (params[k]->getRegId() != -1) {
+            // 栈传递的形参在调用者的栈顶，分配了寄存器时读入
+            iloc.load_base(params[k]->getRegId(),
+                           RISCV_SP_REG_NO,
+                           frameSize + (k - PlatformRiscv64::maxArgRegNum) * 8,
+                           PlatformRiscv64::isPointerValue(params[k]->getType()));
+        }
+    }
+}
+
+/// @brief 函数出口指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_exit(Instruction * inst)
+{
+    if (inst->getOperandsNum()) {
+        // 存在返回值，通过a0返回
+        iloc.load_var(RISCV_A0_REG_NO, inst->getOperand(0));
+    }
+
+    // 恢复保存的寄存器
+    for (size_t k = 0; k < savedRegs.size(); k++) {
+        iloc.load_base(savedRegs[k], RISCV_SP_REG_NO, savedAreaOffset + (int32_t) k * 8, true);
+    }
+
+    if (func->getMaxDep()) {
+        iloc.add_imm(RISCV_SP_REG_NO, RISCV_SP_REG_NO, func->getMaxDep());
+    }
+
+    iloc.inst(RiscvOp::RET);
+}
+
+/// @brief 赋值指令翻译成RISC-V汇编，含通过指针的读与写
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_assign(Instruction * inst)
+{
+    Value * result = inst->getOperand(0);
+    Value * arg1 = inst->getOperand(1);
+
+    if (result->getType()->isPointerType() && !PlatformRiscv64::isPointerValue(arg1->getType())) {
+        // 通过指针写：*%t = x
+        int addr_reg = useReg(result, RISCV_T1_REG_NO);
+        int val_reg = useReg(arg1, RISCV_T0_REG_NO);
+        iloc.store_base(val_reg, addr_reg, 0, false);
+    } else if (arg1->getType()->isPointerType() && !PlatformRiscv64::isPointerValue(result->getType())) {
+        // 通过指针读：x = *%t
+        int addr_reg = useReg(arg1, RISCV_T1_REG_NO);
+        int rd = defReg(result, RISCV_T0_REG_NO);
+        iloc.load_base(rd, addr_reg, 0, false);
+        writeBack(result, rd);
+    } else if (result->getRegId() != -1) {
+        // 复制到寄存器，直接加载
+        iloc.load_var(result->getRegId(), arg1);
+    } else {
+        // 复制到栈中
+        iloc.store_var(useReg(arg1, RISCV_T0_REG_NO), result);
+    }
+}
+
+/// @brief 二元操作指令翻译成RISC-V汇编
+/// @param inst IR指令
+/// @param op 操作码
+void InstSelectorRiscv64::translate_two_operator(Instruction * inst, RiscvOp op)
+{
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    int rs1 = useReg(arg1, RISCV_T0_REG_NO);
+    int rs2 = useReg(arg2, RISCV_T1_REG_NO);
+    int rd = defReg(inst, RISCV_T2_REG_NO);
+
+    iloc.inst(op, rd, rs1, rs2);
+
+    writeBack(inst, rd);
+}
+
+/// @brief 整数加法指令翻译成RISC-V汇编，结果为指针时为地址计算
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_add_int32(Instruction * inst)
+{
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+    bool isPointer = PlatformRiscv64::isPointerValue(inst->getType());
+
+    // 加法满足交换律，常量放在第二个操作数
+    if (dynamic_cast<ConstInt *>(arg1) && !isPointer) {
+        std::swap(arg1, arg2);
+    }
+
+    Instanceof(constVal, ConstInt *, arg2);
+    if (constVal && PlatformRiscv64::isImm12(constVal->getVal())) {
+        // addiw rd,rs,imm 或地址计算addi rd,rs,imm
+        int rs1 = useReg(arg1, RISCV_T0_REG_NO);
+        int rd = defReg(inst, RISCV_T2_REG_NO);
+        iloc.inst(isPointer ? RiscvOp::ADDI : RiscvOp::ADDIW, rd, rs1, -1, constVal->getVal());
+        writeBack(inst, rd);
+    } else {
+        // 整数值在寄存器中均已符号扩展到64位，地址计算可直接用add
+        translate_two_operator(inst, isPointer ? RiscvOp::ADD : RiscvOp::ADDW);
+    }
+}
+
+/// @brief 整数减法指令翻译成RISC-V汇编，结果为指针时为地址计算
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_sub_int32(Instruction * inst)
+{
+    bool isPointer = PlatformRiscv64::isPointerValue(inst->getType());
+
+    Instanceof(constVal, ConstInt *, inst->getOperand(1));
+    if (constVal && PlatformRiscv64::isImm12(-(int64_t) constVal->getVal())) {
+        // 减去常量即加上其相反数
+        int rs1 = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+        int rd = defReg(inst, RISCV_T2_REG_NO);
+        iloc.inst(isPointer ? RiscvOp::ADDI : RiscvOp::ADDIW, rd, rs1, -1, -constVal->getVal());
+        writeBack(inst, rd);
+    } else {
+        translate_two_operator(inst, isPointer ? RiscvOp::SUB : RiscvOp::SUBW);
+    }
+}
+
+/// @brief 整数乘法指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_mul_int32(Instruction * inst)
+{
+    translate_two_operator(inst, RiscvOp::MULW);
+}
+
+/// @brief 整数除法指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_div_int32(Instruction * inst)
+{
+    translate_two_operator(inst, RiscvOp::DIVW);
+}
+
+/// @brief 整数求余指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_mod_int32(Instruction * inst)
+{
+    translate_two_operator(inst, RiscvOp::REMW);
+}
+
+/// @brief 整数求负指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_neg_int32(Instruction * inst)
+{
+    int rs1 = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+    int rd = defReg(inst, RISCV_T2_REG_NO);
+
+    iloc.inst(RiscvOp::NEGW, rd, rs1);
+
+    writeBack(inst, rd);
+}
+
+/// @brief 大于比较指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_gt_int32(Instruction * inst)
+{
+    // a > b 即 b < a
+    int rs1 = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+    int rs2 = useReg(inst->getOperand(1), RISCV_T1_REG_NO);
+    int rd = defReg(inst, RISCV_T2_REG_NO);
+
+    iloc.inst(RiscvOp::SLT, rd, rs2, rs1);
+
+    writeBack(inst, rd);
+}
+
+/// @brief 大于等于比较指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_ge_int32(Instruction * inst)
+{
+    // a >= b 即 !(a < b)
+    int rs1 = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+    int rs2 = useReg(inst->getOperand(1), RISCV_T1_REG_NO);
+    int rd = defReg(inst, RISCV_T2_REG_NO);
+
+    iloc.inst(RiscvOp::SLT, rd, rs1, rs2);
+    iloc.inst(RiscvOp::XORI, rd, rd, -1, 1);
+
+    writeBack(inst, rd);
+}
+
+/// @brief 小于比较指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_lt_int32(Instruction * inst)
+{
+    translate_two_operator(inst, RiscvOp::SLT);
+}
+
+/// @brief 小于等于比较指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_le_int32(Instruction * inst)
+{
+    // a <= b 即 !(b < a)
+    int rs1 = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+    int rs2 = useReg(inst->getOperand(1), RISCV_T1_REG_NO);
+    int rd = defReg(inst, RISCV_T2_REG_NO);
+
+    iloc.inst(RiscvOp::SLT, rd, rs2, rs1);
+    iloc.inst(RiscvOp::XORI, rd, rd, -1, 1);
+
+    writeBack(inst, rd);
+}
+
+/// @brief 等于比较指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_eq_int32(Instruction * inst)
+{
+    // xor rd,a,b; seqz rd,rd
+    int rs1 = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+    int rs2 = useReg(inst->getOperand(1), RISCV_T1_REG_NO);
+    int rd = defReg(inst, RISCV_T2_REG_NO);
+
+    iloc.inst(RiscvOp::XOR, rd, rs1, rs2);
+    iloc.inst(RiscvOp::SEQZ, rd, rd);
+
+    writeBack(inst, rd);
+}
+
+/// @brief 不等于比较指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_ne_int32(Instruction * inst)
+{
+    // xor rd,a,b; snez rd,rd
+    int rs1 = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+    int rs2 = useReg(inst->getOperand(1), RISCV_T1_REG_NO);
+    int rd = defReg(inst, RISCV_T2_REG_NO);
+
+    iloc.inst(RiscvOp::XOR, rd, rs1, rs2);
+    iloc.inst(RiscvOp::SNEZ, rd, rd);
+
+    writeBack(inst, rd);
+}
+
+/// @brief 条件分支指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_bc(Instruction * inst)
+{
+    Instanceof(branchInst, BranchInstruction *, inst);
+
+    if (!branchInst) {
+        minic_log(LOG_ERROR, "转换BranchInstruction失败");
+        return;
+    }
+
+    // bnez cond,true; j false
+    int cond_reg = useReg(inst->getOperand(0), RISCV_T0_REG_NO);
+    iloc.branch_nez(cond_reg, getAsmLabel(branchInst->getTrueLabel()));
+    iloc.jump(getAsmLabel(branchInst->getFalseLabel()));
+}
+
+/// @brief 函数调用指令翻译成RISC-V汇编
+/// @param inst IR指令
+void InstSelectorRiscv64::translate_call(Instruction * inst)
+{
+    Instanceof(callInst, FuncCallInstruction *, inst);
+
+    int32_t operandNum = callInst->getOperandsNum();
+
+    // 前8个之后的实参依次放在栈顶，每个8字节，栈空间在栈帧中已预留
+    for (int32_t k = PlatformRiscv64::maxArgRegNum; k < operandNum; k++) {
+        Value * arg = callInst->getOperand(k);
+        int reg = useReg(arg, RISCV_T0_REG_NO);
+        iloc.store_base(reg, RISCV_SP_REG_NO, (k - PlatformRiscv64::maxArgRegNum) * 8, true);
+    }
+
+    // 寄存器传递的实参直接加载到a0-a7，a0-a7不参与分配，加载时不会覆盖其它实参
+    for (int32_t k = 0; k < operandNum && k < PlatformRiscv64::maxArgRegNum; k++) {
+        iloc.load_var(PlatformRiscv64::argRegNo[k], callInst->getOperand(k));
+    }
+
+    iloc.call_fun(callInst->getCalledName());
+
+    // 返回值在a0中
+    if (callInst->hasResultValue()) {
+        iloc.store_var(RISCV_A0_REG_NO, callInst);
+    }
+}
@@ -0,0 +1,209 @@
+///
+/// @file InstSelectorRiscv64.h
+/// @brief 指令选择器-RISC-V
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "ILocRiscv64.h"
+#include "Instruction.h"
+#include "StringInterner.h"
+#include "PlatformRiscv64.h"
+
+/// @brief 指令选择器-RISC-V
+///
+/// 已分配寄存器的值直接作为指令的操作数，溢出的值借助t0-t2读写栈。
+/// 函数调用遵循LP64约定：前8个整数实参经a0-a7传递，其余按8字节依次放在调用者栈顶。
+class InstSelectorRiscv64 {
+
+    /// @brief 所有的IR指令
+    std::vector<Instruction *> & ir;
+
+    /// @brief 指令变换
+    ILocRiscv64 & iloc;
+
+    /// @brief 要处理的函数
+    Function * func;
+
+    /// @brief 序言中保存、尾声中恢复的寄存器，含ra
+    const std::vector<int> & savedRegs;
+
+    /// @brief 保存寄存器区相对sp的偏移
+    int32_t savedAreaOffset;
+
+protected:
+    /// @brief 指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate(Instruction * inst);
+
+    /// @brief 函数入口指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_entry(Instruction * inst);
+
+    /// @brief 函数出口指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_exit(Instruction * inst);
+
+    /// @brief 赋值指令翻译成RISC-V汇编，含通过指针的读与写
+    /// @param inst IR指令
+    void translate_assign(Instruction * inst);
+
+    /// @brief Label指令指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_label(Instruction * inst);
+
+    /// @brief goto指令指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_goto(Instruction * inst);
+
+    /// @brief 整数加法指令翻译成RISC-V汇编，结果为指针时为地址计算
+    /// @param inst IR指令
+    void translate_add_int32(Instruction * inst);
+
+    /// @brief 整数减法指令翻译成RISC-V汇编，结果为指针时为地址计算
+    /// @param inst IR指令
+    void translate_sub_int32(Instruction * inst);
+
+    /// @brief 整数乘法指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_mul_int32(Instruction * inst);
+
+    /// @brief 整数除法指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_div_int32(Instruction * inst);
+
+    /// @brief 整数求余指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_mod_int32(Instruction * inst);
+
+    /// @brief 整数求负指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_neg_int32(Instruction * inst);
+
+    /// @brief 大于比较指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_gt_int32(Instruction * inst);
+
+    /// @brief 大于等于比较指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_ge_int32(Instruction * inst);
+
+    /// @brief 小于比较指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_lt_int32(Instruction * inst);
+
+    /// @brief 小于等于比较指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_le_int32(Instruction * inst);
+
+    /// @brief 等于比较指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_eq_int32(Instruction * inst);
+
+    /// @brief 不等于比较指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_ne_int32(Instruction * inst);
+
+    /// @brief 条件分支指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_bc(Instruction * inst);
+
+    /// @brief 二元操作指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    /// @param op 操作码
+    void translate_two_operator(Instruction * inst, RiscvOp op);
+
+    /// @brief 函数调用指令翻译成RISC-V汇编
+    /// @param inst IR指令
+    void translate_call(Instruction * inst);
+
+    /// @brief 获取值所在的寄存器，没有分配寄存器时加载到临时寄存器中
+    /// @param val 值
+    /// @param scratch 临时寄存器
+    /// @return 寄存器编号
+    int useReg(Value * val, int scratch);
+
+    /// @brief 获取保存结果的寄存器，没有分配寄存器时使用临时寄存器，之后需writeBack
+    /// @param val 结果值
+    /// @param scratch 临时寄存器
+    /// @return 寄存器编号
+    int defReg(Value * val, int scratch);
+
+    /// @brief 没有分配寄存器的结果写回到栈中
+    /// @param val 结果值
+    /// @param reg_no 结果所在的寄存器
+    void writeBack(Value * val, int reg_no);
+
+    ///
+    /// @brief 输出IR指令
+    ///
+    void outputIRInstruction(Instruction * inst);
+
+    ///
+    /// @brief 根据IR中的标签名称获取汇编中的标签名
+    /// @param irLabel IR标签名称的驻留编号
+    /// @return std::string 汇编标签名
+    ///
+    std::string getAsmLabel(Symbol irLabel);
+
+    /// @brief IR翻译动作函数原型
+    typedef void (InstSelectorRiscv64::*translate_handler)(Instruction *);
+
+    /// @brief IR动作处理函数清单
+    std::map<IRInstOperator, translate_handler> translator_handlers;
+
+    ///
+    /// @brief IR标签名称到Label指令的映射，Label指令的名字为文件级唯一的汇编标签名
+    ///
+    std::unordered_map<Symbol, Instruction *> labelInsts;
+
+    ///
+    /// @brief 显示IR指令内容
+    ///
+    bool showLinearIR = false;
+
+public:
+    /// @brief 构造函数
+    /// @param _irCode IR指令
+    /// @param _iloc 后端指令
+    /// @param _func 函数
+    /// @param _savedRegs 需要保存的寄存器
+    /// @param _savedAreaOffset 保存寄存器区相对sp的偏移
+    InstSelectorRiscv64(std::vector<Instruction *> & _irCode,
+                        ILocRiscv64 & _iloc,
+                        Function * _func,
+                        const std::vector<int> & _savedRegs,
+                        int32_t _savedAreaOffset);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~InstSelectorRiscv64();
+
+    ///
+    /// @brief 设置是否输出线性IR的内容
+    /// @param show true显示，false显示
+    ///
+    void setShowLinearIR(bool show)
+    {
+        showLinearIR = show;
+    }
+
+    /// @brief 指令选择
+    void run();
+};
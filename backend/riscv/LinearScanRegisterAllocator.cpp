@@ -0,0 +1,439 @@
+///
+/// @file LinearScanRegisterAllocator.cpp
+/// @brief 基于活跃区间的线性扫描寄存器分配器的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+
+#include "LinearScanRegisterAllocator.h"
+#include "PlatformRiscv64.h"
+#include "ConstInt.h"
+#include "GlobalVariable.h"
+#include "LocalVariable.h"
+#include "FormalParam.h"
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "BranchInstruction.h"
+
+/// @brief 位集合的操作
+#define BIT_SET(bits, k) ((bits)[(k) >> 6] |= (1ull << ((k) & 63)))
+#define BIT_TEST(bits, k) (((bits)[(k) >> 6] >> ((k) & 63)) & 1ull)
+
+/// @brief 构造函数
+/// @param _func 要分配的函数
+LinearScanRegisterAllocator::LinearScanRegisterAllocator(Function * _func) : func(_func)
+{}
+
+/// @brief 判断值是否参与寄存器分配：形参、局部变量与有结果的指令，数组本身除外
+/// @param val 值
+/// @return true：参与分配
+bool LinearScanRegisterAllocator::isCandidate(Value * val)
+{
+    if (PlatformRiscv64::isArrayStorage(val->getType())) {
+        // 数组需要在栈内分配空间
+        return false;
+    }
+
+    if (dynamic_cast<LocalVariable *>(val) || dynamic_cast<FormalParam *>(val)) {
+        return true;
+    }
+
+    Instanceof(inst, Instruction *, val);
+
+    return inst && inst->hasResultValue();
+}
+
+/// @brief 值的编号
+/// @param val 值
+/// @return 编号，不参与分配时为-1
+int32_t LinearScanRegisterAllocator::indexOf(Value * val)
+{
+    auto pIter = valueIndex.find(val);
+    return (pIter == valueIndex.end()) ? -1 : pIter->second;
+}
+
+/// @brief 获取指令使用的值与定值的值，只包含参与分配的值
+/// @param inst 指令
+/// @param uses 使用的值
+/// @return 定值的值，没有则为空指针
+Value * LinearScanRegisterAllocator::getUseDef(Instruction * inst, std::vector<Value *> & uses)
+{
+    Value * def = nullptr;
+    int32_t first = 0;
+
+    uses.clear();
+
+    if (inst->getOp() == IRInstOperator::IRINST_OP_ASSIGN) {
+
+        Value * result = inst->getOperand(0);
+        Value * arg1 = inst->getOperand(1);
+
+        // *%t = x时%t是使用，其它情况下是定值
+        if (!(result->getType()->isPointerType() && !PlatformRiscv64::isPointerValue(arg1->getType()))) {
+            def = result;
+            first = 1;
+        }
+    } else if (inst->hasResultValue()) {
+        def = inst;
+    }
+
+    for (int32_t k = first; k < inst->getOperandsNum(); k++) {
+        Value * val = inst->getOperand(k);
+        if (indexOf(val) != -1) {
+            uses.push_back(val);
+        }
+    }
+
+    if (def && (indexOf(def) == -1)) {
+        def = nullptr;
+    }
+
+    return def;
+}
+
+/// @brief 划分基本块并建立后继关系
+void LinearScanRegisterAllocator::buildBlocks()
+{
+    // Label指令所在的基本块，分别按IR标签名与指令索引
+    std::unordered_map<Symbol, int32_t> labelBlockByName;
+    std::unordered_map<Instruction *, int32_t> labelBlockByInst;
+
+    for (int32_t pos = 0; pos < (int32_t) insts.size(); pos++) {
+
+        Instruction * inst = insts[pos];
+        IRInstOperator op = inst->getOp();
+
+        // Label指令开始一个新的基本块，跳转指令的下一条也开始新的基本块
+        bool leader = (pos == 0) || (op == IRInstOperator::IRINST_OP_LABEL);
+        if (pos > 0) {
+            IRInstOperator prevOp = insts[pos - 1]->getOp();
+            leader = leader || (prevOp == IRInstOperator::IRINST_OP_GOTO) ||
+                     (prevOp == IRInstOperator::IRINST_OP_BC) || (prevOp == IRInstOperator::IRINST_OP_EXIT);
+        }
+
+        if (leader) {
+            Block block;
+            block.first = pos;
+            block.last = pos;
+            blocks.push_back(block);
+        } else {
+            blocks.back().last = pos;
+        }
+
+        if (Instanceof(labelInst, LabelInstruction *, inst)) {
+            labelBlockByInst[labelInst] = (int32_t) blocks.size() - 1;
+            if (labelInst->getLabel() != 0) {
+                labelBlockByName[labelInst->getLabel()] = (int32_t) blocks.size() - 1;
+            }
+        }
+    }
+
+    auto addSuccByName = [&](Block & block, Symbol name) {
+        auto pIter = labelBlockByName.find(name);
+        if (pIter != labelBlockByName.end()) {
+            block.succs.push_back(pIter->second);
+        }
+    };
+
+    for (int32_t b = 0; b < (int32_t) blocks.size(); b++) {
+
+        Block & block = blocks[b];
+        Instruction * last = insts[block.last];
+
+        if (Instanceof(gotoInst, GotoInstruction *, last)) {
+            if (gotoInst->getTarget()) {
+                block.succs.push_back(labelBlockByInst[gotoInst->getTarget()]);
+            } else {
+                addSuccByName(block, gotoInst->getLabel());
+            }
+        } else if (Instanceof(branchInst, BranchInstruction *, last)) {
+            addSuccByName(block, branchInst->getTrueLabel());
+            addSuccByName(block, branchInst->getFalseLabel());
+        } else if ((last->getOp() != IRInstOperator::IRINST_OP_EXIT) && (b + 1 < (int32_t) blocks.size())) {
+            // 顺序执行到下一个基本块
+            block.succs.push_back(b + 1);
+        }
+    }
+}
+
+/// @brief 活跃变量分析，迭代求解各基本块的liveIn与liveOut
+void LinearScanRegisterAllocator::computeLiveness()
+{
+    size_t words = (values.size() + 63) / 64;
+    std::vector<Value *> uses;
+
+    for (auto & block: blocks) {
+
+        block.use.assign(words, 0);
+        block.def.assign(words, 0);
+        block.liveIn.assign(words, 0);
+        block.liveOut.assign(words, 0);
+
+        for (int32_t pos = block.first; pos <= block.last; pos++) {
+
+            Value * def = getUseDef(insts[pos], uses);
+
+            for (auto val: uses) {
+                int32_t k = indexOf(val);
+                if (!BIT_TEST(block.def, k)) {
+                    BIT_SET(block.use, k);
+                }
+            }
+
+            if (def) {
+                BIT_SET(block.def, indexOf(def));
+            }
+        }
+    }
+
+    // 逆序迭代直到不动点
+    // liveOut[b] = U liveIn[s]，liveIn[b] = use[b] U (liveOut[b] - def[b])
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        for (int32_t b = (int32_t) blocks.size() - 1; b >= 0; b--) {
+
+            Block & block = blocks[b];
+
+            for (size_t w = 0; w < words; w++) {
+
+                uint64_t out = 0;
+                for (auto s: block.succs) {
+                    out |= blocks[s].liveIn[w];
+                }
+
+                uint64_t in = block.use[w] | (out & ~block.def[w]);
+
+                if ((out != block.liveOut[w]) || (in != block.liveIn[w])) {
+                    block.liveOut[w] = out;
+                    block.liveIn[w] = in;
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+/// @brief 由活跃信息得到每个值的活跃区间
+void LinearScanRegisterAllocator::buildIntervals()
+{
+    intervals.resize(values.size());
+    for (size_t k = 0; k < values.size(); k++) {
+        intervals[k].val = values[k];
+        intervals[k].start = INT32_MAX;
+        intervals[k].end = -1;
+    }
+
+    auto extend = [this](int32_t k, int32_t pos) {
+        intervals[k].start = std::min(intervals[k].start, pos);
+        intervals[k].end = std::max(intervals[k].end, pos);
+    };
+
+    // 形参在函数入口处定值
+    for (auto param: func->getParams()) {
+        int32_t k = indexOf(param);
+        if (k != -1) {
+            extend(k, 0);
+        }
+    }
+
+    std::vector<Value *> uses;
+
+    for (auto & block: blocks) {
+
+        for (int32_t pos = block.first; pos <= block.last; pos++) {
+
+            Value * def = getUseDef(insts[pos], uses);
+
+            for (auto val: uses) {
+                extend(indexOf(val), pos);
+            }
+
+            if (def) {
+                extend(indexOf(def), pos);
+            }
+        }
+
+        // 入口活跃的值覆盖到块首，出口活跃的值覆盖到块尾
+        for (int32_t k = 0; k < (int32_t) values.size(); k++) {
+            if (BIT_TEST(block.liveIn, k)) {
+                extend(k, block.first);
+            }
+            if (BIT_TEST(block.liveOut, k)) {
+                extend(k, block.last);
+            }
+        }
+    }
+
+    for (auto & interval: intervals) {
+
+        if (interval.end < 0) {
+            // 从未出现过的值
+            interval.start = interval.end = 0;
+            continue;
+        }
+
+        // 区间内部（不含端点）有函数调用，则值的生存期跨越了调用
+        auto pIter = std::upper_bound(callPositions.begin(), callPositions.end(), interval.start);
+        interval.crossCall = (pIter != callPositions.end()) && (*pIter < interval.end);
+    }
+}
+
+/// @brief 线性扫描分配寄存器
+void LinearScanRegisterAllocator::linearScan()
+{
+    std::vector<Interval *> order;
+    for (auto & interval: intervals) {
+        order.push_back(&interval);
+    }
+
+    std::stable_sort(order.begin(), order.end(), [](Interval * a, Interval * b) { return a->start < b->start; });
+
+    // 空闲的寄存器
+    std::vector<int> freeCaller(PlatformRiscv64::callerSavedRegNo,
+                                PlatformRiscv64::callerSavedRegNo + PlatformRiscv64::callerSavedRegNum);
+    std::vector<int> freeCallee(PlatformRiscv64::calleeSavedRegNo,
+                                PlatformRiscv64::calleeSavedRegNo + PlatformRiscv64::calleeSavedRegNum);
+
+    auto release = [&](int reg) {
+        if (PlatformRiscv64::isCalleeSaved(reg)) {
+            freeCallee.push_back(reg);
+        } else {
+            freeCaller.push_back(reg);
+        }
+    };
+
+    // 正在活跃的已分配区间
+    std::vector<Interval *> active;
+
+    for (auto cur: order) {
+
+        // 终点在当前起点之前的区间结束，释放其寄存器
+        for (auto pIter = active.begin(); pIter != active.end();) {
+            if ((*pIter)->end < cur->start) {
+                release((*pIter)->reg);
+                pIter = active.erase(pIter);
+            } else {
+                pIter++;
+            }
+        }
+
+        int reg = -1;
+
+        // 跨越函数调用的只能用被调用者保存的寄存器，否则优先用调用者保存的寄存器，减少保存与恢复
+        if (!cur->crossCall && !freeCaller.empty()) {
+            reg = freeCaller.back();
+            freeCaller.pop_back();
+        } else if (!freeCallee.empty()) {
+            reg = freeCallee.back();
+            freeCallee.pop_back();
+        }
+
+        if (reg == -1) {
+            // 没有空闲的寄存器，在寄存器可用的活跃区间中选终点最远的
+            Interval * victim = nullptr;
+            for (auto interval: active) {
+                if (cur->crossCall && !PlatformRiscv64::isCalleeSaved(interval->reg)) {
+                    continue;
+                }
+                if (!victim || (interval->end > victim->end)) {
+                    victim = interval;
+                }
+            }
+
+            if (victim && (victim->end > cur->end)) {
+                // 溢出终点更远的区间，其寄存器给当前区间
+                reg = victim->reg;
+                victim->reg = -1;
+                active.erase(std::find(active.begin(), active.end(), victim));
+            } else {
+                // 溢出当前区间
+                continue;
+            }
+        }
+
+        cur->reg = reg;
+        active.push_back(cur);
+    }
+
+    for (auto & interval: intervals) {
+        if (interval.reg == -1) {
+            spilledValues.push_back(interval.val);
+        } else {
+            interval.val->setRegId(interval.reg);
+            if (PlatformRiscv64::isCalleeSaved(interval.reg)) {
+                usedCalleeSavedMask |= 1u << interval.reg;
+            }
+        }
+    }
+}
+
+/// @brief 执行寄存器分配
+void LinearScanRegisterAllocator::run()
+{
+    // 有效指令线性编号，记录函数调用的位置
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (!inst->isDead()) {
+            if (inst->getOp() == IRInstOperator::IRINST_OP_FUNC_CALL) {
+                callPositions.push_back((int32_t) insts.size());
+            }
+            insts.push_back(inst);
+        }
+    }
+
+    // 参与分配的值：形参、局部变量、临时变量
+    auto addValue = [this](Value * val) {
+        if (isCandidate(val) && !valueIndex.count(val)) {
+            valueIndex[val] = (int32_t) values.size();
+            values.push_back(val);
+        }
+    };
+
+    for (auto param: func->getParams()) {
+        addValue(param);
+    }
+
+    for (auto var: func->getVarValues()) {
+        addValue(var);
+    }
+
+    for (auto inst: insts) {
+        if (inst->hasResultValue()) {
+            addValue(inst);
+        }
+    }
+
+    if (insts.empty()) {
+        return;
+    }
+
+    buildBlocks();
+    computeLiveness();
+    buildIntervals();
+    linearScan();
+}
+
+/// @brief 分配出去的被调用者保存的寄存器，函数序言与尾声中需保存与恢复
+/// @return 寄存器编号，从小到大
+std::vector<int> LinearScanRegisterAllocator::getUsedCalleeSavedRegs() const
+{
+    std::vector<int> regs;
+    for (int reg = 0; reg < PlatformRiscv64::maxRegNum; reg++) {
+        if (usedCalleeSavedMask & (1u << reg)) {
+            regs.push_back(reg);
+        }
+    }
+
+    return regs;
+}
@@ -0,0 +1,143 @@
+///
+/// @file LinearScanRegisterAllocator.h
+/// @brief 基于活跃区间的线性扫描寄存器分配器的头文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "Instruction.h"
+#include "Value.h"
+
+/// @brief 线性扫描寄存器分配器
+///
+/// 对函数的线性IR按基本块进行活跃变量分析，得到每个形参、局部变量与临时变量的活跃区间[start,end]，
+/// 然后按起点依次分配寄存器（Poletto & Sarkar的线性扫描）。跨越函数调用的区间只分配被调用者保存的寄存器，
+/// 其余区间优先使用调用者保存的寄存器，寄存器不够时溢出终点最远的区间。
+/// 分配结果通过Value::setRegId记录，没有分配到寄存器的值由调用者分配栈空间。
+class LinearScanRegisterAllocator {
+
+public:
+    /// @brief 构造函数
+    /// @param _func 要分配的函数
+    LinearScanRegisterAllocator(Function * _func);
+
+    /// @brief 执行寄存器分配
+    void run();
+
+    /// @brief 没有分配到寄存器的值，需分配栈空间
+    /// @return 溢出的值
+    const std::vector<Value *> & getSpilledValues() const
+    {
+        return spilledValues;
+    }
+
+    /// @brief 分配出去的被调用者保存的寄存器，函数序言与尾声中需保存与恢复
+    /// @return 寄存器编号，从小到大
+    std::vector<int> getUsedCalleeSavedRegs() const;
+
+    /// @brief 函数内是否含有函数调用，此时ra需要保存
+    /// @return true：有函数调用
+    bool hasFuncCall() const
+    {
+        return !callPositions.empty();
+    }
+
+    /// @brief 判断值是否参与寄存器分配：形参、局部变量与有结果的指令，数组本身除外
+    /// @param val 值
+    /// @return true：参与分配
+    static bool isCandidate(Value * val);
+
+protected:
+    /// @brief 活跃区间
+    struct Interval {
+        /// @brief 对应的值
+        Value * val;
+        /// @brief 起点，指令的线性编号
+        int32_t start;
+        /// @brief 终点，指令的线性编号
+        int32_t end;
+        /// @brief 区间内是否有函数调用
+        bool crossCall = false;
+        /// @brief 分配的寄存器，-1表示溢出
+        int32_t reg = -1;
+    };
+
+    /// @brief 基本块
+    struct Block {
+        /// @brief 第一条与最后一条指令的编号
+        int32_t first;
+        int32_t last;
+        /// @brief 后继基本块
+        std::vector<int32_t> succs;
+        /// @brief 块内先使用后定值的值，以及定值的值
+        std::vector<uint64_t> use;
+        std::vector<uint64_t> def;
+        /// @brief 块入口与出口处活跃的值
+        std::vector<uint64_t> liveIn;
+        std::vector<uint64_t> liveOut;
+    };
+
+    /// @brief 获取指令使用的值与定值的值，只包含参与分配的值
+    /// @param inst 指令
+    /// @param uses 使用的值
+    /// @return 定值的值，没有则为空指针
+    Value * getUseDef(Instruction * inst, std::vector<Value *> & uses);
+
+    /// @brief 划分基本块并建立后继关系
+    void buildBlocks();
+
+    /// @brief 活跃变量分析，迭代求解各基本块的liveIn与liveOut
+    void computeLiveness();
+
+    /// @brief 由活跃信息得到每个值的活跃区间
+    void buildIntervals();
+
+    /// @brief 线性扫描分配寄存器
+    void linearScan();
+
+    /// @brief 值的编号
+    /// @param val 值
+    /// @return 编号，不参与分配时为-1
+    int32_t indexOf(Value * val);
+
+private:
+    /// @brief 要分配的函数
+    Function * func;
+
+    /// @brief 有效的IR指令，下标即线性编号
+    std::vector<Instruction *> insts;
+
+    /// @brief 参与分配的值及其编号
+    std::vector<Value *> values;
+    std::unordered_map<Value *, int32_t> valueIndex;
+
+    /// @brief 基本块
+    std::vector<Block> blocks;
+
+    /// @brief 活跃区间，与values的编号一致
+    std::vector<Interval> intervals;
+
+    /// @brief 函数调用指令的编号，从小到大
+    std::vector<int32_t> callPositions;
+
+    /// @brief 溢出的值
+    std::vector<Value *> spilledValues;
+
+    /// @brief 使用过的被调用者保存的寄存器
+    uint32_t usedCalleeSavedMask = 0;
+};
@@ -0,0 +1,110 @@
+///
+/// @file PlatformRiscv64.cpp
+/// @brief RISC-V 64位平台相关实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include "PlatformRiscv64.h"
+#include "ArrayType.h"
+
+const std::string PlatformRiscv64::regName[PlatformRiscv64::maxRegNum] = {
+    "zero", // x0，恒为0
+    "ra",   // 返回地址
+    "sp",   // 栈指针
+    "gp",   // 全局指针，不使用
+    "tp",   // 线程指针，不使用
+    "t0",   // 指令选择临时寄存器
+    "t1",   // 指令选择临时寄存器
+    "t2",   // 指令选择临时寄存器
+    "s0",   // 需要栈保护，可分配
+    "s1",   // 需要栈保护，可分配
+    "a0",   // 第一个实参，返回值
+    "a1",
+    "a2",
+    "a3",
+    "a4",
+    "a5",
+    "a6",
+    "a7",
+    "s2", // s2-s11需要栈保护，可分配
+    "s3",
+    "s4",
+    "s5",
+    "s6",
+    "s7",
+    "s8",
+    "s9",
+    "s10",
+    "s11",
+    "t3", // t3-t5可分配给不跨越函数调用的变量
+    "t4",
+    "t5",
+    "t6", // 地址计算的临时寄存器
+};
+
+const int PlatformRiscv64::argRegNo[PlatformRiscv64::maxArgRegNum] = {10, 11, 12, 13, 14, 15, 16, 17};
+
+const int PlatformRiscv64::calleeSavedRegNo[PlatformRiscv64::calleeSavedRegNum] =
+    {8, 9, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27};
+
+const int PlatformRiscv64::callerSavedRegNo[PlatformRiscv64::callerSavedRegNum] = {28, 29, 30};
+
+/// @brief 是否是被调用者保存的寄存器
+/// @param reg_no 寄存器编号
+/// @return true：是
+bool PlatformRiscv64::isCalleeSaved(int reg_no)
+{
+    return (reg_no == 8) || (reg_no == 9) || ((reg_no >= 18) && (reg_no <= 27));
+}
+
+/// @brief 是否是12位有符号立即数，可直接用于addi、lw、sw等指令
+/// @param num 立即数
+/// @return true：是
+bool PlatformRiscv64::isImm12(int64_t num)
+{
+    return (num >= -2048) && (num <= 2047);
+}
+
+/// @brief 值的保存方式：32位整数（符号扩展到64位），或者64位地址
+/// @param type 值的类型
+/// @return true：64位地址（指针或数组形参），false：32位整数
+bool PlatformRiscv64::isPointerValue(Type * type)
+{
+    if (type->isPointerType() || type->isArrayParameterType()) {
+        return true;
+    }
+
+    // 数组形参对应的局部变量，其第一维为0，保存的是实参数组的地址
+    Instanceof(arrayType, ArrayType *, type);
+
+    return arrayType && (arrayType->getDimensionCount() > 0) && (arrayType->getDimensionSize(0) == 0);
+}
+
+/// @brief 值是否是数组本身，其值为数组的首地址，不需要从内存中读取
+/// @param type 值的类型
+/// @return true：是数组
+bool PlatformRiscv64::isArrayStorage(Type * type)
+{
+    return type->isArrayType() && !isPointerValue(type);
+}
+
+/// @brief 值在栈内所占空间的大小
+/// @param type 值的类型
+/// @return 字节数
+int32_t PlatformRiscv64::slotSize(Type * type)
+{
+    if (isArrayStorage(type)) {
+        return type->getSize();
+    }
+
+    return isPointerValue(type) ? 8 : 4;
+}
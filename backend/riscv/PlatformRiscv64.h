@@ -0,0 +1,87 @@
+///
+/// @file PlatformRiscv64.h
+/// @brief RISC-V 64位平台相关头文件，寄存器与LP64调用约定
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "Type.h"
+
+// 寄存器编号即x0-x31
+#define RISCV_ZERO_REG_NO 0
+#define RISCV_RA_REG_NO 1
+#define RISCV_SP_REG_NO 2
+
+// t0-t2作为指令选择的临时寄存器，不参与寄存器分配
+#define RISCV_T0_REG_NO 5
+#define RISCV_T1_REG_NO 6
+#define RISCV_T2_REG_NO 7
+
+// 第一个实参与返回值
+#define RISCV_A0_REG_NO 10
+
+// t6用于偏移超出12位立即数时的地址计算，以及全局变量的地址
+#define RISCV_TMP_REG_NO 31
+
+/// @brief RISC-V 64位平台信息
+class PlatformRiscv64 {
+
+public:
+    /// @brief 最大寄存器数目
+    static const int maxRegNum = 32;
+
+    /// @brief 通过寄存器传递的整数实参个数
+    static const int maxArgRegNum = 8;
+
+    /// @brief 寄存器的ABI名字
+    static const std::string regName[maxRegNum];
+
+    /// @brief 依次传递前8个整数实参的寄存器：a0-a7
+    static const int argRegNo[maxArgRegNum];
+
+    /// @brief 可分配的被调用者保存寄存器s0-s11，跨越函数调用的变量只能分配这些寄存器
+    static const int calleeSavedRegNum = 12;
+    static const int calleeSavedRegNo[calleeSavedRegNum];
+
+    /// @brief 可分配的调用者保存寄存器t3-t5，只能分配给不跨越函数调用的变量
+    static const int callerSavedRegNum = 3;
+    static const int callerSavedRegNo[callerSavedRegNum];
+
+    /// @brief 是否是被调用者保存的寄存器
+    /// @param reg_no 寄存器编号
+    /// @return true：是
+    static bool isCalleeSaved(int reg_no);
+
+    /// @brief 是否是12位有符号立即数，可直接用于addi、lw、sw等指令
+    /// @param num 立即数
+    /// @return true：是
+    static bool isImm12(int64_t num);
+
+    /// @brief 值的保存方式：32位整数（符号扩展到64位），或者64位地址
+    /// @param type 值的类型
+    /// @return true：64位地址（指针或数组形参），false：32位整数
+    static bool isPointerValue(Type * type);
+
+    /// @brief 值是否是数组本身，其值为数组的首地址，不需要从内存中读取
+    /// @param type 值的类型
+    /// @return true：是数组
+    static bool isArrayStorage(Type * type);
+
+    /// @brief 值在栈内所占空间的大小
+    /// @param type 值的类型
+    /// @return 字节数
+    static int32_t slotSize(Type * type);
+};
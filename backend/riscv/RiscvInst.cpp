@@ -0,0 +1,156 @@
+///
+/// @file RiscvInst.cpp
+/// @brief RISC-V的机器指令表示及其汇编输出
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <string>
+
+#include "RiscvInst.h"
+#include "PlatformRiscv64.h"
+
+/// @brief 寄存器名
+#define R(no) PlatformRiscv64::regName[no]
+
+RiscvInst::RiscvInst(RiscvOp _opcode, int _rd, int _rs1, int _rs2, int32_t _imm)
+    : opcode(_opcode), rd((int8_t) _rd), rs1((int8_t) _rs1), rs2((int8_t) _rs2), imm(_imm)
+{}
+
+/*
+    设置为无效指令
+*/
+void RiscvInst::setDead()
+{
+    dead = true;
+}
+
+/// @brief 操作码的助记符
+const char * RiscvInst::opName(RiscvOp op)
+{
+    switch (op) {
+        case RiscvOp::LI:
+            return "li";
+        case RiscvOp::LA:
+            return "la";
+        case RiscvOp::MV:
+            return "mv";
+        case RiscvOp::ADD:
+            return "add";
+        case RiscvOp::ADDW:
+            return "addw";
+        case RiscvOp::SUB:
+            return "sub";
+        case RiscvOp::SUBW:
+            return "subw";
+        case RiscvOp::MULW:
+            return "mulw";
+        case RiscvOp::DIVW:
+            return "divw";
+        case RiscvOp::REMW:
+            return "remw";
+        case RiscvOp::SLT:
+            return "slt";
+        case RiscvOp::XOR:
+            return "xor";
+        case RiscvOp::ADDI:
+            return "addi";
+        case RiscvOp::ADDIW:
+            return "addiw";
+        case RiscvOp::XORI:
+            return "xori";
+        case RiscvOp::NEGW:
+            return "negw";
+        case RiscvOp::SEQZ:
+            return "seqz";
+        case RiscvOp::SNEZ:
+            return "snez";
+        case RiscvOp::LW:
+            return "lw";
+        case RiscvOp::LD:
+            return "ld";
+        case RiscvOp::SW:
+            return "sw";
+        case RiscvOp::SD:
+            return "sd";
+        case RiscvOp::BNEZ:
+            return "bnez";
+        case RiscvOp::J:
+            return "j";
+        case RiscvOp::CALL:
+            return "call";
+        case RiscvOp::RET:
+            return "ret";
+        default:
+            return "";
+    }
+}
+
+/*
+    输出函数
+*/
+std::string RiscvInst::outPut() const
+{
+    // 无用代码，什么都不输出
+    if (dead) {
+        return "";
+    }
+
+    std::string ret = opName(opcode);
+
+    switch (opcode) {
+        case RiscvOp::LABEL:
+            // .L1:
+            return symbol + ":";
+        case RiscvOp::COMMENT:
+            // # 注释内容
+            return "# " + symbol;
+        case RiscvOp::LI:
+            // li a0,100
+            return ret + " " + R(rd) + "," + std::to_string(imm);
+        case RiscvOp::LA:
+            // la t6,g
+            return ret + " " + R(rd) + "," + symbol;
+        case RiscvOp::MV:
+        case RiscvOp::NEGW:
+        case RiscvOp::SEQZ:
+        case RiscvOp::SNEZ:
+            // mv a0,s1
+            return ret + " " + R(rd) + "," + R(rs1);
+        case RiscvOp::ADDI:
+        case RiscvOp::ADDIW:
+        case RiscvOp::XORI:
+            // addi sp,sp,-16
+            return ret + " " + R(rd) + "," + R(rs1) + "," + std::to_string(imm);
+        case RiscvOp::LW:
+        case RiscvOp::LD:
+            // lw a0,8(sp)
+            return ret + " " + R(rd) + "," + std::to_string(imm) + "(" + R(rs1) + ")";
+        case RiscvOp::SW:
+        case RiscvOp::SD:
+            // sw a0,8(sp)
+            return ret + " " + R(rs2) + "," + std::to_string(imm) + "(" + R(rs1) + ")";
+        case RiscvOp::BNEZ:
+            // bnez t0,.L1
+            return ret + " " + R(rs1) + "," + symbol;
+        case RiscvOp::J:
+        case RiscvOp::CALL:
+            // call putint
+            return ret + " " + symbol;
+        case RiscvOp::RET:
+            return ret;
+        case RiscvOp::MAX:
+            return "";
+        default:
+            // addw a0,a0,a1
+            return ret + " " + R(rd) + "," + R(rs1) + "," + R(rs2);
+    }
+}
@@ -0,0 +1,119 @@
+///
+/// @file RiscvInst.h
+/// @brief RISC-V的机器指令表示，字段与指令格式的rd、rs1、rs2、imm一一对应
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/// @brief RISC-V机器指令操作码，含常用的伪指令，后缀w为32位运算，结果符号扩展到64位
+enum class RiscvOp : std::uint8_t {
+    /// @brief 标签伪指令，名字保存在symbol中
+    LABEL,
+    /// @brief 注释伪指令，内容保存在symbol中
+    COMMENT,
+
+    /// @brief rd = imm 或 rd = &symbol
+    LI,
+    LA,
+
+    /// @brief rd = rs1
+    MV,
+
+    /// @brief R型：rd = rs1 op rs2
+    ADD,
+    ADDW,
+    SUB,
+    SUBW,
+    MULW,
+    DIVW,
+    REMW,
+    SLT,
+    XOR,
+
+    /// @brief I型：rd = rs1 op imm
+    ADDI,
+    ADDIW,
+    XORI,
+
+    /// @brief 单操作数伪指令：rd = op rs1
+    NEGW,
+    SEQZ,
+    SNEZ,
+
+    /// @brief 访存：rd = [rs1 + imm]，[rs1 + imm] = rs2
+    LW,
+    LD,
+    SW,
+    SD,
+
+    /// @brief 转移
+    BNEZ,
+    J,
+    CALL,
+    RET,
+
+    /// @brief 无效操作码
+    MAX
+};
+
+/// @brief 底层汇编指令：RISC-V
+struct RiscvInst {
+
+    /// @brief 操作码
+    RiscvOp opcode;
+
+    /// @brief 标识指令是否无效
+    bool dead = false;
+
+    /// @brief 目的寄存器
+    int8_t rd = -1;
+
+    /// @brief 第一个源寄存器，访存时为基址寄存器
+    int8_t rs1 = -1;
+
+    /// @brief 第二个源寄存器，store时为要保存的寄存器
+    int8_t rs2 = -1;
+
+    /// @brief 立即数或者访存的偏移
+    int32_t imm = 0;
+
+    /// @brief 标签名、函数名、全局符号名或注释内容，只有用到时才非空
+    std::string symbol;
+
+    /// @brief 构造函数
+    /// @param op 操作码
+    /// @param _rd 目的寄存器
+    /// @param _rs1 第一个源寄存器
+    /// @param _rs2 第二个源寄存器
+    /// @param _imm 立即数
+    RiscvInst(RiscvOp op, int _rd = -1, int _rs1 = -1, int _rs2 = -1, int32_t _imm = 0);
+
+    /// @brief 设置死指令
+    void setDead();
+
+    /// @brief 是否是标签伪指令
+    bool isLabel() const
+    {
+        return opcode == RiscvOp::LABEL;
+    }
+
+    /// @brief 指令字符串输出函数
+    /// @return 汇编指令文本，死指令时为空串
+    std::string outPut() const;
+
+    /// @brief 操作码的助记符
+    static const char * opName(RiscvOp op);
+};
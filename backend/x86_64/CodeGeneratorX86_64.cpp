@@ -0,0 +1,244 @@
+///
+/// @file CodeGeneratorX86_64.cpp
+/// @brief x86-64的后端处理实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "Function.h"
+#include "Module.h"
+#include "PlatformX86_64.h"
+#include "CodeGeneratorX86_64.h"
+#include "InstSelectorX86_64.h"
+#include "ILocX86_64.h"
+
+/// @brief 构造函数
+/// @param tab 符号表
+CodeGeneratorX86_64::CodeGeneratorX86_64(Module * _module) : CodeGeneratorAsm(_module)
+{}
+
+/// @brief 析构函数
+CodeGeneratorX86_64::~CodeGeneratorX86_64()
+{}
+
+/// @brief 产生汇编头部分
+void CodeGeneratorX86_64::genHeader()
+{
+    // GAS默认即为AT&T语法，不需要额外的体系结构指示
+    fprintf(fp, "# x86-64 System V\n");
+
+    // 不需要可执行的栈
+    fprintf(fp, ".section .note.GNU-stack,\"\",@progbits\n");
+}
+
+/// @brief 全局变量Section，主要包含初始化的和未初始化过的
+void CodeGeneratorX86_64::genDataSection()
+{
+    // 生成代码段
+    fprintf(fp, ".text\n");
+
+    // 与ARM32一样，全局变量分为BSS段、.data段与.rodata段三种情况
+    collectWrittenGlobals();
+
+    std::vector<GlobalVariable *> dataVars;
+    std::vector<GlobalVariable *> rodataVars;
+    std::vector<int32_t> words;
+
+    for (auto var: module->getGlobalVariables()) {
+
+        getInitWords(var, words);
+        bool allZero = std::all_of(words.begin(), words.end(), [](int32_t word) { return word == 0; });
+
+        if (var->isInBSSSection() || allZero) {
+
+            // 在BSS段的全局变量，可以包含初值全是0的变量
+            fprintf(fp, ".comm %s, %d, %d\n", var->getName().c_str(), var->getType()->getSize(), var->getAlignment());
+        } else if (writtenGlobals.count(var)) {
+            dataVars.push_back(var);
+        } else {
+            rodataVars.push_back(var);
+        }
+    }
+
+    if (!dataVars.empty()) {
+        fprintf(fp, ".data\n");
+        for (auto var: dataVars) {
+            genGlobalVarData(var);
+        }
+    }
+
+    if (!rodataVars.empty()) {
+        fprintf(fp, ".section .rodata\n");
+        for (auto var: rodataVars) {
+            genGlobalVarData(var);
+        }
+    }
+
+    // 函数在代码段
+    if (!dataVars.empty() || !rodataVars.empty()) {
+        fprintf(fp, ".text\n");
+    }
+}
+
+/// @brief 输出有初值的全局变量的定义及初值，连续的0合并为.zero
+/// @param var 全局变量
+void CodeGeneratorX86_64::genGlobalVarData(GlobalVariable * var)
+{
+    fprintf(fp, ".globl %s\n", var->getName().c_str());
+    fprintf(fp, ".balign %d\n", var->getAlignment());
+    fprintf(fp, ".type %s, @object\n", var->getName().c_str());
+    fprintf(fp, ".size %s, %d\n", var->getName().c_str(), var->getType()->getSize());
+    fprintf(fp, "%s:\n", var->getName().c_str());
+
+    std::vector<int32_t> words;
+    getInitWords(var, words);
+
+    for (size_t k = 0; k < words.size();) {
+
+        if (words[k] == 0) {
+            // .zero 400
+            size_t end = k;
+            while ((end < words.size()) && (words[end] == 0)) {
+                end++;
+            }
+
+            fprintf(fp, "\t.zero %d\n", (int) (end - k) * 4);
+            k = end;
+        } else {
+            // x86的.word为2字节，4字节的字用.long
+            fprintf(fp, "\t.long %d\n", words[k]);
+            k++;
+        }
+    }
+}
+
+/// @brief 针对函数进行汇编指令生成，放到.text代码段中
+/// @param func 要处理的函数
+void CodeGeneratorX86_64::genCodeSection(Function * func)
+{
+    // ILOC代码序列
+    ILocX86_64 iloc(module);
+
+    // 指令选择生成汇编指令
+    selectInstructions(func, iloc);
+
+    // ILOC代码输出为汇编代码
+    fprintf(fp, ".p2align 4\n");
+    fprintf(fp, ".globl %s\n", func->getName().c_str());
+    fprintf(fp, ".type %s, @function\n", func->getName().c_str());
+    fprintf(fp, "%s:\n", func->getName().c_str());
+
+    iloc.outPut(fp);
+
+    fprintf(fp, ".size %s, .-%s\n", func->getName().c_str(), func->getName().c_str());
+}
+
+/// @brief 对函数进行栈分配与指令选择，产生的机器指令放到iloc中
+/// @param func 要处理的函数
+/// @param iloc 机器指令序列
+void CodeGeneratorX86_64::selectInstructions(Function * func, ILocX86_64 & iloc)
+{
+    // 栈内局部变量的站内地址分配
+    registerAllocation(func);
+
+    // 获取函数的指令列表
+    std::vector<Instruction *> & IrInsts = func->getInterCode().getInsts();
+
+    // 汇编指令输出前要确保Label的名字有效，必须是程序级别的唯一，而不是函数内的唯一。要全局编号。
+    for (auto inst: IrInsts) {
+        if (inst->getOp() == IRInstOperator::IRINST_OP_LABEL) {
+            inst->setName(IR_LABEL_PREFIX + std::to_string(labelIndex++));
+        }
+    }
+
+    // 指令选择生成汇编指令
+    InstSelectorX86_64 instSelector(IrInsts, iloc, func);
+    instSelector.setShowLinearIR(this->showLinearIR);
+    instSelector.run();
+
+    // 删除无用的Label指令
+    iloc.deleteUnusedLabel();
+}
+
+/// @brief 寄存器分配，目前变量与临时变量都分配在栈中
+/// @param func 函数指针
+void CodeGeneratorX86_64::registerAllocation(Function * func)
+{
+    // 内置函数不需要处理
+    if (func->isBuiltin()) {
+        return;
+    }
+
+    // 指令选择时每条IR指令的操作数临时读入rax、rcx、rdx，不跨指令占用寄存器，
+    // 因此不需要保护被调用者保存的寄存器rbx、r12-r15，只需保存rbp
+    func->getProtectedReg().clear();
+
+    stackAlloc(func);
+}
+
+/// @brief 栈空间分配，采用rbp+负偏移寻址，栈传递的形参为rbp+正偏移
+/// @param func 要处理的函数
+void CodeGeneratorX86_64::stackAlloc(Function * func)
+{
+    // 栈帧空间（低地址在前，高地址在后）
+    // --------------------- rsp
+    // 局部变量、临时变量、寄存器传递的形参的空间
+    // --------------------- rbp
+    // 保存的rbp
+    // 返回地址
+    // --------------------- rbp + 16
+    // 栈传递的第7个及之后的实参，每个8字节
+    // ---------------------
+
+    int32_t rbp_esp = 0;
+
+    // 按大小对齐后分配，返回负偏移
+    auto alloc = [&rbp_esp](Type * type) {
+        int32_t size = PlatformX86_64::slotSize(type);
+        int32_t align = (size >= 8) ? 8 : 4;
+        rbp_esp = (rbp_esp + size + align - 1) & ~(align - 1);
+        return -rbp_esp;
+    };
+
+    auto & params = func->getParams();
+    for (int k = 0; k < (int) params.size(); k++) {
+        if (k < PlatformX86_64::maxArgRegNum) {
+            params[k]->setMemoryAddr(X86_RBP_REG_NO, alloc(params[k]->getType()));
+        } else {
+            params[k]->setMemoryAddr(X86_RBP_REG_NO, 16 + (k - PlatformX86_64::maxArgRegNum) * 8);
+        }
+    }
+
+    // 遍历函数变量列表
+    for (auto var: func->getVarValues()) {
+        if ((var->getRegId() == -1) && (!var->getMemoryAddr())) {
+            var->setMemoryAddr(X86_RBP_REG_NO, alloc(var->getType()));
+        }
+    }
+
+    // 遍历包含有值的指令，也就是临时变量
+    for (auto inst: func->getInterCode().getInsts()) {
+        if (inst->hasResultValue() && (inst->getRegId() == -1)) {
+            inst->setMemoryAddr(X86_RBP_REG_NO, alloc(inst->getType()));
+        }
+    }
+
+    // call指令执行前rsp要16字节对齐，压入rbp后rsp已对齐，栈帧按16字节取整
+    rbp_esp = (rbp_esp + 15) & ~15;
+
+    func->setMaxDep(rbp_esp);
+}
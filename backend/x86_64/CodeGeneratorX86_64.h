@@ -0,0 +1,59 @@
+///
+/// @file CodeGeneratorX86_64.h
+/// @brief x86-64的后端处理头文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include "CodeGeneratorAsm.h"
+#include "ILocX86_64.h"
+
+/// @brief x86-64的后端，产生System V ABI约定的GAS汇编（AT&T语法）
+class CodeGeneratorX86_64 : public CodeGeneratorAsm {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    CodeGeneratorX86_64(Module * module);
+
+    /// @brief 析构函数
+    ~CodeGeneratorX86_64() override;
+
+protected:
+    /// @brief 产生汇编头部分
+    void genHeader() override;
+
+    /// @brief 全局变量Section，主要包含初始化的和未初始化过的
+    void genDataSection() override;
+
+    /// @brief 输出有初值的全局变量的定义及初值，连续的0合并为.zero
+    /// @param var 全局变量
+    void genGlobalVarData(GlobalVariable * var);
+
+    /// @brief 针对函数进行汇编指令生成，放到.text代码段中
+    /// @param func 要处理的函数
+    void genCodeSection(Function * func) override;
+
+    /// @brief 对函数进行栈分配与指令选择，产生的机器指令放到iloc中
+    /// @param func 要处理的函数
+    /// @param iloc 机器指令序列
+    void selectInstructions(Function * func, ILocX86_64 & iloc);
+
+    /// @brief 寄存器分配，目前变量与临时变量都分配在栈中
+    /// @param func 要处理的函数
+    void registerAllocation(Function * func) override;
+
+    /// @brief 栈空间分配，采用rbp+负偏移寻址，栈传递的形参为rbp+正偏移
+    /// @param func 要处理的函数
+    void stackAlloc(Function * func);
+};
@@ -0,0 +1,208 @@
+///
+/// @file ILocX86_64.cpp
+/// @brief x86-64指令序列管理的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <unordered_set>
+
+#include "Common.h"
+#include "ILocX86_64.h"
+#include "PlatformX86_64.h"
+#include "GlobalVariable.h"
+
+/// @brief 构造函数
+/// @param _module 符号表-模块
+ILocX86_64::ILocX86_64(Module * _module) : module(_module)
+{}
+
+/// @brief 析构函数
+ILocX86_64::~ILocX86_64()
+{
+    for (auto inst: code) {
+        delete inst;
+    }
+}
+
+/// @brief 获取当前的代码序列
+/// @return 代码序列
+std::list<X86Inst *> & ILocX86_64::getCode()
+{
+    return code;
+}
+
+/// @brief 产生一条指令
+/// @param op 操作码
+/// @param dst 目的操作数
+/// @param src 源操作数
+/// @param cond 条件码
+/// @return 新产生的指令
+X86Inst * ILocX86_64::inst(X86Op op, X86Operand dst, X86Operand src, X86Cond cond)
+{
+    X86Inst * x86 = new X86Inst(op, dst, src, cond);
+    code.push_back(x86);
+    return x86;
+}
+
+/// @brief 注释指令
+/// @param str 注释内容
+void ILocX86_64::comment(std::string str)
+{
+    inst(X86Op::COMMENT)->symbol = str;
+}
+
+/// @brief 标签指令
+/// @param name 标签名
+void ILocX86_64::label(std::string name)
+{
+    inst(X86Op::LABEL)->symbol = name;
+}
+
+/// @brief 无条件跳转指令
+/// @param label 目标标签名
+void ILocX86_64::jump(std::string label)
+{
+    inst(X86Op::JMP, X86Operand::makeLabel())->symbol = label;
+}
+
+/// @brief 条件跳转指令
+/// @param cond 条件
+/// @param label 目标标签名
+void ILocX86_64::branch(X86Cond cond, std::string label)
+{
+    inst(X86Op::JCC, X86Operand::makeLabel(), X86Operand(), cond)->symbol = label;
+}
+
+/// @brief 函数调用指令
+/// @param name 函数名
+void ILocX86_64::call_fun(std::string name)
+{
+    inst(X86Op::CALL, X86Operand::makeLabel())->symbol = name;
+}
+
+/// @brief 产生一条源或目的操作数为变量的指令，全局变量采用rip相对寻址，其它采用基址+偏移寻址
+/// @param op 操作码
+/// @param reg 寄存器操作数
+/// @param var 变量
+/// @param varIsDst 变量是否是目的操作数
+void ILocX86_64::inst_var(X86Op op, X86Operand reg, Value * var, bool varIsDst)
+{
+    X86Operand mem;
+    std::string symbol;
+
+    int32_t base_reg_no;
+    int64_t offset;
+
+    if (Instanceof(globalVar, GlobalVariable *, var)) {
+        // g(%rip)
+        mem = X86Operand::makeSymMem();
+        symbol = globalVar->getName();
+    } else if (var->getMemoryAddr(&base_reg_no, &offset)) {
+        // -8(%rbp)
+        mem = X86Operand::makeMem(base_reg_no, (int32_t) offset);
+    } else {
+        minic_log(LOG_ERROR, "变量(%s)没有分配栈空间", var->getIRName().c_str());
+        return;
+    }
+
+    X86Inst * x86 = varIsDst ? inst(op, mem, reg) : inst(op, reg, mem);
+    x86->symbol = symbol;
+}
+
+/// @brief 变量的值加载到寄存器：整数为32位，指针为64位，数组则取其首地址
+/// @param reg_no 寄存器编号
+/// @param var 变量
+void ILocX86_64::load_var(int reg_no, Value * var)
+{
+    if (Instanceof(constVal, ConstInt *, var)) {
+        // movl $100, %eax
+        inst(X86Op::MOVL, X86Operand::makeReg(reg_no, 4), X86Operand::makeImm(constVal->getVal()));
+    } else if (PlatformX86_64::isArrayStorage(var->getType())) {
+        // 数组的值为其首地址：leaq -400(%rbp), %rax
+        inst_var(X86Op::LEAQ, X86Operand::makeReg(reg_no, 8), var, false);
+    } else if (PlatformX86_64::isPointerValue(var->getType())) {
+        // movq -8(%rbp), %rax
+        inst_var(X86Op::MOVQ, X86Operand::makeReg(reg_no, 8), var, false);
+    } else {
+        // movl -4(%rbp), %eax
+        inst_var(X86Op::MOVL, X86Operand::makeReg(reg_no, 4), var, false);
+    }
+}
+
+/// @brief 整数变量的值符号扩展为64位后加载到寄存器，用于地址计算
+/// @param reg_no 寄存器编号
+/// @param var 变量
+void ILocX86_64::load_offset(int reg_no, Value * var)
+{
+    if (Instanceof(constVal, ConstInt *, var)) {
+        // movq $100, %rcx，立即数会被符号扩展
+        inst(X86Op::MOVQ, X86Operand::makeReg(reg_no, 8), X86Operand::makeImm(constVal->getVal()));
+    } else {
+        // movslq -4(%rbp), %rcx
+        inst_var(X86Op::MOVSLQ, X86Operand::makeReg(reg_no, 8), var, false);
+    }
+}
+
+/// @brief 寄存器的值保存到变量中，宽度由变量类型决定
+/// @param reg_no 寄存器编号
+/// @param var 变量
+void ILocX86_64::store_var(int reg_no, Value * var)
+{
+    if (PlatformX86_64::isPointerValue(var->getType())) {
+        // movq %rax, -8(%rbp)
+        inst_var(X86Op::MOVQ, X86Operand::makeReg(reg_no, 8), var, true);
+    } else {
+        // movl %eax, -4(%rbp)
+        inst_var(X86Op::MOVL, X86Operand::makeReg(reg_no, 4), var, true);
+    }
+}
+
+/// @brief 删除无用的Label指令
+void ILocX86_64::deleteUnusedLabel()
+{
+    // 被跳转指令引用的标签
+    std::unordered_set<std::string> usedLabels;
+    for (X86Inst * x86: code) {
+        if ((!x86->dead) && ((x86->opcode == X86Op::JMP) || (x86->opcode == X86Op::JCC))) {
+            usedLabels.insert(x86->symbol);
+        }
+    }
+
+    for (X86Inst * x86: code) {
+        if ((!x86->dead) && x86->isLabel() && !usedLabels.count(x86->symbol)) {
+            x86->setDead();
+        }
+    }
+}
+
+/// @brief 输出汇编
+/// @param file 输出的文件指针
+/// @param outputEmpty 是否输出空语句
+void ILocX86_64::outPut(FILE * file, bool outputEmpty)
+{
+    for (auto x86: code) {
+
+        std::string s = x86->outPut();
+
+        if (x86->isLabel() && !s.empty()) {
+            // Label指令，不需要Tab输出
+            fprintf(file, "%s\n", s.c_str());
+            continue;
+        }
+
+        if (!s.empty()) {
+            fprintf(file, "\t%s\n", s.c_str());
+        } else if ((outputEmpty)) {
+            fprintf(file, "\n");
+        }
+    }
+}
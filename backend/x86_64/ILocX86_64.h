@@ -0,0 +1,106 @@
+///
+/// @file ILocX86_64.h
+/// @brief x86-64指令序列管理的头文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdio>
+#include <list>
+#include <string>
+
+#include "X86Inst.h"
+#include "Module.h"
+
+#define Instanceof(res, type, var) auto res = dynamic_cast<type>(var)
+
+/// @brief 底层汇编序列-x86-64
+class ILocX86_64 {
+
+    /// @brief x86-64汇编序列
+    std::list<X86Inst *> code;
+
+    /// @brief 符号表
+    Module * module;
+
+    /// @brief 产生一条源或目的操作数为变量的指令，全局变量采用rip相对寻址，其它采用基址+偏移寻址
+    /// @param op 操作码
+    /// @param reg 寄存器操作数
+    /// @param var 变量
+    /// @param varIsDst 变量是否是目的操作数
+    void inst_var(X86Op op, X86Operand reg, Value * var, bool varIsDst);
+
+public:
+    /// @brief 构造函数
+    /// @param _module 符号表-模块
+    ILocX86_64(Module * _module);
+
+    /// @brief 析构函数
+    ~ILocX86_64();
+
+    /// @brief 获取当前的代码序列
+    /// @return 代码序列
+    std::list<X86Inst *> & getCode();
+
+    /// @brief 产生一条指令
+    /// @param op 操作码
+    /// @param dst 目的操作数
+    /// @param src 源操作数
+    /// @param cond 条件码
+    /// @return 新产生的指令
+    X86Inst * inst(X86Op op, X86Operand dst = X86Operand(), X86Operand src = X86Operand(), X86Cond cond = X86Cond::NONE);
+
+    /// @brief 注释指令
+    /// @param str 注释内容
+    void comment(std::string str);
+
+    /// @brief 标签指令
+    /// @param name 标签名
+    void label(std::string name);
+
+    /// @brief 无条件跳转指令
+    /// @param label 目标标签名
+    void jump(std::string label);
+
+    /// @brief 条件跳转指令
+    /// @param cond 条件
+    /// @param label 目标标签名
+    void branch(X86Cond cond, std::string label);
+
+    /// @brief 函数调用指令
+    /// @param name 函数名
+    void call_fun(std::string name);
+
+    /// @brief 变量的值加载到寄存器：整数为32位，指针为64位，数组则取其首地址
+    /// @param reg_no 寄存器编号
+    /// @param var 变量
+    void load_var(int reg_no, Value * var);
+
+    /// @brief 整数变量的值符号扩展为64位后加载到寄存器，用于地址计算
+    /// @param reg_no 寄存器编号
+    /// @param var 变量
+    void load_offset(int reg_no, Value * var);
+
+    /// @brief 寄存器的值保存到变量中，宽度由变量类型决定
+    /// @param reg_no 寄存器编号
+    /// @param var 变量
+    void store_var(int reg_no, Value * var);
+
+    /// @brief 删除无用的Label指令
+    void deleteUnusedLabel();
+
+    /// @brief 输出汇编
+    /// @param file 输出的文件指针
+    /// @param outputEmpty 是否输出空语句
+    void outPut(FILE * file, bool outputEmpty = false);
+};
@@ -0,0 +1,454 @@
+///
+/// @file InstSelectorX86_64.cpp
+/// @brief 指令选择器-x86-64的实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cstdio>
+#include <utility>
+
+#include "Common.h"
+#include "ILocX86_64.h"
+#include "InstSelectorX86_64.h"
+#include "PlatformX86_64.h"
+
+#include "Function.h"
+
+#include "LabelInstruction.h"
+#include "GotoInstruction.h"
+#include "FuncCallInstruction.h"
+#include "BranchInstruction.h"
+
+/// @brief 32位寄存器操作数
+#define REG32(no) X86Operand::makeReg(no, 4)
+
+/// @brief 64位寄存器操作数
+#define REG64(no) X86Operand::makeReg(no, 8)
+
+/// @brief 立即数操作数
+#define IMM(num) X86Operand::makeImm(num)
+
+/// @brief 构造函数
+/// @param _irCode 指令
+/// @param _iloc ILoc
+/// @param _func 函数
+InstSelectorX86_64::InstSelectorX86_64(std::vector<Instruction *> & _irCode, ILocX86_64 & _iloc, Function * _func)
+    : ir(_irCode), iloc(_iloc), func(_func)
+{
+    translator_handlers[IRInstOperator::IRINST_OP_ENTRY] = &InstSelectorX86_64::translate_entry;
+    translator_handlers[IRInstOperator::IRINST_OP_EXIT] = &InstSelectorX86_64::translate_exit;
+
+    translator_handlers[IRInstOperator::IRINST_OP_LABEL] = &InstSelectorX86_64::translate_label;
+    translator_handlers[IRInstOperator::IRINST_OP_GOTO] = &InstSelectorX86_64::translate_goto;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ASSIGN] = &InstSelectorX86_64::translate_assign;
+
+    translator_handlers[IRInstOperator::IRINST_OP_ADD_I] = &InstSelectorX86_64::translate_add_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_SUB_I] = &InstSelectorX86_64::translate_sub_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MUL_I] = &InstSelectorX86_64::translate_mul_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_DIV_I] = &InstSelectorX86_64::translate_div_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_MOD_I] = &InstSelectorX86_64::translate_mod_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NEG_I] = &InstSelectorX86_64::translate_neg_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_GT_I] = &InstSelectorX86_64::translate_gt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_GE_I] = &InstSelectorX86_64::translate_ge_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LT_I] = &InstSelectorX86_64::translate_lt_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_LE_I] = &InstSelectorX86_64::translate_le_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_EQ_I] = &InstSelectorX86_64::translate_eq_int32;
+    translator_handlers[IRInstOperator::IRINST_OP_NE_I] = &InstSelectorX86_64::translate_ne_int32;
+
+    translator_handlers[IRInstOperator::IRINST_OP_BC] = &InstSelectorX86_64::translate_bc;
+
+    translator_handlers[IRInstOperator::IRINST_OP_FUNC_CALL] = &InstSelectorX86_64::translate_call;
+
+    // 条件分支与按名字跳转的goto指令引用的是IR中的标签名，这里记录其对应的Label指令
+    for (auto inst: ir) {
+        if (Instanceof(labelInst, LabelInstruction *, inst)) {
+            if (labelInst->getLabel() != 0) {
+                labelInsts[labelInst->getLabel()] = labelInst;
+            }
+        }
+    }
+}
+
+///
+/// @brief 析构函数
+///
+InstSelectorX86_64::~InstSelectorX86_64()
+{}
+
+/// @brief 指令选择执行
+void InstSelectorX86_64::run()
+{
+    for (auto inst: ir) {
+
+        // 逐个指令进行翻译
+        if (!inst->isDead()) {
+            translate(inst);
+        }
+    }
+}
+
+/// @brief 指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate(Instruction * inst)
+{
+    // 操作符
+    IRInstOperator op = inst->getOp();
+
+    auto pIter = translator_handlers.find(op);
+    if (pIter == translator_handlers.end()) {
+        // 没有找到，则说明当前不支持
+        minic_log(LOG_ERROR, "Translate: Operator(%d) not support", (int) op);
+        return;
+    }
+
+    // 开启时输出IR指令作为注释
+    if (showLinearIR) {
+        outputIRInstruction(inst);
+    }
+
+    (this->*(pIter->second))(inst);
+}
+
+///
+/// @brief 输出IR指令
+///
+void InstSelectorX86_64::outputIRInstruction(Instruction * inst)
+{
+    std::string irStr;
+    inst->toString(irStr);
+    if (!irStr.empty()) {
+        iloc.comment(irStr);
+    }
+}
+
+///
+/// @brief 根据IR中的标签名称获取汇编中的标签名
+/// @param irLabel IR标签名称
+/// @return std::string 汇编标签名
+///
+std::string InstSelectorX86_64::getAsmLabel(Symbol irLabel)
+{
+    auto pIter = labelInsts.find(irLabel);
+    if (pIter == labelInsts.end()) {
+        minic_log(LOG_ERROR, "标签(%s)不存在", symbolName(irLabel).data());
+        return std::string(symbolName(irLabel));
+    }
+
+    return pIter->second->getName();
+}
+
+/// @brief Label指令指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_label(Instruction * inst)
+{
+    iloc.label(inst->getName());
+}
+
+/// @brief goto指令指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_goto(Instruction * inst)
+{
+    Instanceof(gotoInst, GotoInstruction *, inst);
+
+    // 无条件跳转，目标可能是Label指令，也可能是标签名称
+    if (gotoInst->getTarget()) {
+        iloc.jump(gotoInst->getTarget()->getName());
+    } else {
+        iloc.jump(getAsmLabel(gotoInst->getLabel()));
+    }
+}
+
+/// @brief 函数入口指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_entry(Instruction * inst)
+{
+    (void) inst;
+
+    // pushq %rbp; movq %rsp, %rbp
+    iloc.inst(X86Op::PUSHQ, REG64(X86_RBP_REG_NO));
+    iloc.inst(X86Op::MOVQ, REG64(X86_RBP_REG_NO), REG64(X86_RSP_REG_NO));
+
+    // 栈帧大小已按16字节对齐，保证函数调用时rsp的对齐
+    if (func->getMaxDep()) {
+        iloc.inst(X86Op::SUBQ, REG64(X86_RSP_REG_NO), IMM(func->getMaxDep()));
+    }
+
+    // 寄存器传递的形参保存到其栈内空间中
+    auto & params = func->getParams();
+    for (int k = 0; k < (int) params.size() && k < PlatformX86_64::maxArgRegNum; k++) {
+        iloc.store_var(PlatformX86_64::argRegNo[k], params[k]);
+    }
+}
+
+/// @brief 函数出口指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_exit(Instruction * inst)
+{
+    if (inst->getOperandsNum()) {
+        // 存在返回值，通过eax返回
+        iloc.load_var(X86_RAX_REG_NO, inst->getOperand(0));
+    }
+
+    // 恢复栈帧并返回
+    iloc.inst(X86Op::LEAVE);
+    iloc.inst(X86Op::RET);
+}
+
+/// @brief 赋值指令翻译成x86-64汇编，含通过指针的读与写
+/// @param inst IR指令
+void InstSelectorX86_64::translate_assign(Instruction * inst)
+{
+    Value * result = inst->getOperand(0);
+    Value * arg1 = inst->getOperand(1);
+
+    bool resultIsPointer = PlatformX86_64::isPointerValue(result->getType());
+    bool arg1IsPointer = PlatformX86_64::isPointerValue(arg1->getType());
+
+    if (result->getType()->isPointerType() && !arg1IsPointer) {
+        // 通过指针写：*%t = x
+        // movl x, %eax; movq %t, %rcx; movl %eax, (%rcx)
+        iloc.load_var(X86_RAX_REG_NO, arg1);
+        iloc.load_var(X86_RCX_REG_NO, result);
+        iloc.inst(X86Op::MOVL, X86Operand::makeMem(X86_RCX_REG_NO, 0), REG32(X86_RAX_REG_NO));
+    } else if (arg1->getType()->isPointerType() && !resultIsPointer) {
+        // 通过指针读：x = *%t
+        // movq %t, %rax; movl (%rax), %eax; movl %eax, x
+        iloc.load_var(X86_RAX_REG_NO, arg1);
+        iloc.inst(X86Op::MOVL, REG32(X86_RAX_REG_NO), X86Operand::makeMem(X86_RAX_REG_NO, 0));
+        iloc.store_var(X86_RAX_REG_NO, result);
+    } else {
+        // 变量之间的复制，宽度由结果的类型决定
+        iloc.load_var(X86_RAX_REG_NO, arg1);
+        iloc.store_var(X86_RAX_REG_NO, result);
+    }
+}
+
+/// @brief 32位二元操作指令翻译成x86-64汇编
+/// @param inst IR指令
+/// @param op 操作码
+void InstSelectorX86_64::translate_two_operator(Instruction * inst, X86Op op)
+{
+    Value * arg1 = inst->getOperand(0);
+    Value * arg2 = inst->getOperand(1);
+
+    // movl a, %eax; movl b, %ecx; op %ecx, %eax; movl %eax, r
+    iloc.load_var(X86_RAX_REG_NO, arg1);
+    iloc.load_var(X86_RCX_REG_NO, arg2);
+    iloc.inst(op, REG32(X86_RAX_REG_NO), REG32(X86_RCX_REG_NO));
+    iloc.store_var(X86_RAX_REG_NO, inst);
+}
+
+/// @brief 结果为指针的加减法，整数偏移符号扩展为64位后参与运算
+/// @param inst IR指令
+/// @param op 操作码，ADDQ或SUBQ
+void InstSelectorX86_64::translate_pointer_operator(Instruction * inst, X86Op op)
+{
+    Value * base = inst->getOperand(0);
+    Value * offset = inst->getOperand(1);
+
+    // 加法满足交换律，地址可能是第二个操作数
+    if ((op == X86Op::ADDQ) && (PlatformX86_64::isPointerValue(offset->getType()) ||
+                                PlatformX86_64::isArrayStorage(offset->getType()))) {
+        std::swap(base, offset);
+    }
+
+    // leaq/movq base, %rax; movslq offset, %rcx; addq %rcx, %rax; movq %rax, r
+    iloc.load_var(X86_RAX_REG_NO, base);
+    iloc.load_offset(X86_RCX_REG_NO, offset);
+    iloc.inst(op, REG64(X86_RAX_REG_NO), REG64(X86_RCX_REG_NO));
+    iloc.store_var(X86_RAX_REG_NO, inst);
+}
+
+/// @brief 整数加法指令翻译成x86-64汇编，结果为指针时为地址计算
+/// @param inst IR指令
+void InstSelectorX86_64::translate_add_int32(Instruction * inst)
+{
+    if (PlatformX86_64::isPointerValue(inst->getType())) {
+        translate_pointer_operator(inst, X86Op::ADDQ);
+    } else {
+        translate_two_operator(inst, X86Op::ADDL);
+    }
+}
+
+/// @brief 整数减法指令翻译成x86-64汇编，结果为指针时为地址计算
+/// @param inst IR指令
+void InstSelectorX86_64::translate_sub_int32(Instruction * inst)
+{
+    if (PlatformX86_64::isPointerValue(inst->getType())) {
+        translate_pointer_operator(inst, X86Op::SUBQ);
+    } else {
+        translate_two_operator(inst, X86Op::SUBL);
+    }
+}
+
+/// @brief 整数乘法指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_mul_int32(Instruction * inst)
+{
+    translate_two_operator(inst, X86Op::IMULL);
+}
+
+/// @brief 除法与求余，被除数符号扩展到edx:eax后idivl
+/// @param inst IR指令
+/// @param result_reg_no 结果所在寄存器，商在eax，余数在edx
+void InstSelectorX86_64::translate_divide(Instruction * inst, int result_reg_no)
+{
+    // movl a, %eax; movl b, %ecx; cltd; idivl %ecx
+    iloc.load_var(X86_RAX_REG_NO, inst->getOperand(0));
+    iloc.load_var(X86_RCX_REG_NO, inst->getOperand(1));
+    iloc.inst(X86Op::CLTD);
+    iloc.inst(X86Op::IDIVL, REG32(X86_RCX_REG_NO));
+    iloc.store_var(result_reg_no, inst);
+}
+
+/// @brief 整数除法指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_div_int32(Instruction * inst)
+{
+    translate_divide(inst, X86_RAX_REG_NO);
+}
+
+/// @brief 整数求余指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_mod_int32(Instruction * inst)
+{
+    translate_divide(inst, X86_RDX_REG_NO);
+}
+
+/// @brief 整数求负指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_neg_int32(Instruction * inst)
+{
+    // movl a, %eax; negl %eax; movl %eax, r
+    iloc.load_var(X86_RAX_REG_NO, inst->getOperand(0));
+    iloc.inst(X86Op::NEGL, REG32(X86_RAX_REG_NO));
+    iloc.store_var(X86_RAX_REG_NO, inst);
+}
+
+/// @brief 通用比较函数，cmpl后通过setcc得到0或1
+/// @param inst IR指令
+/// @param cond 条件码
+void InstSelectorX86_64::translate_compare(Instruction * inst, X86Cond cond)
+{
+    // movl a, %eax; movl b, %ecx; cmpl %ecx, %eax; setcc %al; movzbl %al, %eax
+    iloc.load_var(X86_RAX_REG_NO, inst->getOperand(0));
+    iloc.load_var(X86_RCX_REG_NO, inst->getOperand(1));
+    iloc.inst(X86Op::CMPL, REG32(X86_RAX_REG_NO), REG32(X86_RCX_REG_NO));
+    iloc.inst(X86Op::SETCC, X86Operand::makeReg(X86_RAX_REG_NO, 1), X86Operand(), cond);
+    iloc.inst(X86Op::MOVZBL, REG32(X86_RAX_REG_NO), X86Operand::makeReg(X86_RAX_REG_NO, 1));
+    iloc.store_var(X86_RAX_REG_NO, inst);
+}
+
+/// @brief 大于比较指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_gt_int32(Instruction * inst)
+{
+    translate_compare(inst, X86Cond::G);
+}
+
+/// @brief 大于等于比较指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_ge_int32(Instruction * inst)
+{
+    translate_compare(inst, X86Cond::GE);
+}
+
+/// @brief 小于比较指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_lt_int32(Instruction * inst)
+{
+    translate_compare(inst, X86Cond::L);
+}
+
+/// @brief 小于等于比较指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_le_int32(Instruction * inst)
+{
+    translate_compare(inst, X86Cond::LE);
+}
+
+/// @brief 等于比较指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_eq_int32(Instruction * inst)
+{
+    translate_compare(inst, X86Cond::E);
+}
+
+/// @brief 不等于比较指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_ne_int32(Instruction * inst)
+{
+    translate_compare(inst, X86Cond::NE);
+}
+
+/// @brief 条件分支指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_bc(Instruction * inst)
+{
+    Instanceof(branchInst, BranchInstruction *, inst);
+
+    if (!branchInst) {
+        minic_log(LOG_ERROR, "转换BranchInstruction失败");
+        return;
+    }
+
+    // movl cond, %eax; cmpl $0, %eax; jne true; jmp false
+    iloc.load_var(X86_RAX_REG_NO, inst->getOperand(0));
+    iloc.inst(X86Op::CMPL, REG32(X86_RAX_REG_NO), IMM(0));
+    iloc.branch(X86Cond::NE, getAsmLabel(branchInst->getTrueLabel()));
+    iloc.jump(getAsmLabel(branchInst->getFalseLabel()));
+}
+
+/// @brief 函数调用指令翻译成x86-64汇编
+/// @param inst IR指令
+void InstSelectorX86_64::translate_call(Instruction * inst)
+{
+    Instanceof(callInst, FuncCallInstruction *, inst);
+
+    int32_t operandNum = callInst->getOperandsNum();
+
+    // 前6个之后的实参按8字节入栈，第7个在最低地址，栈空间按16字节对齐
+    int32_t stackArgSize = 0;
+    if (operandNum > PlatformX86_64::maxArgRegNum) {
+        stackArgSize = ((operandNum - PlatformX86_64::maxArgRegNum) * 8 + 15) & ~15;
+        iloc.inst(X86Op::SUBQ, REG64(X86_RSP_REG_NO), IMM(stackArgSize));
+    }
+
+    for (int32_t k = PlatformX86_64::maxArgRegNum; k < operandNum; k++) {
+
+        auto arg = callInst->getOperand(k);
+
+        // movl a, %eax; movq %rax, 8*(k-6)(%rsp)
+        iloc.load_var(X86_RAX_REG_NO, arg);
+        iloc.inst(X86Op::MOVQ,
+                  X86Operand::makeMem(X86_RSP_REG_NO, (k - PlatformX86_64::maxArgRegNum) * 8),
+                  REG64(X86_RAX_REG_NO));
+    }
+
+    // 寄存器传递的实参直接加载到对应的寄存器，加载时不会使用其它寄存器
+    for (int32_t k = 0; k < operandNum && k < PlatformX86_64::maxArgRegNum; k++) {
+        iloc.load_var(PlatformX86_64::argRegNo[k], callInst->getOperand(k));
+    }
+
+    iloc.call_fun(callInst->getCalledName());
+
+    if (stackArgSize) {
+        iloc.inst(X86Op::ADDQ, REG64(X86_RSP_REG_NO), IMM(stackArgSize));
+    }
+
+    // 返回值在eax中
+    if (callInst->hasResultValue()) {
+        iloc.store_var(X86_RAX_REG_NO, callInst);
+    }
+}
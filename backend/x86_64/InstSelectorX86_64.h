@@ -0,0 +1,196 @@
+///
+/// @file InstSelectorX86_64.h
+/// @brief 指令选择器-x86-64
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "ILocX86_64.h"
+#include "Instruction.h"
+#include "StringInterner.h"
+#include "PlatformX86_64.h"
+
+/// @brief 指令选择器-x86-64
+///
+/// 变量与临时变量都在栈中，每条IR指令的操作数依次读入rax、rcx中计算，结果写回栈中。
+/// 函数调用遵循System V AMD64 ABI：前6个整数实参经rdi、rsi、rdx、rcx、r8、r9传递，其余逆序入栈，
+/// call指令执行前rsp需16字节对齐。
+class InstSelectorX86_64 {
+
+    /// @brief 所有的IR指令
+    std::vector<Instruction *> & ir;
+
+    /// @brief 指令变换
+    ILocX86_64 & iloc;
+
+    /// @brief 要处理的函数
+    Function * func;
+
+protected:
+    /// @brief 指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate(Instruction * inst);
+
+    /// @brief 函数入口指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_entry(Instruction * inst);
+
+    /// @brief 函数出口指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_exit(Instruction * inst);
+
+    /// @brief 赋值指令翻译成x86-64汇编，含通过指针的读与写
+    /// @param inst IR指令
+    void translate_assign(Instruction * inst);
+
+    /// @brief Label指令指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_label(Instruction * inst);
+
+    /// @brief goto指令指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_goto(Instruction * inst);
+
+    /// @brief 整数加法指令翻译成x86-64汇编，结果为指针时为地址计算
+    /// @param inst IR指令
+    void translate_add_int32(Instruction * inst);
+
+    /// @brief 整数减法指令翻译成x86-64汇编，结果为指针时为地址计算
+    /// @param inst IR指令
+    void translate_sub_int32(Instruction * inst);
+
+    /// @brief 整数乘法指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_mul_int32(Instruction * inst);
+
+    /// @brief 整数除法指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_div_int32(Instruction * inst);
+
+    /// @brief 整数求余指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_mod_int32(Instruction * inst);
+
+    /// @brief 整数求负指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_neg_int32(Instruction * inst);
+
+    /// @brief 大于比较指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_gt_int32(Instruction * inst);
+
+    /// @brief 大于等于比较指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_ge_int32(Instruction * inst);
+
+    /// @brief 小于比较指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_lt_int32(Instruction * inst);
+
+    /// @brief 小于等于比较指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_le_int32(Instruction * inst);
+
+    /// @brief 等于比较指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_eq_int32(Instruction * inst);
+
+    /// @brief 不等于比较指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_ne_int32(Instruction * inst);
+
+    /// @brief 条件分支指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_bc(Instruction * inst);
+
+    /// @brief 通用比较函数，cmpl后通过setcc得到0或1
+    /// @param inst IR指令
+    /// @param cond 条件码
+    void translate_compare(Instruction * inst, X86Cond cond);
+
+    /// @brief 32位二元操作指令翻译成x86-64汇编
+    /// @param inst IR指令
+    /// @param op 操作码
+    void translate_two_operator(Instruction * inst, X86Op op);
+
+    /// @brief 结果为指针的加减法，整数偏移符号扩展为64位后参与运算
+    /// @param inst IR指令
+    /// @param op 操作码，ADDQ或SUBQ
+    void translate_pointer_operator(Instruction * inst, X86Op op);
+
+    /// @brief 除法与求余，被除数符号扩展到edx:eax后idivl
+    /// @param inst IR指令
+    /// @param result_reg_no 结果所在寄存器，商在eax，余数在edx
+    void translate_divide(Instruction * inst, int result_reg_no);
+
+    /// @brief 函数调用指令翻译成x86-64汇编
+    /// @param inst IR指令
+    void translate_call(Instruction * inst);
+
+    ///
+    /// @brief 输出IR指令
+    ///
+    void outputIRInstruction(Instruction * inst);
+
+    ///
+    /// @brief 根据IR中的标签名称获取汇编中的标签名
+    /// @param irLabel IR标签名称的驻留编号
+    /// @return std::string 汇编标签名
+    ///
+    std::string getAsmLabel(Symbol irLabel);
+
+    /// @brief IR翻译动作函数原型
+    typedef void (InstSelectorX86_64::*translate_handler)(Instruction *);
+
+    /// @brief IR动作处理函数清单
+    std::map<IRInstOperator, translate_handler> translator_handlers;
+
+    ///
+    /// @brief IR标签名称到Label指令的映射，Label指令的名字为文件级唯一的汇编标签名
+    ///
+    std::unordered_map<Symbol, Instruction *> labelInsts;
+
+    ///
+    /// @brief 显示IR指令内容
+    ///
+    bool showLinearIR = false;
+
+public:
+    /// @brief 构造函数
+    /// @param _irCode IR指令
+    /// @param _iloc 后端指令
+    /// @param _func 函数
+    InstSelectorX86_64(std::vector<Instruction *> & _irCode, ILocX86_64 & _iloc, Function * _func);
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~InstSelectorX86_64();
+
+    ///
+    /// @brief 设置是否输出线性IR的内容
+    /// @param show true显示，false显示
+    ///
+    void setShowLinearIR(bool show)
+    {
+        showLinearIR = show;
+    }
+
+    /// @brief 指令选择
+    void run();
+};
@@ -0,0 +1,378 @@
+///
+/// @file JitX86_64.cpp
+/// @brief x86-64的即时编译执行，机器码直接生成到可执行内存中运行
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#define JIT_X86_64_SUPPORTED 1
+#endif
+
+#include "Common.h"
+#include "Function.h"
+#include "Module.h"
+#include "JitX86_64.h"
+#include "X86Encoder.h"
+
+/// @brief 代码区的大小
+static const size_t JIT_CODE_SIZE = 16 * 1024 * 1024;
+
+/// @brief 内置函数putint
+static void jitPutint(int32_t val)
+{
+    printf("%d", val);
+}
+
+/// @brief 内置函数getint
+static int32_t jitGetint()
+{
+    int32_t val = 0;
+    if (scanf("%d", &val) != 1) {
+        val = 0;
+    }
+    return val;
+}
+
+/// @brief 内置函数putch
+static void jitPutch(int32_t ch)
+{
+    putchar((char) ch);
+}
+
+/// @brief 内置函数getch
+static int32_t jitGetch()
+{
+    int ch = getchar();
+    return (ch == EOF) ? -1 : (char) ch;
+}
+
+/// @brief 内置函数putarray
+static void jitPutarray(int32_t n, int32_t * arr)
+{
+    printf("%d:", n);
+    for (int32_t k = 0; k < n; k++) {
+        printf(" %d", arr[k]);
+    }
+    printf("\n");
+}
+
+/// @brief 内置函数getarray
+static int32_t jitGetarray(int32_t * arr)
+{
+    int32_t n = 0;
+    if (scanf("%d", &n) != 1) {
+        return 0;
+    }
+    for (int32_t k = 0; k < n; k++) {
+        if (scanf("%d", &arr[k]) != 1) {
+            arr[k] = 0;
+        }
+    }
+    return n;
+}
+
+/// @brief 获取内置函数在宿主中的实现
+/// @param name 函数名
+/// @return 函数地址，不是内置函数时为nullptr
+static void * builtinAddr(const std::string & name)
+{
+    if (name == "putint") {
+        return (void *) jitPutint;
+    } else if (name == "getint") {
+        return (void *) jitGetint;
+    } else if (name == "putch") {
+        return (void *) jitPutch;
+    } else if (name == "getch") {
+        return (void *) jitGetch;
+    } else if (name == "putarray") {
+        return (void *) jitPutarray;
+    } else if (name == "getarray") {
+        return (void *) jitGetarray;
+    }
+
+    return nullptr;
+}
+
+/// @brief 构造函数
+/// @param _module 符号表
+JitX86_64::JitX86_64(Module * _module) : CodeGeneratorX86_64(_module)
+{}
+
+/// @brief 析构函数
+JitX86_64::~JitX86_64()
+{
+#ifdef JIT_X86_64_SUPPORTED
+    if (region) {
+        munmap(region, regionSize);
+    }
+#endif
+}
+
+/// @brief 编译并执行main函数
+/// @param exitCode main函数的返回值
+/// @return true：成功，false：内存分配失败或者没有main函数
+bool JitX86_64::execute(int & exitCode)
+{
+#ifdef JIT_X86_64_SUPPORTED
+    if (!prepare()) {
+        return false;
+    }
+
+    auto pIter = funcIndex.find("main");
+    if (pIter == funcIndex.end()) {
+        minic_log(LOG_ERROR, "没有main函数");
+        return false;
+    }
+
+    // 经过槽位调用，main函数也在第一次调用时编译
+    using MainFunc = int32_t (*)();
+    auto mainFunc = reinterpret_cast<MainFunc>(slots[pIter->second]);
+
+    exitCode = mainFunc();
+
+    fflush(stdout);
+
+    return true;
+#else
+    (void) exitCode;
+    minic_log(LOG_ERROR, "JIT只支持x86-64的Linux主机");
+    return false;
+#endif
+}
+
+/// @brief 分配可执行内存，全局变量设置初值，槽位表指向内置函数或跳板代码
+/// @return true：成功
+bool JitX86_64::prepare()
+{
+#ifdef JIT_X86_64_SUPPORTED
+    auto align = [](size_t size, size_t alignment) { return (size + alignment - 1) & ~(alignment - 1); };
+
+    // 全局变量的空间
+    size_t dataSize = 0;
+    for (auto var: module->getGlobalVariables()) {
+        dataSize = align(dataSize, 8) + var->getType()->getSize();
+    }
+    dataSize = align(dataSize, 16);
+
+    for (auto func: module->getFunctionList()) {
+        funcIndex[func->getName()] = (int32_t) funcs.size();
+        funcs.push_back(func);
+    }
+
+    size_t slotSize = align(funcs.size() * sizeof(void *), 16);
+
+    // rip相对寻址的偏移为32位，所有内容必须在同一块不超过2G的内存中
+    regionSize = align(dataSize + slotSize + JIT_CODE_SIZE, 4096);
+    if (regionSize >= 0x7fffffffUL) {
+        minic_log(LOG_ERROR, "全局变量过大，JIT无法执行");
+        return false;
+    }
+
+    void * mem = mmap(nullptr, regionSize, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        minic_log(LOG_ERROR, "可执行内存分配失败");
+        return false;
+    }
+
+    region = (uint8_t *) mem;
+
+    // 全局变量，mmap分配的内存已清0，只需写入初值
+    size_t offset = 0;
+    std::vector<int32_t> words;
+    for (auto var: module->getGlobalVariables()) {
+
+        offset = align(offset, 8);
+
+        uint8_t * addr = region + offset;
+        globalAddr[var->getName()] = addr;
+
+        getInitWords(var, words);
+        size_t size = std::min(words.size() * 4, (size_t) var->getType()->getSize());
+        memcpy(addr, words.data(), size);
+
+        offset += var->getType()->getSize();
+    }
+
+    slots = (void **) (region + dataSize);
+    codeTop = region + dataSize + slotSize;
+    codeEnd = region + regionSize;
+
+    // 内置函数的槽位指向宿主的实现，其它函数指向跳板代码
+    for (int32_t index = 0; index < (int32_t) funcs.size(); index++) {
+
+        Function * func = funcs[index];
+        if (func->isBuiltin()) {
+            slots[index] = builtinAddr(func->getName());
+            if (!slots[index]) {
+                minic_log(LOG_ERROR, "内置函数(%s)没有实现", func->getName().c_str());
+                return false;
+            }
+        } else {
+            slots[index] = genTrampoline(index);
+            if (!slots[index]) {
+                minic_log(LOG_ERROR, "代码区空间不足");
+                return false;
+            }
+        }
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+/// @brief 产生函数的跳板代码：保存实参寄存器，调用lazyCompile编译函数后跳转到函数
+/// @param index 函数在槽位表中的下标
+/// @return 跳板代码的地址
+uint8_t * JitX86_64::genTrampoline(int32_t index)
+{
+    std::vector<uint8_t> code;
+
+    auto emitImm = [&code](uint64_t val, int size) {
+        for (int k = 0; k < size; k++) {
+            code.push_back((uint8_t) (val >> (8 * k)));
+        }
+    };
+
+    // 保存寄存器传递的实参：push rdi, rsi, rdx, rcx, r8, r9
+    code.insert(code.end(), {0x57, 0x56, 0x52, 0x51, 0x41, 0x50, 0x41, 0x51});
+
+    // 进入时rsp为16n+8，压入6个寄存器后再减8使得call前16字节对齐：subq $8, %rsp
+    code.insert(code.end(), {0x48, 0x83, 0xEC, 0x08});
+
+    // movabsq $jit, %rdi
+    code.insert(code.end(), {0x48, 0xBF});
+    emitImm((uint64_t) this, 8);
+
+    // movl $index, %esi
+    code.push_back(0xBE);
+    emitImm((uint64_t) index, 4);
+
+    // movabsq $lazyCompile, %rax
+    code.insert(code.end(), {0x48, 0xB8});
+    emitImm((uint64_t) &JitX86_64::lazyCompile, 8);
+
+    // call *%rax
+    code.insert(code.end(), {0xFF, 0xD0});
+
+    // addq $8, %rsp，之后按相反顺序恢复实参寄存器
+    code.insert(code.end(), {0x48, 0x83, 0xC4, 0x08});
+    code.insert(code.end(), {0x41, 0x59, 0x41, 0x58, 0x59, 0x5A, 0x5E, 0x5F});
+
+    // 返回地址与栈传递的实参都没有变化，直接跳转到编译好的函数：jmp *%rax
+    code.insert(code.end(), {0xFF, 0xE0});
+
+    uint8_t * addr = allocCode(code.size());
+    if (addr) {
+        memcpy(addr, code.data(), code.size());
+    }
+
+    return addr;
+}
+
+/// @brief 编译函数，机器码放到代码区并回填槽位
+/// @param index 函数在槽位表中的下标
+/// @return 函数的机器码地址，失败时为nullptr
+uint8_t * JitX86_64::compileFunction(int32_t index)
+{
+    Function * func = funcs[index];
+
+    // 与输出汇编一样进行栈分配与指令选择
+    ILocX86_64 iloc(module);
+    selectInstructions(func, iloc);
+
+    X86Encoder encoder;
+    if (!encoder.encode(iloc.getCode())) {
+        return nullptr;
+    }
+
+    const std::vector<uint8_t> & bytes = encoder.getBytes();
+
+    uint8_t * code = allocCode(bytes.size());
+    if (!code) {
+        minic_log(LOG_ERROR, "代码区空间不足");
+        return nullptr;
+    }
+
+    memcpy(code, bytes.data(), bytes.size());
+
+    // 全局变量与函数槽位都在同一块内存中，rip相对偏移一定在32位范围内
+    for (auto & fixup: encoder.getSymbolFixups()) {
+
+        uint8_t * target = nullptr;
+
+        if (fixup.isCall) {
+            auto pIter = funcIndex.find(fixup.symbol);
+            if (pIter != funcIndex.end()) {
+                target = (uint8_t *) &slots[pIter->second];
+            }
+        } else {
+            auto pIter = globalAddr.find(fixup.symbol);
+            if (pIter != globalAddr.end()) {
+                target = pIter->second;
+            }
+        }
+
+        if (!target) {
+            minic_log(LOG_ERROR, "符号(%s)不存在", fixup.symbol.c_str());
+            return nullptr;
+        }
+
+        int32_t rel = (int32_t) (target - (code + fixup.instEnd));
+        memcpy(code + fixup.offset, &rel, sizeof(rel));
+    }
+
+    slots[index] = code;
+
+    return code;
+}
+
+/// @brief 跳板代码调用的入口，编译失败时无法返回JIT代码继续执行，只能结束进程
+/// @param jit JIT执行器
+/// @param index 函数在槽位表中的下标
+/// @return 函数的机器码地址
+void * JitX86_64::lazyCompile(JitX86_64 * jit, int32_t index)
+{
+    uint8_t * code = jit->compileFunction(index);
+    if (!code) {
+        minic_log(LOG_ERROR, "函数(%s)JIT编译错误", jit->funcs[index]->getName().c_str());
+        fflush(stdout);
+        exit(-1);
+    }
+
+    return code;
+}
+
+/// @brief 在代码区分配空间，按16字节对齐
+/// @param size 字节数
+/// @return 地址，空间不足时为nullptr
+uint8_t * JitX86_64::allocCode(size_t size)
+{
+    uint8_t * addr = (uint8_t *) (((uintptr_t) codeTop + 15) & ~(uintptr_t) 15);
+    if (addr + size > codeEnd) {
+        return nullptr;
+    }
+
+    codeTop = addr + size;
+
+    return addr;
+}
@@ -0,0 +1,98 @@
+///
+/// @file JitX86_64.h
+/// @brief x86-64的即时编译执行，机器码直接生成到可执行内存中运行
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CodeGeneratorX86_64.h"
+
+///
+/// @brief x86-64的JIT执行器
+///
+/// 复用x86-64后端的指令选择，由X86Encoder编码成机器码后放到mmap分配的可执行内存中执行。
+/// 内存中依次为全局变量、函数地址槽位表与代码区，都在同一块内存中，因此可统一采用rip相对寻址。
+/// 函数调用都经过槽位表间接调用：内置函数的槽位指向宿主的C函数；
+/// 其它函数的槽位开始指向一段跳板代码，第一次被调用时才编译该函数并回填槽位，即按需编译。
+///
+class JitX86_64 : public CodeGeneratorX86_64 {
+
+public:
+    /// @brief 构造函数
+    /// @param module 符号表
+    JitX86_64(Module * module);
+
+    /// @brief 析构函数
+    ~JitX86_64() override;
+
+    /// @brief 编译并执行main函数
+    /// @param exitCode main函数的返回值
+    /// @return true：成功，false：内存分配失败或者没有main函数
+    bool execute(int & exitCode);
+
+protected:
+    /// @brief 分配可执行内存，全局变量设置初值，槽位表指向内置函数或跳板代码
+    /// @return true：成功
+    bool prepare();
+
+    /// @brief 产生函数的跳板代码：保存实参寄存器，调用lazyCompile编译函数后跳转到函数
+    /// @param index 函数在槽位表中的下标
+    /// @return 跳板代码的地址
+    uint8_t * genTrampoline(int32_t index);
+
+    /// @brief 编译函数，机器码放到代码区并回填槽位
+    /// @param index 函数在槽位表中的下标
+    /// @return 函数的机器码地址，失败时为nullptr
+    uint8_t * compileFunction(int32_t index);
+
+    /// @brief 跳板代码调用的入口，编译失败时无法返回JIT代码继续执行，只能结束进程
+    /// @param jit JIT执行器
+    /// @param index 函数在槽位表中的下标
+    /// @return 函数的机器码地址
+    static void * lazyCompile(JitX86_64 * jit, int32_t index);
+
+    /// @brief 在代码区分配空间，按16字节对齐
+    /// @param size 字节数
+    /// @return 地址，空间不足时为nullptr
+    uint8_t * allocCode(size_t size);
+
+private:
+    /// @brief mmap分配的内存
+    uint8_t * region = nullptr;
+
+    /// @brief mmap分配的内存大小
+    size_t regionSize = 0;
+
+    /// @brief 代码区的空闲位置
+    uint8_t * codeTop = nullptr;
+
+    /// @brief 代码区的结束位置
+    uint8_t * codeEnd = nullptr;
+
+    /// @brief 函数地址的槽位表
+    void ** slots = nullptr;
+
+    /// @brief 槽位对应的函数
+    std::vector<Function *> funcs;
+
+    /// @brief 函数名到槽位下标的映射
+    std::unordered_map<std::string, int32_t> funcIndex;
+
+    /// @brief 全局变量名到地址的映射
+    std::unordered_map<std::string, uint8_t *> globalAddr;
+};
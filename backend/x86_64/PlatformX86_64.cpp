@@ -0,0 +1,118 @@
+///
+/// @file PlatformX86_64.cpp
+/// @brief x86-64平台相关实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include "PlatformX86_64.h"
+#include "ArrayType.h"
+
+const std::string PlatformX86_64::regName64[PlatformX86_64::maxRegNum] = {
+    "%rax", // 返回值，运算的第一个操作数
+    "%rcx", // 第四个实参，运算的第二个操作数
+    "%rdx", // 第三个实参，除法的余数
+    "%rbx", // 需要栈保护
+    "%rsp", // 栈指针
+    "%rbp", // 帧指针，需要栈保护
+    "%rsi", // 第二个实参
+    "%rdi", // 第一个实参
+    "%r8",  // 第五个实参
+    "%r9",  // 第六个实参
+    "%r10",
+    "%r11",
+    "%r12", // 需要栈保护
+    "%r13", // 需要栈保护
+    "%r14", // 需要栈保护
+    "%r15", // 需要栈保护
+};
+
+const std::string PlatformX86_64::regName32[PlatformX86_64::maxRegNum] = {
+    "%eax",
+    "%ecx",
+    "%edx",
+    "%ebx",
+    "%esp",
+    "%ebp",
+    "%esi",
+    "%edi",
+    "%r8d",
+    "%r9d",
+    "%r10d",
+    "%r11d",
+    "%r12d",
+    "%r13d",
+    "%r14d",
+    "%r15d",
+};
+
+const std::string PlatformX86_64::regName8[PlatformX86_64::maxRegNum] = {
+    "%al",
+    "%cl",
+    "%dl",
+    "%bl",
+    "%spl",
+    "%bpl",
+    "%sil",
+    "%dil",
+    "%r8b",
+    "%r9b",
+    "%r10b",
+    "%r11b",
+    "%r12b",
+    "%r13b",
+    "%r14b",
+    "%r15b",
+};
+
+const int PlatformX86_64::argRegNo[PlatformX86_64::maxArgRegNum] = {
+    X86_RDI_REG_NO,
+    X86_RSI_REG_NO,
+    X86_RDX_REG_NO,
+    X86_RCX_REG_NO,
+    X86_R8_REG_NO,
+    X86_R9_REG_NO,
+};
+
+/// @brief 值的保存方式：32位整数，或者64位地址
+/// @param type 值的类型
+/// @return true：64位地址（指针或数组形参），false：32位整数
+bool PlatformX86_64::isPointerValue(Type * type)
+{
+    if (type->isPointerType() || type->isArrayParameterType()) {
+        return true;
+    }
+
+    // 数组形参对应的局部变量，其第一维为0，保存的是实参数组的地址
+    Instanceof(arrayType, ArrayType *, type);
+
+    return arrayType && (arrayType->getDimensionCount() > 0) && (arrayType->getDimensionSize(0) == 0);
+}
+
+/// @brief 值是否是数组本身，其值为数组的首地址，不需要从内存中读取
+/// @param type 值的类型
+/// @return true：是数组
+bool PlatformX86_64::isArrayStorage(Type * type)
+{
+    return type->isArrayType() && !isPointerValue(type);
+}
+
+/// @brief 值在栈内所占空间的大小
+/// @param type 值的类型
+/// @return 字节数
+int32_t PlatformX86_64::slotSize(Type * type)
+{
+    if (isArrayStorage(type)) {
+        return type->getSize();
+    }
+
+    return isPointerValue(type) ? 8 : 4;
+}
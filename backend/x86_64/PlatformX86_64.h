@@ -0,0 +1,72 @@
+///
+/// @file PlatformX86_64.h
+/// @brief x86-64平台相关头文件，寄存器与System V ABI的调用约定
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <string>
+
+#include "Type.h"
+
+// 寄存器编号与指令编码中的编号一致
+#define X86_RAX_REG_NO 0
+#define X86_RCX_REG_NO 1
+#define X86_RDX_REG_NO 2
+#define X86_RBX_REG_NO 3
+#define X86_RSP_REG_NO 4
+#define X86_RBP_REG_NO 5
+#define X86_RSI_REG_NO 6
+#define X86_RDI_REG_NO 7
+#define X86_R8_REG_NO 8
+#define X86_R9_REG_NO 9
+#define X86_R10_REG_NO 10
+#define X86_R11_REG_NO 11
+
+/// @brief x86-64平台信息
+class PlatformX86_64 {
+
+public:
+    /// @brief 最大寄存器数目
+    static const int maxRegNum = 16;
+
+    /// @brief 通过寄存器传递的整数实参个数
+    static const int maxArgRegNum = 6;
+
+    /// @brief 64位寄存器的名字
+    static const std::string regName64[maxRegNum];
+
+    /// @brief 32位寄存器的名字
+    static const std::string regName32[maxRegNum];
+
+    /// @brief 低8位寄存器的名字
+    static const std::string regName8[maxRegNum];
+
+    /// @brief 依次传递前6个整数实参的寄存器：rdi、rsi、rdx、rcx、r8、r9
+    static const int argRegNo[maxArgRegNum];
+
+    /// @brief 值的保存方式：32位整数，或者64位地址
+    /// @param type 值的类型
+    /// @return true：64位地址（指针或数组形参），false：32位整数
+    static bool isPointerValue(Type * type);
+
+    /// @brief 值是否是数组本身，其值为数组的首地址，不需要从内存中读取
+    /// @param type 值的类型
+    /// @return true：是数组
+    static bool isArrayStorage(Type * type);
+
+    /// @brief 值在栈内所占空间的大小
+    /// @param type 值的类型
+    /// @return 字节数
+    static int32_t slotSize(Type * type);
+};
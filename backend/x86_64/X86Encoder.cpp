@@ -0,0 +1,379 @@
+///
+/// @file X86Encoder.cpp
+/// @brief x86-64机器指令的二进制编码，供JIT直接生成机器码
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include "Common.h"
+#include "X86Encoder.h"
+
+/// @brief 条件码在jcc、setcc中的编码
+/// @param cond 条件
+/// @return 编码
+static uint8_t condCode(X86Cond cond)
+{
+    switch (cond) {
+        case X86Cond::E:
+            return 0x4;
+        case X86Cond::NE:
+            return 0x5;
+        case X86Cond::L:
+            return 0xC;
+        case X86Cond::GE:
+            return 0xD;
+        case X86Cond::LE:
+            return 0xE;
+        case X86Cond::G:
+            return 0xF;
+        default:
+            return 0x0;
+    }
+}
+
+/// @brief 是否能用8位有符号数表示
+static bool isInt8(int32_t val)
+{
+    return (val >= -128) && (val <= 127);
+}
+
+/// @brief 是否为内存操作数
+static bool isMem(const X86Operand & opnd)
+{
+    return (opnd.kind == X86OperandKind::MEM) || (opnd.kind == X86OperandKind::SYM_MEM);
+}
+
+/// @brief 编码指令序列
+/// @param code 指令序列
+/// @return true：成功，false：有不支持的指令或标签不存在
+bool X86Encoder::encode(const std::list<X86Inst *> & code)
+{
+    for (auto inst: code) {
+
+        if (inst->dead) {
+            continue;
+        }
+
+        if (!encodeInst(inst)) {
+            minic_log(LOG_ERROR, "x86-64指令(%s)不支持编码", inst->outPut().c_str());
+            return false;
+        }
+
+        // 指令中的rip相对偏移以指令的结束位置为基准
+        for (size_t k = symbolFixups.size() - pendingFixups; k < symbolFixups.size(); k++) {
+            symbolFixups[k].instEnd = bytes.size();
+        }
+        pendingFixups = 0;
+    }
+
+    // 回填跳转的偏移
+    for (auto & [offset, label]: labelFixups) {
+
+        auto pIter = labels.find(label);
+        if (pIter == labels.end()) {
+            minic_log(LOG_ERROR, "标签(%s)不存在", label.c_str());
+            return false;
+        }
+
+        int32_t rel = (int32_t) pIter->second - (int32_t) (offset + 4);
+        for (int k = 0; k < 4; k++) {
+            bytes[offset + k] = (uint8_t) (rel >> (8 * k));
+        }
+    }
+
+    return true;
+}
+
+/// @brief 输出一个字节
+/// @param byte 字节
+void X86Encoder::emit8(uint8_t byte)
+{
+    bytes.push_back(byte);
+}
+
+/// @brief 按小端输出32位整数
+/// @param val 整数
+void X86Encoder::emit32(int32_t val)
+{
+    for (int k = 0; k < 4; k++) {
+        bytes.push_back((uint8_t) ((uint32_t) val >> (8 * k)));
+    }
+}
+
+/// @brief 输出跳转的32位偏移，留待标签回填
+/// @param label 目标标签
+void X86Encoder::emitLabelRel(const std::string & label)
+{
+    labelFixups.emplace_back(bytes.size(), label);
+    emit32(0);
+}
+
+/// @brief 输出带ModRM的指令：REX前缀、操作码、ModRM/SIB与偏移
+/// @param w 是否为64位操作
+/// @param opcode 操作码字节
+/// @param regField ModRM的reg字段，寄存器编号或操作码扩展
+/// @param rm 寄存器或内存操作数
+/// @param symbol rm为SYM_MEM时的符号名
+/// @param byteReg 是否访问8位寄存器
+void X86Encoder::emitModRM(bool w,
+                           std::initializer_list<uint8_t> opcode,
+                           int regField,
+                           const X86Operand & rm,
+                           const std::string & symbol,
+                           bool byteReg)
+{
+    int rmReg = (rm.kind == X86OperandKind::SYM_MEM) ? 0 : rm.reg;
+
+    uint8_t rex = 0x40 | (w ? 0x8 : 0) | ((regField & 0x8) ? 0x4 : 0) | ((rmReg & 0x8) ? 0x1 : 0);
+
+    // spl、bpl、sil、dil需要REX前缀，否则编码为ah、ch、dh、bh
+    bool needRex = (rex != 0x40);
+    if (byteReg && ((regField >= 4) || ((rm.kind == X86OperandKind::REG) && (rmReg >= 4)))) {
+        needRex = true;
+    }
+
+    if (needRex) {
+        emit8(rex);
+    }
+
+    for (auto byte: opcode) {
+        emit8(byte);
+    }
+
+    uint8_t reg = (uint8_t) ((regField & 0x7) << 3);
+
+    switch (rm.kind) {
+        case X86OperandKind::REG:
+            emit8(0xC0 | reg | (rmReg & 0x7));
+            break;
+
+        case X86OperandKind::SYM_MEM:
+            // rip相对寻址，偏移留待重定位
+            emit8(0x05 | reg);
+            symbolFixups.push_back({bytes.size(), 0, symbol, false});
+            pendingFixups++;
+            emit32(0);
+            break;
+
+        case X86OperandKind::MEM: {
+            int base = rmReg & 0x7;
+
+            // rbp、r13作为基址时没有无偏移的形式
+            uint8_t mod;
+            if ((rm.imm == 0) && (base != 5)) {
+                mod = 0x00;
+            } else if (isInt8(rm.imm)) {
+                mod = 0x40;
+            } else {
+                mod = 0x80;
+            }
+
+            emit8(mod | reg | base);
+
+            // rsp、r12作为基址时需要SIB字节
+            if (base == 4) {
+                emit8(0x24);
+            }
+
+            if (mod == 0x40) {
+                emit8((uint8_t) rm.imm);
+            } else if (mod == 0x80) {
+                emit32(rm.imm);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+/// @brief 编码一条指令
+/// @param inst 指令
+/// @return true：成功
+bool X86Encoder::encodeInst(const X86Inst * inst)
+{
+    const X86Operand & dst = inst->dst;
+    const X86Operand & src = inst->src;
+
+    switch (inst->opcode) {
+        case X86Op::LABEL:
+            labels[inst->symbol] = bytes.size();
+            return true;
+
+        case X86Op::COMMENT:
+            return true;
+
+        case X86Op::MOVL:
+        case X86Op::MOVQ: {
+            bool w = inst->opcode == X86Op::MOVQ;
+
+            if ((dst.kind == X86OperandKind::REG) && (src.kind == X86OperandKind::IMM)) {
+                if (w) {
+                    // movq $imm, %r：C7 /0，立即数符号扩展
+                    emitModRM(true, {0xC7}, 0, dst, inst->symbol);
+                } else {
+                    // movl $imm, %r：B8+r
+                    if (dst.reg & 0x8) {
+                        emit8(0x41);
+                    }
+                    emit8((uint8_t) (0xB8 + (dst.reg & 0x7)));
+                }
+                emit32(src.imm);
+            } else if ((dst.kind == X86OperandKind::REG) &&
+                       ((src.kind == X86OperandKind::REG) || isMem(src))) {
+                emitModRM(w, {0x8B}, dst.reg, src, inst->symbol);
+            } else if (isMem(dst) && (src.kind == X86OperandKind::REG)) {
+                emitModRM(w, {0x89}, src.reg, dst, inst->symbol);
+            } else if (isMem(dst) && (src.kind == X86OperandKind::IMM)) {
+                emitModRM(w, {0xC7}, 0, dst, inst->symbol);
+                emit32(src.imm);
+            } else {
+                return false;
+            }
+            return true;
+        }
+
+        case X86Op::MOVSLQ:
+            if (dst.kind != X86OperandKind::REG) {
+                return false;
+            }
+            emitModRM(true, {0x63}, dst.reg, src, inst->symbol);
+            return true;
+
+        case X86Op::MOVZBL:
+            if (dst.kind != X86OperandKind::REG) {
+                return false;
+            }
+            emitModRM(false, {0x0F, 0xB6}, dst.reg, src, inst->symbol, true);
+            return true;
+
+        case X86Op::LEAQ:
+            if ((dst.kind != X86OperandKind::REG) || !isMem(src)) {
+                return false;
+            }
+            emitModRM(true, {0x8D}, dst.reg, src, inst->symbol);
+            return true;
+
+        case X86Op::ADDL:
+        case X86Op::ADDQ:
+        case X86Op::SUBL:
+        case X86Op::SUBQ:
+        case X86Op::CMPL: {
+            bool w = (inst->opcode == X86Op::ADDQ) || (inst->opcode == X86Op::SUBQ);
+
+            // 操作码扩展，以及r/m为目的与reg为目的两种形式的操作码
+            int ext;
+            uint8_t opRmReg, opRegRm;
+            if ((inst->opcode == X86Op::ADDL) || (inst->opcode == X86Op::ADDQ)) {
+                ext = 0;
+                opRmReg = 0x01;
+                opRegRm = 0x03;
+            } else if ((inst->opcode == X86Op::SUBL) || (inst->opcode == X86Op::SUBQ)) {
+                ext = 5;
+                opRmReg = 0x29;
+                opRegRm = 0x2B;
+            } else {
+                ext = 7;
+                opRmReg = 0x39;
+                opRegRm = 0x3B;
+            }
+
+            if (src.kind == X86OperandKind::IMM) {
+                if (isInt8(src.imm)) {
+                    emitModRM(w, {0x83}, ext, dst, inst->symbol);
+                    emit8((uint8_t) src.imm);
+                } else {
+                    emitModRM(w, {0x81}, ext, dst, inst->symbol);
+                    emit32(src.imm);
+                }
+            } else if (src.kind == X86OperandKind::REG) {
+                emitModRM(w, {opRmReg}, src.reg, dst, inst->symbol);
+            } else if ((dst.kind == X86OperandKind::REG) && isMem(src)) {
+                emitModRM(w, {opRegRm}, dst.reg, src, inst->symbol);
+            } else {
+                return false;
+            }
+            return true;
+        }
+
+        case X86Op::IMULL:
+            if (dst.kind != X86OperandKind::REG) {
+                return false;
+            }
+            if (src.kind == X86OperandKind::IMM) {
+                // imull $imm, %r：69 /r，源与目的为同一寄存器
+                emitModRM(false, {0x69}, dst.reg, dst, inst->symbol);
+                emit32(src.imm);
+            } else {
+                emitModRM(false, {0x0F, 0xAF}, dst.reg, src, inst->symbol);
+            }
+            return true;
+
+        case X86Op::NEGL:
+            emitModRM(false, {0xF7}, 3, dst, inst->symbol);
+            return true;
+
+        case X86Op::IDIVL:
+            emitModRM(false, {0xF7}, 7, dst, inst->symbol);
+            return true;
+
+        case X86Op::CLTD:
+            emit8(0x99);
+            return true;
+
+        case X86Op::SETCC:
+            emitModRM(false, {0x0F, (uint8_t) (0x90 | condCode(inst->cond))}, 0, dst, inst->symbol, true);
+            return true;
+
+        case X86Op::JMP:
+            emit8(0xE9);
+            emitLabelRel(inst->symbol);
+            return true;
+
+        case X86Op::JCC:
+            emit8(0x0F);
+            emit8((uint8_t) (0x80 | condCode(inst->cond)));
+            emitLabelRel(inst->symbol);
+            return true;
+
+        case X86Op::CALL:
+            // call *f(%rip)：FF /2，经过存放函数地址的槽位间接调用
+            emit8(0xFF);
+            emit8(0x15);
+            symbolFixups.push_back({bytes.size(), 0, inst->symbol, true});
+            pendingFixups++;
+            emit32(0);
+            return true;
+
+        case X86Op::LEAVE:
+            emit8(0xC9);
+            return true;
+
+        case X86Op::RET:
+            emit8(0xC3);
+            return true;
+
+        case X86Op::PUSHQ:
+        case X86Op::POPQ:
+            if (dst.kind != X86OperandKind::REG) {
+                return false;
+            }
+            if (dst.reg & 0x8) {
+                emit8(0x41);
+            }
+            emit8((uint8_t) (((inst->opcode == X86Op::PUSHQ) ? 0x50 : 0x58) + (dst.reg & 0x7)));
+            return true;
+
+        default:
+            return false;
+    }
+}
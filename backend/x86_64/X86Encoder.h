@@ -0,0 +1,115 @@
+///
+/// @file X86Encoder.h
+/// @brief x86-64机器指令的二进制编码，供JIT直接生成机器码
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "X86Inst.h"
+
+/// @brief 把一个函数的X86Inst序列编码成机器码
+///
+/// 函数内的标签在编码结束时回填，跳转一律使用32位偏移。
+/// 全局变量与函数调用都采用rip相对寻址，留下符号重定位由使用者按最终地址回填。
+class X86Encoder {
+
+public:
+    /// @brief 符号的重定位
+    struct SymbolFixup {
+        /// @brief 32位偏移在机器码中的位置
+        size_t offset;
+
+        /// @brief 所在指令的结束位置，rip相对偏移以此为基准
+        size_t instEnd;
+
+        /// @brief 全局变量名或函数名
+        std::string symbol;
+
+        /// @brief 是否为函数调用，函数调用时偏移指向存放函数地址的槽位
+        bool isCall;
+    };
+
+    /// @brief 编码指令序列
+    /// @param code 指令序列
+    /// @return true：成功，false：有不支持的指令或标签不存在
+    bool encode(const std::list<X86Inst *> & code);
+
+    /// @brief 获取机器码
+    /// @return 机器码
+    const std::vector<uint8_t> & getBytes() const
+    {
+        return bytes;
+    }
+
+    /// @brief 获取符号的重定位
+    /// @return 重定位列表
+    const std::vector<SymbolFixup> & getSymbolFixups() const
+    {
+        return symbolFixups;
+    }
+
+protected:
+    /// @brief 编码一条指令
+    /// @param inst 指令
+    /// @return true：成功
+    bool encodeInst(const X86Inst * inst);
+
+    /// @brief 输出带ModRM的指令：REX前缀、操作码、ModRM/SIB与偏移
+    /// @param w 是否为64位操作
+    /// @param opcode 操作码字节
+    /// @param regField ModRM的reg字段，寄存器编号或操作码扩展
+    /// @param rm 寄存器或内存操作数
+    /// @param symbol rm为SYM_MEM时的符号名
+    /// @param byteReg 是否访问8位寄存器
+    void emitModRM(bool w,
+                   std::initializer_list<uint8_t> opcode,
+                   int regField,
+                   const X86Operand & rm,
+                   const std::string & symbol,
+                   bool byteReg = false);
+
+    /// @brief 输出一个字节
+    /// @param byte 字节
+    void emit8(uint8_t byte);
+
+    /// @brief 按小端输出32位整数
+    /// @param val 整数
+    void emit32(int32_t val);
+
+    /// @brief 输出跳转的32位偏移，留待标签回填
+    /// @param label 目标标签
+    void emitLabelRel(const std::string & label);
+
+private:
+    /// @brief 机器码
+    std::vector<uint8_t> bytes;
+
+    /// @brief 标签在机器码中的位置
+    std::unordered_map<std::string, size_t> labels;
+
+    /// @brief 待回填的跳转：32位偏移的位置及目标标签
+    std::vector<std::pair<size_t, std::string>> labelFixups;
+
+    /// @brief 符号的重定位
+    std::vector<SymbolFixup> symbolFixups;
+
+    /// @brief 当前指令中尚未确定instEnd的符号重定位个数
+    size_t pendingFixups = 0;
+};
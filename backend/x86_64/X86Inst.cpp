@@ -0,0 +1,227 @@
+///
+/// @file X86Inst.cpp
+/// @brief x86-64的机器指令表示及其AT&T语法的汇编输出
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <string>
+
+#include "X86Inst.h"
+#include "PlatformX86_64.h"
+
+/// @brief 寄存器操作数
+X86Operand X86Operand::makeReg(int32_t reg_no, int32_t width)
+{
+    X86Operand opnd;
+    opnd.kind = X86OperandKind::REG;
+    opnd.reg = (int8_t) reg_no;
+    opnd.width = (int8_t) width;
+    return opnd;
+}
+
+/// @brief 立即数操作数
+X86Operand X86Operand::makeImm(int32_t value)
+{
+    X86Operand opnd;
+    opnd.kind = X86OperandKind::IMM;
+    opnd.imm = value;
+    return opnd;
+}
+
+/// @brief 基址+偏移的内存操作数
+X86Operand X86Operand::makeMem(int32_t base_reg_no, int32_t disp)
+{
+    X86Operand opnd;
+    opnd.kind = X86OperandKind::MEM;
+    opnd.reg = (int8_t) base_reg_no;
+    opnd.imm = disp;
+    return opnd;
+}
+
+/// @brief 相对rip的符号内存操作数
+X86Operand X86Operand::makeSymMem()
+{
+    X86Operand opnd;
+    opnd.kind = X86OperandKind::SYM_MEM;
+    return opnd;
+}
+
+/// @brief 标签操作数
+X86Operand X86Operand::makeLabel()
+{
+    X86Operand opnd;
+    opnd.kind = X86OperandKind::LABEL;
+    return opnd;
+}
+
+X86Inst::X86Inst(X86Op _opcode, X86Operand _dst, X86Operand _src, X86Cond _cond)
+    : opcode(_opcode), cond(_cond), dst(_dst), src(_src)
+{}
+
+/*
+    设置为无效指令
+*/
+void X86Inst::setDead()
+{
+    dead = true;
+}
+
+/// @brief 操作码的助记符，jcc与setcc不含条件
+const char * X86Inst::opName(X86Op op)
+{
+    switch (op) {
+        case X86Op::MOVL:
+            return "movl";
+        case X86Op::MOVQ:
+            return "movq";
+        case X86Op::MOVSLQ:
+            return "movslq";
+        case X86Op::MOVZBL:
+            return "movzbl";
+        case X86Op::LEAQ:
+            return "leaq";
+        case X86Op::ADDL:
+            return "addl";
+        case X86Op::ADDQ:
+            return "addq";
+        case X86Op::SUBL:
+            return "subl";
+        case X86Op::SUBQ:
+            return "subq";
+        case X86Op::IMULL:
+            return "imull";
+        case X86Op::NEGL:
+            return "negl";
+        case X86Op::CLTD:
+            return "cltd";
+        case X86Op::IDIVL:
+            return "idivl";
+        case X86Op::CMPL:
+            return "cmpl";
+        case X86Op::SETCC:
+            return "set";
+        case X86Op::JMP:
+            return "jmp";
+        case X86Op::JCC:
+            return "j";
+        case X86Op::CALL:
+            return "call";
+        case X86Op::LEAVE:
+            return "leave";
+        case X86Op::RET:
+            return "ret";
+        case X86Op::PUSHQ:
+            return "pushq";
+        case X86Op::POPQ:
+            return "popq";
+        default:
+            return "";
+    }
+}
+
+/// @brief 条件码的后缀
+const char * X86Inst::condName(X86Cond cond)
+{
+    switch (cond) {
+        case X86Cond::E:
+            return "e";
+        case X86Cond::NE:
+            return "ne";
+        case X86Cond::G:
+            return "g";
+        case X86Cond::GE:
+            return "ge";
+        case X86Cond::L:
+            return "l";
+        case X86Cond::LE:
+            return "le";
+        default:
+            return "";
+    }
+}
+
+/// @brief 操作数输出
+/// @param opnd 操作数
+/// @param str 追加输出的字符串
+void X86Inst::outPutOperand(const X86Operand & opnd, std::string & str) const
+{
+    switch (opnd.kind) {
+        case X86OperandKind::REG:
+            if (opnd.width == 8) {
+                str += PlatformX86_64::regName64[opnd.reg];
+            } else if (opnd.width == 1) {
+                str += PlatformX86_64::regName8[opnd.reg];
+            } else {
+                str += PlatformX86_64::regName32[opnd.reg];
+            }
+            break;
+        case X86OperandKind::IMM:
+            str += "$" + std::to_string(opnd.imm);
+            break;
+        case X86OperandKind::MEM:
+            // -16(%rbp) (%rax)
+            if (opnd.imm) {
+                str += std::to_string(opnd.imm);
+            }
+            str += "(" + PlatformX86_64::regName64[opnd.reg] + ")";
+            break;
+        case X86OperandKind::SYM_MEM:
+            str += symbol + "(%rip)";
+            break;
+        case X86OperandKind::LABEL:
+            str += symbol;
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+    输出函数
+*/
+std::string X86Inst::outPut() const
+{
+    // 无用代码，什么都不输出
+    if (dead) {
+        return "";
+    }
+
+    switch (opcode) {
+        case X86Op::LABEL:
+            // .L1:
+            return symbol + ":";
+        case X86Op::COMMENT:
+            // # 注释内容
+            return "# " + symbol;
+        case X86Op::MAX:
+            return "";
+        default:
+            break;
+    }
+
+    std::string ret = opName(opcode);
+    ret += condName(cond);
+
+    // AT&T语法源操作数在前，目的操作数在后
+    if (src.valid()) {
+        ret += " ";
+        outPutOperand(src, ret);
+        ret += ",";
+    }
+
+    if (dst.valid()) {
+        ret += src.valid() ? "" : " ";
+        outPutOperand(dst, ret);
+    }
+
+    return ret;
+}
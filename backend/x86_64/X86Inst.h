@@ -0,0 +1,180 @@
+///
+/// @file X86Inst.h
+/// @brief x86-64的机器指令表示，操作码、条件码与操作数均为类型化描述，输出为AT&T语法
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/// @brief x86-64机器指令操作码，后缀l为32位操作，q为64位操作
+enum class X86Op : std::uint8_t {
+    /// @brief 标签伪指令，名字保存在symbol中
+    LABEL,
+    /// @brief 注释伪指令，内容保存在symbol中
+    COMMENT,
+
+    /// @brief 数据传送
+    MOVL,
+    MOVQ,
+    MOVSLQ,
+    MOVZBL,
+    LEAQ,
+
+    /// @brief 算术运算
+    ADDL,
+    ADDQ,
+    SUBL,
+    SUBQ,
+    IMULL,
+    NEGL,
+    CLTD,
+    IDIVL,
+
+    /// @brief 比较与按条件置位
+    CMPL,
+    SETCC,
+
+    /// @brief 转移
+    JMP,
+    JCC,
+    CALL,
+    LEAVE,
+    RET,
+
+    /// @brief 入栈与出栈
+    PUSHQ,
+    POPQ,
+
+    /// @brief 无效操作码
+    MAX
+};
+
+/// @brief 条件码，用于jcc与setcc，NONE为无条件
+enum class X86Cond : std::uint8_t {
+    NONE,
+    E,
+    NE,
+    G,
+    GE,
+    L,
+    LE,
+};
+
+/// @brief 操作数类别
+enum class X86OperandKind : std::uint8_t {
+    /// @brief 无此操作数
+    NONE,
+    /// @brief 寄存器，width给出使用的宽度
+    REG,
+    /// @brief 立即数，输出时带$
+    IMM,
+    /// @brief 基址+偏移的内存寻址，-16(%rbp)
+    MEM,
+    /// @brief 相对rip的符号寻址，g(%rip)，符号名在指令的symbol中
+    SYM_MEM,
+    /// @brief 标签或函数名，名字在指令的symbol中
+    LABEL,
+};
+
+/// @brief 机器指令的操作数，不含任何字符串，可直接拷贝
+struct X86Operand {
+
+    /// @brief 操作数类别
+    X86OperandKind kind = X86OperandKind::NONE;
+
+    /// @brief 寄存器编号，MEM时为基址寄存器
+    int8_t reg = -1;
+
+    /// @brief 寄存器的宽度，1、4或8字节
+    int8_t width = 4;
+
+    /// @brief 立即数或者MEM的偏移
+    int32_t imm = 0;
+
+    /// @brief 寄存器操作数
+    static X86Operand makeReg(int32_t reg_no, int32_t width);
+
+    /// @brief 立即数操作数
+    static X86Operand makeImm(int32_t value);
+
+    /// @brief 基址+偏移的内存操作数
+    static X86Operand makeMem(int32_t base_reg_no, int32_t disp);
+
+    /// @brief 相对rip的符号内存操作数
+    static X86Operand makeSymMem();
+
+    /// @brief 标签操作数
+    static X86Operand makeLabel();
+
+    /// @brief 是否是有效的操作数
+    bool valid() const
+    {
+        return kind != X86OperandKind::NONE;
+    }
+};
+
+/// @brief 底层汇编指令：x86-64
+struct X86Inst {
+
+    /// @brief 操作码
+    X86Op opcode;
+
+    /// @brief 条件
+    X86Cond cond = X86Cond::NONE;
+
+    /// @brief 标识指令是否无效
+    bool dead = false;
+
+    /// @brief 目的操作数，单操作数指令的唯一操作数
+    X86Operand dst;
+
+    /// @brief 源操作数
+    X86Operand src;
+
+    /// @brief 标签名、函数名、全局符号名或注释内容，只有用到时才非空
+    std::string symbol;
+
+    /// @brief 构造函数
+    /// @param op 操作码
+    /// @param _dst 目的操作数
+    /// @param _src 源操作数
+    /// @param _cond 条件码
+    X86Inst(X86Op op, X86Operand _dst = X86Operand(), X86Operand _src = X86Operand(), X86Cond _cond = X86Cond::NONE);
+
+    /// @brief 设置死指令
+    void setDead();
+
+    /// @brief 是否是标签伪指令
+    bool isLabel() const
+    {
+        return opcode == X86Op::LABEL;
+    }
+
+    /// @brief 指令字符串输出函数
+    /// @return 汇编指令文本，死指令时为空串
+    std::string outPut() const;
+
+    /// @brief 操作码的助记符，jcc与setcc不含条件
+    static const char * opName(X86Op op);
+
+    /// @brief 条件码的后缀
+    static const char * condName(X86Cond cond);
+
+private:
+    /// @brief 操作数输出
+    /// @param opnd 操作数
+    /// @param str 追加输出的字符串
+    void outPutOperand(const X86Operand & opnd, std::string & str) const;
+};
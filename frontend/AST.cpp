@@ -2,8 +2,8 @@
 /// @file AST.cpp
 /// @brief 抽象语法树AST管理的实现
 /// @author zenglj (zenglj@live.com)
-/// @version 1.1
-/// @date 2024-11-23
+/// @version 1.4
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,9 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>节点与孩子数组从内存池分配
+/// <tr><td>2026-10-19 <td>1.3     <td>zenglj  <td>紧凑节点，名字驻留，IR产生的临时状态移到IRGenerator
+/// <tr><td>2026-10-19 <td>1.4     <td>去掉全局的ast_root，内存池与节点计数改为每线程一份
 /// </table>
 ///
 #include <cstdarg>
@@ -23,14 +26,50 @@
 #include "Types/IntegerType.h"
 #include "Types/VoidType.h"
 
-/* 整个AST的根节点 */
-ast_node * ast_root = nullptr;
+/* 当前线程的AST已创建的节点个数，用于节点编号 */
+static thread_local uint32_t ast_node_count = 0;
+
+/// @brief 获取当前线程编译所用的AST内存池，每个线程同时只编译一个源文件
+/// @return 内存池
+Arena & ast_node::arena()
+{
+    static thread_local Arena astArena;
+
+    return astArena;
+}
+
+/// @brief 当前AST已创建的节点个数
+/// @return 节点个数
+uint32_t ast_node::getNodeCount()
+{
+    return ast_node_count;
+}
+
+/// @brief 尾部追加孩子，容量不够时在内存池中按倍数扩容
+/// @param node 孩子节点
+void ast_node_list::push_back(ast_node * node)
+{
+    if (count == capacity) {
+        uint32_t newCapacity = capacity ? capacity * 2 : 2;
+        auto newItems = static_cast<ast_node **>(
+            ast_node::arena().allocate(newCapacity * sizeof(ast_node *), alignof(ast_node *)));
+
+        for (uint32_t i = 0; i < count; i++) {
+            newItems[i] = items[i];
+        }
+
+        items = newItems;
+        capacity = newCapacity;
+    }
+
+    items[count++] = node;
+}
 
 /// @brief 创建指定节点类型的节点
 /// @param _node_type 节点类型
 /// @param _line_no 行号
 ast_node::ast_node(ast_operator_type _node_type, Type * _type, int64_t _line_no)
-    : node_type(_node_type), line_no(-1), type(_type)
+    : node_type(_node_type), line_no(-1), id(ast_node_count++), type(_type), integer_val(0)
 {}
 
 /// @brief 构造函数
@@ -51,16 +90,16 @@ ast_node::ast_node(digit_int_attr attr)
 /// @param attr 字符型字面量
 ast_node::ast_node(var_id_attr attr) : ast_node(ast_operator_type::AST_OP_LEAF_VAR_ID, VoidType::getType(), attr.lineno)
 {
-    name = attr.id;
+    name = intern(attr.id);
 }
 
 /// @brief 针对标识符ID的叶子构造函数
 /// @param _id 标识符ID
 /// @param _line_no 行号
-ast_node::ast_node(std::string _id, int64_t _line_no)
+ast_node::ast_node(std::string_view _id, int64_t _line_no)
     : ast_node(ast_operator_type::AST_OP_LEAF_VAR_ID, VoidType::getType(), _line_no)
 {
-    name = _id;
+    name = intern(_id);
 }
 
 /// @brief 判断是否是叶子节点
@@ -92,7 +131,7 @@ bool ast_node::isLeafNode()
 /// @return 创建的节点
 ast_node * ast_node::New(ast_operator_type type, ...)
 {
-    ast_node * parent_node = new ast_node(type);
+    ast_node * parent_node = ast_node::create(type);
 
     va_list valist;
 
@@ -136,7 +175,7 @@ ast_node * ast_node::insert_son_node(ast_node * node)
 /// @param attr 无符号整数字面量
 ast_node * ast_node::New(digit_int_attr attr)
 {
-    ast_node * node = new ast_node(attr);
+    ast_node * node = ast_node::create(attr);
 
     return node;
 }
@@ -145,7 +184,7 @@ ast_node * ast_node::New(digit_int_attr attr)
 /// @param attr 字符型字面量
 ast_node * ast_node::New(var_id_attr attr)
 {
-    ast_node * node = new ast_node(attr);
+    ast_node * node = ast_node::create(attr);
 
     return node;
 }
@@ -153,9 +192,9 @@ ast_node * ast_node::New(var_id_attr attr)
 /// @brief 创建标识符的叶子节点
 /// @param id 词法值
 /// @param line_no 行号
-ast_node * ast_node::New(std::string id, int64_t lineno)
+ast_node * ast_node::New(std::string_view id, int64_t lineno)
 {
-    ast_node * node = new ast_node(id, lineno);
+    ast_node * node = ast_node::create(id, lineno);
 
     return node;
 }
@@ -166,35 +205,27 @@ ast_node * ast_node::New(std::string id, int64_t lineno)
 /// @return 创建的节点
 ast_node * ast_node::New(Type * type)
 {
-    ast_node * node = new ast_node(type);
+    ast_node * node = ast_node::create(type);
 
     return node;
 }
 
-/// @brief 递归清理抽象语法树
+/// @brief 释放节点，节点的内存随内存池整体释放，这里不做任何事
 /// @param node AST的节点
 void ast_node::Delete(ast_node * node)
 {
-    if (node) {
-
-        for (auto child: node->sons) {
-            ast_node::Delete(child);
-        }
-
-        // 这里没有必要清理孩子，由于下面就要删除该节点
-        // node->sons.clear();
-    }
-
-    // 清理node资源
-    delete node;
+    (void) node;
 }
 
 ///
-/// @brief AST资源清理
+/// @brief AST资源清理，整体释放AST的内存池
 ///
 void free_ast(ast_node * root)
 {
-    ast_node::Delete(root);
+    (void) root;
+
+    ast_node::arena().release();
+    ast_node_count = 0;
 }
 
 /// @brief 创建函数定义类型的内部AST节点
@@ -205,19 +236,19 @@ void free_ast(ast_node * root)
 /// @return 创建的节点
 ast_node * create_func_def(ast_node * type_node, ast_node * name_node, ast_node * block_node, ast_node * params_node)
 {
-    ast_node * node = new ast_node(ast_operator_type::AST_OP_FUNC_DEF, type_node->type, name_node->line_no);
+    ast_node * node = ast_node::create(ast_operator_type::AST_OP_FUNC_DEF, type_node->type, name_node->line_no);
 
     // 设置函数名
     node->name = name_node->name;
 
     // 如果没有参数，则创建参数节点
     if (!params_node) {
-        params_node = new ast_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAMS);
+        params_node = ast_node::create(ast_operator_type::AST_OP_FUNC_FORMAL_PARAMS);
     }
 
     // 如果没有函数体，则创建函数体，也就是语句块
     if (!block_node) {
-        block_node = new ast_node(ast_operator_type::AST_OP_BLOCK);
+        block_node = ast_node::create(ast_operator_type::AST_OP_BLOCK);
     }
 
     (void) node->insert_son_node(type_node);
@@ -260,7 +291,7 @@ ast_node * create_contain_node(ast_operator_type node_type,
                                ast_node * second_child,
                                ast_node * third_child)
 {
-    ast_node * node = new ast_node(node_type);
+    ast_node * node = ast_node::create(node_type);
 
     if (first_child) {
         (void) node->insert_son_node(first_child);
@@ -304,14 +335,14 @@ ast_node * create_type_node(type_attr & attr)
 /// @return 创建的节点
 ast_node * create_func_call(ast_node * funcname_node, ast_node * params_node)
 {
-    ast_node * node = new ast_node(ast_operator_type::AST_OP_FUNC_CALL);
+    ast_node * node = ast_node::create(ast_operator_type::AST_OP_FUNC_CALL);
 
     // 设置调用函数名
     node->name = funcname_node->name;
 
     // 如果没有参数，则创建参数节点
     if (!params_node) {
-        params_node = new ast_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS);
+        params_node = ast_node::create(ast_operator_type::AST_OP_FUNC_REAL_PARAMS);
     }
 
     (void) node->insert_son_node(funcname_node);
@@ -2,8 +2,8 @@
 /// @file AST.h
 /// @brief 抽象语法树AST管理的头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.1
-/// @date 2024-11-23
+/// @version 1.4
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,9 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>节点与孩子数组从内存池分配
+/// <tr><td>2026-10-19 <td>1.3     <td>zenglj  <td>紧凑节点，名字驻留，IR产生的临时状态移到IRGenerator
+/// <tr><td>2026-10-19 <td>1.4     <td>去掉全局的ast_root，内存池与节点计数改为每线程一份
 /// </table>
 ///
 #pragma once
@@ -19,17 +22,18 @@
 #include <cstdint>
 #include <cstdio>
 #include <string>
-#include <vector>
+#include <string_view>
 
+#include "Arena.h"
 #include "AttrType.h"
-#include "IRCode.h"
-#include "Value.h"
+#include "StringInterner.h"
+#include "Type.h"
 #include "VoidType.h"
 
 ///
 /// @brief AST节点的类型。C++专门因为枚举类来区分C语言的结构体
 ///
-enum class ast_operator_type : int {
+enum class ast_operator_type : uint8_t {
 
     /* 以下为AST的叶子节点 */
 
@@ -161,57 +165,122 @@ enum class ast_operator_type : int {
     AST_OP_MAX,
 };
 
+class ast_node;
+
+///
+/// @brief 孩子节点数组，元素连续存放在AST的内存池中
+///
+/// 只提供AST用到的vector接口。扩容时旧数组留在内存池中随AST整体释放，
+/// 本身可平凡析构，节点因此不需要登记析构。
+///
+class ast_node_list {
+public:
+    typedef ast_node ** iterator;
+    typedef ast_node * const * const_iterator;
+
+    iterator begin()
+    {
+        return items;
+    }
+
+    iterator end()
+    {
+        return items + count;
+    }
+
+    const_iterator begin() const
+    {
+        return items;
+    }
+
+    const_iterator end() const
+    {
+        return items + count;
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    bool empty() const
+    {
+        return count == 0;
+    }
+
+    ast_node *& operator[](size_t index)
+    {
+        return items[index];
+    }
+
+    ast_node * operator[](size_t index) const
+    {
+        return items[index];
+    }
+
+    /// @brief 尾部追加孩子，容量不够时在内存池中按倍数扩容
+    /// @param node 孩子节点
+    void push_back(ast_node * node);
+
+    /// @brief 清空孩子，容量保留
+    void clear()
+    {
+        count = 0;
+    }
+
+private:
+    /// @brief 孩子数组
+    ast_node ** items = nullptr;
+
+    /// @brief 孩子个数
+    uint32_t count = 0;
+
+    /// @brief 数组容量
+    uint32_t capacity = 0;
+};
+
 ///
 /// @brief 抽象语法树AST的节点描述类
 ///
+/// 节点及其孩子数组都从AST的内存池中分配，不单独释放，由free_ast整体释放。
+/// 节点只保存语法信息，名字为驻留编号，IR产生过程中的指令块、值与标签等
+/// 临时状态由IRGenerator按节点编号保存在旁路表中。
+///
 class ast_node {
 public:
     /// @brief 节点类型
     ast_operator_type node_type;
 
+    ///
+    /// @brief 在进入block等节点时是否要进行作用域管理。默认要做。
+    ///
+    bool needScope = true;
+
     /// @brief 行号信息，主要针对叶子节点有用
-    int64_t line_no;
+    int32_t line_no;
+
+    /// @brief 节点编号，同一棵AST内从0开始连续编号，可作为旁路表的下标
+    uint32_t id;
+
+    /// @brief 变量名，或者函数名，为驻留编号，0表示没有名字
+    Symbol name = 0;
 
     /// @brief 节点值的类型，可用于函数返回值类型
     Type * type;
 
-    /// @brief 无符号整数字面量值
-    uint32_t integer_val;
+    union {
+        /// @brief 无符号整数字面量值
+        uint32_t integer_val;
 
-    /// @brief float类型字面量值
-    float float_val;
-
-    /// @brief 变量名，或者函数名
-    std::string name;
+        /// @brief float类型字面量值
+        float float_val;
+    };
 
     /// @brief 父节点
     ast_node * parent = nullptr;
 
     /// @brief 孩子节点
-    std::vector<ast_node *> sons;
-
-    /// @brief 线性IR指令块，可包含多条IR指令，用于线性IR指令产生用
-    InterCode blockInsts;
-
-    /// @brief 线性IR指令或者运行产生的Value，用于线性IR指令产生用
-    Value * val = nullptr;
-
-    ///
-    /// @brief 在进入block等节点时是否要进行作用域管理。默认要做。
-    ///
-    bool needScope = true;
-
-    /// @brief 关系表达式的真出口标签
-    std::string true_label;
-    
-    /// @brief 关系表达式的假出口标签
-    std::string false_label;
-    
-    /// @brief 循环开始标签，用于continue跳转
-    std::string loop_start_label;
-    
-    /// @brief 循环结束标签，用于break跳转
-    std::string loop_end_label;
+    ast_node_list sons;
 
     /// @brief 创建指定节点类型的节点
     /// @param _node_type 节点类型
@@ -232,7 +301,14 @@ public:
     /// @brief 针对标识符ID的叶子构造函数
     /// @param _id 标识符ID
     /// @param _line_no 行号
-    ast_node(std::string id, int64_t _line_no);
+    ast_node(std::string_view id, int64_t _line_no);
+
+    /// @brief 获取变量名或者函数名
+    /// @return 名字，没有名字时为空串
+    std::string_view getName() const
+    {
+        return symbolName(name);
+    }
 
     /// @brief 判断是否是叶子节点
     /// @param type 节点类型
@@ -263,7 +339,7 @@ public:
     /// @brief 创建标识符的叶子节点
     /// @param id 词法值
     /// @param line_no 行号
-    static ast_node * New(std::string id, int64_t lineno);
+    static ast_node * New(std::string_view id, int64_t lineno);
 
     /// @brief 创建具备指定类型的节点
     /// @param type 节点值类型
@@ -272,18 +348,38 @@ public:
     static ast_node * New(Type * type);
 
     ///
-    /// @brief 释放节点
+    /// @brief 释放节点，节点的内存随内存池整体释放，这里不做任何事
     /// @param node
     ///
     static void Delete(ast_node * node);
+
+    ///
+    /// @brief 获取当前线程编译所用的AST内存池，不同线程可同时建立各自的AST
+    /// @return 内存池
+    ///
+    static Arena & arena();
+
+    ///
+    /// @brief 当前线程的AST已创建的节点个数，节点编号小于该值
+    /// @return 节点个数
+    ///
+    static uint32_t getNodeCount();
+
+    ///
+    /// @brief 在AST的内存池中创建节点
+    /// @param args 构造函数的参数
+    /// @return 创建的节点
+    ///
+    template <typename... Args>
+    static ast_node * create(Args &&... args)
+    {
+        return arena().create<ast_node>(std::forward<Args>(args)...);
+    }
 };
 
-/// @brief AST资源清理
+/// @brief AST资源清理，整体释放当前线程AST的内存池，之前创建的所有节点都不能再使用
 void free_ast(ast_node * root);
 
-/// @brief抽象语法树的根节点指针
-extern ast_node * ast_root;
-
 /// @brief 创建AST的内部节点，请注意可追加孩子节点，请按次序依次加入，最多3个
 /// @param node_type 节点类型
 /// @param first_child 第一个孩子节点
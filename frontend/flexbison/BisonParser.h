@@ -2,8 +2,8 @@
 /// @file BisonParser.h
 /// @brief Bison分析的头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,25 +11,12 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>改为纯语法分析器，yyparse的声明由生成的头文件给出
 /// </table>
 ///
 #pragma once
 
 #include "AttrType.h"
 
-/// @brief yyparse的类型声明
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse(void * YYPARSE_PARAM);
-#else
-int yyparse();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse(void);
-#else
-int yyparse();
-#endif
-#endif /* ! YYPARSE_PARAM */
-
+/// yyparse(yyscan_t scanner, ast_node ** root)的声明在生成的头文件中
 #include "MiniCBison.h"
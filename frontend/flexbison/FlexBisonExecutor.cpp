@@ -2,8 +2,8 @@
 /// @file FlexBisonExecutor.cpp
 /// @brief Flex+Bison词语与语法分析执行器
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,44 +11,86 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>使用可重入的扫描器与纯语法分析器
 /// </table>
 ///
+#include <cstdio>
+#include <filesystem>
+
 #include "FlexBisonExecutor.h"
 #include "BisonParser.h"
 #include "FlexLexer.h"
+#include "MappedFile.h"
 
 /// @brief 前端词法与语法解析生成AST
 /// @return true: 成功 false：错误
 bool FlexBisonExecutor::run()
 {
     // 若指定有参数，则作为词法分析的输入文件
-    yyin = fopen(filename.c_str(), "r");
-    if (yyin == nullptr) {
-        printf("Can't open file %s\n", filename.c_str());
+    // 普通文件映射到内存，管道、/dev/stdin等不是普通文件的输入仍由flex按流分块读入
+    std::error_code ec;
+    bool regular = std::filesystem::is_regular_file(filename, ec);
+
+    MappedFile source;
+    FILE * stream = nullptr;
+    if (regular) {
+        if (!source.open(filename)) {
+            printf("Can't open file %s\n", filename.c_str());
+            return false;
+        }
+    } else {
+        stream = fopen(filename.c_str(), "r");
+        if (nullptr == stream) {
+            printf("Can't open file %s\n", filename.c_str());
+            return false;
+        }
+    }
+
+    // 扫描器的状态都在scanner中，不同的执行器可同时运行
+    yyscan_t scanner;
+    if (yylex_init(&scanner) != 0) {
+        printf("yylex_init failed\n");
+        if (stream) {
+            fclose(stream);
+        }
         return false;
     }
 
+    // 整个文件作为一个缓冲区，空白与注释的跳过不会在分块读入的边界处中断
+    // 按流读入时跨越分块边界的注释由规则本身识别，见MiniC.l中的yy_skip_blank
+    YY_BUFFER_STATE buffer = nullptr;
+    if (regular) {
+        buffer = yy_scan_bytes(source.data(), (int) source.size(), scanner);
+    } else {
+        buffer = yy_create_buffer(stream, YY_BUF_SIZE, scanner);
+        yy_switch_to_buffer(buffer, scanner);
+    }
+    yyset_lineno(1, scanner);
+
     // 如果要查看LALR的移进与归约过程，请设置yydebug为1
 #ifdef BISON_DEBUG_ENABLE
     yydebug = 1;
 #endif
 
-    // 词法、语法分析生成抽象语法树AST
-    bool result = yyparse();
-    if (0 != result) {
-        printf("yyparse failed\n");
+    // 词法、语法分析生成抽象语法树AST，根节点通过参数返回
+    ast_node * root = nullptr;
+    int result = yyparse(scanner, &root);
+
+    // 释放缓冲区与扫描器
+    yy_delete_buffer(buffer, scanner);
+    yylex_destroy(scanner);
 
-        // 关闭文件
-        fclose(yyin);
+    if (stream) {
+        fclose(stream);
+    }
 
+    if (0 != result) {
+        printf("yyparse failed\n");
         return false;
     }
 
     // 设置抽象语法树的根节点
-    astRoot = ast_root;
-
-    // 关闭文件
-    fclose(yyin);
+    astRoot = root;
 
     return true;
 }
\ No newline at end of file
@@ -10,4 +10,7 @@
  */
 #pragma once
 
+// 可重入扫描器的yylex与yyget_lval要用到bison生成的YYSTYPE
+#include "BisonParser.h"
+
 #include "MiniCFlex.h"
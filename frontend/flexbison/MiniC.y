@@ -2,25 +2,39 @@
 #include <cstdio>
 #include <cstring>
 
+// bison生成的头文件，词法分析的头文件要用到其中的YYSTYPE
+#include "BisonParser.h"
+
 // 词法分析头文件
 #include "FlexLexer.h"
 
-// bison生成的头文件
-#include "BisonParser.h"
-
 // 抽象语法树函数定义原型头文件
 #include "AST.h"
 
 #include "IntegerType.h"
 
 // LR分析失败时所调用函数的原型声明
-void yyerror(char * msg);
-
-// 用于生成唯一标签的计数器
-static int unique_label_counter = 0;
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg);
 
 %}
 
+// 生成的头文件中yyparse的参数要用到扫描器与AST节点的类型
+%code requires {
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void * yyscan_t;
+#endif
+
+class ast_node;
+}
+
+// 纯语法分析器，不使用全局变量，yylval等都是yyparse的局部变量，可同时分析多个文件
+%define api.pure full
+
+// 词法分析使用flex的可重入扫描器，抽象语法树的根通过root返回
+%lex-param {yyscan_t scanner}
+%parse-param {yyscan_t scanner} {ast_node ** root}
+
 // 联合体声明，用于后续终结符和非终结符号属性指定使用
 %union {
     class ast_node * node;
@@ -91,14 +105,14 @@ CompileUnit : FuncDef {
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		$$ = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, $1);
 
-		// 设置到全局变量中
-		ast_root = $$;
+		// 通过yyparse的参数返回
+		*root = $$;
 	}
 	| VarDecl {
 
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		$$ = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, $1);
-		ast_root = $$;
+		*root = $$;
 	}
 	| CompileUnit FuncDef {
 
@@ -387,44 +401,24 @@ Statement : T_RETURN Expr T_SEMICOLON {
 	| T_IF T_L_PAREN Expr T_R_PAREN Statement {
 		// IF语句
 		
-		// 为条件表达式生成唯一的真假出口标签
-		std::string true_label = ".L" + std::to_string(unique_label_counter++);
-		std::string false_label = ".L" + std::to_string(unique_label_counter++);
-		
-		// 设置条件表达式的真假出口标签
-		$3->true_label = true_label;  // 真出口，执行语句
-		$3->false_label = false_label; // 假出口，跳过语句
-		
+		// 条件表达式的真假出口标签在产生IR时设置
+
 		// 创建IF语句节点，包含条件表达式和语句
 		$$ = create_contain_node(ast_operator_type::AST_OP_IF, $3, $5);
 	}
 	| T_IF T_L_PAREN Expr T_R_PAREN Statement T_ELSE Statement {
 		// IF-ELSE语句
 		
-		// 为条件表达式生成唯一的真假出口标签
-		std::string true_label = ".L" + std::to_string(unique_label_counter++);
-		std::string false_label = ".L" + std::to_string(unique_label_counter++);
-		std::string end_label = ".L" + std::to_string(unique_label_counter++);
-		
-		// 设置条件表达式的真假出口标签
-		$3->true_label = true_label;  // 真出口，执行IF语句
-		$3->false_label = false_label; // 假出口，执行ELSE语句
-		
+		// 条件表达式的真假出口标签在产生IR时设置
+
 		// 创建IF-ELSE语句节点，包含条件表达式、IF语句和ELSE语句
 		$$ = create_contain_node(ast_operator_type::AST_OP_IF_ELSE, $3, $5, $7);
 	}
 	| T_WHILE T_L_PAREN Expr T_R_PAREN Statement {
 		// WHILE循环语句
 		
-		// 为条件表达式生成唯一的循环入口、循环体和循环结束标签
-		std::string loop_start_label_parser_hint = ".L" + std::to_string(unique_label_counter++);
-		std::string loop_body_label_parser_hint = ".L" + std::to_string(unique_label_counter++);
-		std::string loop_end_label_parser_hint = ".L" + std::to_string(unique_label_counter++);
-		
-		// 设置条件表达式的真假出口标签 (these are hints for the condition node itself)
-		$3->true_label = loop_body_label_parser_hint;
-		$3->false_label = loop_end_label_parser_hint;
-		
+		// 循环入口、循环体和循环结束标签在产生IR时设置
+
 		// 创建WHILE语句节点，包含条件表达式和循环体语句
 		ast_node* while_node = create_contain_node(ast_operator_type::AST_OP_WHILE, $3, $5);
 		
@@ -692,7 +686,7 @@ ArrayDimensions : T_L_BRACKET T_DIGIT T_R_BRACKET {
 	}
 	| T_L_BRACKET T_R_BRACKET {
 		// 空维度数组（用于函数形参）
-		ast_node * dim_node = ast_node::New(digit_int_attr{0, yylineno}); // 使用0表示空维度
+		ast_node * dim_node = ast_node::New(digit_int_attr{0, yyget_lineno(scanner)}); // 使用0表示空维度
 		$$ = create_contain_node(ast_operator_type::AST_OP_ARRAY_DIMENSIONS, dim_node);
 	}
 	| ArrayDimensions T_L_BRACKET T_DIGIT T_R_BRACKET {
@@ -702,7 +696,7 @@ ArrayDimensions : T_L_BRACKET T_DIGIT T_R_BRACKET {
 	}
 	| ArrayDimensions T_L_BRACKET T_R_BRACKET {
 		// 多维数组的空维度
-		ast_node * dim_node = ast_node::New(digit_int_attr{0, yylineno}); // 使用0表示空维度
+		ast_node * dim_node = ast_node::New(digit_int_attr{0, yyget_lineno(scanner)}); // 使用0表示空维度
 		$$ = $1->insert_son_node(dim_node);
 	}
 	;
@@ -725,7 +719,9 @@ ArrayAccess : T_ID T_L_BRACKET Expr T_R_BRACKET {
 %%
 
 // 语法识别错误要调用函数的定义
-void yyerror(char * msg)
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg)
 {
-    printf("Line %d: %s\n", yylineno, msg);
+    (void) root;
+
+    printf("Line %d: %s\n", yyget_lineno(scanner), msg);
 }
@@ -55,7 +55,7 @@
 #define YYSKELETON_NAME "yacc.c"
 
 /* Pure parsers.  */
-#define YYPURE 0
+#define YYPURE 2
 
 /* Push parsers.  */
 #define YYPUSH 0
@@ -72,25 +72,22 @@
 #include <cstdio>
 #include <cstring>
 
+// bison生成的头文件，词法分析的头文件要用到其中的YYSTYPE
+#include "BisonParser.h"
+
 // 词法分析头文件
 #include "FlexLexer.h"
 
-// bison生成的头文件
-#include "BisonParser.h"
-
 // 抽象语法树函数定义原型头文件
 #include "AST.h"
 
 #include "IntegerType.h"
 
 // LR分析失败时所调用函数的原型声明
-void yyerror(char * msg);
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg);
 
-// 用于生成唯一标签的计数器
-static int unique_label_counter = 0;
 
-
-#line 94 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 91 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
 
 # ifndef YY_CAST
 #  ifdef __cplusplus
@@ -571,15 +568,15 @@ static const yytype_int8 yytranslate[] =
 /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
 static const yytype_int16 yyrline[] =
 {
-       0,    89,    89,    97,   103,   108,   115,   133,   152,   156,
-     163,   180,   200,   206,   217,   222,   231,   235,   246,   252,
-     283,   316,   324,   336,   345,   346,   353,   359,   363,   369,
-     375,   381,   387,   401,   416,   433,   437,   445,   452,   455,
-     458,   465,   468,   471,   480,   485,   490,   498,   501,   504,
-     507,   510,   513,   522,   527,   532,   540,   543,   552,   557,
-     562,   570,   573,   576,   586,   592,   598,   604,   620,   639,
-     643,   649,   661,   665,   672,   681,   688,   693,   698,   703,
-     711,   719
+       0,   103,   103,   111,   117,   122,   129,   147,   166,   170,
+     177,   194,   214,   220,   231,   236,   245,   249,   260,   266,
+     297,   330,   338,   350,   359,   360,   367,   373,   377,   383,
+     389,   395,   401,   409,   417,   427,   431,   439,   446,   449,
+     452,   459,   462,   465,   474,   479,   484,   492,   495,   498,
+     501,   504,   507,   516,   521,   526,   534,   537,   546,   551,
+     556,   564,   567,   570,   580,   586,   592,   598,   614,   633,
+     637,   643,   655,   659,   666,   675,   682,   687,   692,   697,
+     705,   713
 };
 #endif
 
@@ -805,7 +802,7 @@ enum { YYENOMEM = -2 };
       }                                                           \
     else                                                          \
       {                                                           \
-        yyerror (YY_("syntax error: cannot back up")); \
+        yyerror (scanner, root, YY_("syntax error: cannot back up")); \
         YYERROR;                                                  \
       }                                                           \
   while (0)
@@ -838,7 +835,7 @@ do {                                                                      \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Kind, Value); \
+                  Kind, Value, scanner, root); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
@@ -850,10 +847,12 @@ do {                                                                      \
 
 static void
 yy_symbol_value_print (FILE *yyo,
-                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, ast_node ** root)
 {
   FILE *yyoutput = yyo;
   YY_USE (yyoutput);
+  YY_USE (scanner);
+  YY_USE (root);
   if (!yyvaluep)
     return;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
@@ -868,12 +867,12 @@ yy_symbol_value_print (FILE *yyo,
 
 static void
 yy_symbol_print (FILE *yyo,
-                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, yyscan_t scanner, ast_node ** root)
 {
   YYFPRINTF (yyo, "%s %s (",
              yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, root);
   YYFPRINTF (yyo, ")");
 }
 
@@ -907,7 +906,7 @@ do {                                                            \
 
 static void
 yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
-                 int yyrule)
+                 int yyrule, yyscan_t scanner, ast_node ** root)
 {
   int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
@@ -920,7 +919,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
                        YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
-                       &yyvsp[(yyi + 1) - (yynrhs)]);
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, root);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -928,7 +927,7 @@ yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
 # define YY_REDUCE_PRINT(Rule)          \
 do {                                    \
   if (yydebug)                          \
-    yy_reduce_print (yyssp, yyvsp, Rule); \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, root); \
 } while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
@@ -969,9 +968,11 @@ int yydebug;
 
 static void
 yydestruct (const char *yymsg,
-            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, yyscan_t scanner, ast_node ** root)
 {
   YY_USE (yyvaluep);
+  YY_USE (scanner);
+  YY_USE (root);
   if (!yymsg)
     yymsg = "Deleting";
   YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
@@ -982,13 +983,6 @@ yydestruct (const char *yymsg,
 }
 
 
-/* Lookahead token kind.  */
-int yychar;
-
-/* The semantic value of the lookahead symbol.  */
-YYSTYPE yylval;
-/* Number of syntax errors so far.  */
-int yynerrs;
 
 
 
@@ -998,8 +992,21 @@ int yynerrs;
 `----------*/
 
 int
-yyparse (void)
+yyparse (yyscan_t scanner, ast_node ** root)
 {
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
     yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
     int yyerrstatus = 0;
@@ -1152,7 +1159,7 @@ yybackup:
   if (yychar == YYEMPTY)
     {
       YYDPRINTF ((stderr, "Reading a token\n"));
-      yychar = yylex ();
+      yychar = yylex (&yylval, scanner);
     }
 
   if (yychar <= YYEOF)
@@ -1240,50 +1247,50 @@ yyreduce:
   switch (yyn)
     {
   case 2: /* CompileUnit: FuncDef  */
-#line 89 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 103 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                       {
 
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, (yyvsp[0].node));
 
-		// 设置到全局变量中
-		ast_root = (yyval.node);
+		// 通过yyparse的参数返回
+		*root = (yyval.node);
 	}
-#line 1253 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1260 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 3: /* CompileUnit: VarDecl  */
-#line 97 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 111 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
 
 		// 创建一个编译单元的节点AST_OP_COMPILE_UNIT
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT, (yyvsp[0].node));
-		ast_root = (yyval.node);
+		*root = (yyval.node);
 	}
-#line 1264 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1271 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 4: /* CompileUnit: CompileUnit FuncDef  */
-#line 103 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 117 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 
 		// 把函数定义的节点作为编译单元的孩子
 		(yyval.node) = (yyvsp[-1].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1274 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1281 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 5: /* CompileUnit: CompileUnit VarDecl  */
-#line 108 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 122 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// 把变量定义的节点作为编译单元的孩子
 		(yyval.node) = (yyvsp[-1].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1283 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1290 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 6: /* FuncDef: BasicType T_ID T_L_PAREN T_R_PAREN Block  */
-#line 115 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 129 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                     {
 
 		// 函数返回类型
@@ -1302,11 +1309,11 @@ yyreduce:
 		// create_func_def函数内会释放funcId中指向的标识符空间，切记，之后不要再释放，之前一定要是通过strdup函数或者malloc分配的空间
 		(yyval.node) = create_func_def(funcReturnType, funcId, blockNode, formalParamsNode);
 	}
-#line 1306 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1313 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 7: /* FuncDef: BasicType T_ID T_L_PAREN FormalParamList T_R_PAREN Block  */
-#line 133 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 147 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                                    {
 		// 函数返回类型
 		type_attr funcReturnType = (yyvsp[-5].type);
@@ -1323,29 +1330,29 @@ yyreduce:
 		// 创建函数定义的节点，孩子有类型，函数名，语句块和形参
 		(yyval.node) = create_func_def(funcReturnType, funcId, blockNode, formalParamsNode);
 	}
-#line 1327 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1334 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 8: /* FormalParamList: FormalParam  */
-#line 152 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 166 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// 创建形参列表节点，并把当前的形参节点加入
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAMS, (yyvsp[0].node));
 	}
-#line 1336 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1343 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 9: /* FormalParamList: FormalParamList T_COMMA FormalParam  */
-#line 156 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 170 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                               {
 		// 左递归增加形参
 		(yyval.node) = (yyvsp[-2].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1345 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1352 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 10: /* FormalParam: BasicType T_ID  */
-#line 163 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 177 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                              {
 		// 形参类型
 		type_attr paramType = (yyvsp[-1].type);
@@ -1363,11 +1370,11 @@ yyreduce:
 		// 创建形参节点，包含类型和名称
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAM, type_node, id_node);
 	}
-#line 1367 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1374 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 11: /* FormalParam: BasicType T_ID ArrayDimensions  */
-#line 180 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 194 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                          {
 		// 数组形参定义
 		type_attr paramType = (yyvsp[-2].type);
@@ -1383,78 +1390,78 @@ yyreduce:
 		// 创建数组形参节点，包含类型、名称和维度信息
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_FUNC_FORMAL_PARAM_ARRAY, type_node, id_node, (yyvsp[0].node));
 	}
-#line 1387 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1394 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 12: /* Block: T_L_BRACE T_R_BRACE  */
-#line 200 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 214 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                             {
 		// 语句块没有语句
 
 		// 为了方便创建一个空的Block节点
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_BLOCK);
 	}
-#line 1398 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1405 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 13: /* Block: T_L_BRACE BlockItemList T_R_BRACE  */
-#line 206 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 220 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                             {
 		// 语句块含有语句
 
 		// BlockItemList归约时内部创建Block节点，并把语句加入，这里不创建Block节点
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 1409 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1416 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 14: /* BlockItemList: BlockItem  */
-#line 217 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 231 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                           {
 		// 第一个左侧的孩子节点归约成Block节点，后续语句可持续作为孩子追加到Block节点中
 		// 创建一个AST_OP_BLOCK类型的中间节点，孩子为Statement($1)
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_BLOCK, (yyvsp[0].node));
 	}
-#line 1419 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1426 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 15: /* BlockItemList: BlockItemList BlockItem  */
-#line 222 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 236 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                   {
 		// 把BlockItem归约的节点加入到BlockItemList的节点中
 		(yyval.node) = (yyvsp[-1].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 1428 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1435 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 16: /* BlockItem: Statement  */
-#line 231 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 245 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                        {
 		// 语句节点传递给归约后的节点上，综合属性
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1437 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1444 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 17: /* BlockItem: VarDecl  */
-#line 235 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 249 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
 		// 变量声明节点传递给归约后的节点上，综合属性
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1446 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1453 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 18: /* VarDecl: VarDeclExpr T_SEMICOLON  */
-#line 246 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 260 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                   {
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 1454 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1461 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 19: /* VarDeclExpr: BasicType VarDef  */
-#line 252 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 266 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 
 		ast_node * type_node = create_type_node((yyvsp[-1].type)); // $1 is BasicType
@@ -1486,11 +1493,11 @@ yyreduce:
              ((yyval.node))->type = type_node->type; // Explicitly set type for the statement node
         }
 	}
-#line 1490 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1497 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 20: /* VarDeclExpr: VarDeclExpr T_COMMA VarDef  */
-#line 283 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 297 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                      {
 
         Type * common_type_for_stmt = (yyvsp[-2].node)->type; // Corrected type to Type*
@@ -1521,11 +1528,11 @@ yyreduce:
 
         (yyval.node) = (yyvsp[-2].node)->insert_son_node(decl_node); // Add to existing AST_OP_DECL_STMT
 	}
-#line 1525 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1532 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 21: /* VarDef: T_ID  */
-#line 316 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 330 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
               {
 		// 变量ID
 
@@ -1534,11 +1541,11 @@ yyreduce:
 		// 对于字符型字面量的字符串空间需要释放，因词法用到了strdup进行了字符串复制
 		free((yyvsp[0].var_id).id);
 	}
-#line 1538 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1545 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 22: /* VarDef: T_ID ArrayDimensions  */
-#line 324 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 338 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                {
 		// 数组变量定义
 		
@@ -1551,444 +1558,424 @@ yyreduce:
 		// 创建数组定义节点，包含变量名和维度信息
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_ARRAY_DEF, var_node, (yyvsp[0].node));
 	}
-#line 1555 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1562 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 23: /* VarDef: T_ID T_ASSIGN Expr  */
-#line 336 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 350 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                          { // New production for initialization
         ast_node * id_node = ast_node::New(var_id_attr{(yyvsp[-2].var_id).id, (yyvsp[-2].var_id).lineno});
         free((yyvsp[-2].var_id).id); // free the strduped id
         // Temporarily use AST_OP_ASSIGN to package id_node and expr_node ($3)
         (yyval.node) = create_contain_node(ast_operator_type::AST_OP_ASSIGN, id_node, (yyvsp[0].node));
     }
-#line 1566 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1573 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 24: /* BasicType: T_INT  */
-#line 345 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 359 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                  { (yyval.type) = (yyvsp[0].type); }
-#line 1572 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1579 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 25: /* BasicType: T_VOID  */
-#line 346 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 360 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   { (yyval.type) = (yyvsp[0].type); }
-#line 1578 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1585 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 26: /* Statement: T_RETURN Expr T_SEMICOLON  */
-#line 353 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 367 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                       {
 		// 返回语句
 
 		// 创建返回节点AST_OP_RETURN，其孩子为Expr，即$2
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_RETURN, (yyvsp[-1].node));
 	}
-#line 1589 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1596 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 27: /* Statement: T_RETURN T_SEMICOLON  */
-#line 359 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 373 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                {
 		// 创建一个没有子节点的返回节点 AST_OP_RETURN
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_RETURN);
 	}
-#line 1598 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1605 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 28: /* Statement: LVal T_ASSIGN Expr T_SEMICOLON  */
-#line 363 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 377 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                          {
 		// 赋值语句
 
 		// 创建一个AST_OP_ASSIGN类型的中间节点，孩子为LVal($1)和Expr($3)
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_ASSIGN, (yyvsp[-3].node), (yyvsp[-1].node));
 	}
-#line 1609 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1616 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 29: /* Statement: Block  */
-#line 369 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 383 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		// 语句块
 
 		// 内部已创建block节点，直接传递给Statement
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1620 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1627 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 30: /* Statement: Expr T_SEMICOLON  */
-#line 375 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 389 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                            {
 		// 表达式语句
 
 		// 内部已创建表达式，直接传递给Statement
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 1631 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1638 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 31: /* Statement: T_SEMICOLON  */
-#line 381 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 395 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                       {
 		// 空语句
 
 		// 直接返回空指针，需要再把语句加入到语句块时要注意判断，空语句不要加入
 		(yyval.node) = nullptr;
 	}
-#line 1642 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1649 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 32: /* Statement: T_IF T_L_PAREN Expr T_R_PAREN Statement  */
-#line 387 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 401 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                   {
 		// IF语句
 		
-		// 为条件表达式生成唯一的真假出口标签
-		std::string true_label = ".L" + std::to_string(unique_label_counter++);
-		std::string false_label = ".L" + std::to_string(unique_label_counter++);
-		
-		// 设置条件表达式的真假出口标签
-		(yyvsp[-2].node)->true_label = true_label;  // 真出口，执行语句
-		(yyvsp[-2].node)->false_label = false_label; // 假出口，跳过语句
-		
+		// 条件表达式的真假出口标签在产生IR时设置
+
 		// 创建IF语句节点，包含条件表达式和语句
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_IF, (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1661 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1662 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 33: /* Statement: T_IF T_L_PAREN Expr T_R_PAREN Statement T_ELSE Statement  */
-#line 401 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 409 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                                    {
 		// IF-ELSE语句
 		
-		// 为条件表达式生成唯一的真假出口标签
-		std::string true_label = ".L" + std::to_string(unique_label_counter++);
-		std::string false_label = ".L" + std::to_string(unique_label_counter++);
-		std::string end_label = ".L" + std::to_string(unique_label_counter++);
-		
-		// 设置条件表达式的真假出口标签
-		(yyvsp[-4].node)->true_label = true_label;  // 真出口，执行IF语句
-		(yyvsp[-4].node)->false_label = false_label; // 假出口，执行ELSE语句
-		
+		// 条件表达式的真假出口标签在产生IR时设置
+
 		// 创建IF-ELSE语句节点，包含条件表达式、IF语句和ELSE语句
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_IF_ELSE, (yyvsp[-4].node), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1681 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1675 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 34: /* Statement: T_WHILE T_L_PAREN Expr T_R_PAREN Statement  */
-#line 416 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 417 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                      {
 		// WHILE循环语句
 		
-		// 为条件表达式生成唯一的循环入口、循环体和循环结束标签
-		std::string loop_start_label_parser_hint = ".L" + std::to_string(unique_label_counter++);
-		std::string loop_body_label_parser_hint = ".L" + std::to_string(unique_label_counter++);
-		std::string loop_end_label_parser_hint = ".L" + std::to_string(unique_label_counter++);
-		
-		// 设置条件表达式的真假出口标签 (these are hints for the condition node itself)
-		(yyvsp[-2].node)->true_label = loop_body_label_parser_hint;
-		(yyvsp[-2].node)->false_label = loop_end_label_parser_hint;
-		
+		// 循环入口、循环体和循环结束标签在产生IR时设置
+
 		// 创建WHILE语句节点，包含条件表达式和循环体语句
 		ast_node* while_node = create_contain_node(ast_operator_type::AST_OP_WHILE, (yyvsp[-2].node), (yyvsp[0].node));
 		
 		(yyval.node) = while_node;
 	}
-#line 1703 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1690 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 35: /* Statement: T_BREAK T_SEMICOLON  */
-#line 433 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 427 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// BREAK语句
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_BREAK);
 	}
-#line 1712 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1699 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 36: /* Statement: T_CONTINUE T_SEMICOLON  */
-#line 437 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 431 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                  {
 		// CONTINUE语句
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_CONTINUE);
 	}
-#line 1721 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1708 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 37: /* Expr: OrExpr  */
-#line 445 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 439 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
               {
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1729 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1716 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 38: /* OrExpr: AndExpr  */
-#line 452 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 446 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                  {
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1737 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1724 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 39: /* OrExpr: AndExpr T_OR AndExpr  */
-#line 455 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 449 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                {
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_OR, (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1745 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1732 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 40: /* OrExpr: OrExpr T_OR AndExpr  */
-#line 458 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 452 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_OR, (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1753 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1740 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 41: /* AndExpr: RelExp  */
-#line 465 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 459 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                  {
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1761 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1748 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 42: /* AndExpr: RelExp T_AND RelExp  */
-#line 468 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 462 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_AND, (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1769 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1756 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 43: /* AndExpr: AndExpr T_AND RelExp  */
-#line 471 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 465 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                {
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_AND, (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1777 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1764 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 44: /* RelExp: AddExp  */
-#line 480 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 474 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		// 加减表达式
 		// 直接传递到归约后的节点
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1787 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1774 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 45: /* RelExp: AddExp RelOp AddExp  */
-#line 485 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 479 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// 算术表达式 + 关系运算 + 算术表达式
 		// 创建关系运算节点，孩子为两个算术表达式节点
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1797 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1784 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 46: /* RelExp: RelExp RelOp AddExp  */
-#line 490 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 484 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// 关系表达式 + 关系运算 + 算术表达式
 		// 创建关系运算节点，孩子为关系表达式和算术表达式
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1807 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1794 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 47: /* RelOp: T_GT  */
-#line 498 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 492 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
             {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_GT;
 	}
-#line 1815 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1802 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 48: /* RelOp: T_GE  */
-#line 501 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 495 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_GE;
 	}
-#line 1823 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1810 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 49: /* RelOp: T_LT  */
-#line 504 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 498 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_LT;
 	}
-#line 1831 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1818 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 50: /* RelOp: T_LE  */
-#line 507 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 501 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_LE;
 	}
-#line 1839 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1826 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 51: /* RelOp: T_EQ  */
-#line 510 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 504 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_EQ;
 	}
-#line 1847 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1834 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 52: /* RelOp: T_NE  */
-#line 513 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 507 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_NE;
 	}
-#line 1855 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1842 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 53: /* AddExp: MulExp  */
-#line 522 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 516 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		// 乘除模表达式
 		// 直接传递到归约后的节点
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1865 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1852 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 54: /* AddExp: MulExp AddOp MulExp  */
-#line 527 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 521 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// 两个乘除模表达式的加减运算
 		// 创建加减运算节点，其孩子为两个乘除模表达式节点
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1875 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1862 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 55: /* AddExp: AddExp AddOp MulExp  */
-#line 532 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 526 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                               {
 		// 左递归形式可通过加减连接多个乘除模表达式
 		// 创建加减运算节点，孩子为AddExp($1)和MulExp($3)
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1885 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1872 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 56: /* AddOp: T_ADD  */
-#line 540 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 534 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
              {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_ADD;
 	}
-#line 1893 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1880 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 57: /* AddOp: T_SUB  */
-#line 543 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 537 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_SUB;
 	}
-#line 1901 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1888 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 58: /* MulExp: UnaryExp  */
-#line 552 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 546 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
 		// 一元表达式
 		// 直接传递到归约后的节点
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1911 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1898 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 59: /* MulExp: UnaryExp MulOp UnaryExp  */
-#line 557 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 551 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                   {
 		// 两个一元表达式的乘除模运算
 		// 创建乘除模运算节点，其孩子为两个一元表达式节点
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1921 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1908 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 60: /* MulExp: MulExp MulOp UnaryExp  */
-#line 562 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 556 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                 {
 		// 左递归形式可通过乘除模连接多个一元表达式
 		// 创建乘除模运算节点，孩子为MulExp($1)和UnaryExp($3)
 		(yyval.node) = create_contain_node(ast_operator_type((yyvsp[-1].op_class)), (yyvsp[-2].node), (yyvsp[0].node));
 	}
-#line 1931 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1918 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 61: /* MulOp: T_MUL  */
-#line 570 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 564 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
              {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_MUL;
 	}
-#line 1939 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1926 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 62: /* MulOp: T_DIV  */
-#line 573 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 567 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_DIV;
 	}
-#line 1947 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1934 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 63: /* MulOp: T_MOD  */
-#line 576 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 570 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		(yyval.op_class) = (int)ast_operator_type::AST_OP_MOD;
 	}
-#line 1955 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1942 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 64: /* UnaryExp: PrimaryExp  */
-#line 586 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 580 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                       {
 		// 基本表达式
 
 		// 传递到归约后的UnaryExp上
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 1966 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1953 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 65: /* UnaryExp: T_SUB UnaryExp  */
-#line 592 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 586 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                          {
 		// 求负运算
 		
 		// 创建求负运算节点
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_NEG, (yyvsp[0].node));
 	}
-#line 1977 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1964 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 66: /* UnaryExp: T_NOT UnaryExp  */
-#line 598 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 592 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                          {
 		// 逻辑非运算
 		
 		// 创建逻辑非运算节点
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_NOT, (yyvsp[0].node));
 	}
-#line 1988 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1975 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 67: /* UnaryExp: T_ID T_L_PAREN T_R_PAREN  */
-#line 604 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 598 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                    {
 		// 没有实参的函数调用
 
@@ -2005,11 +1992,11 @@ yyreduce:
 		(yyval.node) = create_func_call(name_node, paramListNode);
 
 	}
-#line 2009 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 1996 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 68: /* UnaryExp: T_ID T_L_PAREN RealParamList T_R_PAREN  */
-#line 620 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 614 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                  {
 		// 含有实参的函数调用
 
@@ -2025,60 +2012,60 @@ yyreduce:
 		// 创建函数调用节点，其孩子为被调用函数名和实参，实参不为空
 		(yyval.node) = create_func_call(name_node, paramListNode);
 	}
-#line 2029 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2016 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 69: /* PrimaryExp: T_L_PAREN Expr T_R_PAREN  */
-#line 639 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 633 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                        {
 		// 带有括号的表达式
 		(yyval.node) = (yyvsp[-1].node);
 	}
-#line 2038 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2025 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 70: /* PrimaryExp: T_DIGIT  */
-#line 643 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 637 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                   {
         	// 无符号整型字面量
 
 		// 创建一个无符号整型的终结符节点
 		(yyval.node) = ast_node::New((yyvsp[0].integer_num));
 	}
-#line 2049 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2036 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 71: /* PrimaryExp: LVal  */
-#line 649 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 643 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                 {
 		// 具有左值的表达式
 
 		// 直接传递到归约后的非终结符号PrimaryExp
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 2060 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2047 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 72: /* RealParamList: Expr  */
-#line 661 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 655 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                      {
 		// 创建实参列表节点，并把当前的Expr节点加入
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS, (yyvsp[0].node));
 	}
-#line 2069 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2056 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 73: /* RealParamList: RealParamList T_COMMA Expr  */
-#line 665 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 659 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                      {
 		// 左递归增加实参表达式
 		(yyval.node) = (yyvsp[-2].node)->insert_son_node((yyvsp[0].node));
 	}
-#line 2078 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2065 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 74: /* LVal: T_ID  */
-#line 672 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 666 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
             {
 		// 变量名终结符
 
@@ -2088,60 +2075,60 @@ yyreduce:
 		// 对于字符型字面量的字符串空间需要释放，因词法用到了strdup进行了字符串复制
 		free((yyvsp[0].var_id).id);
 	}
-#line 2092 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2079 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 75: /* LVal: ArrayAccess  */
-#line 681 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 675 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                       {
 		// 数组访问表达式
 		(yyval.node) = (yyvsp[0].node);
 	}
-#line 2101 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2088 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 76: /* ArrayDimensions: T_L_BRACKET T_DIGIT T_R_BRACKET  */
-#line 688 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 682 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                   {
 		// 一维数组
 		ast_node * dim_node = ast_node::New((yyvsp[-1].integer_num));
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_ARRAY_DIMENSIONS, dim_node);
 	}
-#line 2111 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2098 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 77: /* ArrayDimensions: T_L_BRACKET T_R_BRACKET  */
-#line 693 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 687 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                   {
 		// 空维度数组（用于函数形参）
-		ast_node * dim_node = ast_node::New(digit_int_attr{0, yylineno}); // 使用0表示空维度
+		ast_node * dim_node = ast_node::New(digit_int_attr{0, yyget_lineno(scanner)}); // 使用0表示空维度
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_ARRAY_DIMENSIONS, dim_node);
 	}
-#line 2121 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2108 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 78: /* ArrayDimensions: ArrayDimensions T_L_BRACKET T_DIGIT T_R_BRACKET  */
-#line 698 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 692 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                           {
 		// 多维数组，左递归添加维度
 		ast_node * dim_node = ast_node::New((yyvsp[-1].integer_num));
 		(yyval.node) = (yyvsp[-3].node)->insert_son_node(dim_node);
 	}
-#line 2131 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2118 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 79: /* ArrayDimensions: ArrayDimensions T_L_BRACKET T_R_BRACKET  */
-#line 703 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 697 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                   {
 		// 多维数组的空维度
-		ast_node * dim_node = ast_node::New(digit_int_attr{0, yylineno}); // 使用0表示空维度
+		ast_node * dim_node = ast_node::New(digit_int_attr{0, yyget_lineno(scanner)}); // 使用0表示空维度
 		(yyval.node) = (yyvsp[-2].node)->insert_son_node(dim_node);
 	}
-#line 2141 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2128 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 80: /* ArrayAccess: T_ID T_L_BRACKET Expr T_R_BRACKET  */
-#line 711 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 705 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                 {
 		// 一维数组访问
 		ast_node * var_node = ast_node::New((yyvsp[-3].var_id));
@@ -2150,20 +2137,20 @@ yyreduce:
 		// 创建数组访问节点，包含数组名和索引表达式
 		(yyval.node) = create_contain_node(ast_operator_type::AST_OP_ARRAY_ACCESS, var_node, (yyvsp[-1].node));
 	}
-#line 2154 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2141 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
   case 81: /* ArrayAccess: ArrayAccess T_L_BRACKET Expr T_R_BRACKET  */
-#line 719 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 713 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
                                                    {
 		// 多维数组访问，左递归添加索引
 		(yyval.node) = (yyvsp[-3].node)->insert_son_node((yyvsp[-1].node));
 	}
-#line 2163 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2150 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
     break;
 
 
-#line 2167 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
+#line 2154 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.cpp"
 
       default: break;
     }
@@ -2210,7 +2197,7 @@ yyerrlab:
   if (!yyerrstatus)
     {
       ++yynerrs;
-      yyerror (YY_("syntax error"));
+      yyerror (scanner, root, YY_("syntax error"));
     }
 
   if (yyerrstatus == 3)
@@ -2227,7 +2214,7 @@ yyerrlab:
       else
         {
           yydestruct ("Error: discarding",
-                      yytoken, &yylval);
+                      yytoken, &yylval, scanner, root);
           yychar = YYEMPTY;
         }
     }
@@ -2283,7 +2270,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, root);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2321,7 +2308,7 @@ yyabortlab:
 | yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
 `-----------------------------------------------------------*/
 yyexhaustedlab:
-  yyerror (YY_("memory exhausted"));
+  yyerror (scanner, root, YY_("memory exhausted"));
   yyresult = 2;
   goto yyreturnlab;
 
@@ -2336,7 +2323,7 @@ yyreturnlab:
          user semantic actions for why this is necessary.  */
       yytoken = YYTRANSLATE (yychar);
       yydestruct ("Cleanup: discarding lookahead",
-                  yytoken, &yylval);
+                  yytoken, &yylval, scanner, root);
     }
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
@@ -2345,7 +2332,7 @@ yyreturnlab:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, root);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
@@ -2356,11 +2343,13 @@ yyreturnlab:
   return yyresult;
 }
 
-#line 725 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 719 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
 
 
 // 语法识别错误要调用函数的定义
-void yyerror(char * msg)
+void yyerror(yyscan_t scanner, ast_node ** root, const char * msg)
 {
-    printf("Line %d: %s\n", yylineno, msg);
+    (void) root;
+
+    printf("Line %d: %s\n", yyget_lineno(scanner), msg);
 }
@@ -44,6 +44,17 @@
 #if YYDEBUG
 extern int yydebug;
 #endif
+/* "%code requires" blocks.  */
+#line 22 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+#define YY_TYPEDEF_YY_SCANNER_T
+typedef void * yyscan_t;
+#endif
+
+class ast_node;
+
+#line 58 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.h"
 
 /* Token kinds.  */
 #ifndef YYTOKENTYPE
@@ -95,7 +106,7 @@ extern int yydebug;
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 25 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
+#line 39 "/home/code/exp04-minic-expr/frontend/flexbison/MiniC.y"
 
     class ast_node * node;
 
@@ -105,7 +116,7 @@ union YYSTYPE
     struct type_attr type;
     int op_class;
 
-#line 109 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.h"
+#line 120 "/home/code/exp04-minic-expr/frontend/flexbison/autogenerated/MiniCBison.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -114,10 +125,9 @@ typedef union YYSTYPE YYSTYPE;
 #endif
 
 
-extern YYSTYPE yylval;
 
 
-int yyparse (void);
+int yyparse (yyscan_t scanner, ast_node ** root);
 
 
 #endif /* !YY_YY_HOME_CODE_EXP04_MINIC_EXPR_FRONTEND_FLEXBISON_AUTOGENERATED_MINICBISON_H_INCLUDED  */
@@ -2,8 +2,8 @@
 /// @file RecursiveDescentExecutor.cpp
 /// @brief 递归下降分析执行器类的实现
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,8 +11,10 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>使用各自的分析上下文
 /// </table>
 ///
+#include "MappedFile.h"
 #include "RecursiveDescentExecutor.h"
 #include "RecursiveDescentFlex.h"
 #include "RecursiveDescentParser.h"
@@ -21,28 +23,22 @@
 /// @return true: 成功 false：错误
 bool RecursiveDescentExecutor::run()
 {
-    // 若指定有参数，则作为词法分析的输入文件
-    rd_filein = fopen(filename.c_str(), "r");
-    if (rd_filein == nullptr) {
+    // 若指定有参数，则作为词法分析的输入文件，整个映射到内存后扫描
+    MappedFile source;
+    if (!source.open(filename)) {
         printf("Can't open file %s\n", filename.c_str());
         return false;
     }
 
+    // 分析状态都在上下文中，不同的执行器可同时运行
+    RDParserContext ctx;
+    rd_set_buffer(ctx, source.data(), source.size());
+
     // 如果要查看LALR的移进与归约过程，请设置yydebug为1
     // yydebug = 1;
 
     // 词法、语法分析生成抽象语法树AST
-    astRoot = rd_parse();
-    if (!astRoot) {
-
-        // 关闭文件
-        fclose(rd_filein);
-
-        return false;
-    }
-
-    // 关闭文件
-    fclose(rd_filein);
+    astRoot = rd_parse(ctx);
 
-    return true;
+    return astRoot != nullptr;
 }
\ No newline at end of file
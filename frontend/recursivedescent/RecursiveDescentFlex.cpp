@@ -2,8 +2,8 @@
 /// @file RecursiveDescentFlex.cpp
 /// @brief 词法分析的手动实现源文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.1
-/// @date 2024-11-23
+/// @version 1.4
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,377 +12,371 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>改为在内存缓冲区上用指针扫描，关键字用完美哈希查找
+/// <tr><td>2026-10-19 <td>1.3     <td>zenglj  <td>空白与注释用SIMD成块跳过
+/// <tr><td>2026-10-19 <td>1.4     <td>zenglj  <td>词法状态移到分析的上下文中
 /// </table>
 ///
-#include <cctype>
+#include <array>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
-#include <string>
+#include <string_view>
 
+#include "RecursiveDescentFlex.h"
 #include "RecursiveDescentParser.h"
-#include "Common.h"
+#include "SkipBlank.h"
 
-/// @brief 词法分析的行号信息
-int64_t rd_line_no = 1;
+/// @brief 字符的类别
+enum CharClass : uint8_t {
+    CC_DIGIT = 1,  ///< 0-9
+    CC_HEX = 2,    ///< 0-9a-fA-F
+    CC_LETTER = 4, ///< 字母或下划线
+};
 
-/// @brief 词法分析的token对应的字符识别
-std::string tokenValue;
+/// @brief 字符类别表，代替逐字符调用isdigit等函数
+static constexpr std::array<uint8_t, 256> charClass = [] {
+    std::array<uint8_t, 256> table{};
+    for (int c = '0'; c <= '9'; c++) {
+        table[c] = CC_DIGIT | CC_HEX;
+    }
+    for (int c = 'a'; c <= 'z'; c++) {
+        table[c] = CC_LETTER;
+        table[c - 'a' + 'A'] = CC_LETTER;
+    }
+    for (int c = 'a'; c <= 'f'; c++) {
+        table[c] |= CC_HEX;
+        table[c - 'a' + 'A'] |= CC_HEX;
+    }
+    table['_'] = CC_LETTER;
+    return table;
+}();
 
-/// @brief 输入源文件指针
-FILE * rd_filein;
+/// @brief 检查字符是否属于指定的类别
+/// @param c 字符
+/// @param cls 类别
+/// @return true：属于，false：不属于
+static inline bool isClass(char c, uint8_t cls)
+{
+    return (charClass[(uint8_t) c] & cls) != 0;
+}
 
 /// @brief 关键字与Token类别的数据结构
 struct KeywordToken {
-    std::string name;
-    enum RDTokenType type;
+    std::string_view name;
+    enum RDTokenType type = RDTokenType::T_ID;
 };
 
 /// @brief  关键字与Token对应表
-static KeywordToken allKeywords[] = {
+static constexpr KeywordToken allKeywords[] = {
     {"int", RDTokenType::T_INT},
     {"return", RDTokenType::T_RETURN},
     {"if", RDTokenType::T_IF},
     {"else", RDTokenType::T_ELSE},
 };
 
-/// @brief 在标识符中检查是否时关键字，若是关键字则返回对应关键字的Token，否则返回T_ID
-/// @param id 标识符
-/// @return Token
-static RDTokenType getKeywordToken(std::string id)
+/// @brief 关键字哈希表的大小，须为2的幂
+static constexpr size_t KEYWORD_TABLE_SIZE = 8;
+
+/// @brief 关键字的哈希函数，长度与首字符之和对当前的关键字没有冲突，即完美哈希
+/// @param id 标识符，不能为空
+/// @return 哈希表的下标
+static constexpr size_t keywordHash(std::string_view id)
+{
+    return (id.size() + (uint8_t) id[0]) & (KEYWORD_TABLE_SIZE - 1);
+}
+
+/// @brief 按哈希值存放的关键字表，没有关键字的位置名字为空
+static constexpr std::array<KeywordToken, KEYWORD_TABLE_SIZE> keywordTable = [] {
+    std::array<KeywordToken, KEYWORD_TABLE_SIZE> table{};
+    for (auto & keyword: allKeywords) {
+        table[keywordHash(keyword.name)] = keyword;
+    }
+    return table;
+}();
+
+/// @brief 检查哈希函数对所有的关键字都没有冲突
+/// @return true：没有冲突
+static constexpr bool keywordHashIsPerfect()
 {
-    //如果在allkeywords中找到，则说明为关键字
     for (auto & keyword: allKeywords) {
-        if (keyword.name == id) {
-            return keyword.type;
+        if (keywordTable[keywordHash(keyword.name)].name != keyword.name) {
+            return false;
         }
     }
-    // 如果不再allkeywords中，说明是标识符
-    return RDTokenType::T_ID;
+    return true;
 }
 
-/// @brief 检查下一个字符是否匹配指定字符
+static_assert(keywordHashIsPerfect(), "关键字哈希有冲突，请修改keywordHash");
+
+/// @brief 在标识符中检查是否时关键字，若是关键字则返回对应关键字的Token，否则返回T_ID
+/// @param id 标识符
+/// @return Token
+static RDTokenType getKeywordToken(std::string_view id)
+{
+    // 哈希位置上的关键字相同才是关键字，否则是标识符
+    const KeywordToken & keyword = keywordTable[keywordHash(id)];
+
+    return keyword.name == id ? keyword.type : RDTokenType::T_ID;
+}
+
+/// @brief 检查下一个字符是否匹配指定字符，匹配则前进
+/// @param ctx 分析的上下文
 /// @param expected 期望的字符
 /// @return true: 匹配，false: 不匹配
-static bool is_next(char expected)
+static inline bool is_next(RDParserContext & ctx, char expected)
 {
-    int c = fgetc(rd_filein);
-    if (c == expected) {
+    if (ctx.cursor < ctx.limit && *ctx.cursor == expected) {
+        ctx.cursor++;
         return true;
     }
-    // 不匹配则回退
-    ungetc(c, rd_filein);
+
     return false;
 }
 
-/// @brief 读取下一个字符并前进
-static void nextChar()
+/// @brief 跳过空白符号与注释，并统计行号
+/// @param ctx 分析的上下文
+static void skipBlank(RDParserContext & ctx)
 {
-    // 这个函数仅在is_next返回true后调用，所以不需要做任何事情
+    const char * p = ctx.cursor;
+    const char * end = ctx.limit;
+
+    for (;;) {
+
+        // 空格、TAB、换行符与注释用SIMD成块跳过
+        p = skipBlankAndComment(p, end, ctx.line_no);
+
+        if (p >= end) {
+            break;
+        }
+
+        if (*p == '\r') {
+            // 支持Linux/Windows/Mac系统的行号分析
+            // Windows：\r\n
+            // Mac: \r
+            // Unix(Linux): \n
+            ctx.line_no++;
+            p++;
+            if (p < end && *p == '\n') {
+                p++;
+            }
+        } else if (p[0] == '/' && p + 1 < end && p[1] == '/') {
+            // 单行注释直到文件尾都没有换行符，与flex的"//".*规则相同，跳到文件尾
+            p = end;
+        } else {
+            // 没有结束的多行注释不跳过，与flex的规则相同，/识别为T_DIV，其后的内容继续识别
+            break;
+        }
+    }
+
+    ctx.cursor = p;
 }
 
-/// @brief 词法文法，获取下一个Token
-/// @return  Token，值保存在rd_lval中
-int rd_flex()
+/// @brief 识别无符号整数，含10进制、8进制与16进制
+/// @param ctx 分析的上下文
+/// @param start Token的起始位置
+/// @return Token
+static int scanNumber(RDParserContext & ctx, const char * start)
 {
-    int c;              // 扫描的字符
-    int tokenKind = -1; // Token的值
+    const char * p = start + 1;
+    const char * end = ctx.limit;
+    uint32_t val;
 
-    // 忽略空白符号，主要有空格，TAB键和换行符
-    while ((c = fgetc(rd_filein)) == ' ' || c == '\t' || c == '\n' || c == '\r') {
-
-        // 支持Linux/Windows/Mac系统的行号分析
-        // Windows：\r\n
-        // Mac: \n
-        // Unix(Linux): \r
-        if (c == '\r') {
-            c = fgetc(rd_filein);
-            rd_line_no++;
-            if (c != '\n') {
-                // 不是\n，则回退
-                ungetc(c, rd_filein);
-            }
-        } else if (c == '\n') {
-            rd_line_no++;
+    if (*start != '0') {
+        // 10进制数字，最长匹配，直到非数字结束
+        val = (uint32_t) (*start - '0');
+        while (p < end && isClass(*p, CC_DIGIT)) {
+            val = val * 10 + (uint32_t) (*p++ - '0');
+        }
+    } else if (p + 1 < end && (*p == 'x' || *p == 'X') && isClass(p[1], CC_HEX)) {
+        // 16进制，0x后面必须有有效的16进制数字，否则只识别为单个0
+        val = 0;
+        for (p++; p < end && isClass(*p, CC_HEX); p++) {
+            uint32_t c = (uint8_t) *p;
+            val = val * 16 + (c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10);
+        }
+    } else {
+        // 8进制数字，或者单个0
+        val = 0;
+        while (p < end && *p >= '0' && *p <= '7') {
+            val = val * 8 + (uint32_t) (*p++ - '0');
         }
     }
 
+    ctx.cursor = p;
+
+    ctx.lval.integer_num.val = val;
+    ctx.lval.integer_num.lineno = ctx.line_no;
+
+    // 存储数字的token值
+    ctx.tokenValue = std::string_view(start, (size_t) (p - start));
+
+    return RDTokenType::T_DIGIT;
+}
+
+/// @brief 识别标识符，包含关键字/保留字或自定义标识符
+/// @param ctx 分析的上下文
+/// @param start Token的起始位置
+/// @return Token
+static int scanIdentifier(RDParserContext & ctx, const char * start)
+{
+    const char * p = start + 1;
+    const char * end = ctx.limit;
+
+    // 最长匹配标识符
+    while (p < end && isClass(*p, CC_LETTER | CC_DIGIT)) {
+        p++;
+    }
+
+    ctx.cursor = p;
+
+    // 存储标识符
+    ctx.tokenValue = std::string_view(start, (size_t) (p - start));
+
+    // 检查是否是关键字，若是则返回对应的Token，否则返回T_ID
+    RDTokenType tokenKind = getKeywordToken(ctx.tokenValue);
+    if (tokenKind == RDTokenType::T_ID) {
+        // 自定义标识符
+
+        // 设置ID的值
+        ctx.lval.var_id.id = strndup(start, ctx.tokenValue.size());
+
+        // 设置行号
+        ctx.lval.var_id.lineno = ctx.line_no;
+    } else if (tokenKind == RDTokenType::T_INT) {
+        // int关键字
+
+        // 设置类型与行号
+        ctx.lval.type.type = BasicType::TYPE_INT;
+        ctx.lval.type.lineno = ctx.line_no;
+    }
+
+    return tokenKind;
+}
+
+/// @brief 设置词法分析的输入缓冲区，行号从1开始
+/// @param ctx 分析的上下文
+/// @param buf 缓冲区的起始地址，不要求以'\0'结尾
+/// @param len 缓冲区的字节数
+void rd_set_buffer(RDParserContext & ctx, const char * buf, size_t len)
+{
+    ctx.cursor = buf;
+    ctx.limit = buf + len;
+    ctx.line_no = 1;
+    ctx.tokenValue = std::string_view();
+}
+
+/// @brief 词法文法，获取下一个Token
+/// @param ctx 分析的上下文
+/// @return  Token，值保存在ctx.lval中
+int rd_flex(RDParserContext & ctx)
+{
+    int tokenKind = -1; // Token的值
+
+    // 忽略空白符号与注释
+    skipBlank(ctx);
+
     // 文件结束符
-    if (c == EOF) {
+    if (ctx.cursor >= ctx.limit) {
+        ctx.tokenValue = std::string_view();
+
         // 返回文件结束符
         return RDTokenType::T_EOF;
     }
 
-    // TODO 请自行实现删除源文件中的注释，含单行注释和多行注释等
-
-    // 处理数字
-    if (isdigit(c)) {
+    const char * start = ctx.cursor++;
+    char c = *start;
 
+    if (isClass(c, CC_DIGIT)) {
         // 识别无符号数
-        rd_lval.integer_num.lineno = rd_line_no;
-        
-        if (c == '0') {
-            // 可能是0开头的8进制或16进制，或者单个0
-            rd_lval.integer_num.val = 0;
-            c = fgetc(rd_filein);
-            
-            if (c == 'x' || c == 'X') {
-                // 16进制
-                c = fgetc(rd_filein);
-                if (!isxdigit(c)) {
-                    // 0x后面必须有有效的16进制数字
-                    ungetc(c, rd_filein);
-                    ungetc('x', rd_filein); // 退回x字符
-                    
-                    // 只识别为单个0
-                    tokenValue = "0";
-                    tokenKind = RDTokenType::T_DIGIT;
-                    return tokenKind;
-                } else {
-                    // 处理16进制数字
-                    do {
-                        // 处理16进制数字
-                        if (isdigit(c)) {
-                            rd_lval.integer_num.val = rd_lval.integer_num.val * 16 + (c - '0');
-                        } else if (c >= 'a' && c <= 'f') {
-                            rd_lval.integer_num.val = rd_lval.integer_num.val * 16 + (c - 'a' + 10);
-                        } else if (c >= 'A' && c <= 'F') {
-                            rd_lval.integer_num.val = rd_lval.integer_num.val * 16 + (c - 'A' + 10);
-                        }
-                        c = fgetc(rd_filein);
-                    } while (isxdigit(c));
-                }
-            } else if (c >= '0' && c <= '7') {
-                // 8进制数字
-                do {
-                    rd_lval.integer_num.val = rd_lval.integer_num.val * 8 + (c - '0');
-                    c = fgetc(rd_filein);
-                } while (c >= '0' && c <= '7');
+        return scanNumber(ctx, start);
+    }
+
+    if (isClass(c, CC_LETTER)) {
+        // 识别标识符或关键字
+        return scanIdentifier(ctx, start);
+    }
+
+    switch (c) {
+        case '(':
+            tokenKind = RDTokenType::T_L_PAREN;
+            break;
+        case ')':
+            tokenKind = RDTokenType::T_R_PAREN;
+            break;
+        case '{':
+            tokenKind = RDTokenType::T_L_BRACE;
+            break;
+        case '}':
+            tokenKind = RDTokenType::T_R_BRACE;
+            break;
+        case ';':
+            tokenKind = RDTokenType::T_SEMICOLON;
+            break;
+        case ',':
+            tokenKind = RDTokenType::T_COMMA;
+            break;
+        case '+':
+            tokenKind = RDTokenType::T_ADD;
+            break;
+        case '-':
+            tokenKind = RDTokenType::T_SUB;
+            break;
+        case '*':
+            tokenKind = RDTokenType::T_MUL;
+            break;
+        case '/':
+            // 注释已被跳过，这里只能是除法运算符
+            tokenKind = RDTokenType::T_DIV;
+            break;
+        case '%':
+            tokenKind = RDTokenType::T_MOD;
+            break;
+        case '=':
+            // 检查是否是等号
+            tokenKind = is_next(ctx, '=') ? RDTokenType::T_EQ : RDTokenType::T_ASSIGN;
+            break;
+        case '>':
+            // 检查是否是>=
+            tokenKind = is_next(ctx, '=') ? RDTokenType::T_GE : RDTokenType::T_GT;
+            break;
+        case '<':
+            // 检查是否是<=
+            tokenKind = is_next(ctx, '=') ? RDTokenType::T_LE : RDTokenType::T_LT;
+            break;
+        case '!':
+            // 检查是否是!=，否则为逻辑非运算符
+            tokenKind = is_next(ctx, '=') ? RDTokenType::T_NE : RDTokenType::T_NOT;
+            break;
+        case '&':
+            // 检查是否是&&
+            if (is_next(ctx, '&')) {
+                tokenKind = RDTokenType::T_AND;
             } else {
-                // 单个0
-                ungetc(c, rd_filein);
-                
-                // 存储数字的token值
-                tokenValue = "0";
-                
-                tokenKind = RDTokenType::T_DIGIT;
-                return tokenKind;
-            }
-            
-            // 存储数字的token值
-            tokenValue = std::to_string(rd_lval.integer_num.val);
-            
-            // 多读的字符回退
-            ungetc(c, rd_filein);
-            
-            tokenKind = RDTokenType::T_DIGIT;
-        } else {
-            // 10进制数字
-            rd_lval.integer_num.val = c - '0';
-            
-            // 最长匹配，直到非数字结束
-            while (isdigit(c = fgetc(rd_filein))) {
-                rd_lval.integer_num.val = rd_lval.integer_num.val * 10 + c - '0';
+                // 错误的token
+                printf("Line(%lld): 无效的字符 &\n", (long long) ctx.line_no);
+                tokenKind = RDTokenType::T_ERR;
             }
-            
-            // 存储数字的token值
-            tokenValue = std::to_string(rd_lval.integer_num.val);
-            
-            // 多读的字符回退
-            ungetc(c, rd_filein);
-            
-            tokenKind = RDTokenType::T_DIGIT;
-        }
-    } else if (c == '(') {
-        // 识别字符(
-        tokenKind = RDTokenType::T_L_PAREN;
-        // 存储字符(
-        tokenValue = "(";
-    } else if (c == ')') {
-        // 识别字符)
-        tokenKind = RDTokenType::T_R_PAREN;
-        // 存储字符)
-        tokenValue = ")";
-    } else if (c == '{') {
-        // 识别字符{
-        tokenKind = RDTokenType::T_L_BRACE;
-        // 存储字符{
-        tokenValue = "{";
-    } else if (c == '}') {
-        // 识别字符}
-        tokenKind = RDTokenType::T_R_BRACE;
-        // 存储字符}
-        tokenValue = "}";
-    } else if (c == ';') {
-        // 识别字符;
-        tokenKind = RDTokenType::T_SEMICOLON;
-        // 存储字符;
-        tokenValue = ";";
-    } else if (c == '+') {
-        // 识别字符+
-        tokenKind = RDTokenType::T_ADD;
-		// 存储字符+
-        tokenValue = "+";
-    } else if (c == '-') {
-        // 识别字符-
-        tokenKind = RDTokenType::T_SUB;
-		// 存储字符-
-        tokenValue = "-";
-    } else if (c == '*') {
-        // 识别字符*
-        tokenKind = RDTokenType::T_MUL;
-        // 存储字符*
-        tokenValue = "*";
-    } else if (c == '/') {
-        // 需要判断是否是注释
-        c = fgetc(rd_filein);
-        if (c == '/') {
-            // 单行注释，读取直到行尾
-            while ((c = fgetc(rd_filein)) != EOF && c != '\n');
-            
-            if (c == '\n') {
-                rd_line_no++;
-                ungetc(c, rd_filein);
-            }
-            
-            // 递归调用自身获取下一个真正的Token
-            return rd_flex();
-        } else if (c == '*') {
-            // 多行注释，读取直到*/
-            int prev = 0;
-            while ((c = fgetc(rd_filein)) != EOF) {
-                if (c == '\n') {
-                    rd_line_no++;
-                } else if (prev == '*' && c == '/') {
-                    // 注释结束
-                    break;
-                }
-                prev = c;
+            break;
+        case '|':
+            // 检查是否是||
+            if (is_next(ctx, '|')) {
+                tokenKind = RDTokenType::T_OR;
+            } else {
+                // 错误的token
+                printf("Line(%lld): 无效的字符 |\n", (long long) ctx.line_no);
+                tokenKind = RDTokenType::T_ERR;
             }
-            
-            // 递归调用自身获取下一个真正的Token
-            return rd_flex();
-        } else {
-            // 不是注释，是除法运算符
-            ungetc(c, rd_filein);
-            tokenKind = RDTokenType::T_DIV;
-            // 存储字符/
-            tokenValue = "/";
-        }
-    } else if (c == '%') {
-        // 识别字符%
-        tokenKind = RDTokenType::T_MOD;
-        // 存储字符%
-        tokenValue = "%";
-    } else if (c == '=') {
-        // 检查是否是等号
-        if (is_next('=')) {
-            nextChar();
-            tokenKind = RDTokenType::T_EQ;
-            tokenValue = "==";
-        } else {
-            tokenKind = RDTokenType::T_ASSIGN;
-            tokenValue = "=";
-        }
-    } else if (c == ',') {
-        // 识别字符;
-        tokenKind = RDTokenType::T_COMMA;
-		// 存储字符,
-        tokenValue = ",";
-    } else if (isLetterUnderLine(c)) {
-        // 识别标识符，包含关键字/保留字或自定义标识符
-
-        // 最长匹配标识符
-        std::string name;
-
-        do {
-            // 记录字符
-            name.push_back(c);
-            c = fgetc(rd_filein);
-        } while (isLetterDigitalUnderLine(c));
-
-        // 存储标识符
-        tokenValue = name;
-
-        // 多读的字符恢复，下次可继续读到该字符
-        ungetc(c, rd_filein);
-
-        // 检查是否是关键字，若是则返回对应的Token，否则返回T_ID
-        tokenKind = getKeywordToken(name);
-        if (tokenKind == RDTokenType::T_ID) {
-            // 自定义标识符
-
-            // 设置ID的值
-            rd_lval.var_id.id = strdup(name.c_str());
-
-            // 设置行号
-            rd_lval.var_id.lineno = rd_line_no;
-        } else if (tokenKind == RDTokenType::T_INT) {
-            // int关键字
-
-            // 设置类型与行号
-            rd_lval.type.type = BasicType::TYPE_INT;
-            rd_lval.type.lineno = rd_line_no;
-        }
-    } else if (c == '>') {
-        // 检查是否是>=
-        if (is_next('=')) {
-            nextChar();
-            tokenKind = RDTokenType::T_GE;
-            tokenValue = ">=";
-        } else {
-            tokenKind = RDTokenType::T_GT;
-            tokenValue = ">";
-        }
-    } else if (c == '<') {
-        // 检查是否是<=
-        if (is_next('=')) {
-            nextChar();
-            tokenKind = RDTokenType::T_LE;
-            tokenValue = "<=";
-        } else {
-            tokenKind = RDTokenType::T_LT;
-            tokenValue = "<";
-        }
-    } else if (c == '!') {
-        // 检查是否是!=
-        if (is_next('=')) {
-            nextChar();
-            tokenKind = RDTokenType::T_NE;
-            tokenValue = "!=";
-        } else {
-            // 逻辑非运算符
-            tokenKind = RDTokenType::T_NOT;
-            tokenValue = "!";
-        }
-    } else if (c == '&') {
-        // 检查是否是&&
-        if (is_next('&')) {
-            nextChar();
-            tokenKind = RDTokenType::T_AND;
-            tokenValue = "&&";
-        } else {
-            // 错误的token
-            printf("Line(%lld): 无效的字符 &\n", (long long)rd_line_no);
+            break;
+        default:
+            printf("Line(%lld): Invalid char %c\n", (long long) ctx.line_no, c);
             tokenKind = RDTokenType::T_ERR;
-            tokenValue = "&";
-        }
-    } else if (c == '|') {
-        // 检查是否是||
-        if (is_next('|')) {
-            nextChar();
-            tokenKind = RDTokenType::T_OR;
-            tokenValue = "||";
-        } else {
-            // 错误的token
-            printf("Line(%lld): 无效的字符 |\n", (long long)rd_line_no);
-            tokenKind = RDTokenType::T_ERR;
-            tokenValue = "|";
-        }
-    } else {
-        printf("Line(%lld): Invalid char %s\n", (long long) rd_line_no, tokenValue.c_str());
-        tokenKind = RDTokenType::T_ERR;
+            break;
     }
 
+    // 存储Token的字符
+    ctx.tokenValue = std::string_view(start, (size_t) (ctx.cursor - start));
+
     // Token的类别
     return tokenKind;
 }
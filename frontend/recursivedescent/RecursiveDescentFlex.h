@@ -2,8 +2,8 @@
 /// @file RecursiveDescentFlex.h
 /// @brief 词法分析的头文件，不借助工具实现
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-21
+/// @version 1.2
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,17 +11,19 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>输入由文件指针改为内存缓冲区
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>词法状态移到分析的上下文中
 /// </table>
 ///
 #pragma once
 
-#include <stdio.h>
+#include <cstddef>
 
-// 行号信息
-extern int rd_line_no;
+// 行号、记号值等词法状态都保存在分析的上下文中
+struct RDParserContext;
 
-// 输入文件指针
-extern FILE * rd_filein;
+/// 设置词法分析的输入缓冲区
+void rd_set_buffer(RDParserContext & ctx, const char * buf, size_t len);
 
 /// 识别词法
-int rd_flex();
+int rd_flex(RDParserContext & ctx);
@@ -2,8 +2,8 @@
 /// @file RecursiveDescentParser.cpp
 /// @brief 递归下降分析法实现的语法分析后产生抽象语法树的实现
 /// @author zenglj (zenglj@live.com)
-/// @version 1.1
-/// @date 2024-11-23
+/// @version 1.2
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,7 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>分析状态移到上下文对象中，可同时分析多个文件
 /// </table>
 ///
 #include <stdarg.h>
@@ -21,43 +22,31 @@
 #include "RecursiveDescentFlex.h"
 #include "RecursiveDescentParser.h"
 
-// 定义全局变量给词法分析使用，用于填充值
-RDSType rd_lval;
-
-// 词法识别的记号值，原始文本字符串
-extern std::string tokenValue;
-
-// 语法分析过程中的错误数目
-static int errno_num = 0;
-
-// 语法分析过程中的LookAhead，指向下一个Token
-static RDTokenType lookaheadTag = RDTokenType::T_EMPTY;
-
-static ast_node * Block();
-static ast_node * ifStatement();
-static ast_node * expr();
-static ast_node * logicOrExp();
-static ast_node * logicAndExp();
-static ast_node * relExp();
-static ast_node * addExp();
+static ast_node * Block(RDParserContext & ctx);
+static ast_node * ifStatement(RDParserContext & ctx);
+static ast_node * expr(RDParserContext & ctx);
+static ast_node * logicOrExp(RDParserContext & ctx);
+static ast_node * logicAndExp(RDParserContext & ctx);
+static ast_node * relExp(RDParserContext & ctx);
+static ast_node * addExp(RDParserContext & ctx);
 
 ///
 /// @brief 继续检查LookAhead指向的记号是否是T，用于符号的FIRST集合或Follow集合判断
 ///
-#define _(T) || (lookaheadTag == T)
+#define _(T) || (ctx.lookaheadTag == T)
 
 ///
 /// @brief 第一个检查LookAhead指向的记号是否属于C，用于符号的FIRST集合或Follow集合判断
 /// 如判断是否是T_ID，或者T_INT，可结合F和_两个宏来实现，即F(T_ID) _(T_INT)
 ///
-#define F(C) (lookaheadTag == C)
+#define F(C) (ctx.lookaheadTag == C)
 
 ///
 /// @brief lookahead指向下一个Token
 ///
-static void advance()
+static void advance(RDParserContext & ctx)
 {
-    lookaheadTag = (RDTokenType) rd_flex();
+    ctx.lookaheadTag = (RDTokenType) rd_flex(ctx);
 }
 
 ///
@@ -65,7 +54,7 @@ static void advance()
 /// @param tag 是否匹配指定的Tag
 /// @return true：匹配，false：未匹配
 ///
-static bool match(RDTokenType tag)
+static bool match(RDParserContext & ctx, RDTokenType tag)
 {
     bool result = false;
 
@@ -74,7 +63,7 @@ static bool match(RDTokenType tag)
         result = true;
 
         // 匹配，则向前获取下一个Token
-        advance();
+        advance(ctx);
     }
 
     return result;
@@ -84,7 +73,7 @@ static bool match(RDTokenType tag)
 /// @brief 语法错误输出
 /// @param format 格式化字符串，和printf的格式化字符串一样
 ///
-static void semerror(const char * format, ...)
+static void semerror(RDParserContext & ctx, const char * format, ...)
 {
     char logStr[1024];
 
@@ -96,19 +85,19 @@ static void semerror(const char * format, ...)
 
     va_end(ap);
 
-    printf("Line(%d): %s\n", rd_line_no, logStr);
+    printf("Line(%lld): %s\n", (long long) ctx.line_no, logStr);
 
-    errno_num++;
+    ctx.errno_num++;
 }
 
 ///
 /// @brief 实参列表语法分析，文法: realParamList: expr (T_COMMA expr)*;
 /// @return ast_node* 实参列表节点
 ///
-static void realParamList(ast_node * realParamsNode)
+static void realParamList(RDParserContext & ctx, ast_node * realParamsNode)
 {
     // 实参表达式expr识别
-    ast_node * param_node = expr();
+    ast_node * param_node = expr(ctx);
     if (!param_node) {
 
         // 不是合法的实参
@@ -122,10 +111,10 @@ static void realParamList(ast_node * realParamsNode)
     for (;;) {
 
         // 识别逗号
-        if (match(T_COMMA)) {
+        if (match(ctx, T_COMMA)) {
 
             // 识别实参
-            param_node = expr();
+            param_node = expr(ctx);
 
             (void) realParamsNode->insert_son_node(param_node);
         } else {
@@ -142,7 +131,7 @@ static void realParamList(ast_node * realParamsNode)
 /// 其文法为 idTail: T_L_PAREN realParamList? T_R_PAREN | ε
 /// @return ast_node*
 ///
-static ast_node * idTail(var_id_attr & id)
+static ast_node * idTail(RDParserContext & ctx, var_id_attr & id)
 {
     // 标识符节点
     ast_node * node = ast_node::New(id);
@@ -151,23 +140,23 @@ static ast_node * idTail(var_id_attr & id)
     free(id.id);
     id.id = nullptr;
 
-    if (match(T_L_PAREN)) {
+    if (match(ctx, T_L_PAREN)) {
 
         // 函数调用，idTail: T_L_PAREN realParamList? T_R_PAREN
 
         ast_node * realParamsNode = create_contain_node(ast_operator_type::AST_OP_FUNC_REAL_PARAMS);
 
-        if (match(T_R_PAREN)) {
+        if (match(ctx, T_R_PAREN)) {
 
             // 被调用函数没有实参，返回一个空的实参清单节点
             return realParamsNode;
         }
 
         // 识别实参列表
-        realParamList(realParamsNode);
+        realParamList(ctx, realParamsNode);
 
-        if (!match(T_R_PAREN)) {
-            semerror("函数调用缺少右括号");
+        if (!match(ctx, T_R_PAREN)) {
+            semerror(ctx, "函数调用缺少右括号");
         }
 
         // 创建函数调用节点
@@ -195,7 +184,7 @@ static ast_node * idTail(var_id_attr & id)
 /// 可以是空串，代表简单变量。
 /// @return ast_node*
 ///
-static ast_node * unaryExp()
+static ast_node * unaryExp(RDParserContext & ctx)
 {
     ast_node * node = nullptr;
 
@@ -203,10 +192,10 @@ static ast_node * unaryExp()
         // 求负运算 unaryExp: T_SUB unaryExp
         
         // 跳过当前记号，指向下一个记号
-        advance();
+        advance(ctx);
         
         // 识别操作数
-        ast_node * operand = unaryExp();
+        ast_node * operand = unaryExp(ctx);
         
         // 创建求负运算节点
         node = create_contain_node(ast_operator_type::AST_OP_NEG, operand);
@@ -214,10 +203,10 @@ static ast_node * unaryExp()
         // 逻辑非运算 unaryExp: T_NOT unaryExp
         
         // 跳过当前记号，指向下一个记号
-        advance();
+        advance(ctx);
         
         // 识别操作数
-        ast_node * operand = unaryExp();
+        ast_node * operand = unaryExp(ctx);
         
         // 创建逻辑非运算节点
         node = create_contain_node(ast_operator_type::AST_OP_NOT, operand);
@@ -225,32 +214,32 @@ static ast_node * unaryExp()
 
         // 无符号整数，primaryExp: T_DIGIT
 
-        node = ast_node::New(rd_lval.integer_num);
+        node = ast_node::New(ctx.lval.integer_num);
 
         // 跳过当前记号，指向下一个记号
-        advance();
+        advance(ctx);
 
-    } else if (match(T_L_PAREN)) {
+    } else if (match(ctx, T_L_PAREN)) {
 
         // 括号表达式，primaryExp: T_L_PAREN expr T_R_PAREN
 
         // 括号内表达式识别
-        node = expr();
+        node = expr(ctx);
 
-        if (!match(T_R_PAREN)) {
-            semerror("缺少右括号");
+        if (!match(ctx, T_R_PAREN)) {
+            semerror(ctx, "缺少右括号");
         }
     } else if (F(T_ID)) {
 
         // ID开头的表达式，可以是函数调用，也可以是数组(目前不支持)，或者简单变量，primaryExp: T_ID idTail
 
-        var_id_attr & id = rd_lval.var_id;
+        var_id_attr & id = ctx.lval.var_id;
 
         // 跳过当前记号，指向下一个记号
-        advance();
+        advance(ctx);
 
         // 识别ID尾部符号
-        node = idTail(id);
+        node = idTail(ctx, id);
     }
 
     return node;
@@ -260,22 +249,22 @@ static ast_node * unaryExp()
 /// @brief 乘除模运算符, 其文法为mulOp : T_MUL | T_DIV | T_MOD;
 /// @return ast_operator_type AST中节点的运算符
 ///
-ast_operator_type mulOp()
+ast_operator_type mulOp(RDParserContext & ctx)
 {
     ast_operator_type type = ast_operator_type::AST_OP_MAX;
 
     if (F(T_MUL)) {
         type = ast_operator_type::AST_OP_MUL;
         // 跳过当前的记号，指向下一个记号
-        advance();
+        advance(ctx);
     } else if (F(T_DIV)) {
         type = ast_operator_type::AST_OP_DIV;
         // 跳过当前的记号，指向下一个记号
-        advance();
+        advance(ctx);
     } else if (F(T_MOD)) {
         type = ast_operator_type::AST_OP_MOD;
         // 跳过当前的记号，指向下一个记号
-        advance();
+        advance(ctx);
     }
 
     return type;
@@ -287,10 +276,10 @@ ast_operator_type mulOp()
 ///
 /// @return ast_node*
 ///
-static ast_node * mulExp()
+static ast_node * mulExp(RDParserContext & ctx)
 {
     // 识别第一个unaryExp
-    ast_node * left_node = unaryExp();
+    ast_node * left_node = unaryExp(ctx);
     if (!left_node) {
         // 非法的一元表达式
         return nullptr;
@@ -301,14 +290,14 @@ static ast_node * mulExp()
     for (;;) {
 
         // 获取乘除模运算符
-        ast_operator_type op = mulOp();
+        ast_operator_type op = mulOp(ctx);
         if (ast_operator_type::AST_OP_MAX == op) {
             // 不是乘除模运算符则正常结束
             break;
         }
 
         // 获取右侧表达式
-        ast_node * right_node = unaryExp();
+        ast_node * right_node = unaryExp(ctx);
         if (!right_node) {
             // 二元乘除模运算没有合法的右侧表达式
             break;
@@ -325,7 +314,7 @@ static ast_node * mulExp()
 /// @brief 加减运算符, 其文法为addOp : T_ADD | T_SUB;
 /// @return ast_operator_type AST中节点的运算符
 ///
-ast_operator_type addOp()
+ast_operator_type addOp(RDParserContext & ctx)
 {
     ast_operator_type type = ast_operator_type::AST_OP_MAX;
 
@@ -334,13 +323,13 @@ ast_operator_type addOp()
         type = ast_operator_type::AST_OP_ADD;
 
         // 跳过当前的记号，指向下一个记号
-        advance();
+        advance(ctx);
     } else if (F(T_SUB)) {
 
         type = ast_operator_type::AST_OP_SUB;
 
         // 跳过当前的记号，指向下一个记号
-        advance();
+        advance(ctx);
     }
 
     return type;
@@ -352,10 +341,10 @@ ast_operator_type addOp()
 ///
 /// @return ast_node*
 ///
-static ast_node * addExp()
+static ast_node * addExp(RDParserContext & ctx)
 {
     // 识别第一个mulExp
-    ast_node * left_node = mulExp();
+    ast_node * left_node = mulExp(ctx);
     if (!left_node) {
         // 非法的乘除模表达式
         return nullptr;
@@ -366,7 +355,7 @@ static ast_node * addExp()
     for (;;) {
 
         // 获取加减运算符
-        ast_operator_type op = addOp();
+        ast_operator_type op = addOp(ctx);
         if (ast_operator_type::AST_OP_MAX == op) {
 
             // 不是加减运算符则正常结束
@@ -374,7 +363,7 @@ static ast_node * addExp()
         }
 
         // 获取右侧表达式
-        ast_node * right_node = mulExp();
+        ast_node * right_node = mulExp(ctx);
         if (!right_node) {
 
             // 二元加减运算没有合法的右侧表达式
@@ -390,27 +379,27 @@ static ast_node * addExp()
 
 /// @brief 表达式文法 expr : logicOrExp, 表达式支持逻辑或、逻辑与、关系运算、加法、减法、乘法、除法、求余和一元运算
 /// @return AST的节点
-static ast_node * expr()
+static ast_node * expr(RDParserContext & ctx)
 {
-    return logicOrExp();
+    return logicOrExp(ctx);
 }
 
 /// @brief returnStatement -> T_RETURN expr T_SEMICOLON
 /// @return AST的节点
-static ast_node * returnStatement()
+static ast_node * returnStatement(RDParserContext & ctx)
 {
 
-    if (match(T_RETURN)) {
+    if (match(ctx, T_RETURN)) {
 
         // return语句的First集合元素为T_RETURN
         // 若匹配，则说明是return语句
 
-        ast_node * expr_node = expr();
+        ast_node * expr_node = expr(ctx);
 
-        if (!match(T_SEMICOLON)) {
+        if (!match(ctx, T_SEMICOLON)) {
 
             // 返回语句后没有分号
-            semerror("返回语句后没有分号");
+            semerror(ctx, "返回语句后没有分号");
         }
 
         return create_contain_node(ast_operator_type::AST_OP_RETURN, expr_node);
@@ -420,9 +409,9 @@ static ast_node * returnStatement()
 }
 
 /// 识别表达式尾部符号，文法： assignExprStmtTail : T_ASSIGN expr | ε
-static ast_node * assignExprStmtTail(ast_node * left_node)
+static ast_node * assignExprStmtTail(RDParserContext & ctx, ast_node * left_node)
 {
-    if (match(T_ASSIGN)) {
+    if (match(ctx, T_ASSIGN)) {
 
         // 赋值运算符，说明含有赋值运算
 
@@ -430,13 +419,13 @@ static ast_node * assignExprStmtTail(ast_node * left_node)
         if (!left_node) {
 
             // 没有左侧节点，则语法错误
-            semerror("赋值语句的左侧表达式不能为空");
+            semerror(ctx, "赋值语句的左侧表达式不能为空");
 
             return nullptr;
         }
 
         // 赋值运算符右侧表达式分析识别
-        ast_node * right_node = expr();
+        ast_node * right_node = expr(ctx);
 
         return create_contain_node(ast_operator_type::AST_OP_ASSIGN, left_node, right_node);
     } else if (F(T_SEMICOLON)) {
@@ -451,12 +440,12 @@ static ast_node * assignExprStmtTail(ast_node * left_node)
 /// @brief 赋值语句或表达式语句识别，文法：assignExprStmt : expr assignExprStmtTail
 /// @return ast_node*
 ///
-static ast_node * assignExprStmt()
+static ast_node * assignExprStmt(RDParserContext & ctx)
 {
     // 识别表达式，目前还不知道是否是表达式语句或赋值语句
-    ast_node * expr_node = expr();
+    ast_node * expr_node = expr(ctx);
 
-    return assignExprStmtTail(expr_node);
+    return assignExprStmtTail(ctx, expr_node);
 }
 
 ///
@@ -475,24 +464,24 @@ static ast_node * assignExprStmt()
 ///
 /// @return AST的节点
 ///
-static ast_node * statement()
+static ast_node * statement(RDParserContext & ctx)
 {
     ast_node * node = nullptr;
     if (F(T_RETURN)) {
 
         // Return语句，识别产生式statement: returnStatement
-        node = returnStatement();
+        node = returnStatement(ctx);
     } else if (F(T_L_BRACE)) {
 
         // 语句块，识别产生式statement: block
-        node = Block();
+        node = Block(ctx);
     } else if (F(T_SEMICOLON)) {
 
         // 空语句，识别产生式statement: T_SEMICOLON
-        advance();
+        advance(ctx);
     } else if (F(T_IF)) {
         // if语句，识别产生式statement: ifStatement
-        node = ifStatement();
+        node = ifStatement(ctx);
     } else if (F(T_ID) _(T_L_PAREN) _(T_DIGIT)) {
 
         // 赋值语句，statement -> assignExprStmt T_SEMICOLON
@@ -502,10 +491,10 @@ static ast_node * statement()
         // 赋值语句以T_ID开头，并且左值要具有左值属性
         // 表达式语句可以以T_ID开头，也可以左小括号T_L_PAREN，甚至一元运算符等开头
         // 目前文法下表达式语句在不支持一元运算符的情况下只能以T_ID或T_L_PAREN开头
-        node = assignExprStmt();
+        node = assignExprStmt(ctx);
 
-        if (!match(T_SEMICOLON)) {
-            semerror("语句后缺少分号");
+        if (!match(ctx, T_SEMICOLON)) {
+            semerror(ctx, "语句后缺少分号");
         }
     }
 
@@ -514,45 +503,45 @@ static ast_node * statement()
 
 /// @brief if语句的语法分析，文法: ifStatement -> T_IF T_L_PAREN expr T_R_PAREN statement (T_ELSE statement)?
 /// @return AST的节点
-static ast_node * ifStatement()
+static ast_node * ifStatement(RDParserContext & ctx)
 {
     // 匹配if关键字
-    if (!match(T_IF)) {
+    if (!match(ctx, T_IF)) {
         return nullptr;
     }
 
     // 匹配左括号
-    if (!match(T_L_PAREN)) {
-        semerror("if语句缺少左括号");
+    if (!match(ctx, T_L_PAREN)) {
+        semerror(ctx, "if语句缺少左括号");
         return nullptr;
     }
 
     // 解析条件表达式
-    ast_node * condition = expr();
+    ast_node * condition = expr(ctx);
     if (!condition) {
-        semerror("if语句缺少条件表达式");
+        semerror(ctx, "if语句缺少条件表达式");
         return nullptr;
     }
 
     // 匹配右括号
-    if (!match(T_R_PAREN)) {
-        semerror("if语句缺少右括号");
+    if (!match(ctx, T_R_PAREN)) {
+        semerror(ctx, "if语句缺少右括号");
         return nullptr;
     }
 
     // 解析then语句
-    ast_node * then_stmt = statement();
+    ast_node * then_stmt = statement(ctx);
     if (!then_stmt) {
-        semerror("if语句缺少then语句");
+        semerror(ctx, "if语句缺少then语句");
         return nullptr;
     }
 
     // 检查是否有else部分
-    if (match(T_ELSE)) {
+    if (match(ctx, T_ELSE)) {
         // 解析else语句
-        ast_node * else_stmt = statement();
+        ast_node * else_stmt = statement(ctx);
         if (!else_stmt) {
-            semerror("else后缺少语句");
+            semerror(ctx, "else后缺少语句");
             return nullptr;
         }
 
@@ -568,9 +557,9 @@ static ast_node * ifStatement()
 /// @brief 变量定义列表语法识别 其文法：varDeclList : T_COMMA T_ID varDeclList | T_SEMICOLON
 /// @param vardeclstmt_node 变量声明语句节点，所有的变量节点应该加到该节点中
 ///
-static void varDeclList(ast_node * vardeclstmt_node)
+static void varDeclList(RDParserContext & ctx, ast_node * vardeclstmt_node)
 {
-    if (match(T_COMMA)) {
+    if (match(ctx, T_COMMA)) {
 
         // 匹配成功，定义列表中有逗号
 
@@ -580,26 +569,26 @@ static void varDeclList(ast_node * vardeclstmt_node)
             // 定义列表中定义的变量
 
             // 新建变量声明节点并加入变量声明语句中
-            (void) add_var_decl_node(vardeclstmt_node, rd_lval.var_id);
+            (void) add_var_decl_node(vardeclstmt_node, ctx.lval.var_id);
 
             // 填过当前的Token，指向下一个Token
-            advance();
+            advance(ctx);
 
             // 递归调用，不断追加变量定义
-            varDeclList(vardeclstmt_node);
+            varDeclList(ctx, vardeclstmt_node);
         } else {
-            semerror("逗号后必须是标识符");
+            semerror(ctx, "逗号后必须是标识符");
         }
-    } else if (match(T_SEMICOLON)) {
+    } else if (match(ctx, T_SEMICOLON)) {
         // 匹配成功，则说明只有前面的一个变量或者变量定义，正常结束
     } else {
-        semerror("非法记号: %d", (int) lookaheadTag);
+        semerror(ctx, "非法记号: %d", (int) ctx.lookaheadTag);
 
         // 忽略该记号，继续检查
-        advance();
+        advance(ctx);
 
         // 继续检查后续的变量
-        varDeclList(vardeclstmt_node);
+        varDeclList(ctx, vardeclstmt_node);
     }
 }
 
@@ -609,31 +598,31 @@ static void varDeclList(ast_node * vardeclstmt_node)
 ///
 /// @return ast_node* 局部变量声明节点
 ///
-static ast_node * varDecl()
+static ast_node * varDecl(RDParserContext & ctx)
 {
     if (F(T_INT)) {
 
-        // 这里必须复制，而不能引用，因为rd_lval为全局，下一个记号识别后要被覆盖
-        type_attr type = rd_lval.type;
+        // 这里必须复制，而不能引用，因为ctx.lval在下一个记号识别后要被覆盖
+        type_attr type = ctx.lval.type;
 
         // 跳过int类型的记号，指向下一个Token
-        advance();
+        advance(ctx);
 
         // 检测是否是标识符
         if (F(T_ID)) {
 
             // 创建变量声明语句，并加入第一个变量
-            ast_node * stmt_node = create_var_decl_stmt_node(type, rd_lval.var_id);
+            ast_node * stmt_node = create_var_decl_stmt_node(type, ctx.lval.var_id);
 
             // 跳过标识符记号，指向下一个Token
-            advance();
+            advance(ctx);
 
-            varDeclList(stmt_node);
+            varDeclList(ctx, stmt_node);
 
             return stmt_node;
 
         } else {
-            semerror("类型后要求的记号为标识符");
+            semerror(ctx, "类型后要求的记号为标识符");
             // 这里忽略继续检查下一个记号，为便于一次可检查出多个错误
             // 当然可以直接退出循环，一旦有错就不再检查语法错误。
         }
@@ -656,12 +645,12 @@ static ast_node * varDecl()
 /// statement:T_RETURN expr T_SEMICOLON | lVal T_ASSIGN expr T_SEMICOLON | block | expr? T_SEMICOLON
 /// @return 返回AST的节点
 ///
-static ast_node * BlockItem()
+static ast_node * BlockItem(RDParserContext & ctx)
 {
     if (F(T_INT)) {
-        return varDecl();
+        return varDecl(ctx);
     } else {
-        return statement();
+        return statement(ctx);
     }
 }
 
@@ -669,7 +658,7 @@ static ast_node * BlockItem()
 /// @brief 块内语句列表识别，文法为BlockItemList : BlockItem+
 /// @return AST的节点
 ///
-static void BlockItemList(ast_node * blockNode)
+static void BlockItemList(RDParserContext & ctx, ast_node * blockNode)
 {
     for (;;) {
 
@@ -679,7 +668,7 @@ static void BlockItemList(ast_node * blockNode)
         }
 
         // 遍历BlockItem
-        ast_node * itemNode = BlockItem();
+        ast_node * itemNode = BlockItem(ctx);
         if (itemNode) {
             blockNode->insert_son_node(itemNode);
         } else {
@@ -693,24 +682,24 @@ static void BlockItemList(ast_node * blockNode)
 /// @brief 语句块识别，文法：Block -> T_L_BRACE BlockItemList? T_R_BRACE
 /// @return AST的节点
 ///
-static ast_node * Block()
+static ast_node * Block(RDParserContext & ctx)
 {
-    if (match(T_L_BRACE)) {
+    if (match(ctx, T_L_BRACE)) {
 
         // 创建语句块节点
         ast_node * blockNode = create_contain_node(ast_operator_type::AST_OP_BLOCK);
 
         // 空的语句块
-        if (match(T_R_BRACE)) {
+        if (match(ctx, T_R_BRACE)) {
             return blockNode;
         }
 
         // 块内语句列表识别
-        BlockItemList(blockNode);
+        BlockItemList(ctx, blockNode);
 
         // 没有匹配左大括号，则语法错误
-        if (!match(T_R_BRACE)) {
-            semerror("缺少右大括号");
+        if (!match(ctx, T_R_BRACE)) {
+            semerror(ctx, "缺少右大括号");
         }
 
         // 正常
@@ -726,16 +715,16 @@ static ast_node * Block()
 /// @param type 类型 变量类型或函数返回值类型
 /// @param id 标识符 变量名或者函数名
 ///
-static ast_node * idtail(type_attr & type, var_id_attr & id)
+static ast_node * idtail(RDParserContext & ctx, type_attr & type, var_id_attr & id)
 {
-    if (match(T_L_PAREN)) {
+    if (match(ctx, T_L_PAREN)) {
         // 函数定义
 
         // 目前函数定义没有形参，因此必须是右小括号
-        if (match(T_R_PAREN)) {
+        if (match(ctx, T_R_PAREN)) {
 
             // 识别block
-            ast_node * blockNode = Block();
+            ast_node * blockNode = Block(ctx);
 
             // 形参结点没有，设置为空指针
             ast_node * formalParamsNode = nullptr;
@@ -744,7 +733,7 @@ static ast_node * idtail(type_attr & type, var_id_attr & id)
             // create_func_def函数内会释放id中指向的标识符空间，切记，之后不要再释放，之前一定要是通过strdup函数或者malloc分配的空间
             return create_func_def(type, id, blockNode, formalParamsNode);
         } else {
-            semerror("函数定义缺少右小括号");
+            semerror(ctx, "函数定义缺少右小括号");
         }
 
         return nullptr;
@@ -755,7 +744,7 @@ static ast_node * idtail(type_attr & type, var_id_attr & id)
     // 根据第一个变量声明创建变量声明语句节点并加入其中
     ast_node * stmt_node = create_var_decl_stmt_node(type, id);
 
-    varDeclList(stmt_node);
+    varDeclList(ctx, stmt_node);
 
     return stmt_node;
 }
@@ -778,7 +767,7 @@ static ast_node * idtail(type_attr & type, var_id_attr & id)
 // idtail : varDeclList | T_L_PAREN T_R_PAREN block
 // varDeclList : T_COMMA T_ID varDeclList | T_SEMICOLON
 // 闭包代表一个循环，可以0以上的循环，最后一个为EOF
-static ast_node * compileUnit()
+static ast_node * compileUnit(RDParserContext & ctx)
 {
     // 创建AST的根节点，编译单元运算符
     ast_node * cu_node = create_contain_node(ast_operator_type::AST_OP_COMPILE_UNIT);
@@ -788,27 +777,27 @@ static ast_node * compileUnit()
         // match匹配并LookAhead往前挪动
         if (F(T_INT)) {
 
-            type_attr type = rd_lval.type;
+            type_attr type = ctx.lval.type;
 
             // 跳过当前的记号，指向下一个记号
-            advance();
+            advance(ctx);
 
             // 检测是否是标识符
             if (F(T_ID)) {
 
                 // 获取标识符的值和定位信息
-                var_id_attr id = rd_lval.var_id;
+                var_id_attr id = ctx.lval.var_id;
 
                 // 跳过当前的记号，指向下一个记号
-                advance();
+                advance(ctx);
 
                 // 函数定义的开头为int
-                ast_node * node = idtail(type, id);
+                ast_node * node = idtail(ctx, type, id);
 
                 // 加入到父节点中，node为空时insert_son_node内部进行了忽略
                 (void) cu_node->insert_son_node(node);
             } else {
-                semerror("类型后要求的记号为标识符");
+                semerror(ctx, "类型后要求的记号为标识符");
                 // 这里忽略继续检查下一个记号，为便于一次可检查出多个错误
                 // 当然可以直接退出循环，一旦有错就不再检查语法错误。
             }
@@ -817,7 +806,8 @@ static ast_node * compileUnit()
             // 文件解析完毕
             break;
         } else {
-            // 这里发现错误
+            // 这里发现错误，与flex+bison一样，多余的记号（如没有结束的注释）也是语法错误
+            semerror(ctx, "要求的记号为类型或文件结束");
             break;
         }
     }
@@ -827,20 +817,21 @@ static ast_node * compileUnit()
 
 ///
 /// @brief 采用递归下降分析法实现词法与语法分析生成抽象语法树
+/// @param ctx 分析的上下文，须先用rd_set_buffer设置输入
 /// @return ast_node* 空指针失败，否则成功
 ///
-ast_node * rd_parse()
+ast_node * rd_parse(RDParserContext & ctx)
 {
     // 没有错误信息
-    errno_num = 0;
+    ctx.errno_num = 0;
 
     // lookahead指向第一个Token
-    advance();
+    advance(ctx);
 
-    ast_node * astRoot = compileUnit();
+    ast_node * astRoot = compileUnit(ctx);
 
     // 如果有错误信息，则返回-1，否则返回0
-    if (errno_num != 0) {
+    if (ctx.errno_num != 0) {
         return nullptr;
     }
 
@@ -848,28 +839,28 @@ ast_node * rd_parse()
 }
 
 ///
-ast_operator_type relOp()
+ast_operator_type relOp(RDParserContext & ctx)
 {
     ast_operator_type type = ast_operator_type::AST_OP_MAX;
 
     if (F(T_GT)) {
         type = ast_operator_type::AST_OP_GT;
-        advance();
+        advance(ctx);
     } else if (F(T_GE)) {
         type = ast_operator_type::AST_OP_GE;
-        advance();
+        advance(ctx);
     } else if (F(T_LT)) {
         type = ast_operator_type::AST_OP_LT;
-        advance();
+        advance(ctx);
     } else if (F(T_LE)) {
         type = ast_operator_type::AST_OP_LE;
-        advance();
+        advance(ctx);
     } else if (F(T_EQ)) {
         type = ast_operator_type::AST_OP_EQ;
-        advance();
+        advance(ctx);
     } else if (F(T_NE)) {
         type = ast_operator_type::AST_OP_NE;
-        advance();
+        advance(ctx);
     }
 
     return type;
@@ -880,24 +871,24 @@ ast_operator_type relOp()
 ///
 /// @return ast_node*
 ///
-static ast_node * relExp()
+static ast_node * relExp(RDParserContext & ctx)
 {
     // 识别第一个addExp
-    ast_node * left_node = addExp();
+    ast_node * left_node = addExp(ctx);
     if (!left_node) {
         // 非法的加减表达式
         return nullptr;
     }
 
     // 识别关系运算符和右侧加减表达式
-    ast_operator_type op = relOp();
+    ast_operator_type op = relOp(ctx);
     if (ast_operator_type::AST_OP_MAX == op) {
         // 不是关系运算符则直接返回左侧节点
         return left_node;
     }
 
     // 获取右侧表达式
-    ast_node * right_node = addExp();
+    ast_node * right_node = addExp(ctx);
     if (!right_node) {
         // 关系运算没有合法的右侧表达式，直接返回左侧节点
         return left_node;
@@ -911,10 +902,10 @@ static ast_node * relExp()
 /// @brief 逻辑或运算符, 其文法为 T_OR
 /// @return 返回逻辑或运算符节点类型
 ///
-static ast_operator_type logicOrOp()
+static ast_operator_type logicOrOp(RDParserContext & ctx)
 {
     if (F(T_OR)) {
-        advance();
+        advance(ctx);
         return ast_operator_type::AST_OP_OR;
     }
     return ast_operator_type::AST_OP_MAX;
@@ -925,10 +916,10 @@ static ast_operator_type logicOrOp()
 /// 支持短路求值（第一个操作数为真时不计算第二个操作数）
 /// @return 逻辑或表达式节点
 ///
-static ast_node * logicOrExp()
+static ast_node * logicOrExp(RDParserContext & ctx)
 {
     // 识别第一个logicAndExp
-    ast_node * left_node = logicAndExp();
+    ast_node * left_node = logicAndExp(ctx);
     if (!left_node) {
         // 非法的逻辑与表达式
         return nullptr;
@@ -937,14 +928,14 @@ static ast_node * logicOrExp()
     // 识别闭包(logicOrOp logicAndExp)*
     for (;;) {
         // 获取逻辑或运算符
-        ast_operator_type op = logicOrOp();
+        ast_operator_type op = logicOrOp(ctx);
         if (ast_operator_type::AST_OP_MAX == op) {
             // 不是逻辑或运算符则正常结束
             break;
         }
 
         // 获取右侧表达式
-        ast_node * right_node = logicAndExp();
+        ast_node * right_node = logicAndExp(ctx);
         if (!right_node) {
             // 二元逻辑或运算没有合法的右侧表达式
             break;
@@ -961,10 +952,10 @@ static ast_node * logicOrExp()
 /// @brief 逻辑与运算符, 其文法为 T_AND
 /// @return 返回逻辑与运算符节点类型
 ///
-static ast_operator_type logicAndOp()
+static ast_operator_type logicAndOp(RDParserContext & ctx)
 {
     if (F(T_AND)) {
-        advance();
+        advance(ctx);
         return ast_operator_type::AST_OP_AND;
     }
     return ast_operator_type::AST_OP_MAX;
@@ -975,10 +966,10 @@ static ast_operator_type logicAndOp()
 /// 支持短路求值（第一个操作数为假时不计算第二个操作数）
 /// @return 逻辑与表达式节点
 ///
-static ast_node * logicAndExp()
+static ast_node * logicAndExp(RDParserContext & ctx)
 {
     // 识别第一个relExp
-    ast_node * left_node = relExp();
+    ast_node * left_node = relExp(ctx);
     if (!left_node) {
         // 非法的关系表达式
         return nullptr;
@@ -987,14 +978,14 @@ static ast_node * logicAndExp()
     // 识别闭包(logicAndOp relExp)*
     for (;;) {
         // 获取逻辑与运算符
-        ast_operator_type op = logicAndOp();
+        ast_operator_type op = logicAndOp(ctx);
         if (ast_operator_type::AST_OP_MAX == op) {
             // 不是逻辑与运算符则正常结束
             break;
         }
 
         // 获取右侧表达式
-        ast_node * right_node = relExp();
+        ast_node * right_node = relExp(ctx);
         if (!right_node) {
             // 二元逻辑与运算没有合法的右侧表达式
             break;
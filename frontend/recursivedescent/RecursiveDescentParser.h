@@ -2,8 +2,8 @@
 /// @file RecursiveDescentParser.h
 /// @brief 递归下降分析法实现的语法分析后产生抽象语法树的头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.1
-/// @date 2024-11-23
+/// @version 1.2
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,10 +12,14 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-21 <td>1.0     <td>zenglj  <td>新做
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>分析状态移到上下文对象中，可同时分析多个文件
 /// </table>
 ///
 #pragma once
 
+#include <cstdint>
+#include <string_view>
+
 #include "AST.h"
 #include "AttrType.h"
 
@@ -65,11 +69,37 @@ union RDSType {
     type_attr type;             // 类型
 };
 
-/// @brief 词法与语法分析数据交互的Token的值
-extern RDSType rd_lval;
+///
+/// @brief 递归下降分析的上下文，包含词法与语法分析的全部状态
+///
+/// 每个被分析的文件使用各自的上下文，不同的文件可在不同的线程中同时分析。
+///
+struct RDParserContext {
+    /// @brief 输入缓冲区中下一个要扫描的字符
+    const char * cursor = nullptr;
+
+    /// @brief 输入缓冲区的结束位置
+    const char * limit = nullptr;
+
+    /// @brief 词法分析的行号信息
+    int64_t line_no = 1;
+
+    /// @brief 词法分析的token对应的字符识别，指向输入缓冲区，不做复制
+    std::string_view tokenValue;
+
+    /// @brief 词法与语法分析数据交互的Token的值
+    RDSType lval{};
+
+    /// @brief 语法分析过程中的LookAhead，指向下一个Token
+    RDTokenType lookaheadTag = RDTokenType::T_EMPTY;
+
+    /// @brief 语法分析过程中的错误数目
+    int errno_num = 0;
+};
 
 ///
 /// @brief 采用递归下降分析法实现词法与语法分析生成抽象语法树
+/// @param ctx 分析的上下文，须先用rd_set_buffer设置输入
 /// @return ast_node* 空指针失败，否则成功
 ///
-ast_node * rd_parse();
+ast_node * rd_parse(RDParserContext & ctx);
@@ -0,0 +1,185 @@
+///
+/// @file IRBinaryFormat.h
+/// @brief 二进制形式DragonIR模块文件的布局
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+
+///
+/// 文件由文件头与若干个表组成，各表按4字节对齐，字段都是小端的整数。
+/// 表之间用下标相互引用而不是指针，映射到内存后可直接按数组访问，不需要解析：
+/// - 所有名字连接成一个字节串，字符串表的每一项为名字在其中的(偏移, 长度)，其它表用字符串的编号引用名字，
+///   编号0为空串；
+/// - 类型表中的指针、数组类型引用其元素类型的下标，维度保存在维度表中；
+/// - 整数常量保存在常量表中，相同的常量只保存一份；
+/// - 函数的形参、局部变量与指令各自连续存放，函数记录其起始下标与个数；
+/// - 指令的操作数连续存放在操作数表中，每个操作数为一个32位整数，低3位为种类，其余为下标，
+///   局部的下标相对于所在函数。
+///
+
+/// @brief 文件的魔数，即"DIRB"
+constexpr uint32_t IRBIN_MAGIC = 0x42524944;
+
+/// @brief 格式的版本号
+constexpr uint32_t IRBIN_VERSION = 1;
+
+/// @brief 没有引用时的下标
+constexpr int32_t IRBIN_NONE = -1;
+
+///
+/// @brief 文件中的各个表
+///
+enum IRBinSection : uint32_t {
+    IRBIN_SEC_CHAR,     ///< 名字连接而成的字节串，单位为字节
+    IRBIN_SEC_STRING,   ///< 字符串表
+    IRBIN_SEC_CONST,    ///< 常量表
+    IRBIN_SEC_TYPE,     ///< 类型表
+    IRBIN_SEC_DIM,      ///< 维度表
+    IRBIN_SEC_GLOBAL,   ///< 全局变量表
+    IRBIN_SEC_FUNCTION, ///< 函数表，含被调用的内置函数
+    IRBIN_SEC_PARAM,    ///< 形参表
+    IRBIN_SEC_LOCAL,    ///< 局部变量表
+    IRBIN_SEC_INST,     ///< 指令表
+    IRBIN_SEC_OPERAND,  ///< 操作数表
+    IRBIN_SEC_MAX
+};
+
+///
+/// @brief 类型的种类
+///
+enum IRBinTypeKind : uint32_t {
+    IRBIN_TYPE_VOID,
+    IRBIN_TYPE_BOOL,
+    IRBIN_TYPE_INT,
+    IRBIN_TYPE_POINTER,
+    IRBIN_TYPE_ARRAY,
+    IRBIN_TYPE_ARRAY_PARAM,
+};
+
+///
+/// @brief 操作数的种类
+///
+enum IRBinValueKind : uint32_t {
+    IRBIN_VALUE_CONST,  ///< 整数常量，下标为常量表的下标
+    IRBIN_VALUE_GLOBAL, ///< 全局变量
+    IRBIN_VALUE_PARAM,  ///< 所在函数的形参
+    IRBIN_VALUE_LOCAL,  ///< 所在函数的局部变量
+    IRBIN_VALUE_INST,   ///< 所在函数的指令结果
+};
+
+///
+/// @brief 函数的标志位
+///
+enum IRBinFunctionFlag : uint32_t {
+    IRBIN_FUNC_BUILTIN = 1,   ///< 内置函数，只有名字，装载时按名字查找
+    IRBIN_FUNC_CALLS = 2,     ///< 函数中有函数调用
+};
+
+/// @brief 操作数种类所占的位数
+constexpr uint32_t IRBIN_VALUE_KIND_BITS = 3;
+
+///
+/// @brief 字符串表的一项
+///
+struct IRBinString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+///
+/// @brief 表在文件中的位置
+///
+struct IRBinSectionRef {
+    uint32_t offset; ///< 相对于文件开头的字节偏移
+    uint32_t count;  ///< 元素个数
+};
+
+///
+/// @brief 文件头
+///
+struct IRBinHeader {
+    uint32_t magic;
+    uint32_t version;
+    IRBinSectionRef sections[IRBIN_SEC_MAX];
+};
+
+///
+/// @brief 类型
+///
+struct IRBinType {
+    uint32_t kind;    ///< IRBinTypeKind
+    int32_t element;  ///< 指针指向的类型或者数组的元素类型
+    uint32_t dimFirst;
+    uint32_t dimCount;
+};
+
+///
+/// @brief 全局变量
+///
+struct IRBinGlobal {
+    uint32_t name;
+    int32_t type;
+    int32_t initializer; ///< 初始值在常量表中的下标，没有初始值时为IRBIN_NONE
+};
+
+///
+/// @brief 函数
+///
+struct IRBinFunction {
+    uint32_t name;
+    int32_t returnType;
+    uint32_t flags; ///< IRBinFunctionFlag的组合
+    int32_t maxFuncCallArgCnt;
+    uint32_t paramFirst;
+    uint32_t paramCount;
+    uint32_t localFirst;
+    uint32_t localCount;
+    uint32_t instFirst;
+    uint32_t instCount;
+    int32_t exitLabel;   ///< 出口标签的指令下标
+    int32_t returnValue; ///< 返回值变量的局部变量下标
+};
+
+///
+/// @brief 形参或者局部变量
+///
+struct IRBinVariable {
+    uint32_t irName;
+    uint32_t name;
+    int32_t type;
+    int32_t scopeLevel;
+};
+
+///
+/// @brief 指令
+///
+/// 标签的名字、跳转的标签名放在label中，条件跳转的假出口放在label2中；
+/// 跳转指令的目标指令下标与函数调用的被调用函数下标放在aux中。
+///
+struct IRBinInst {
+    uint16_t op; ///< IRInstOperator
+    uint16_t operandCount;
+    int32_t type;
+    uint32_t irName;
+    uint32_t operandFirst;
+    int32_t aux;
+    uint32_t label;
+    uint32_t label2;
+};
+
+///
+/// @brief 指令的操作数，低IRBIN_VALUE_KIND_BITS位为IRBinValueKind，其余为下标
+///
+typedef uint32_t IRBinOperand;
@@ -0,0 +1,659 @@
+///
+/// @file IRBinaryReader.cpp
+/// @brief 通过mmap装载二进制形式的DragonIR模块文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define IRBIN_MMAP_SUPPORTED 1
+#endif
+
+#include "Common.h"
+#include "IRBinaryReader.h"
+
+#include "ArrayParameterType.h"
+#include "ArrayType.h"
+#include "IntegerType.h"
+#include "PointerType.h"
+#include "VoidType.h"
+
+#include "FormalParam.h"
+#include "LocalVariable.h"
+
+#include "ArgInstruction.h"
+#include "BinaryInstruction.h"
+#include "BranchInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GetElementPtrInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "MoveInstruction.h"
+#include "NegInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _module 要填充的模块，应只含有内置函数
+///
+IRBinaryReader::IRBinaryReader(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 析构函数，解除文件映射
+///
+IRBinaryReader::~IRBinaryReader()
+{
+#ifdef IRBIN_MMAP_SUPPORTED
+    if (mapped) {
+        munmap(const_cast<uint8_t *>(base), size);
+    }
+#endif
+}
+
+///
+/// @brief 检查文件是否是二进制形式的DragonIR
+/// @param filePath 文件路径
+/// @return true：是
+///
+bool IRBinaryReader::isBinary(const std::string & filePath)
+{
+    FILE * fp = fopen(filePath.c_str(), "rb");
+    if (nullptr == fp) {
+        return false;
+    }
+
+    uint32_t magic = 0;
+    size_t readSize = fread(&magic, sizeof(magic), 1, fp);
+    fclose(fp);
+
+    return readSize == 1 && magic == IRBIN_MAGIC;
+}
+
+///
+/// @brief 装载二进制文件
+/// @param filePath 文件路径
+/// @return true：成功，false：文件不能读取或者内容无效
+///
+bool IRBinaryReader::run(const std::string & filePath)
+{
+    if (!mapFile(filePath)) {
+        minic_log(LOG_ERROR, "IR文件(%s)读取失败", filePath.c_str());
+        return false;
+    }
+
+    if (!checkHeader()) {
+        minic_log(LOG_ERROR, "IR文件(%s)不是有效的二进制DragonIR", filePath.c_str());
+        return false;
+    }
+
+    placeholder = module->newConstInt(0);
+
+    if (!loadTypes() || !loadGlobals() || !loadFunctions()) {
+        minic_log(LOG_ERROR, "IR文件(%s)的内容无效", filePath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 映射文件到内存
+/// @param filePath 文件路径
+/// @return true：成功
+///
+bool IRBinaryReader::mapFile(const std::string & filePath)
+{
+#ifdef IRBIN_MMAP_SUPPORTED
+    int fd = open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+
+    size = (size_t) st.st_size;
+
+    void * addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    base = static_cast<const uint8_t *>(addr);
+    mapped = true;
+
+    return true;
+#else
+    // 不支持mmap时整个读入
+    FILE * fp = fopen(filePath.c_str(), "rb");
+    if (nullptr == fp) {
+        return false;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long fileSize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    if (fileSize <= 0) {
+        fclose(fp);
+        return false;
+    }
+
+    buffer.resize((size_t) fileSize);
+    size = fread(&buffer[0], 1, buffer.size(), fp);
+    fclose(fp);
+
+    base = reinterpret_cast<const uint8_t *>(buffer.data());
+
+    return size == buffer.size();
+#endif
+}
+
+///
+/// @brief 检查文件头与各表的范围，获取各表的起始地址
+/// @return true：成功
+///
+bool IRBinaryReader::checkHeader()
+{
+    if (size < sizeof(IRBinHeader)) {
+        return false;
+    }
+
+    header = reinterpret_cast<const IRBinHeader *>(base);
+    if (header->magic != IRBIN_MAGIC || header->version != IRBIN_VERSION) {
+        return false;
+    }
+
+    // 各个表的元素大小，字符串表以字节为单位
+    static const size_t elementSize[IRBIN_SEC_MAX] = {
+        1,
+        sizeof(IRBinString),
+        sizeof(int32_t),
+        sizeof(IRBinType),
+        sizeof(int32_t),
+        sizeof(IRBinGlobal),
+        sizeof(IRBinFunction),
+        sizeof(IRBinVariable),
+        sizeof(IRBinVariable),
+        sizeof(IRBinInst),
+        sizeof(IRBinOperand),
+    };
+
+    for (uint32_t k = 0; k < IRBIN_SEC_MAX; k++) {
+        const IRBinSectionRef & section = header->sections[k];
+        if (section.offset % 4 || section.offset > size ||
+            (uint64_t) section.count * elementSize[k] > size - section.offset) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 创建类型
+/// @return true：成功
+///
+bool IRBinaryReader::loadTypes()
+{
+    const IRBinType * records = table<IRBinType>(IRBIN_SEC_TYPE);
+    const int32_t * dims = table<int32_t>(IRBIN_SEC_DIM);
+
+    for (uint32_t k = 0; k < count(IRBIN_SEC_TYPE); k++) {
+
+        const IRBinType & record = records[k];
+
+        // 元素类型总是在前面
+        Type * element = nullptr;
+        if (record.kind >= IRBIN_TYPE_POINTER) {
+            if (record.element < 0 || (uint32_t) record.element >= k) {
+                return false;
+            }
+            element = types[record.element];
+        }
+
+        std::vector<int32_t> dimensions;
+        if (record.kind >= IRBIN_TYPE_ARRAY) {
+            if (record.dimFirst > count(IRBIN_SEC_DIM) || record.dimCount > count(IRBIN_SEC_DIM) - record.dimFirst) {
+                return false;
+            }
+            dimensions.assign(dims + record.dimFirst, dims + record.dimFirst + record.dimCount);
+        }
+
+        Type * type;
+        switch (record.kind) {
+            case IRBIN_TYPE_VOID:
+                type = VoidType::getType();
+                break;
+            case IRBIN_TYPE_BOOL:
+                type = IntegerType::getTypeBool();
+                break;
+            case IRBIN_TYPE_INT:
+                type = IntegerType::getTypeInt();
+                break;
+            case IRBIN_TYPE_POINTER:
+                type = const_cast<PointerType *>(PointerType::get(element));
+                break;
+            case IRBIN_TYPE_ARRAY:
+                type = ArrayType::get(element, dimensions);
+                break;
+            case IRBIN_TYPE_ARRAY_PARAM:
+                type = new ArrayParameterType(element, dimensions);
+                break;
+            default:
+                return false;
+        }
+
+        types.push_back(type);
+    }
+
+    return true;
+}
+
+///
+/// @brief 创建全局变量
+/// @return true：成功
+///
+bool IRBinaryReader::loadGlobals()
+{
+    const IRBinGlobal * records = table<IRBinGlobal>(IRBIN_SEC_GLOBAL);
+
+    for (uint32_t k = 0; k < count(IRBIN_SEC_GLOBAL); k++) {
+
+        const IRBinGlobal & record = records[k];
+
+        Type * type = getType(record.type);
+        std::string name = getString(record.name);
+        if (!type || name.empty()) {
+            return false;
+        }
+
+        Constant * initializer = nullptr;
+        if (record.initializer != IRBIN_NONE) {
+            if (record.initializer < 0 || (uint32_t) record.initializer >= count(IRBIN_SEC_CONST)) {
+                return false;
+            }
+            initializer = module->newConstInt(table<int32_t>(IRBIN_SEC_CONST)[record.initializer]);
+        }
+
+        Value * var = module->newVarValue(type, name, initializer);
+        if (!var) {
+            return false;
+        }
+
+        globals.push_back(var);
+    }
+
+    return true;
+}
+
+///
+/// @brief 创建函数与形参
+/// @return true：成功
+///
+bool IRBinaryReader::loadFunctions()
+{
+    const IRBinFunction * records = table<IRBinFunction>(IRBIN_SEC_FUNCTION);
+    const IRBinVariable * paramRecords = table<IRBinVariable>(IRBIN_SEC_PARAM);
+
+    // 先创建所有的函数，函数调用可引用后面的函数
+    for (uint32_t k = 0; k < count(IRBIN_SEC_FUNCTION); k++) {
+
+        const IRBinFunction & record = records[k];
+
+        std::string name = getString(record.name);
+        Type * returnType = getType(record.returnType);
+        if (name.empty() || !returnType) {
+            return false;
+        }
+
+        if (record.flags & IRBIN_FUNC_BUILTIN) {
+            // 内置函数由Module创建
+            Function * func = module->findFunction(name);
+            if (!func || !func->isBuiltin()) {
+                return false;
+            }
+            functions.push_back(func);
+            continue;
+        }
+
+        if (record.paramFirst > count(IRBIN_SEC_PARAM) || record.paramCount > count(IRBIN_SEC_PARAM) - record.paramFirst) {
+            return false;
+        }
+
+        std::vector<FormalParam *> params;
+        for (uint32_t p = 0; p < record.paramCount; p++) {
+
+            const IRBinVariable & paramRecord = paramRecords[record.paramFirst + p];
+
+            Type * type = getType(paramRecord.type);
+            if (!type) {
+                for (auto param: params) {
+                    delete param;
+                }
+                return false;
+            }
+
+            FormalParam * param = new FormalParam(type, getString(paramRecord.name));
+            param->setIRName(getString(paramRecord.irName));
+            params.push_back(param);
+        }
+
+        Function * func = module->newFunction(name, returnType, params);
+        if (!func) {
+            for (auto param: params) {
+                delete param;
+            }
+            return false;
+        }
+
+        functions.push_back(func);
+    }
+
+    for (uint32_t k = 0; k < count(IRBIN_SEC_FUNCTION); k++) {
+        if (!(records[k].flags & IRBIN_FUNC_BUILTIN) && !loadFunctionBody(functions[k], records[k])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+///
+/// @brief 创建函数的局部变量与指令
+/// @param func 函数
+/// @param record 函数的记录
+/// @return true：成功
+///
+bool IRBinaryReader::loadFunctionBody(Function * func, const IRBinFunction & record)
+{
+    const IRBinVariable * localRecords = table<IRBinVariable>(IRBIN_SEC_LOCAL);
+    const IRBinInst * instRecords = table<IRBinInst>(IRBIN_SEC_INST);
+
+    if (record.localFirst > count(IRBIN_SEC_LOCAL) || record.localCount > count(IRBIN_SEC_LOCAL) - record.localFirst ||
+        record.instFirst > count(IRBIN_SEC_INST) || record.instCount > count(IRBIN_SEC_INST) - record.instFirst) {
+        return false;
+    }
+
+    curFunc = func;
+    locals.clear();
+    insts.assign(record.instCount, nullptr);
+    fixups.clear();
+
+    for (uint32_t k = 0; k < record.localCount; k++) {
+
+        const IRBinVariable & localRecord = localRecords[record.localFirst + k];
+
+        Type * type = getType(localRecord.type);
+        if (!type) {
+            return false;
+        }
+
+        LocalVariable * var = func->newLocalVarValue(type, getString(localRecord.name), localRecord.scopeLevel);
+        var->setIRName(getString(localRecord.irName));
+        locals.push_back(var);
+    }
+
+    // 标签没有操作数，预先创建，前向的跳转可直接引用
+    for (uint32_t k = 0; k < record.instCount; k++) {
+
+        const IRBinInst & instRecord = instRecords[record.instFirst + k];
+        if (instRecord.op != (uint32_t) IRInstOperator::IRINST_OP_LABEL) {
+            continue;
+        }
+
+        std::string labelName = getString(instRecord.label);
+        insts[k] = labelName.empty() ? new LabelInstruction(func) : new LabelInstruction(func, intern(labelName));
+    }
+
+    for (uint32_t k = 0; k < record.instCount; k++) {
+
+        Instruction * inst = loadInst(func, instRecords[record.instFirst + k], (int32_t) k);
+        if (!inst) {
+            return false;
+        }
+
+        inst->setIRName(getString(instRecords[record.instFirst + k].irName));
+        insts[k] = inst;
+
+        func->getInterCode().addInst(inst);
+    }
+
+    // 回填引用后面指令结果的操作数
+    for (auto & fixup: fixups) {
+        fixup.inst->setOperand(fixup.pos, insts[fixup.target]);
+    }
+
+    if (record.exitLabel >= 0 && (uint32_t) record.exitLabel < record.instCount) {
+        func->setExitLabel(insts[record.exitLabel]);
+    }
+
+    if (record.returnValue >= 0 && (uint32_t) record.returnValue < record.localCount) {
+        func->setReturnValue(static_cast<LocalVariable *>(locals[record.returnValue]));
+    }
+
+    func->setExistFuncCall(record.flags & IRBIN_FUNC_CALLS);
+    func->setMaxFuncCallArgCnt(record.maxFuncCallArgCnt);
+
+    return true;
+}
+
+///
+/// @brief 创建一条指令
+/// @param func 所属函数
+/// @param record 指令的记录
+/// @param index 指令在函数中的下标
+/// @return 指令，出错时为空指针
+///
+Instruction * IRBinaryReader::loadInst(Function * func, const IRBinInst & record, int32_t index)
+{
+    if (record.operandFirst > count(IRBIN_SEC_OPERAND) ||
+        record.operandCount > count(IRBIN_SEC_OPERAND) - record.operandFirst) {
+        return nullptr;
+    }
+
+    Type * type = getType(record.type);
+    if (!type) {
+        return nullptr;
+    }
+
+    // 引用后面指令结果的操作数在指令创建后才能登记指令，先记录起始位置
+    size_t fixupFirst = fixups.size();
+
+    // 操作数
+    const IRBinOperand * operandRecords = table<IRBinOperand>(IRBIN_SEC_OPERAND) + record.operandFirst;
+
+    std::vector<Value *> vals;
+    for (uint32_t k = 0; k < record.operandCount; k++) {
+        Value * val = getOperand(operandRecords[k], index, (int32_t) k);
+        if (!val) {
+            return nullptr;
+        }
+        vals.push_back(val);
+    }
+
+    Instruction * inst = nullptr;
+    IRInstOperator op = (IRInstOperator) record.op;
+
+    switch (op) {
+        case IRInstOperator::IRINST_OP_ENTRY:
+            inst = new EntryInstruction(func);
+            break;
+        case IRInstOperator::IRINST_OP_EXIT:
+            inst = new ExitInstruction(func, vals.empty() ? nullptr : vals[0]);
+            break;
+        case IRInstOperator::IRINST_OP_LABEL:
+            inst = insts[index];
+            break;
+        case IRInstOperator::IRINST_OP_GOTO:
+            if (record.aux >= 0) {
+                if ((size_t) record.aux >= insts.size() || !insts[record.aux]) {
+                    return nullptr;
+                }
+                inst = new GotoInstruction(func, insts[record.aux]);
+            } else {
+                inst = new GotoInstruction(func, intern(getString(record.label)));
+            }
+            break;
+        case IRInstOperator::IRINST_OP_BC:
+            if (vals.size() != 1) {
+                return nullptr;
+            }
+            inst = new BranchInstruction(func,
+                                         vals[0],
+                                         intern(getString(record.label)),
+                                         intern(getString(record.label2)));
+            break;
+        case IRInstOperator::IRINST_OP_ASSIGN:
+            if (vals.size() != 2) {
+                return nullptr;
+            }
+            inst = new MoveInstruction(func, vals[0], vals[1]);
+            break;
+        case IRInstOperator::IRINST_OP_ADD_I:
+        case IRInstOperator::IRINST_OP_SUB_I:
+        case IRInstOperator::IRINST_OP_MUL_I:
+        case IRInstOperator::IRINST_OP_DIV_I:
+        case IRInstOperator::IRINST_OP_MOD_I:
+        case IRInstOperator::IRINST_OP_LT_I:
+        case IRInstOperator::IRINST_OP_LE_I:
+        case IRInstOperator::IRINST_OP_GT_I:
+        case IRInstOperator::IRINST_OP_GE_I:
+        case IRInstOperator::IRINST_OP_EQ_I:
+        case IRInstOperator::IRINST_OP_NE_I:
+            if (vals.size() != 2) {
+                return nullptr;
+            }
+            inst = new BinaryInstruction(func, op, vals[0], vals[1], type);
+            break;
+        case IRInstOperator::IRINST_OP_NEG_I:
+            if (vals.size() != 1) {
+                return nullptr;
+            }
+            inst = new NegInstruction(func, vals[0], type);
+            break;
+        case IRInstOperator::IRINST_OP_FUNC_CALL:
+            if (record.aux < 0 || (size_t) record.aux >= functions.size()) {
+                return nullptr;
+            }
+            inst = new FuncCallInstruction(func, functions[record.aux], vals, type);
+            break;
+        case IRInstOperator::IRINST_OP_ARG:
+            if (vals.size() != 1) {
+                return nullptr;
+            }
+            inst = new ArgInstruction(func, vals[0]);
+            break;
+        case IRInstOperator::IRINST_OP_GEP:
+            if (vals.empty() || !type->isPointerType()) {
+                return nullptr;
+            }
+            inst = new GetElementPtrInstruction(func,
+                                                vals[0],
+                                                std::vector<Value *>(vals.begin() + 1, vals.end()),
+                                                static_cast<PointerType *>(type));
+            break;
+        default:
+            return nullptr;
+    }
+
+    for (size_t k = fixupFirst; k < fixups.size(); k++) {
+        fixups[k].inst = inst;
+    }
+
+    return inst;
+}
+
+///
+/// @brief 获取字符串
+/// @param id 字符串的编号
+/// @return 字符串，编号无效时为空串
+///
+std::string IRBinaryReader::getString(uint32_t id)
+{
+    if (id >= count(IRBIN_SEC_STRING)) {
+        return std::string();
+    }
+
+    const IRBinString & str = table<IRBinString>(IRBIN_SEC_STRING)[id];
+
+    uint32_t charSize = count(IRBIN_SEC_CHAR);
+    if (str.offset > charSize || str.length > charSize - str.offset) {
+        return std::string();
+    }
+
+    return std::string(table<char>(IRBIN_SEC_CHAR) + str.offset, str.length);
+}
+
+///
+/// @brief 获取类型
+/// @param index 类型的下标
+/// @return 类型，下标无效时为空指针
+///
+Type * IRBinaryReader::getType(int32_t index)
+{
+    if (index < 0 || (size_t) index >= types.size()) {
+        return nullptr;
+    }
+
+    return types[index];
+}
+
+///
+/// @brief 获取操作数，引用后面的指令结果时返回占位值并登记回填
+/// @param operand 操作数的记录
+/// @param index 当前指令的下标
+/// @param pos 在指令中的操作数位置
+/// @return 值，无效时为空指针
+///
+Value * IRBinaryReader::getOperand(IRBinOperand operand, int32_t index, int32_t pos)
+{
+    int32_t k = (int32_t) (operand >> IRBIN_VALUE_KIND_BITS);
+
+    switch (operand & ((1u << IRBIN_VALUE_KIND_BITS) - 1)) {
+        case IRBIN_VALUE_CONST:
+            return (uint32_t) k < count(IRBIN_SEC_CONST) ? module->newConstInt(table<int32_t>(IRBIN_SEC_CONST)[k])
+                                                         : nullptr;
+        case IRBIN_VALUE_GLOBAL:
+            return (k >= 0 && (size_t) k < globals.size()) ? globals[k] : nullptr;
+        case IRBIN_VALUE_PARAM: {
+            auto & params = curFunc->getParams();
+            return (k >= 0 && (size_t) k < params.size()) ? params[k] : nullptr;
+        }
+        case IRBIN_VALUE_LOCAL:
+            return (k >= 0 && (size_t) k < locals.size()) ? locals[k] : nullptr;
+        case IRBIN_VALUE_INST:
+            if (k < 0 || (size_t) k >= insts.size()) {
+                return nullptr;
+            }
+            if (k >= index) {
+                // 后面指令的结果，先占位，指令创建后回填
+                fixups.push_back({nullptr, pos, k});
+                return placeholder;
+            }
+            return insts[k];
+        default:
+            return nullptr;
+    }
+}
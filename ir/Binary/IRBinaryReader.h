@@ -0,0 +1,235 @@
+///
+/// @file IRBinaryReader.h
+/// @brief 通过mmap装载二进制形式的DragonIR模块文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Function.h"
+#include "IRBinaryFormat.h"
+#include "Module.h"
+
+///
+/// @brief 二进制DragonIR的装载器
+///
+/// 文件映射到内存后各个表直接按数组访问，没有词法与语法分析，
+/// 只需检查下标的范围，再按下标依次创建Module中的对象。
+/// 指令的操作数引用后面指令的结果时先用占位值，函数的指令创建完毕后回填；
+/// 标签指令没有操作数，预先创建，跳转指令可直接引用后面的标签。
+///
+class IRBinaryReader {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要填充的模块，应只含有内置函数
+    ///
+    explicit IRBinaryReader(Module * _module);
+
+    ///
+    /// @brief 析构函数，解除文件映射
+    ///
+    ~IRBinaryReader();
+
+    ///
+    /// @brief 检查文件是否是二进制形式的DragonIR
+    /// @param filePath 文件路径
+    /// @return true：是
+    ///
+    static bool isBinary(const std::string & filePath);
+
+    ///
+    /// @brief 装载二进制文件
+    /// @param filePath 文件路径
+    /// @return true：成功，false：文件不能读取或者内容无效
+    ///
+    bool run(const std::string & filePath);
+
+protected:
+    ///
+    /// @brief 映射文件到内存
+    /// @param filePath 文件路径
+    /// @return true：成功
+    ///
+    bool mapFile(const std::string & filePath);
+
+    ///
+    /// @brief 检查文件头与各表的范围，获取各表的起始地址
+    /// @return true：成功
+    ///
+    bool checkHeader();
+
+    ///
+    /// @brief 创建类型
+    /// @return true：成功
+    ///
+    bool loadTypes();
+
+    ///
+    /// @brief 创建全局变量
+    /// @return true：成功
+    ///
+    bool loadGlobals();
+
+    ///
+    /// @brief 创建函数与形参
+    /// @return true：成功
+    ///
+    bool loadFunctions();
+
+    ///
+    /// @brief 创建函数的局部变量与指令
+    /// @param func 函数
+    /// @param record 函数的记录
+    /// @return true：成功
+    ///
+    bool loadFunctionBody(Function * func, const IRBinFunction & record);
+
+    ///
+    /// @brief 创建一条指令
+    /// @param func 所属函数
+    /// @param record 指令的记录
+    /// @param index 指令在函数中的下标
+    /// @return 指令，出错时为空指针
+    ///
+    Instruction * loadInst(Function * func, const IRBinInst & record, int32_t index);
+
+    ///
+    /// @brief 获取字符串
+    /// @param id 字符串的编号
+    /// @return 字符串，编号无效时为空串
+    ///
+    std::string getString(uint32_t id);
+
+    ///
+    /// @brief 获取类型
+    /// @param index 类型的下标
+    /// @return 类型，下标无效时为空指针
+    ///
+    Type * getType(int32_t index);
+
+    ///
+    /// @brief 获取操作数，引用后面的指令结果时返回占位值并登记回填
+    /// @param operand 操作数的记录
+    /// @param index 当前指令的下标
+    /// @param pos 在指令中的操作数位置
+    /// @return 值，无效时为空指针
+    ///
+    Value * getOperand(IRBinOperand operand, int32_t index, int32_t pos);
+
+    ///
+    /// @brief 获取表的起始地址
+    /// @tparam T 表的元素类型
+    /// @param section 表
+    /// @return 起始地址
+    ///
+    template <typename T>
+    const T * table(IRBinSection section)
+    {
+        return reinterpret_cast<const T *>(base + header->sections[section].offset);
+    }
+
+    ///
+    /// @brief 获取表的元素个数
+    /// @param section 表
+    /// @return 元素个数
+    ///
+    uint32_t count(IRBinSection section)
+    {
+        return header->sections[section].count;
+    }
+
+private:
+    ///
+    /// @brief 待回填的操作数
+    ///
+    struct Fixup {
+        Instruction * inst;
+        int32_t pos;
+        int32_t target;
+    };
+
+    ///
+    /// @brief 要填充的模块
+    ///
+    Module * module;
+
+    ///
+    /// @brief 文件在内存中的起始地址
+    ///
+    const uint8_t * base = nullptr;
+
+    ///
+    /// @brief 文件大小
+    ///
+    size_t size = 0;
+
+    ///
+    /// @brief 是否是mmap映射的内存，否则为读入的缓冲区
+    ///
+    bool mapped = false;
+
+    ///
+    /// @brief 不支持mmap时读入的文件内容
+    ///
+    std::string buffer;
+
+    ///
+    /// @brief 文件头
+    ///
+    const IRBinHeader * header = nullptr;
+
+    ///
+    /// @brief 按下标的类型
+    ///
+    std::vector<Type *> types;
+
+    ///
+    /// @brief 按下标的全局变量
+    ///
+    std::vector<Value *> globals;
+
+    ///
+    /// @brief 按下标的函数
+    ///
+    std::vector<Function *> functions;
+
+    ///
+    /// @brief 当前函数
+    ///
+    Function * curFunc = nullptr;
+
+    ///
+    /// @brief 当前函数按下标的局部变量
+    ///
+    std::vector<Value *> locals;
+
+    ///
+    /// @brief 当前函数按下标的指令
+    ///
+    std::vector<Instruction *> insts;
+
+    ///
+    /// @brief 当前函数中待回填的操作数
+    ///
+    std::vector<Fixup> fixups;
+
+    ///
+    /// @brief 引用后面指令结果时操作数的占位值
+    ///
+    Value * placeholder = nullptr;
+};
@@ -0,0 +1,464 @@
+///
+/// @file IRBinaryWriter.cpp
+/// @brief 把Module输出为二进制形式的DragonIR模块文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cstdio>
+
+#include "Common.h"
+#include "IRBinaryWriter.h"
+
+#include "ArrayParameterType.h"
+#include "ArrayType.h"
+#include "IntegerType.h"
+#include "PointerType.h"
+
+#include "ConstInt.h"
+#include "FormalParam.h"
+#include "GlobalVariable.h"
+#include "LocalVariable.h"
+
+#include "BranchInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+
+///
+/// @brief 构造函数
+/// @param _module 要输出的模块
+///
+IRBinaryWriter::IRBinaryWriter(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 生成操作数
+/// @param kind 种类
+/// @param index 下标
+/// @return 操作数
+///
+static IRBinOperand makeOperand(IRBinValueKind kind, int32_t index)
+{
+    return ((uint32_t) index << IRBIN_VALUE_KIND_BITS) | kind;
+}
+
+///
+/// @brief 输出二进制文件
+/// @param filePath 文件路径
+/// @return true：成功，false：有不能输出的值或者文件写入失败
+///
+bool IRBinaryWriter::run(const std::string & filePath)
+{
+    // 编号0为空串
+    strings.push_back({0, 0});
+    stringIndex.emplace(std::string(), 0);
+
+    // 全局变量
+    for (auto var: module->getGlobalVariables()) {
+
+        IRBinGlobal record{};
+        record.name = addString(var->getName());
+        record.type = addType(var->getType());
+        record.initializer = IRBIN_NONE;
+        if (record.type == IRBIN_NONE) {
+            minic_log(LOG_ERROR, "全局变量(%s)的类型不能输出", var->getName().c_str());
+            return false;
+        }
+
+        if (var->hasInitializer()) {
+            auto init = dynamic_cast<ConstInt *>(var->getInitializer());
+            if (!init) {
+                minic_log(LOG_ERROR, "全局变量(%s)的初始值不是整数", var->getName().c_str());
+                return false;
+            }
+            record.initializer = addConst(init->getVal());
+        }
+
+        globalIndex[var] = (int32_t) globals.size();
+        globals.push_back(record);
+    }
+
+    // 用户函数先全部登记，函数调用时可引用后面的函数
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            functionIndex[func] = (int32_t) functions.size();
+            functions.emplace_back();
+        }
+    }
+
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin() && !addFunctionBody(func, functionIndex[func])) {
+            return false;
+        }
+    }
+
+    // 按表的次序拼接文件内容，每个表都4字节对齐
+    image.assign(sizeof(IRBinHeader), '\0');
+
+    appendSection(IRBIN_SEC_CHAR, chars.data(), chars.size(), (uint32_t) chars.size());
+    appendSection(IRBIN_SEC_STRING, strings.data(), strings.size() * sizeof(IRBinString), (uint32_t) strings.size());
+    appendSection(IRBIN_SEC_CONST, consts.data(), consts.size() * sizeof(int32_t), (uint32_t) consts.size());
+    appendSection(IRBIN_SEC_TYPE, types.data(), types.size() * sizeof(IRBinType), (uint32_t) types.size());
+    appendSection(IRBIN_SEC_DIM, dims.data(), dims.size() * sizeof(int32_t), (uint32_t) dims.size());
+    appendSection(IRBIN_SEC_GLOBAL, globals.data(), globals.size() * sizeof(IRBinGlobal), (uint32_t) globals.size());
+    appendSection(IRBIN_SEC_FUNCTION,
+                  functions.data(),
+                  functions.size() * sizeof(IRBinFunction),
+                  (uint32_t) functions.size());
+    appendSection(IRBIN_SEC_PARAM, params.data(), params.size() * sizeof(IRBinVariable), (uint32_t) params.size());
+    appendSection(IRBIN_SEC_LOCAL, locals.data(), locals.size() * sizeof(IRBinVariable), (uint32_t) locals.size());
+    appendSection(IRBIN_SEC_INST, insts.data(), insts.size() * sizeof(IRBinInst), (uint32_t) insts.size());
+    appendSection(IRBIN_SEC_OPERAND,
+                  operands.data(),
+                  operands.size() * sizeof(IRBinOperand),
+                  (uint32_t) operands.size());
+
+    header.magic = IRBIN_MAGIC;
+    header.version = IRBIN_VERSION;
+    image.replace(0, sizeof(IRBinHeader), reinterpret_cast<const char *>(&header), sizeof(IRBinHeader));
+
+    FILE * fp = fopen(filePath.c_str(), "wb");
+    if (nullptr == fp) {
+        minic_log(LOG_ERROR, "文件(%s)打开失败", filePath.c_str());
+        return false;
+    }
+
+    size_t written = fwrite(image.data(), 1, image.size(), fp);
+    fclose(fp);
+
+    if (written != image.size()) {
+        minic_log(LOG_ERROR, "文件(%s)写入失败", filePath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+///
+/// @brief 收集函数的形参、局部变量与指令
+/// @param func 函数
+/// @param index 函数在函数表中的下标
+/// @return true：成功
+///
+bool IRBinaryWriter::addFunctionBody(Function * func, int32_t index)
+{
+    // 收集指令时内置函数会加入函数表，函数表可能扩容，最后再写回函数的记录
+    IRBinFunction record{};
+
+    record.name = addString(func->getName());
+    record.returnType = addType(func->getReturnType());
+    record.exitLabel = IRBIN_NONE;
+    record.returnValue = IRBIN_NONE;
+
+    localValues.clear();
+
+    record.paramFirst = (uint32_t) params.size();
+
+    auto & funcParams = func->getParams();
+    for (size_t k = 0; k < funcParams.size(); k++) {
+
+        IRBinVariable var{};
+        var.irName = addString(funcParams[k]->getIRName());
+        var.name = addString(funcParams[k]->getName());
+        var.type = addType(funcParams[k]->getType());
+        if (var.type == IRBIN_NONE) {
+            minic_log(LOG_ERROR, "函数(%s)的形参类型不能输出", func->getName().c_str());
+            return false;
+        }
+
+        localValues[funcParams[k]] = makeOperand(IRBIN_VALUE_PARAM, (int32_t) k);
+        params.push_back(var);
+    }
+
+    record.paramCount = (uint32_t) params.size() - record.paramFirst;
+    record.localFirst = (uint32_t) locals.size();
+
+    for (auto var: func->getVarValues()) {
+
+        int32_t localIndex = (int32_t) (locals.size() - record.localFirst);
+
+        IRBinVariable local{};
+        local.irName = addString(var->getIRName());
+        local.name = addString(var->getName());
+        local.type = addType(var->getType());
+        local.scopeLevel = var->getScopeLevel();
+        if (local.type == IRBIN_NONE) {
+            minic_log(LOG_ERROR, "函数(%s)的局部变量类型不能输出", func->getName().c_str());
+            return false;
+        }
+
+        if (var == func->getReturnValue()) {
+            record.returnValue = localIndex;
+        }
+
+        localValues[var] = makeOperand(IRBIN_VALUE_LOCAL, localIndex);
+        locals.push_back(local);
+    }
+
+    record.localCount = (uint32_t) locals.size() - record.localFirst;
+
+    // 指令的下标先全部登记，操作数可引用后面指令的结果，跳转可引用后面的标签
+    auto & code = func->getInterCode().getInsts();
+    for (size_t k = 0; k < code.size(); k++) {
+        localValues[code[k]] = makeOperand(IRBIN_VALUE_INST, (int32_t) k);
+        if (code[k] == func->getExitLabel()) {
+            record.exitLabel = (int32_t) k;
+        }
+    }
+
+    record.instFirst = (uint32_t) insts.size();
+
+    for (auto inst: code) {
+        if (!addInst(inst)) {
+            minic_log(LOG_ERROR, "函数(%s)的指令不能输出", func->getName().c_str());
+            return false;
+        }
+    }
+
+    record.instCount = (uint32_t) insts.size() - record.instFirst;
+
+    if (func->getExistFuncCall()) {
+        record.flags |= IRBIN_FUNC_CALLS;
+    }
+    record.maxFuncCallArgCnt = func->getMaxFuncCallArgCnt();
+
+    functions[index] = record;
+
+    return true;
+}
+
+///
+/// @brief 获取被调用函数的下标，内置函数第一次被调用时加入函数表
+/// @param func 被调用函数
+/// @return 下标
+///
+int32_t IRBinaryWriter::addCalledFunction(Function * func)
+{
+    auto pIter = functionIndex.find(func);
+    if (pIter != functionIndex.end()) {
+        return pIter->second;
+    }
+
+    // 内置函数只需要名字，装载时由Module提供
+    IRBinFunction record{};
+    record.name = addString(func->getName());
+    record.returnType = addType(func->getReturnType());
+    record.flags = IRBIN_FUNC_BUILTIN;
+    record.exitLabel = IRBIN_NONE;
+    record.returnValue = IRBIN_NONE;
+
+    int32_t index = (int32_t) functions.size();
+    functions.push_back(record);
+    functionIndex[func] = index;
+
+    return index;
+}
+
+///
+/// @brief 收集一条指令
+/// @param inst 指令
+/// @return true：成功
+///
+bool IRBinaryWriter::addInst(Instruction * inst)
+{
+    IRBinInst record{};
+    record.op = (uint16_t) inst->getOp();
+    record.type = addType(inst->getType());
+    record.irName = addString(inst->getIRName());
+    record.aux = IRBIN_NONE;
+
+    if (record.type == IRBIN_NONE) {
+        return false;
+    }
+
+    switch (inst->getOp()) {
+        case IRInstOperator::IRINST_OP_LABEL:
+            record.label = addString(std::string(static_cast<LabelInstruction *>(inst)->getLabelName()));
+            break;
+        case IRInstOperator::IRINST_OP_GOTO: {
+            auto gotoInst = static_cast<GotoInstruction *>(inst);
+            if (gotoInst->getTarget()) {
+                auto pIter = localValues.find(gotoInst->getTarget());
+                if (pIter == localValues.end()) {
+                    return false;
+                }
+                record.aux = (int32_t) (pIter->second >> IRBIN_VALUE_KIND_BITS);
+            }
+            record.label = addString(std::string(gotoInst->getLabelName()));
+            break;
+        }
+        case IRInstOperator::IRINST_OP_BC: {
+            auto branchInst = static_cast<BranchInstruction *>(inst);
+            record.label = addString(std::string(branchInst->getTrueLabelName()));
+            record.label2 = addString(std::string(branchInst->getFalseLabelName()));
+            break;
+        }
+        case IRInstOperator::IRINST_OP_FUNC_CALL:
+            record.aux = addCalledFunction(static_cast<FuncCallInstruction *>(inst)->calledFunction);
+            break;
+        default:
+            break;
+    }
+
+    record.operandFirst = (uint32_t) operands.size();
+
+    for (auto use: inst->getOperands()) {
+        if (!addOperand(use->getUsee())) {
+            return false;
+        }
+    }
+
+    record.operandCount = (uint16_t) (operands.size() - record.operandFirst);
+
+    insts.push_back(record);
+
+    return true;
+}
+
+///
+/// @brief 收集指令的操作数
+/// @param val 操作数
+/// @return true：成功，false：不能引用的值
+///
+bool IRBinaryWriter::addOperand(Value * val)
+{
+    if (auto constVal = dynamic_cast<ConstInt *>(val)) {
+        operands.push_back(makeOperand(IRBIN_VALUE_CONST, addConst(constVal->getVal())));
+        return true;
+    }
+
+    auto pIter = localValues.find(val);
+    if (pIter != localValues.end()) {
+        operands.push_back(pIter->second);
+        return true;
+    }
+
+    auto gIter = globalIndex.find(val);
+    if (gIter != globalIndex.end()) {
+        operands.push_back(makeOperand(IRBIN_VALUE_GLOBAL, gIter->second));
+        return true;
+    }
+
+    return false;
+}
+
+///
+/// @brief 名字加入字符串表，相同的名字只保存一份
+/// @param str 名字
+/// @return 字符串的编号
+///
+uint32_t IRBinaryWriter::addString(const std::string & str)
+{
+    auto pIter = stringIndex.find(str);
+    if (pIter != stringIndex.end()) {
+        return pIter->second;
+    }
+
+    uint32_t index = (uint32_t) strings.size();
+    strings.push_back({(uint32_t) chars.size(), (uint32_t) str.size()});
+    chars += str;
+    stringIndex.emplace(str, index);
+
+    return index;
+}
+
+///
+/// @brief 整数常量加入常量表，相同的常量只保存一份
+/// @param val 常量值
+/// @return 常量的下标
+///
+int32_t IRBinaryWriter::addConst(int32_t val)
+{
+    auto pIter = constIndex.find(val);
+    if (pIter != constIndex.end()) {
+        return pIter->second;
+    }
+
+    int32_t index = (int32_t) consts.size();
+    consts.push_back(val);
+    constIndex.emplace(val, index);
+
+    return index;
+}
+
+///
+/// @brief 类型加入类型表，元素类型先于引用它的类型加入
+/// @param type 类型
+/// @return 类型的下标，不能输出的类型为IRBIN_NONE
+///
+int32_t IRBinaryWriter::addType(Type * type)
+{
+    auto pIter = typeIndex.find(type);
+    if (pIter != typeIndex.end()) {
+        return pIter->second;
+    }
+
+    IRBinType record{};
+    record.element = IRBIN_NONE;
+
+    if (type->isVoidType()) {
+        record.kind = IRBIN_TYPE_VOID;
+    } else if (type->isInt1Byte()) {
+        record.kind = IRBIN_TYPE_BOOL;
+    } else if (type->isInt32Type()) {
+        record.kind = IRBIN_TYPE_INT;
+    } else if (type->isPointerType()) {
+        record.kind = IRBIN_TYPE_POINTER;
+        record.element = addType(const_cast<Type *>(static_cast<PointerType *>(type)->getPointeeType()));
+    } else if (type->isArrayParameterType()) {
+        auto paramType = static_cast<ArrayParameterType *>(type);
+        record.kind = IRBIN_TYPE_ARRAY_PARAM;
+        record.element = addType(paramType->getElementType());
+        record.dimFirst = (uint32_t) dims.size();
+        record.dimCount = (uint32_t) paramType->getDimensionSizes().size();
+        dims.insert(dims.end(), paramType->getDimensionSizes().begin(), paramType->getDimensionSizes().end());
+    } else if (type->isArrayType()) {
+        auto arrayType = static_cast<ArrayType *>(type);
+        record.kind = IRBIN_TYPE_ARRAY;
+        record.element = addType(arrayType->getElementType());
+        record.dimFirst = (uint32_t) dims.size();
+        record.dimCount = (uint32_t) arrayType->getDimensions().size();
+        dims.insert(dims.end(), arrayType->getDimensions().begin(), arrayType->getDimensions().end());
+    } else {
+        return IRBIN_NONE;
+    }
+
+    if (record.kind >= IRBIN_TYPE_POINTER && record.element == IRBIN_NONE) {
+        return IRBIN_NONE;
+    }
+
+    int32_t index = (int32_t) types.size();
+    types.push_back(record);
+    typeIndex[type] = index;
+
+    return index;
+}
+
+///
+/// @brief 把一个表追加到文件内容中
+/// @param section 表
+/// @param data 表的内容
+/// @param size 字节数
+/// @param count 元素个数
+///
+void IRBinaryWriter::appendSection(IRBinSection section, const void * data, size_t size, uint32_t count)
+{
+    // 4字节对齐
+    image.append((4 - image.size() % 4) % 4, '\0');
+
+    header.sections[section].offset = (uint32_t) image.size();
+    header.sections[section].count = count;
+
+    if (size) {
+        image.append(static_cast<const char *>(data), size);
+    }
+}
@@ -0,0 +1,210 @@
+///
+/// @file IRBinaryWriter.h
+/// @brief 把Module输出为二进制形式的DragonIR模块文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "IRBinaryFormat.h"
+#include "Module.h"
+
+///
+/// @brief 二进制DragonIR的输出器
+///
+/// 先把Module中的名字、类型、全局变量、函数、形参、局部变量、指令与操作数分别收集到各自的表中，
+/// 指针都换成表中的下标，最后按IRBinaryFormat.h描述的布局一次写出。
+/// 名字、常量与类型在表中只保存一份，内置函数只有被调用时才加入函数表。
+///
+class IRBinaryWriter {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要输出的模块
+    ///
+    explicit IRBinaryWriter(Module * _module);
+
+    ///
+    /// @brief 输出二进制文件
+    /// @param filePath 文件路径
+    /// @return true：成功，false：有不能输出的值或者文件写入失败
+    ///
+    bool run(const std::string & filePath);
+
+protected:
+    ///
+    /// @brief 收集函数的形参、局部变量与指令
+    /// @param func 函数
+    /// @param index 函数在函数表中的下标
+    /// @return true：成功
+    ///
+    bool addFunctionBody(Function * func, int32_t index);
+
+    ///
+    /// @brief 获取被调用函数的下标，内置函数第一次被调用时加入函数表
+    /// @param func 被调用函数
+    /// @return 下标
+    ///
+    int32_t addCalledFunction(Function * func);
+
+    ///
+    /// @brief 收集一条指令
+    /// @param inst 指令
+    /// @return true：成功
+    ///
+    bool addInst(Instruction * inst);
+
+    ///
+    /// @brief 收集指令的操作数
+    /// @param val 操作数
+    /// @return true：成功，false：不能引用的值
+    ///
+    bool addOperand(Value * val);
+
+    ///
+    /// @brief 名字加入字符串表，相同的名字只保存一份
+    /// @param str 名字
+    /// @return 字符串的编号
+    ///
+    uint32_t addString(const std::string & str);
+
+    ///
+    /// @brief 整数常量加入常量表，相同的常量只保存一份
+    /// @param val 常量值
+    /// @return 常量的下标
+    ///
+    int32_t addConst(int32_t val);
+
+    ///
+    /// @brief 类型加入类型表，元素类型先于引用它的类型加入
+    /// @param type 类型
+    /// @return 类型的下标，不能输出的类型为IRBIN_NONE
+    ///
+    int32_t addType(Type * type);
+
+    ///
+    /// @brief 把一个表追加到文件内容中
+    /// @param section 表
+    /// @param data 表的内容
+    /// @param size 字节数
+    /// @param count 元素个数
+    ///
+    void appendSection(IRBinSection section, const void * data, size_t size, uint32_t count);
+
+private:
+    ///
+    /// @brief 要输出的模块
+    ///
+    Module * module;
+
+    ///
+    /// @brief 文件头
+    ///
+    IRBinHeader header{};
+
+    ///
+    /// @brief 文件内容
+    ///
+    std::string image;
+
+    ///
+    /// @brief 名字连接而成的字节串
+    ///
+    std::string chars;
+
+    ///
+    /// @brief 字符串表
+    ///
+    std::vector<IRBinString> strings;
+
+    ///
+    /// @brief 名字的编号
+    ///
+    std::unordered_map<std::string, uint32_t> stringIndex;
+
+    ///
+    /// @brief 常量表
+    ///
+    std::vector<int32_t> consts;
+
+    ///
+    /// @brief 常量的下标
+    ///
+    std::unordered_map<int32_t, int32_t> constIndex;
+
+    ///
+    /// @brief 类型表
+    ///
+    std::vector<IRBinType> types;
+
+    ///
+    /// @brief 类型的下标
+    ///
+    std::unordered_map<const Type *, int32_t> typeIndex;
+
+    ///
+    /// @brief 维度表
+    ///
+    std::vector<int32_t> dims;
+
+    ///
+    /// @brief 全局变量表
+    ///
+    std::vector<IRBinGlobal> globals;
+
+    ///
+    /// @brief 全局变量的下标
+    ///
+    std::unordered_map<Value *, int32_t> globalIndex;
+
+    ///
+    /// @brief 函数表
+    ///
+    std::vector<IRBinFunction> functions;
+
+    ///
+    /// @brief 函数的下标
+    ///
+    std::unordered_map<Function *, int32_t> functionIndex;
+
+    ///
+    /// @brief 形参表
+    ///
+    std::vector<IRBinVariable> params;
+
+    ///
+    /// @brief 局部变量表
+    ///
+    std::vector<IRBinVariable> locals;
+
+    ///
+    /// @brief 指令表
+    ///
+    std::vector<IRBinInst> insts;
+
+    ///
+    /// @brief 操作数表
+    ///
+    std::vector<IRBinOperand> operands;
+
+    ///
+    /// @brief 当前函数中形参、局部变量与指令的引用
+    ///
+    std::unordered_map<Value *, IRBinOperand> localValues;
+};
@@ -294,6 +294,20 @@ void Function::setExistFuncCall(bool exist)
     funcCallExist = exist;
 }
 
+/// @brief 栈帧是否需要帧指针fp，不需要时栈内变量采用sp寻址
+/// @return 是否需要帧指针
+bool Function::getNeedFramePointer()
+{
+    return framePointer;
+}
+
+/// @brief 设置栈帧是否需要帧指针fp
+/// @param need true: 需要 false: 不需要
+void Function::setNeedFramePointer(bool need)
+{
+    framePointer = need;
+}
+
 /// @brief 新建变量型Value。先检查是否存在，不存在则创建，否则失败
 /// @param name 变量ID
 /// @param type 变量类型
@@ -127,6 +127,13 @@ public:
     /// @param exist true: 存在 false: 不存在
     void setExistFuncCall(bool exist);
 
+    /// @brief 栈帧是否需要帧指针fp，不需要时栈内变量采用sp寻址
+    bool getNeedFramePointer();
+
+    /// @brief 设置栈帧是否需要帧指针fp
+    /// @param need true: 需要 false: 不需要
+    void setNeedFramePointer(bool need);
+
     /// @brief 获取本函数需要保护的寄存器
     /// @return 要保护的寄存器
     std::vector<int32_t> & getProtectedReg();
@@ -238,6 +245,11 @@ private:
     ///
     bool funcCallExist = false;
 
+    ///
+    /// @brief 栈帧是否需要帧指针
+    ///
+    bool framePointer = false;
+
     ///
     /// @brief 本函数内函数调用的参数个数最大值
     ///
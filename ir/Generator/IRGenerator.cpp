@@ -2,8 +2,8 @@
 /// @file IRGenerator.cpp
 /// @brief AST遍历产生线性IR的源文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.1
-/// @date 2024-11-23
+/// @version 1.2
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,7 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>AST节点的IR临时状态改为按节点编号的旁路表
 /// </table>
 ///
 #include <cstdint>
@@ -51,14 +52,14 @@
 
 // Static helper function to generate a conditional branch based on a Value.
 // If the value is not already a boolean (i1), it compares it to zero.
-static void generateBranchOnValue(ast_node* node, Module* module, Value* value, const std::string& true_label, const std::string& false_label) {
+static void generateBranchOnValue(InterCode& block, Module* module, Value* value, Symbol true_label, Symbol false_label) {
     if (!value) {
         minic_log(LOG_ERROR, "Cannot generate branch on a null value.");
         return;
     }
     // If the value is already a boolean result from a comparison, use it directly.
     if (value->getType()->isInt1Byte()) {
-        node->blockInsts.addInst(new BranchInstruction(module->getCurrentFunction(), value, true_label, false_label));
+        block.addInst(new BranchInstruction(module->getCurrentFunction(), value, true_label, false_label));
     } else { 
         // Otherwise, it's a value that needs to be compared to zero.
         BinaryInstruction* cmpInst = new BinaryInstruction(
@@ -68,32 +69,33 @@ static void generateBranchOnValue(ast_node* node, Module* module, Value* value,
             module->newConstInt(0),
             IntegerType::getTypeBool()
         );
-        node->blockInsts.addInst(cmpInst);
-        node->blockInsts.addInst(new BranchInstruction(module->getCurrentFunction(), cmpInst, true_label, false_label));
+        block.addInst(cmpInst);
+        block.addInst(new BranchInstruction(module->getCurrentFunction(), cmpInst, true_label, false_label));
     }
 }
 
 
 // Static helper function definition (NEW POSITION, AT TOP)
-static bool find_enclosing_loop_labels(ast_node* current_node, std::string& loop_s_label, std::string& loop_e_label) {
+static bool find_enclosing_loop_labels(const ast_ir_state* states, ast_node* current_node, Symbol& loop_s_label, Symbol& loop_e_label) {
     ast_node* walker = current_node; 
     while (walker) {
+        const ast_ir_state& state = states[walker->id];
         if (walker->node_type == ast_operator_type::AST_OP_WHILE) {
-            if (!walker->loop_start_label.empty() && !walker->loop_end_label.empty()) {
-                loop_s_label = walker->loop_start_label;
-                loop_e_label = walker->loop_end_label;
+            if (state.loop_start_label != 0 && state.loop_end_label != 0) {
+                loop_s_label = state.loop_start_label;
+                loop_e_label = state.loop_end_label;
                 return true;
             }
         }
-        if (!walker->loop_start_label.empty() && !walker->loop_end_label.empty()) {
+        if (state.loop_start_label != 0 && state.loop_end_label != 0) {
              bool isLikelyLoopBodyBlock = false;
              if(walker->parent && walker->parent->node_type == ast_operator_type::AST_OP_WHILE && 
                 walker->parent->sons.size() > 1 && walker->parent->sons[1] == walker){
                  isLikelyLoopBodyBlock = true; 
              }
              if(isLikelyLoopBodyBlock){
-                loop_s_label = walker->loop_start_label;
-                loop_e_label = walker->loop_end_label;
+                loop_s_label = state.loop_start_label;
+                loop_e_label = state.loop_end_label;
                 return true;
              }
         }
@@ -178,9 +180,15 @@ bool IRGenerator::run()
 {
     ast_node * node;
 
+    // 每个AST节点一个临时状态，节点本身不再携带指令块与标签
+    irStates.reset(new ast_ir_state[ast_node::getNodeCount()]);
+
     // 从根节点进行遍历
     node = ir_visit_ast_node(root);
 
+    // 指令都已转移到函数中，剩余的临时状态随之释放
+    irStates.reset();
+
     return node != nullptr;
 }
 
@@ -222,7 +230,7 @@ ast_node * IRGenerator::ir_visit_ast_node(ast_node * node)
     }
 
     // 成功处理后检查是否设置了必要的属性
-    if (node && node->val == nullptr) {
+    if (node && ir(node).val == nullptr) {
         // 这里不应该发出警告，因为某些节点(如语句块)不需要设置val
         if (node->node_type == ast_operator_type::AST_OP_GT ||
             node->node_type == ast_operator_type::AST_OP_GE ||
@@ -295,7 +303,7 @@ bool IRGenerator::ir_function_define(ast_node * node)
     ast_node * block_node = node->sons[3];
 
     // 创建一个新的函数定义
-    Function * newFunc = module->newFunction(name_node->name, type_node->type);
+    Function * newFunc = module->newFunction(std::string(name_node->getName()), type_node->type);
     if (!newFunc) {
         // 新定义的函数已经存在，则失败返回。
         // TODO 自行追加语义错误处理
@@ -339,12 +347,12 @@ bool IRGenerator::ir_function_define(ast_node * node)
         if (localVar) {
             // 创建形参赋值指令：将形参赋值给局部变量
             MoveInstruction* moveInst = new MoveInstruction(newFunc, localVar, formalParam);
-            param_node->blockInsts.addInst(moveInst);
+            ir(param_node).blockInsts.addInst(moveInst);
         }
     }
     
     // 添加形参处理的指令到函数体
-    node->blockInsts.addInst(param_node->blockInsts);
+    ir(node).blockInsts.addInst(ir(param_node).blockInsts);
 
     // 新建一个Value，用于保存函数的返回值，如果没有返回值可不用申请
     LocalVariable * retValue = nullptr;
@@ -366,12 +374,12 @@ bool IRGenerator::ir_function_define(ast_node * node)
     }
 
     // IR指令追加到当前的节点中
-    node->blockInsts.addInst(block_node->blockInsts);
+    ir(node).blockInsts.addInst(ir(block_node).blockInsts);
 
-    // 此时，所有指令都加入到当前函数中，也就是node->blockInsts
+    // 此时，所有指令都加入到当前函数中，ir(也就是node).blockInsts
 
     // node节点的指令移动到函数的IR指令列表中
-    irCode.addInst(node->blockInsts);
+    irCode.addInst(ir(node).blockInsts);
 
     // 添加函数出口Label指令，主要用于return语句跳转到这里进行函数的退出
     irCode.addInst(exitLabelInst);
@@ -419,7 +427,7 @@ bool IRGenerator::ir_function_formal_params(ast_node * node)
         ast_node* nameNode = paramNode->sons[1];
         
         // 创建形参
-        std::string paramName = nameNode->name;
+        std::string paramName(nameNode->getName());
         Type* paramType = IntegerType::getTypeInt(); // 目前仅支持整型参数
         
         // 为形参创建形参变量
@@ -470,7 +478,7 @@ bool IRGenerator::ir_function_call(ast_node * node)
     // 第一个节点：函数名节点
     // 第二个节点：实参列表节点
 
-    std::string funcName = node->sons[0]->name;
+    std::string funcName(node->sons[0]->getName());
     int64_t lineno = node->sons[0]->line_no;
 
     ast_node * paramsNode = node->sons[1];
@@ -508,13 +516,13 @@ bool IRGenerator::ir_function_call(ast_node * node)
                 return false;
             }
 
-            realParams.push_back(temp->val);
-            node->blockInsts.addInst(temp->blockInsts);
+            realParams.push_back(ir(temp).val);
+            ir(node).blockInsts.addInst(ir(temp).blockInsts);
         }
     }
 
     // 检查参数个数是否匹配
-    if (realParams.size() != declaredParamCount) {
+    if ((int32_t) realParams.size() != declaredParamCount) {
         // 函数参数的个数不一致，语义错误
         minic_log(LOG_ERROR, "第%lld行的被调用函数(%s)参数个数不匹配，期望%d个，实际%zu个", 
                  (long long)lineno, funcName.c_str(), declaredParamCount, realParams.size());
@@ -527,10 +535,10 @@ bool IRGenerator::ir_function_call(ast_node * node)
     FuncCallInstruction * funcCallInst = new FuncCallInstruction(currentFunc, calledFunction, realParams, type);
 
     // 创建函数调用指令
-    node->blockInsts.addInst(funcCallInst);
+    ir(node).blockInsts.addInst(funcCallInst);
 
     // 函数调用结果Value保存到node中，可能为空，上层节点可利用这个值
-    node->val = funcCallInst;
+    ir(node).val = funcCallInst;
 
     return true;
 }
@@ -545,7 +553,7 @@ bool IRGenerator::ir_block(ast_node * node)
         module->enterScope();
     }
 
-    std::vector<ast_node *>::iterator pIter;
+    ast_node_list::iterator pIter;
     for (pIter = node->sons.begin(); pIter != node->sons.end(); ++pIter) {
 
         // 遍历Block的每个语句，进行显示或者运算
@@ -554,7 +562,7 @@ bool IRGenerator::ir_block(ast_node * node)
             return false;
         }
 
-        node->blockInsts.addInst(temp->blockInsts);
+        ir(node).blockInsts.addInst(ir(temp).blockInsts);
     }
 
     // 离开作用域
@@ -584,7 +592,7 @@ Value* IRGenerator::dereferenceIfPointer(ast_node* node, Value* val)
     
     // 创建指针解引用指令：tempVar = *pointer
     MoveInstruction* loadInst = new MoveInstruction(module->getCurrentFunction(), tempVar, val);
-    node->blockInsts.addInst(loadInst);
+    ir(node).blockInsts.addInst(loadInst);
     
     return tempVar;
 }
@@ -614,8 +622,8 @@ bool IRGenerator::ir_add(ast_node * node)
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* leftVal = dereferenceIfPointer(node, left->val);
-    Value* rightVal = dereferenceIfPointer(node, right->val);
+    Value* leftVal = dereferenceIfPointer(node, ir(left).val);
+    Value* rightVal = dereferenceIfPointer(node, ir(right).val);
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
@@ -626,11 +634,11 @@ bool IRGenerator::ir_add(ast_node * node)
                                                         IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(addInst);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    ir(node).blockInsts.addInst(addInst);
 
-    node->val = addInst;
+    ir(node).val = addInst;
 
     return true;
 }
@@ -660,8 +668,8 @@ bool IRGenerator::ir_sub(ast_node * node)
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* leftVal = dereferenceIfPointer(node, left->val);
-    Value* rightVal = dereferenceIfPointer(node, right->val);
+    Value* leftVal = dereferenceIfPointer(node, ir(left).val);
+    Value* rightVal = dereferenceIfPointer(node, ir(right).val);
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
@@ -672,11 +680,11 @@ bool IRGenerator::ir_sub(ast_node * node)
                                                         IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(subInst);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    ir(node).blockInsts.addInst(subInst);
 
-    node->val = subInst;
+    ir(node).val = subInst;
 
     return true;
 }
@@ -697,7 +705,7 @@ bool IRGenerator::ir_neg(ast_node * node)
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* operandVal = dereferenceIfPointer(node, operand->val);
+    Value* operandVal = dereferenceIfPointer(node, ir(operand).val);
 
     // 创建NEG指令
     NegInstruction * negInst = new NegInstruction(module->getCurrentFunction(),
@@ -705,10 +713,10 @@ bool IRGenerator::ir_neg(ast_node * node)
                                                         IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(operand->blockInsts);
-    node->blockInsts.addInst(negInst);
+    ir(node).blockInsts.addInst(ir(operand).blockInsts);
+    ir(node).blockInsts.addInst(negInst);
 
-    node->val = negInst;
+    ir(node).val = negInst;
 
     return true;
 }
@@ -743,30 +751,30 @@ bool IRGenerator::ir_assign(ast_node * node)
     // 检查左值是否为数组访问
     if (son1_node->node_type == ast_operator_type::AST_OP_ARRAY_ACCESS) {
         // 数组元素赋值，使用内存存储指令
-        // left->val 是数组元素的地址，right->val 是要赋的值
+        // ir(left).val 是数组元素的地址，ir(right).val 是要赋的值
         
         // 创建内存存储指令 *address = value
         // 这里我们需要创建一个特殊的赋值指令来处理内存存储
-        MoveInstruction * storeInst = new MoveInstruction(module->getCurrentFunction(), left->val, right->val);
+        MoveInstruction * storeInst = new MoveInstruction(module->getCurrentFunction(), ir(left).val, ir(right).val);
         
         // 创建临时变量保存IR的值，以及线性IR指令
-        node->blockInsts.addInst(right->blockInsts);
-        node->blockInsts.addInst(left->blockInsts);
-        node->blockInsts.addInst(storeInst);
+        ir(node).blockInsts.addInst(ir(right).blockInsts);
+        ir(node).blockInsts.addInst(ir(left).blockInsts);
+        ir(node).blockInsts.addInst(storeInst);
         
         // 这里假定赋值的类型是一致的
-        node->val = storeInst;
+        ir(node).val = storeInst;
     } else {
         // 普通变量赋值
-    MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), left->val, right->val);
+    MoveInstruction * movInst = new MoveInstruction(module->getCurrentFunction(), ir(left).val, ir(right).val);
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(movInst);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    ir(node).blockInsts.addInst(movInst);
 
     // 这里假定赋值的类型是一致的
-    node->val = movInst;
+    ir(node).val = movInst;
     }
 
     return true;
@@ -800,19 +808,19 @@ bool IRGenerator::ir_return(ast_node * node)
     if (right) {
 
         // 创建临时变量保存IR的值，以及线性IR指令
-        node->blockInsts.addInst(right->blockInsts);
+        ir(node).blockInsts.addInst(ir(right).blockInsts);
 
         // 返回值赋值到函数返回值变量上，然后跳转到函数的尾部
-        node->blockInsts.addInst(new MoveInstruction(currentFunc, currentFunc->getReturnValue(), right->val));
+        ir(node).blockInsts.addInst(new MoveInstruction(currentFunc, currentFunc->getReturnValue(), ir(right).val));
 
-        node->val = right->val;
+        ir(node).val = ir(right).val;
     } else {
         // 没有返回值
-        node->val = nullptr;
+        ir(node).val = nullptr;
     }
 
     // 跳转到函数的尾部出口指令上
-    node->blockInsts.addInst(new GotoInstruction(currentFunc, currentFunc->getExitLabel()));
+    ir(node).blockInsts.addInst(new GotoInstruction(currentFunc, currentFunc->getExitLabel()));
 
     return true;
 }
@@ -833,7 +841,7 @@ bool IRGenerator::ir_leaf_node_type(ast_node * node)
 bool IRGenerator::ir_leaf_node_var_id(ast_node * node)
 {
     // 安全检查
-    if (!node || node->name.empty()) {
+    if (!node || node->name == 0) {
         minic_log(LOG_ERROR, "变量标识符节点无效或名称为空");
         return false;
     }
@@ -843,11 +851,11 @@ bool IRGenerator::ir_leaf_node_var_id(ast_node * node)
     
     // 检查变量是否存在
     if (!val) {
-        minic_log(LOG_ERROR, "变量 '%s' 未定义", node->name.c_str());
+        minic_log(LOG_ERROR, "变量 '%s' 未定义", node->getName().data());
         return false;
     }
 
-    node->val = val;
+    ir(node).val = val;
     return true;
 }
 
@@ -861,7 +869,7 @@ bool IRGenerator::ir_leaf_node_uint(ast_node * node)
     // 新建一个整数常量Value
     val = module->newConstInt((int32_t) node->integer_val);
 
-    node->val = val;
+    ir(node).val = val;
 
     return true;
 }
@@ -881,7 +889,7 @@ bool IRGenerator::ir_declare_statment(ast_node * node)
         }
         // Accumulate instructions from this var_decl (which now includes potential store)
         // into the DECL_STMT node's instructions.
-        node->blockInsts.addInst(visited_var_decl_node->blockInsts);
+        ir(node).blockInsts.addInst(ir(visited_var_decl_node).blockInsts);
     }
 
     return true; // If all declarations were processed successfully
@@ -922,14 +930,14 @@ bool IRGenerator::ir_variable_declare(ast_node * node) // node is AST_OP_VAR_DEC
             minic_log(LOG_ERROR, "Array definition node missing variable name.");
             return false;
         }
-        var_name = id_or_array_node->sons[0]->name;
+        var_name = id_or_array_node->sons[0]->getName();
     } else if (id_or_array_node->node_type == ast_operator_type::AST_OP_LEAF_VAR_ID) {
         if (!type_node_ast || !type_node_ast->type) {
             minic_log(LOG_ERROR, "Type node or type information missing for simple variable declaration.");
             return false;
         }
         var_type = type_node_ast->type;
-        var_name = id_or_array_node->name;
+        var_name = id_or_array_node->getName();
     } else {
         minic_log(LOG_ERROR, "Unexpected node type (expected VAR_ID or ARRAY_DEF) as second child of AST_OP_VAR_DECL.");
         return false;
@@ -945,7 +953,7 @@ bool IRGenerator::ir_variable_declare(ast_node * node) // node is AST_OP_VAR_DEC
             minic_log(LOG_ERROR, "Failed to generate IR for initializer of variable '%s'.", var_name.c_str());
             return false;
         }
-        if (!init_expr_ast_node->val) {
+        if (!ir(init_expr_ast_node).val) {
             minic_log(LOG_ERROR, "Initializer expression for variable '%s' did not yield a Value.", var_name.c_str());
             return false;
         }
@@ -961,19 +969,19 @@ bool IRGenerator::ir_variable_declare(ast_node * node) // node is AST_OP_VAR_DEC
                     global_const_initializer = module->newConstInt(negValue);
                     
                     // 清空生成的指令，因为我们直接计算了常量值
-                    init_expr_ast_node->blockInsts.Delete();
-                    init_expr_ast_node->val = global_const_initializer;
+                    ir(init_expr_ast_node).blockInsts.Delete();
+                    ir(init_expr_ast_node).val = global_const_initializer;
                 } else {
                     minic_log(LOG_ERROR, "Initializer for global variable '%s' contains non-constant expression.", var_name.c_str());
                     return false;
                 }
             } else {
                 // 原有的检查逻辑
-                if (!init_expr_ast_node->blockInsts.getInsts().empty()) {
+                if (!ir(init_expr_ast_node).blockInsts.getInsts().empty()) {
                     minic_log(LOG_ERROR, "Initializer for global variable '%s' is not a simple constant expression (generated instructions).", var_name.c_str());
                     return false;
                 }
-                global_const_initializer = dynamic_cast<Constant*>(init_expr_ast_node->val);
+                global_const_initializer = dynamic_cast<Constant*>(ir(init_expr_ast_node).val);
                 if (!global_const_initializer) {
                     minic_log(LOG_ERROR, "Initializer for global variable '%s' is not a compile-time constant.", var_name.c_str());
                     return false;
@@ -991,14 +999,14 @@ bool IRGenerator::ir_variable_declare(ast_node * node) // node is AST_OP_VAR_DEC
     }
     
     // Assign the memory location (AllocaInst or GlobalVariable) as the value of the ID/ARRAY_DEF node
-    id_or_array_node->val = var_mem_location;
+    ir(id_or_array_node).val = var_mem_location;
     // Also for the VAR_DECL node itself.
-    node->val = var_mem_location;
+    ir(node).val = var_mem_location;
 
     // If it's a local variable AND has an initializer, generate store instruction
     if (module->getCurrentFunction() != nullptr && has_initializer) {
         // init_expr_ast_node is already visited and its val is set
-        Value* init_val_raw = init_expr_ast_node->val;
+        Value* init_val_raw = ir(init_expr_ast_node).val;
         Value* value_to_store = dereferenceIfPointer(node, init_val_raw); 
         if (!value_to_store) {
             minic_log(LOG_ERROR, "Failed to obtain value to store for local variable initializer of '%s'.", var_name.c_str());
@@ -1007,15 +1015,15 @@ bool IRGenerator::ir_variable_declare(ast_node * node) // node is AST_OP_VAR_DEC
 
         MoveInstruction* store_inst = new MoveInstruction(module->getCurrentFunction(), var_mem_location, value_to_store);
         
-        // Add instructions from initializer expression evaluation (already part of 'node->blockInsts' via dereferenceIfPointer)
+        // Add instructions from initializer expression evaluation (already part of 'ir(node).blockInsts' via dereferenceIfPointer)
         // then add the store instruction.
-        node->blockInsts.addInst(init_expr_ast_node->blockInsts);
-        node->blockInsts.addInst(store_inst);
+        ir(node).blockInsts.addInst(ir(init_expr_ast_node).blockInsts);
+        ir(node).blockInsts.addInst(store_inst);
     } else if (module->getCurrentFunction() == nullptr && has_initializer) {
         // For globals with a valid constant initializer, the initialization is part of GlobalVariable.
-        // Add instructions from init_expr_ast_node->blockInsts (should be empty for simple constants)
+        // Add instructions from ir(init_expr_ast_node).blockInsts (should be empty for simple constants)
         // This is mostly for completeness, as an error would have been raised if blockInsts wasn't empty.
-        node->blockInsts.addInst(init_expr_ast_node->blockInsts);
+        ir(node).blockInsts.addInst(ir(init_expr_ast_node).blockInsts);
     }
     // If it's an array (global or local) without an initializer, it's just allocated.
     // If it's a simple variable (global or local) without an initializer, it's just allocated (global zero-initialized by default by convention in C).
@@ -1048,8 +1056,8 @@ bool IRGenerator::ir_mul(ast_node * node)
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* leftVal = dereferenceIfPointer(node, left->val);
-    Value* rightVal = dereferenceIfPointer(node, right->val);
+    Value* leftVal = dereferenceIfPointer(node, ir(left).val);
+    Value* rightVal = dereferenceIfPointer(node, ir(right).val);
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
@@ -1060,11 +1068,11 @@ bool IRGenerator::ir_mul(ast_node * node)
                                                       IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(mulInst);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    ir(node).blockInsts.addInst(mulInst);
 
-    node->val = mulInst;
+    ir(node).val = mulInst;
 
     return true;
 }
@@ -1094,8 +1102,8 @@ bool IRGenerator::ir_div(ast_node * node)
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* leftVal = dereferenceIfPointer(node, left->val);
-    Value* rightVal = dereferenceIfPointer(node, right->val);
+    Value* leftVal = dereferenceIfPointer(node, ir(left).val);
+    Value* rightVal = dereferenceIfPointer(node, ir(right).val);
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
@@ -1106,11 +1114,11 @@ bool IRGenerator::ir_div(ast_node * node)
                                                       IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(divInst);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    ir(node).blockInsts.addInst(divInst);
 
-    node->val = divInst;
+    ir(node).val = divInst;
 
     return true;
 }
@@ -1140,8 +1148,8 @@ bool IRGenerator::ir_mod(ast_node * node)
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* leftVal = dereferenceIfPointer(node, left->val);
-    Value* rightVal = dereferenceIfPointer(node, right->val);
+    Value* leftVal = dereferenceIfPointer(node, ir(left).val);
+    Value* rightVal = dereferenceIfPointer(node, ir(right).val);
 
     // 这里只处理整型的数据，如需支持实数，则需要针对类型进行处理
 
@@ -1152,11 +1160,11 @@ bool IRGenerator::ir_mod(ast_node * node)
                                                       IntegerType::getTypeInt());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(modInst);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    ir(node).blockInsts.addInst(modInst);
 
-    node->val = modInst;
+    ir(node).val = modInst;
 
     return true;
 }
@@ -1164,9 +1172,9 @@ bool IRGenerator::ir_mod(ast_node * node)
 /// @brief 生成唯一的标签名
 /// @param prefix 标签前缀
 /// @return 生成的标签名
-std::string IRGenerator::generateUniqueLabel(const std::string& prefix)
+Symbol IRGenerator::generateUniqueLabel(const std::string& prefix)
 {
-    return prefix + std::to_string(label_counter++);
+    return intern(prefix + std::to_string(label_counter++));
 }
 
 /// @brief 通用关系表达式处理函数
@@ -1188,7 +1196,7 @@ bool IRGenerator::ir_rel_operation(ast_node * node, IRInstOperator op)
 
     // 左操作数
     ast_node * left = ir_visit_ast_node(src1_node);
-    if (!left || !left->val) {
+    if (!left || !ir(left).val) {
         // 某个变量没有定值
         minic_log(LOG_ERROR, "关系运算左操作数处理失败");
         return false;
@@ -1196,15 +1204,15 @@ bool IRGenerator::ir_rel_operation(ast_node * node, IRInstOperator op)
 
     // 右操作数
     ast_node * right = ir_visit_ast_node(src2_node);
-    if (!right || !right->val) {
+    if (!right || !ir(right).val) {
         // 某个变量没有定值
         minic_log(LOG_ERROR, "关系运算右操作数处理失败");
         return false;
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* leftVal = dereferenceIfPointer(node, left->val);
-    Value* rightVal = dereferenceIfPointer(node, right->val);
+    Value* leftVal = dereferenceIfPointer(node, ir(left).val);
+    Value* rightVal = dereferenceIfPointer(node, ir(right).val);
 
     // 生成比较指令
     BinaryInstruction * cmpInst = new BinaryInstruction(module->getCurrentFunction(),
@@ -1214,20 +1222,20 @@ bool IRGenerator::ir_rel_operation(ast_node * node, IRInstOperator op)
                                                        IntegerType::getTypeBool());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(left->blockInsts);
-    node->blockInsts.addInst(right->blockInsts);
-    node->blockInsts.addInst(cmpInst);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    ir(node).blockInsts.addInst(cmpInst);
 
-    node->val = cmpInst;
+    ir(node).val = cmpInst;
 
     // 如果父节点已经设置了真假出口标签，则生成条件跳转指令
-    if (!node->true_label.empty() && !node->false_label.empty()) {
+    if (ir(node).true_label != 0 && ir(node).false_label != 0) {
         // 创建条件分支指令
         BranchInstruction * branchInst = new BranchInstruction(module->getCurrentFunction(),
                                                              cmpInst,
-                                                             node->true_label,
-                                                             node->false_label);
-        node->blockInsts.addInst(branchInst);
+                                                             ir(node).true_label,
+                                                             ir(node).false_label);
+        ir(node).blockInsts.addInst(branchInst);
     }
 
     return true;
@@ -1297,13 +1305,13 @@ bool IRGenerator::ir_if(ast_node * node)
     ast_node * then_node = node->sons[1];
 
     // 生成唯一标签
-    std::string true_label = generateUniqueLabel(".L");    // IF分支的标签
-    std::string end_label = generateUniqueLabel(".L");     // 结束标签
+    Symbol true_label = generateUniqueLabel(".L");    // IF分支的标签
+    Symbol end_label = generateUniqueLabel(".L");     // 结束标签
 
     // 设置条件表达式的真假出口标签
     if (condition_node) {
-        condition_node->true_label = true_label;
-        condition_node->false_label = end_label;
+        ir(condition_node).true_label = true_label;
+        ir(condition_node).false_label = end_label;
     } else {
         minic_log(LOG_ERROR, "if语句条件表达式为空");
         return false;
@@ -1317,11 +1325,11 @@ bool IRGenerator::ir_if(ast_node * node)
     }
 
     // 将条件表达式生成的指令添加到当前节点的指令列表中
-    node->blockInsts.addInst(condition->blockInsts);
+    ir(node).blockInsts.addInst(ir(condition).blockInsts);
 
     // 如果条件表达式本身没有生成跳转指令（例如 if(x)），则我们在这里生成
-    if (!node->blockInsts.hasTerminalInst()) {
-        generateBranchOnValue(node, module, condition->val, true_label, end_label);
+    if (!ir(node).blockInsts.hasTerminalInst()) {
+        generateBranchOnValue(ir(node).blockInsts, module, ir(condition).val, true_label, end_label);
     }
 
     // 真出口标签 (IF分支)
@@ -1346,9 +1354,9 @@ bool IRGenerator::ir_if(ast_node * node)
     }
 
     // 组装指令
-    node->blockInsts.addInst(true_label_inst);         // IF分支标签
-    node->blockInsts.addInst(then_stmt->blockInsts);   // IF分支指令
-    node->blockInsts.addInst(end_label_inst);          // 结束标签
+    ir(node).blockInsts.addInst(true_label_inst);         // IF分支标签
+    ir(node).blockInsts.addInst(ir(then_stmt).blockInsts);   // IF分支指令
+    ir(node).blockInsts.addInst(end_label_inst);          // 结束标签
 
     return true;
 }
@@ -1376,13 +1384,13 @@ bool IRGenerator::ir_if_else(ast_node * node)
     }
 
     // 生成唯一标签
-    std::string true_label = generateUniqueLabel(".L");    // IF分支的标签
-    std::string false_label = generateUniqueLabel(".L");   // ELSE分支的标签
-    std::string end_label = generateUniqueLabel(".L");     // 结束标签
+    Symbol true_label = generateUniqueLabel(".L");    // IF分支的标签
+    Symbol false_label = generateUniqueLabel(".L");   // ELSE分支的标签
+    Symbol end_label = generateUniqueLabel(".L");     // 结束标签
 
     // 设置条件表达式的真假出口标签
-    condition_node->true_label = true_label;
-    condition_node->false_label = false_label;
+    ir(condition_node).true_label = true_label;
+    ir(condition_node).false_label = false_label;
 
     // 处理条件表达式
     ast_node * condition = ir_visit_ast_node(condition_node);
@@ -1392,11 +1400,11 @@ bool IRGenerator::ir_if_else(ast_node * node)
     }
 
     // 将条件表达式生成的指令添加到当前节点的指令列表中
-    node->blockInsts.addInst(condition->blockInsts);
+    ir(node).blockInsts.addInst(ir(condition).blockInsts);
 
     // 如果条件表达式本身没有生成跳转指令（例如 if(x)），则我们在这里生成
-    if (!node->blockInsts.hasTerminalInst()) {
-        generateBranchOnValue(node, module, condition->val, true_label, false_label);
+    if (!ir(node).blockInsts.hasTerminalInst()) {
+        generateBranchOnValue(ir(node).blockInsts, module, ir(condition).val, true_label, false_label);
     }
 
     // 真出口标签 (IF分支)
@@ -1442,12 +1450,12 @@ bool IRGenerator::ir_if_else(ast_node * node)
     }
 
     // 组装指令
-    node->blockInsts.addInst(true_label_inst);         // IF分支标签
-    node->blockInsts.addInst(then_stmt->blockInsts);   // IF分支指令
-    node->blockInsts.addInst(goto_end_inst);           // 跳转到结束
-    node->blockInsts.addInst(false_label_inst);        // ELSE分支标签
-    node->blockInsts.addInst(else_stmt->blockInsts);   // ELSE分支指令
-    node->blockInsts.addInst(end_label_inst);          // 结束标签
+    ir(node).blockInsts.addInst(true_label_inst);         // IF分支标签
+    ir(node).blockInsts.addInst(ir(then_stmt).blockInsts);   // IF分支指令
+    ir(node).blockInsts.addInst(goto_end_inst);           // 跳转到结束
+    ir(node).blockInsts.addInst(false_label_inst);        // ELSE分支标签
+    ir(node).blockInsts.addInst(ir(else_stmt).blockInsts);   // ELSE分支指令
+    ir(node).blockInsts.addInst(end_label_inst);          // 结束标签
 
     return true;
 }
@@ -1460,60 +1468,60 @@ bool IRGenerator::ir_and(ast_node * node)
     ast_node * left_node = node->sons[0];
     ast_node * right_node = node->sons[1];
     
-    std::string true_label_final = node->true_label;
-    std::string false_label_final = node->false_label;
+    Symbol true_label_final = ir(node).true_label;
+    Symbol false_label_final = ir(node).false_label;
     bool in_expression_context = false;
 
     // Determine if we are in a control-flow context or expression context.
-    if (true_label_final.empty() || false_label_final.empty()) {
+    if (true_label_final == 0 || false_label_final == 0) {
         in_expression_context = true;
         true_label_final = generateUniqueLabel(".L");
         false_label_final = generateUniqueLabel(".L");
     }
 
-    std::string right_operand_label = generateUniqueLabel(".L_AND_RIGHT");
+    Symbol right_operand_label = generateUniqueLabel(".L_AND_RIGHT");
 
     // --- Process left operand (A in A && B) ---
-    left_node->true_label = right_operand_label; // If true, check B
-    left_node->false_label = false_label_final;  // If false, short-circuit
+    ir(left_node).true_label = right_operand_label; // If true, check B
+    ir(left_node).false_label = false_label_final;  // If false, short-circuit
     ast_node * left = ir_visit_ast_node(left_node);
     if (!left) return false;
     
-    node->blockInsts.addInst(left->blockInsts);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
     // If the visited node hasn't terminated with a branch, add one.
-    if (!left->blockInsts.hasTerminalInst()) {
-        generateBranchOnValue(node, module, left->val, right_operand_label, false_label_final);
+    if (!ir(left).blockInsts.hasTerminalInst()) {
+        generateBranchOnValue(ir(node).blockInsts, module, ir(left).val, right_operand_label, false_label_final);
     }
 
     // --- Process right operand (B in A && B) ---
-    node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), right_operand_label));
+    ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), right_operand_label));
 
-    right_node->true_label = true_label_final;   // If true, the whole expression is true
-    right_node->false_label = false_label_final; // If false, the whole expression is false
+    ir(right_node).true_label = true_label_final;   // If true, the whole expression is true
+    ir(right_node).false_label = false_label_final; // If false, the whole expression is false
     ast_node * right = ir_visit_ast_node(right_node);
     if (!right) return false;
-    node->blockInsts.addInst(right->blockInsts);
-    if (!right->blockInsts.hasTerminalInst()) {
-        generateBranchOnValue(node, module, right->val, true_label_final, false_label_final);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    if (!ir(right).blockInsts.hasTerminalInst()) {
+        generateBranchOnValue(ir(node).blockInsts, module, ir(right).val, true_label_final, false_label_final);
     }
 
     // If we need to produce a 0/1 value for an expression context.
     if (in_expression_context) {
-        std::string end_label = generateUniqueLabel(".L_AND_END");
+        Symbol end_label = generateUniqueLabel(".L_AND_END");
         Value* result_var = module->newVarValue(IntegerType::getTypeInt());
-        node->val = result_var;
+        ir(node).val = result_var;
 
         // True case: land here, set result to 1, and jump to the end.
-        node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), true_label_final));
-        node->blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(1)));
-        node->blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), end_label));
+        ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), true_label_final));
+        ir(node).blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(1)));
+        ir(node).blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), end_label));
 
         // False case: land here, set result to 0.
-        node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), false_label_final));
-        node->blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(0)));
+        ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), false_label_final));
+        ir(node).blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(0)));
         
         // End label for the expression.
-        node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), end_label));
+        ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), end_label));
     }
     
     return true;
@@ -1527,56 +1535,56 @@ bool IRGenerator::ir_or(ast_node * node)
     ast_node * left_node = node->sons[0];
     ast_node * right_node = node->sons[1];
     
-    std::string true_label_final = node->true_label;
-    std::string false_label_final = node->false_label;
+    Symbol true_label_final = ir(node).true_label;
+    Symbol false_label_final = ir(node).false_label;
     bool in_expression_context = false;
 
-    if (true_label_final.empty() || false_label_final.empty()) {
+    if (true_label_final == 0 || false_label_final == 0) {
         in_expression_context = true;
         true_label_final = generateUniqueLabel(".L");
         false_label_final = generateUniqueLabel(".L");
     }
 
-    std::string right_operand_label = generateUniqueLabel(".L_OR_RIGHT");
+    Symbol right_operand_label = generateUniqueLabel(".L_OR_RIGHT");
 
     // --- Process left operand (A in A || B) ---
-    left_node->true_label = true_label_final;   // If true, short-circuit
-    left_node->false_label = right_operand_label; // If false, check B
+    ir(left_node).true_label = true_label_final;   // If true, short-circuit
+    ir(left_node).false_label = right_operand_label; // If false, check B
     ast_node * left = ir_visit_ast_node(left_node);
     if (!left) return false;
-    node->blockInsts.addInst(left->blockInsts);
-    if (!left->blockInsts.hasTerminalInst()) {
-        generateBranchOnValue(node, module, left->val, true_label_final, right_operand_label);
+    ir(node).blockInsts.addInst(ir(left).blockInsts);
+    if (!ir(left).blockInsts.hasTerminalInst()) {
+        generateBranchOnValue(ir(node).blockInsts, module, ir(left).val, true_label_final, right_operand_label);
     }
 
     // --- Process right operand (B in A || B) ---
-    node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), right_operand_label));
+    ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), right_operand_label));
 
-    right_node->true_label = true_label_final;   // If true, the whole expression is true
-    right_node->false_label = false_label_final; // If false, the whole expression is false
+    ir(right_node).true_label = true_label_final;   // If true, the whole expression is true
+    ir(right_node).false_label = false_label_final; // If false, the whole expression is false
     ast_node * right = ir_visit_ast_node(right_node);
     if (!right) return false;
-    node->blockInsts.addInst(right->blockInsts);
-    if (!right->blockInsts.hasTerminalInst()) {
-        generateBranchOnValue(node, module, right->val, true_label_final, false_label_final);
+    ir(node).blockInsts.addInst(ir(right).blockInsts);
+    if (!ir(right).blockInsts.hasTerminalInst()) {
+        generateBranchOnValue(ir(node).blockInsts, module, ir(right).val, true_label_final, false_label_final);
     }
 
     if (in_expression_context) {
-        std::string end_label = generateUniqueLabel(".L_OR_END");
+        Symbol end_label = generateUniqueLabel(".L_OR_END");
         Value* result_var = module->newVarValue(IntegerType::getTypeInt());
-        node->val = result_var;
+        ir(node).val = result_var;
 
         // True case
-        node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), true_label_final));
-        node->blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(1)));
-        node->blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), end_label));
+        ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), true_label_final));
+        ir(node).blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(1)));
+        ir(node).blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), end_label));
 
         // False case
-        node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), false_label_final));
-        node->blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(0)));
+        ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), false_label_final));
+        ir(node).blockInsts.addInst(new MoveInstruction(module->getCurrentFunction(), result_var, module->newConstInt(0)));
         
         // End
-        node->blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), end_label));
+        ir(node).blockInsts.addInst(new LabelInstruction(module->getCurrentFunction(), end_label));
     }
     
     return true;
@@ -1591,10 +1599,10 @@ bool IRGenerator::ir_not(ast_node * node)
     ast_node * operand_node = node->sons[0];
 
     // 如果父节点设置了真假出口标签，需要交换传递给子节点
-    if (!node->true_label.empty() && !node->false_label.empty()) {
+    if (ir(node).true_label != 0 && ir(node).false_label != 0) {
         // 逻辑非运算会将真假出口互换
-        operand_node->true_label = node->false_label;
-        operand_node->false_label = node->true_label;
+        ir(operand_node).true_label = ir(node).false_label;
+        ir(operand_node).false_label = ir(node).true_label;
         
         // 处理操作数
         ast_node * operand = ir_visit_ast_node(operand_node);
@@ -1604,8 +1612,8 @@ bool IRGenerator::ir_not(ast_node * node)
         }
         
         // 直接使用操作数的指令
-        node->blockInsts.addInst(operand->blockInsts);
-        node->val = operand->val;
+        ir(node).blockInsts.addInst(ir(operand).blockInsts);
+        ir(node).val = ir(operand).val;
         
         return true;
     }
@@ -1618,7 +1626,7 @@ bool IRGenerator::ir_not(ast_node * node)
     }
 
     // 如果操作数是指针类型，需要先解引用
-    Value* operandVal = dereferenceIfPointer(node, operand->val);
+    Value* operandVal = dereferenceIfPointer(node, ir(operand).val);
 
     // 创建常量0
     ConstInt * zero = new ConstInt(0);
@@ -1631,19 +1639,19 @@ bool IRGenerator::ir_not(ast_node * node)
                                                      IntegerType::getTypeBool());
 
     // 创建临时变量保存IR的值，以及线性IR指令
-    node->blockInsts.addInst(operand->blockInsts);
-    node->blockInsts.addInst(cmpInst);
+    ir(node).blockInsts.addInst(ir(operand).blockInsts);
+    ir(node).blockInsts.addInst(cmpInst);
 
-    node->val = cmpInst;
+    ir(node).val = cmpInst;
 
     // 如果设置了真假出口标签，则生成条件跳转指令
-    if (!node->true_label.empty() && !node->false_label.empty()) {
+    if (ir(node).true_label != 0 && ir(node).false_label != 0) {
         // 创建条件分支指令
         BranchInstruction * branchInst = new BranchInstruction(module->getCurrentFunction(),
                                                               cmpInst,
-                                                              node->true_label,
-                                                              node->false_label);
-        node->blockInsts.addInst(branchInst);
+                                                              ir(node).true_label,
+                                                              ir(node).false_label);
+        ir(node).blockInsts.addInst(branchInst);
     }
 
     return true;
@@ -1665,18 +1673,18 @@ bool IRGenerator::ir_while(ast_node * node)
     ast_node * body_node = node->sons[1];
 
     // 生成唯一的循环标签
-    std::string loop_start_label = generateUniqueLabel(".L"); // This is the label for condition check
-    std::string loop_body_label = generateUniqueLabel(".L");  // This is where body starts if condition true
-    std::string loop_end_label = generateUniqueLabel(".L");   // This is where loop exits if condition false
+    Symbol loop_start_label = generateUniqueLabel(".L"); // This is the label for condition check
+    Symbol loop_body_label = generateUniqueLabel(".L");  // This is where body starts if condition true
+    Symbol loop_end_label = generateUniqueLabel(".L");   // This is where loop exits if condition false
 
     // Store the actual IR labels on the AST_OP_WHILE node for break/continue
-    node->loop_start_label = loop_start_label; // For continue: jump to condition check
-    node->loop_end_label = loop_end_label;     // For break: jump to loop exit
+    ir(node).loop_start_label = loop_start_label; // For continue: jump to condition check
+    ir(node).loop_end_label = loop_end_label;     // For break: jump to loop exit
 
     // 设置条件表达式的真假出口标签，以便条件表达式内部的跳转指令使用它们
     if (condition_node) {
-        condition_node->true_label = loop_body_label;  // 条件为真，跳转到循环体
-        condition_node->false_label = loop_end_label; // 条件为假，跳转到循环结束
+        ir(condition_node).true_label = loop_body_label;  // 条件为真，跳转到循环体
+        ir(condition_node).false_label = loop_end_label; // 条件为假，跳转到循环结束
     } else {
         minic_log(LOG_ERROR, "while语句条件表达式为空");
         return false;
@@ -1696,12 +1704,15 @@ bool IRGenerator::ir_while(ast_node * node)
         return false;
     }
 
+    // 循环开始标签在条件表达式之前，回边跳转到这里重新计算条件
+    ir(node).blockInsts.addInst(loop_start_inst);
+
     // 将条件表达式生成的指令添加到当前节点的指令列表中
-    node->blockInsts.addInst(condition->blockInsts);
+    ir(node).blockInsts.addInst(ir(condition).blockInsts);
 
     // 如果条件表达式本身没有生成跳转指令（例如 while(x)），则我们在这里生成
-    if (!node->blockInsts.hasTerminalInst()) {
-        generateBranchOnValue(node, module, condition->val, loop_body_label, loop_end_label);
+    if (!ir(node).blockInsts.hasTerminalInst()) {
+        generateBranchOnValue(ir(node).blockInsts, module, ir(condition).val, loop_body_label, loop_end_label);
     }
 
     // 循环体标签指令
@@ -1726,11 +1737,10 @@ bool IRGenerator::ir_while(ast_node * node)
     }
 
     // 组装指令
-    node->blockInsts.addInst(loop_start_inst);
-    node->blockInsts.addInst(loop_body_inst);          // 循环体标签
-    node->blockInsts.addInst(body->blockInsts);        // 循环体指令
-    node->blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), loop_start_label)); // 循环体执行完后跳转到循环开始
-    node->blockInsts.addInst(loop_end_inst);            // 循环结
+    ir(node).blockInsts.addInst(loop_body_inst);          // 循环体标签
+    ir(node).blockInsts.addInst(ir(body).blockInsts);        // 循环体指令
+    ir(node).blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), loop_start_label)); // 循环体执行完后跳转到循环开始
+    ir(node).blockInsts.addInst(loop_end_inst);            // 循环结
 
     return true;
 }
@@ -1753,7 +1763,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
         return false;
     }
     
-    std::string arrayName = arrayNode->name;
+    std::string arrayName(arrayNode->getName());
     Value* arrayVar = module->findVarValue(arrayName);
     if (!arrayVar) {
         minic_log(LOG_ERROR, "未定义的数组变量: %s", arrayName.c_str());
@@ -1818,13 +1828,13 @@ bool IRGenerator::ir_array_access(ast_node * node)
                     return false;
                 }
                 
-                Value* indexVal = indexNode->val;
+                Value* indexVal = ir(indexNode).val;
                 if (!indexVal) {
                     minic_log(LOG_ERROR, "无效的数组索引");
                     return false;
                 }
                 
-                node->blockInsts.addInst(indexNode->blockInsts);
+                ir(node).blockInsts.addInst(ir(indexNode).blockInsts);
                 
                 // 计算当前维度的乘数（后续所有维度的大小的乘积）
                 int32_t multiplier = 1;
@@ -1846,7 +1856,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                         multiplierVal,
                         IntegerType::getTypeInt()
                     );
-                    node->blockInsts.addInst(mulInst);
+                    ir(node).blockInsts.addInst(mulInst);
                     currentOffset = mulInst;
                 }
                 
@@ -1861,7 +1871,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                         currentOffset,
                         IntegerType::getTypeInt()
                     );
-                    node->blockInsts.addInst(addInst);
+                    ir(node).blockInsts.addInst(addInst);
                     totalOffset = addInst;
                 }
             }
@@ -1875,7 +1885,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 elementSize,
                 IntegerType::getTypeInt()
             );
-            node->blockInsts.addInst(offsetMulInst);
+            ir(node).blockInsts.addInst(offsetMulInst);
             
             BinaryInstruction* finalAddrInst = new BinaryInstruction(
                 module->getCurrentFunction(),
@@ -1884,7 +1894,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 offsetMulInst,
                 const_cast<PointerType*>(PointerType::get(baseElementType))
             );
-            node->blockInsts.addInst(finalAddrInst);
+            ir(node).blockInsts.addInst(finalAddrInst);
             
             // 检查是否需要解引用
             bool needDereference = true;
@@ -1898,12 +1908,12 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 // 用于表达式中的读取，需要解引用
                 Value* tempVar = module->newVarValue(baseElementType);
                 MoveInstruction* loadInst = new MoveInstruction(module->getCurrentFunction(), tempVar, finalAddrInst);
-                node->blockInsts.addInst(loadInst);
-                node->val = tempVar;
+                ir(node).blockInsts.addInst(loadInst);
+                ir(node).val = tempVar;
                 node->type = baseElementType;
             } else {
                 // 用于赋值的左值，返回地址
-                node->val = finalAddrInst;
+                ir(node).val = finalAddrInst;
                 node->type = const_cast<PointerType*>(PointerType::get(baseElementType));
             }
         } else {
@@ -1915,13 +1925,13 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 return false;
             }
             
-            Value* firstIndexVal = firstIndexNode->val;
+            Value* firstIndexVal = ir(firstIndexNode).val;
             if (!firstIndexVal) {
                 minic_log(LOG_ERROR, "无效的数组索引");
                 return false;
             }
             
-            node->blockInsts.addInst(firstIndexNode->blockInsts);
+            ir(node).blockInsts.addInst(ir(firstIndexNode).blockInsts);
             
             // 计算最终地址：baseAddr + index * sizeof(element)
             Value* elementSize = module->newConstInt(4); // 假设int为4字节
@@ -1932,7 +1942,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 elementSize,
                 IntegerType::getTypeInt()
             );
-            node->blockInsts.addInst(offsetMulInst);
+            ir(node).blockInsts.addInst(offsetMulInst);
             
             BinaryInstruction* finalAddrInst = new BinaryInstruction(
                 module->getCurrentFunction(),
@@ -1941,7 +1951,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 offsetMulInst,
                 const_cast<PointerType*>(PointerType::get(baseElementType))
             );
-            node->blockInsts.addInst(finalAddrInst);
+            ir(node).blockInsts.addInst(finalAddrInst);
             
             // 检查是否需要解引用
             bool needDereference = true;
@@ -1955,12 +1965,12 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 // 用于表达式中的读取，需要解引用
                 Value* tempVar = module->newVarValue(baseElementType);
                 MoveInstruction* loadInst = new MoveInstruction(module->getCurrentFunction(), tempVar, finalAddrInst);
-                node->blockInsts.addInst(loadInst);
-                node->val = tempVar;
+                ir(node).blockInsts.addInst(loadInst);
+                ir(node).val = tempVar;
                 node->type = baseElementType;
             } else {
                 // 用于赋值的左值，返回地址
-                node->val = finalAddrInst;
+                ir(node).val = finalAddrInst;
                 node->type = const_cast<PointerType*>(PointerType::get(baseElementType));
             }
         }
@@ -1989,7 +1999,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 return false;
             }
             
-            Value* indexVal = indexNode->val;
+            Value* indexVal = ir(indexNode).val;
             if (!indexVal) {
                 minic_log(LOG_ERROR, "无效的数组索引");
                 return false;
@@ -2012,8 +2022,8 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 dimSizeVal,
                 IntegerType::getTypeInt()
             );
-            node->blockInsts.addInst(indexNode->blockInsts);
-            node->blockInsts.addInst(mulInst);
+            ir(node).blockInsts.addInst(ir(indexNode).blockInsts);
+            ir(node).blockInsts.addInst(mulInst);
             
             // 累加偏移量
             if (offset == nullptr) {
@@ -2026,7 +2036,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                     mulInst,
                     IntegerType::getTypeInt()
                 );
-                node->blockInsts.addInst(addInst);
+                ir(node).blockInsts.addInst(addInst);
                 offset = addInst;
             }
         }
@@ -2040,7 +2050,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
             elementSize,
             IntegerType::getTypeInt()
         );
-        node->blockInsts.addInst(offsetMulInst);
+        ir(node).blockInsts.addInst(offsetMulInst);
         
         BinaryInstruction* finalAddrInst = new BinaryInstruction(
             module->getCurrentFunction(),
@@ -2049,7 +2059,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
             offsetMulInst,
             const_cast<PointerType*>(PointerType::get(arrayType->getElementType()))
         );
-        node->blockInsts.addInst(finalAddrInst);
+        ir(node).blockInsts.addInst(finalAddrInst);
         
         // 确定结果类型：如果是完全索引，返回元素类型；否则返回降维后的数组类型
         Type* resultType;
@@ -2083,17 +2093,17 @@ bool IRGenerator::ir_array_access(ast_node * node)
             // 完全索引且用于表达式中的读取，需要解引用
             Value* tempVar = module->newVarValue(resultType);
             MoveInstruction* loadInst = new MoveInstruction(module->getCurrentFunction(), tempVar, finalAddrInst);
-            node->blockInsts.addInst(loadInst);
-            node->val = tempVar;
+            ir(node).blockInsts.addInst(loadInst);
+            ir(node).val = tempVar;
             node->type = resultType;
         } else {
             // 用于赋值的左值、数组降维访问或函数参数，返回地址
             if (indexCount < dimensions.size() || isUsedAsFunctionParam) {
                 // 数组降维访问或函数参数，直接返回地址，不解引用
-                node->val = finalAddrInst;
+                ir(node).val = finalAddrInst;
                 node->type = resultType;
             } else {
-                node->val = finalAddrInst;
+                ir(node).val = finalAddrInst;
                 node->type = const_cast<PointerType*>(PointerType::get(resultType));
             }
         }
@@ -2131,13 +2141,13 @@ bool IRGenerator::ir_array_access(ast_node * node)
                     return false;
                 }
                 
-                Value* indexVal = indexNode->val;
+                Value* indexVal = ir(indexNode).val;
                 if (!indexVal) {
                     minic_log(LOG_ERROR, "无效的数组索引");
                     return false;
                 }
                 
-                node->blockInsts.addInst(indexNode->blockInsts);
+                ir(node).blockInsts.addInst(ir(indexNode).blockInsts);
                 
                 // 计算当前维度的乘数（后续所有维度的大小的乘积）
                 int32_t multiplier = 1;
@@ -2159,7 +2169,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                         multiplierVal,
                         IntegerType::getTypeInt()
                     );
-                    node->blockInsts.addInst(mulInst);
+                    ir(node).blockInsts.addInst(mulInst);
                     currentOffset = mulInst;
                 }
                 
@@ -2174,7 +2184,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                         currentOffset,
                         IntegerType::getTypeInt()
                     );
-                    node->blockInsts.addInst(addInst);
+                    ir(node).blockInsts.addInst(addInst);
                     totalOffset = addInst;
                 }
             }
@@ -2188,7 +2198,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 elementSize,
                 IntegerType::getTypeInt()
             );
-            node->blockInsts.addInst(offsetMulInst);
+            ir(node).blockInsts.addInst(offsetMulInst);
             
             BinaryInstruction* finalAddrInst = new BinaryInstruction(
                 module->getCurrentFunction(),
@@ -2197,7 +2207,7 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 offsetMulInst,
                 const_cast<PointerType*>(PointerType::get(baseElementType))
             );
-            node->blockInsts.addInst(finalAddrInst);
+            ir(node).blockInsts.addInst(finalAddrInst);
             
             // 检查是否需要解引用
             bool needDereference = true;
@@ -2211,12 +2221,12 @@ bool IRGenerator::ir_array_access(ast_node * node)
                 // 用于表达式中的读取，需要解引用
                 Value* tempVar = module->newVarValue(baseElementType);
                 MoveInstruction* loadInst = new MoveInstruction(module->getCurrentFunction(), tempVar, finalAddrInst);
-                node->blockInsts.addInst(loadInst);
-                node->val = tempVar;
+                ir(node).blockInsts.addInst(loadInst);
+                ir(node).val = tempVar;
                 node->type = baseElementType;
             } else {
                 // 用于赋值的左值，返回地址
-                node->val = finalAddrInst;
+                ir(node).val = finalAddrInst;
                 node->type = const_cast<PointerType*>(PointerType::get(baseElementType));
             }
         } else {
@@ -2286,7 +2296,7 @@ bool IRGenerator::ir_array_def(ast_node * node)
             return false;
         }
         
-        Instanceof(constInt, ConstInt *, son->val);
+        Instanceof(constInt, ConstInt *, ir(son).val);
         if (!constInt) {
             minic_log(LOG_ERROR, "数组维度必须是常量");
             return false;
@@ -2334,7 +2344,7 @@ bool IRGenerator::ir_func_formal_param_array(ast_node * node)
     }
     
     // 获取参数名（不需要处理名称节点，直接获取名称）
-    std::string paramName = nameNode->name;
+    std::string paramName(nameNode->getName());
     
     // 处理维度节点 - 获取各个维度的大小
     if (!ir_visit_ast_node(dimNode)) {
@@ -2352,7 +2362,7 @@ bool IRGenerator::ir_func_formal_param_array(ast_node * node)
         // 其他维度必须指定大小
         if (dimSizeNode->node_type == ast_operator_type::AST_OP_LEAF_LITERAL_UINT) {
             // 有具体大小
-            Instanceof(constInt, ConstInt *, dimSizeNode->val);
+            Instanceof(constInt, ConstInt *, ir(dimSizeNode).val);
             if (!constInt) {
                 minic_log(LOG_ERROR, "数组形参维度必须是常量");
                 return false;
@@ -2401,7 +2411,7 @@ bool IRGenerator::ir_func_formal_param_array(ast_node * node)
     }
     
     // 将赋值指令添加到节点的指令列表中
-    node->blockInsts.addInst(moveInst);
+    ir(node).blockInsts.addInst(moveInst);
     
     // 确认变量确实添加到了作用域中
     Value* testVar = module->findVarValue(paramName);
@@ -2418,9 +2428,9 @@ bool IRGenerator::ir_func_formal_param_array(ast_node * node)
 /// @return 翻译是否成功，true：成功，false：失败
 bool IRGenerator::ir_break(ast_node * node)
 {
-    std::string loop_start_label_found, loop_end_label_found;
-    if (find_enclosing_loop_labels(node, loop_start_label_found, loop_end_label_found)) {
-        node->blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), loop_end_label_found));
+    Symbol loop_start_label_found = 0, loop_end_label_found = 0;
+    if (find_enclosing_loop_labels(irStates.get(), node, loop_start_label_found, loop_end_label_found)) {
+        ir(node).blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), loop_end_label_found));
         return true;
     } else {
         long long line = node->line_no > 0 ? node->line_no : 0;
@@ -2434,9 +2444,9 @@ bool IRGenerator::ir_break(ast_node * node)
 /// @return 翻译是否成功，true：成功，false：失败
 bool IRGenerator::ir_continue(ast_node * node)
 {
-    std::string loop_start_label_found, loop_end_label_found;
-    if (find_enclosing_loop_labels(node, loop_start_label_found, loop_end_label_found)) {
-        node->blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), loop_start_label_found));
+    Symbol loop_start_label_found = 0, loop_end_label_found = 0;
+    if (find_enclosing_loop_labels(irStates.get(), node, loop_start_label_found, loop_end_label_found)) {
+        ir(node).blockInsts.addInst(new GotoInstruction(module->getCurrentFunction(), loop_start_label_found));
         return true;
     } else {
         long long line = node->line_no > 0 ? node->line_no : 0;
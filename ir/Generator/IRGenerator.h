@@ -2,8 +2,8 @@
 /// @file IRGenerator.h
 /// @brief AST遍历产生线性IR的头文件
 /// @author zenglj (zenglj@live.com)
-/// @version 1.1
-/// @date 2024-11-23
+/// @version 1.2
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,14 +12,41 @@
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
 /// <tr><td>2024-11-23 <td>1.1     <td>zenglj  <td>表达式版增强
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>AST节点的IR临时状态改为按节点编号的旁路表
 /// </table>
 ///
 #pragma once
 
+#include <memory>
 #include <unordered_map>
 
 #include "AST.h"
+#include "IRCode.h"
 #include "Module.h"
+#include "StringInterner.h"
+
+///
+/// @brief AST节点在产生IR过程中的临时状态，只在IRGenerator::run期间存在
+///
+struct ast_ir_state {
+    /// @brief 线性IR指令块，可包含多条IR指令
+    InterCode blockInsts;
+
+    /// @brief 线性IR指令或者运行产生的Value
+    Value * val = nullptr;
+
+    /// @brief 关系表达式的真出口标签
+    Symbol true_label = 0;
+
+    /// @brief 关系表达式的假出口标签
+    Symbol false_label = 0;
+
+    /// @brief 循环开始标签，用于continue跳转
+    Symbol loop_start_label = 0;
+
+    /// @brief 循环结束标签，用于break跳转
+    Symbol loop_end_label = 0;
+};
 
 /// @brief AST遍历产生线性IR类
 class IRGenerator {
@@ -186,8 +213,8 @@ protected:
 
     /// @brief 生成唯一的标签名
     /// @param prefix 标签前缀
-    /// @return 生成的标签名
-    std::string generateUniqueLabel(const std::string& prefix);
+    /// @return 生成的标签名，已驻留
+    Symbol generateUniqueLabel(const std::string& prefix);
 
     /// @brief 标签计数器，用于生成唯一标签
     int label_counter = 0;
@@ -259,9 +286,20 @@ private:
     /// @return 解引用后的值或原值
     Value* dereferenceIfPointer(ast_node* node, Value* val);
 
+    /// @brief 获取AST节点在产生IR过程中的临时状态
+    /// @param node AST节点
+    /// @return 临时状态
+    ast_ir_state & ir(ast_node * node)
+    {
+        return irStates[node->id];
+    }
+
     /// @brief 抽象语法树的根
     ast_node * root;
 
+    /// @brief 按节点编号存放的IR临时状态，run结束时释放
+    std::unique_ptr<ast_ir_state[]> irStates;
+
     /// @brief 符号表:模块
     Module * module;
 };
@@ -187,12 +187,21 @@ public:
     /// @param _regId 基址寄存器编号
     /// @param _offset 偏移
     ///
-    void setMemoryAddr(int32_t _regId, int64_t _offset)
+    void setMemoryAddr(int32_t _regId, int64_t _offset) override
     {
         baseRegNo = _regId;
         offset = _offset;
     }
 
+    ///
+    /// @brief 设置寄存器编号
+    /// @param _regId 寄存器编号
+    ///
+    void setRegId(int32_t _regId) override
+    {
+        this->regId = _regId;
+    }
+
     ///
     /// @brief 对该Value进行Load用的寄存器编号
     /// @return int32_t 寄存器编号
@@ -3,8 +3,8 @@
 /// @brief 条件分支指令
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-25
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-25 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>标签名改为驻留编号
 /// </table>
 ///
 #include "BranchInstruction.h"
@@ -24,8 +25,8 @@
 /// @param _false_label 假出口标签
 BranchInstruction::BranchInstruction(Function * _func, 
                                     Value * _condition, 
-                                    std::string _true_label, 
-                                    std::string _false_label)
+                                    Symbol _true_label, 
+                                    Symbol _false_label)
     : Instruction(_func, IRInstOperator::IRINST_OP_BC, VoidType::getType()),
       true_label(_true_label),
       false_label(_false_label)
@@ -40,5 +41,8 @@ void BranchInstruction::toString(std::string & str)
     Value *condition = getOperand(0);
 
     // 条件分支指令
-    str = "bc " + condition->getIRName() + ", label " + true_label + ", label " + false_label;
+    str = "bc " + condition->getIRName() + ", label ";
+    str += getTrueLabelName();
+    str += ", label ";
+    str += getFalseLabelName();
 } 
\ No newline at end of file
@@ -3,8 +3,8 @@
 /// @brief 条件分支指令
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-11-25
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,11 +12,15 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-11-25 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>标签名改为驻留编号
 /// </table>
 ///
 #pragma once
 
+#include <string_view>
+
 #include "Instruction.h"
+#include "StringInterner.h"
 
 ///
 /// @brief 条件分支指令
@@ -29,23 +33,31 @@ public:
     /// @param _condition 条件值
     /// @param _true_label 真出口标签
     /// @param _false_label 假出口标签
-    BranchInstruction(Function * _func, Value * _condition, std::string _true_label, std::string _false_label);
+    BranchInstruction(Function * _func, Value * _condition, Symbol _true_label, Symbol _false_label);
 
     /// @brief 转换成字符串
     void toString(std::string & str) override;
 
     /// @brief 获取真出口标签
-    /// @return 真出口标签
-    std::string getTrueLabel() const { return true_label; }
+    /// @return 真出口标签的驻留编号
+    Symbol getTrueLabel() const { return true_label; }
 
     /// @brief 获取假出口标签
+    /// @return 假出口标签的驻留编号
+    Symbol getFalseLabel() const { return false_label; }
+
+    /// @brief 获取真出口标签的名称
+    /// @return 真出口标签
+    std::string_view getTrueLabelName() const { return symbolName(true_label); }
+
+    /// @brief 获取假出口标签的名称
     /// @return 假出口标签
-    std::string getFalseLabel() const { return false_label; }
+    std::string_view getFalseLabelName() const { return symbolName(false_label); }
 
 private:
     /// @brief 真出口标签
-    std::string true_label;
+    Symbol true_label;
 
     /// @brief 假出口标签
-    std::string false_label;
+    Symbol false_label;
 }; 
\ No newline at end of file
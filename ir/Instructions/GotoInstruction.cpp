@@ -3,8 +3,8 @@
 /// @brief 无条件跳转指令即goto指令
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>标签名改为驻留编号
 /// </table>
 ///
 
@@ -33,11 +34,10 @@ GotoInstruction::GotoInstruction(Function * _func, Instruction * _target)
 ///
 /// @brief 无条件跳转指令的构造函数，使用标签名称
 /// @param _func 所属函数
-/// @param _label_name 目标标签名称
+/// @param _label 目标标签名称，驻留编号
 ///
-GotoInstruction::GotoInstruction(Function * _func, std::string _label_name)
-    : Instruction(_func, IRInstOperator::IRINST_OP_GOTO, VoidType::getType()),
-      label_name(_label_name)
+GotoInstruction::GotoInstruction(Function * _func, Symbol _label)
+    : Instruction(_func, IRInstOperator::IRINST_OP_GOTO, VoidType::getType()), label(_label)
 {
 }
 
@@ -46,8 +46,9 @@ void GotoInstruction::toString(std::string & str)
 {
     if (target) {
         str = "br label " + target->getIRName();
-    } else if (!label_name.empty()) {
-        str = "br label " + label_name;
+    } else if (label != 0) {
+        str = "br label ";
+        str += getLabelName();
     } else {
         str = "br <unknown>";
     }
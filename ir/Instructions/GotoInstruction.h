@@ -3,8 +3,8 @@
 /// @brief 无条件跳转指令即goto指令
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,11 +12,13 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>标签名改为驻留编号
 /// </table>
 ///
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "Instruction.h"
 #include "LabelInstruction.h"
@@ -37,9 +39,9 @@ public:
     ///
     /// @brief 无条件跳转指令的构造函数，使用标签名称
     /// @param _func 所属函数
-    /// @param _label_name 目标标签名称
+    /// @param _label 目标标签名称，驻留编号
     ///
-    GotoInstruction(Function * _func, std::string _label_name);
+    GotoInstruction(Function * _func, Symbol _label);
 
     /// @brief 转换成字符串
     void toString(std::string & str) override;
@@ -50,6 +52,24 @@ public:
     ///
     [[nodiscard]] LabelInstruction * getTarget() const;
 
+    ///
+    /// @brief 获取目标标签名称的驻留编号，只有按标签名称构造时才非0
+    /// @return Symbol 标签名称
+    ///
+    [[nodiscard]] Symbol getLabel() const
+    {
+        return label;
+    }
+
+    ///
+    /// @brief 获取目标标签名称，只有按标签名称构造时才非空
+    /// @return std::string_view 标签名称
+    ///
+    [[nodiscard]] std::string_view getLabelName() const
+    {
+        return symbolName(label);
+    }
+
 private:
     ///
     /// @brief 跳转到的目标Label指令
@@ -59,5 +79,5 @@ private:
     ///
     /// @brief 目标标签名称
     ///
-    std::string label_name;
+    Symbol label = 0;
 };
@@ -2,8 +2,8 @@
 /// @file LabelInstruction.cpp
 /// @brief Label指令
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>标签名改为驻留编号
 /// </table>
 ///
 #include "VoidType.h"
@@ -28,19 +29,19 @@ LabelInstruction::LabelInstruction(Function * _func)
 ///
 /// @brief 带标签名的构造函数
 /// @param _func 所属函数
-/// @param _label_name 标签名称
+/// @param _label 标签名称，驻留编号
 ///
-LabelInstruction::LabelInstruction(Function * _func, std::string _label_name)
-    : Instruction(_func, IRInstOperator::IRINST_OP_LABEL, VoidType::getType()),
-      label_name(_label_name)
+LabelInstruction::LabelInstruction(Function * _func, Symbol _label)
+    : Instruction(_func, IRInstOperator::IRINST_OP_LABEL, VoidType::getType()), label(_label)
 {}
 
 /// @brief 转换成字符串
 /// @param str 返回指令字符串
 void LabelInstruction::toString(std::string & str)
 {
-    if (!label_name.empty()) {
-        str = label_name + ":";
+    if (label != 0) {
+        str.assign(getLabelName());
+        str += ":";
     } else {
         str = IRName + ":";
     }
@@ -3,8 +3,8 @@
 /// @brief Label指令
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,13 +12,16 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>标签名改为驻留编号
 /// </table>
 ///
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "Instruction.h"
+#include "StringInterner.h"
 
 class Function;
 
@@ -37,9 +40,9 @@ public:
     ///
     /// @brief 带标签名的构造函数
     /// @param _func 所属函数
-    /// @param _label_name 标签名称
+    /// @param _label 标签名称，驻留编号
     ///
-    LabelInstruction(Function * _func, std::string _label_name);
+    LabelInstruction(Function * _func, Symbol _label);
 
     ///
     /// @brief 转换成字符串
@@ -47,9 +50,27 @@ public:
     ///
     void toString(std::string & str) override;
 
+    ///
+    /// @brief 获取标签名称的驻留编号，没有指定名称时为0
+    /// @return Symbol 标签名称
+    ///
+    [[nodiscard]] Symbol getLabel() const
+    {
+        return label;
+    }
+
+    ///
+    /// @brief 获取标签名称，没有指定名称时为空串
+    /// @return std::string_view 标签名称
+    ///
+    [[nodiscard]] std::string_view getLabelName() const
+    {
+        return symbolName(label);
+    }
+
 private:
     ///
-    /// @brief 标签名称
+    /// @brief 标签名称，驻留编号
     ///
-    std::string label_name;
+    Symbol label = 0;
 };
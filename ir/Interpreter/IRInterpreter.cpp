@@ -0,0 +1,1049 @@
+///
+/// @file IRInterpreter.cpp
+/// @brief DragonIR的解释执行器，直接执行内存中的Module
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "Common.h"
+#include "IRInterpreter.h"
+
+#include "ArrayType.h"
+#include "ConstInt.h"
+#include "GlobalVariable.h"
+
+#include "BranchInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+
+/// @brief 开头保留的内存字节数，使空指针及其附近的地址无效
+#define MEM_RESERVED 16
+
+/// @brief 内存的上限，含全局变量与栈
+#define MEM_LIMIT (256u * 1024 * 1024)
+
+/// @brief 调用栈的最大深度
+#define MAX_CALL_DEPTH 1000000
+
+/// @brief 值是否为数组形参或其对应的局部变量，保存的是数组的地址
+/// @param type 值的类型
+/// @return true：是地址
+static bool isPointerValue(Type * type)
+{
+    if (type->isPointerType() || type->isArrayParameterType()) {
+        return true;
+    }
+
+    // 数组形参对应的局部变量，其第一维为0
+    Instanceof(arrayType, ArrayType *, type);
+
+    return arrayType && (arrayType->getDimensionCount() > 0) && (arrayType->getDimensionSize(0) == 0);
+}
+
+/// @brief 值是否是数组本身，其值为数组的首地址
+/// @param type 值的类型
+/// @return true：是数组
+static bool isArrayStorage(Type * type)
+{
+    return type->isArrayType() && !isPointerValue(type);
+}
+
+/// @brief 构造函数
+/// @param _module 要执行的模块
+IRInterpreter::IRInterpreter(Module * _module) : module(_module)
+{}
+
+/// @brief 执行main函数
+/// @param exitCode main函数的返回值
+/// @return true：成功，false：预处理或运行出错
+bool IRInterpreter::run(int & exitCode)
+{
+    allocGlobals();
+
+    // 先给所有函数编号，调用点预处理时需要
+    for (auto func: module->getFunctionList()) {
+        if (!func->isBuiltin()) {
+            funcIndex[func] = (int32_t) funcs.size();
+            funcs.emplace_back();
+        }
+    }
+
+    for (auto & [func, index]: funcIndex) {
+        if (!prepare(func, funcs[index])) {
+            return false;
+        }
+    }
+
+    Function * mainFunc = module->findFunction("main");
+    if (!mainFunc || mainFunc->isBuiltin()) {
+        minic_log(LOG_ERROR, "没有找到main函数");
+        return false;
+    }
+
+    bool result = execute(funcIndex[mainFunc], exitCode);
+
+    fflush(stdout);
+
+    return result;
+}
+
+/// @brief 全局变量分配内存并设置初值
+void IRInterpreter::allocGlobals()
+{
+    memTop = MEM_RESERVED;
+
+    for (auto var: module->getGlobalVariables()) {
+
+        int32_t align = var->getAlignment() > 0 ? var->getAlignment() : 4;
+        memTop = (memTop + align - 1) & ~(uint32_t) (align - 1);
+
+        globalAddr[var] = memTop;
+        memTop += (uint32_t) var->getType()->getSize();
+    }
+
+    memory.assign(memTop, 0);
+
+    // 与汇编的数据段一样，只有标量有初值
+    for (auto var: module->getGlobalVariables()) {
+        if (Instanceof(constVal, ConstInt *, var->getInitializer())) {
+            writeWord(globalAddr[var], constVal->getVal());
+        }
+    }
+}
+
+/// @brief 函数预处理，操作数换成槽位下标，标签换成指令下标
+/// @param func 函数
+/// @param prepared 预处理的结果
+/// @return true：成功，false：有不支持的指令
+bool IRInterpreter::prepare(Function * func, PreparedFunction & prepared)
+{
+    prepared.func = func;
+
+    std::unordered_map<Value *, int32_t> slotIndex;
+    std::unordered_map<int64_t, int32_t> constIndex;
+
+    auto newSlot = [&prepared](int64_t init) {
+        prepared.slotInit.push_back(init);
+        return prepared.slotNum++;
+    };
+
+    // 形参依次占用开头的槽位，调用时实参直接拷贝过来
+    for (auto param: func->getParams()) {
+        slotIndex[param] = newSlot(0);
+    }
+
+    for (auto var: func->getVarValues()) {
+        slotIndex[var] = newSlot(0);
+        if (isArrayStorage(var->getType())) {
+            prepared.arrays.emplace_back(slotIndex[var], (uint32_t) var->getType()->getSize());
+        }
+    }
+
+    auto constSlot = [&](int64_t val) {
+        auto pIter = constIndex.find(val);
+        if (pIter != constIndex.end()) {
+            return pIter->second;
+        }
+        int32_t slot = newSlot(val);
+        constIndex[val] = slot;
+        return slot;
+    };
+
+    auto & codes = prepared.codes;
+
+    // 操作数换成槽位下标。全局标量在内存中，先读到临时槽位中
+    auto use = [&](Value * val) -> int32_t {
+        if (Instanceof(constVal, ConstInt *, val)) {
+            return constSlot(constVal->getVal());
+        }
+
+        auto gIter = globalAddr.find(val);
+        if (gIter != globalAddr.end()) {
+            if (isArrayStorage(val->getType())) {
+                return constSlot(gIter->second);
+            }
+            int32_t tmp = newSlot(0);
+            codes.push_back({Op::LOADG, tmp, (int32_t) gIter->second, 0});
+            return tmp;
+        }
+
+        auto pIter = slotIndex.find(val);
+        if (pIter != slotIndex.end()) {
+            return pIter->second;
+        }
+
+        int32_t slot = newSlot(0);
+        slotIndex[val] = slot;
+        return slot;
+    };
+
+    // 结果的槽位。全局标量先写到临时槽位，再由STOREG写回内存
+    int32_t pendingStore = -1;
+    int32_t pendingSlot = -1;
+    auto def = [&](Value * val) -> int32_t {
+        auto gIter = globalAddr.find(val);
+        if (gIter != globalAddr.end()) {
+            pendingStore = (int32_t) gIter->second;
+            pendingSlot = newSlot(0);
+            return pendingSlot;
+        }
+        return use(val);
+    };
+
+    std::unordered_map<Symbol, int32_t> labelByName;
+    std::unordered_map<Instruction *, int32_t> labelByInst;
+
+    // 跳转目标待回填：指令下标、是否为假出口、目标标签
+    struct Fixup {
+        size_t code;
+        bool second;
+        Symbol name;
+        Instruction * target;
+    };
+    std::vector<Fixup> fixups;
+
+    for (auto inst: func->getInterCode().getInsts()) {
+
+        if (inst->isDead()) {
+            continue;
+        }
+
+        pendingStore = -1;
+
+        switch (inst->getOp()) {
+            case IRInstOperator::IRINST_OP_ENTRY:
+            case IRInstOperator::IRINST_OP_ARG:
+                break;
+
+            case IRInstOperator::IRINST_OP_LABEL: {
+                Instanceof(labelInst, LabelInstruction *, inst);
+                labelByInst[inst] = (int32_t) codes.size();
+                if (labelInst->getLabel() != 0) {
+                    labelByName[labelInst->getLabel()] = (int32_t) codes.size();
+                }
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_GOTO: {
+                Instanceof(gotoInst, GotoInstruction *, inst);
+                fixups.push_back({codes.size(), false, gotoInst->getLabel(), gotoInst->getTarget()});
+                codes.push_back({Op::JMP, -1, 0, 0});
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_BC: {
+                Instanceof(branchInst, BranchInstruction *, inst);
+                int32_t cond = use(inst->getOperand(0));
+                fixups.push_back({codes.size(), false, branchInst->getTrueLabel(), nullptr});
+                fixups.push_back({codes.size(), true, branchInst->getFalseLabel(), nullptr});
+                codes.push_back({Op::BC, -1, cond, -1});
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_EXIT: {
+                int32_t src = (inst->getOperandsNum() > 0) ? use(inst->getOperand(0)) : -1;
+                codes.push_back({Op::RET, 0, src, 0});
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_ASSIGN: {
+                Value * result = inst->getOperand(0);
+                Value * arg1 = inst->getOperand(1);
+
+                if (result->getType()->isPointerType() && !isPointerValue(arg1->getType())) {
+                    // *%t = x
+                    int32_t addr = use(result);
+                    codes.push_back({Op::STORE, 0, addr, use(arg1)});
+                } else if (arg1->getType()->isPointerType() && !isPointerValue(result->getType())) {
+                    // x = *%t
+                    int32_t addr = use(arg1);
+                    codes.push_back({Op::LOAD, def(result), addr, 0});
+                } else {
+                    int32_t src = use(arg1);
+                    codes.push_back({Op::MOV, def(result), src, 0});
+                }
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_NEG_I: {
+                int32_t src = use(inst->getOperand(0));
+                codes.push_back({Op::NEG, def(inst), src, 0});
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_ADD_I:
+            case IRInstOperator::IRINST_OP_SUB_I:
+            case IRInstOperator::IRINST_OP_MUL_I:
+            case IRInstOperator::IRINST_OP_DIV_I:
+            case IRInstOperator::IRINST_OP_MOD_I:
+            case IRInstOperator::IRINST_OP_LT_I:
+            case IRInstOperator::IRINST_OP_LE_I:
+            case IRInstOperator::IRINST_OP_GT_I:
+            case IRInstOperator::IRINST_OP_GE_I:
+            case IRInstOperator::IRINST_OP_EQ_I:
+            case IRInstOperator::IRINST_OP_NE_I: {
+                static const std::unordered_map<int, Op> binaryOps = {
+                    {(int) IRInstOperator::IRINST_OP_ADD_I, Op::ADD},
+                    {(int) IRInstOperator::IRINST_OP_SUB_I, Op::SUB},
+                    {(int) IRInstOperator::IRINST_OP_MUL_I, Op::MUL},
+                    {(int) IRInstOperator::IRINST_OP_DIV_I, Op::DIV},
+                    {(int) IRInstOperator::IRINST_OP_MOD_I, Op::MOD},
+                    {(int) IRInstOperator::IRINST_OP_LT_I, Op::LT},
+                    {(int) IRInstOperator::IRINST_OP_LE_I, Op::LE},
+                    {(int) IRInstOperator::IRINST_OP_GT_I, Op::GT},
+                    {(int) IRInstOperator::IRINST_OP_GE_I, Op::GE},
+                    {(int) IRInstOperator::IRINST_OP_EQ_I, Op::EQ},
+                    {(int) IRInstOperator::IRINST_OP_NE_I, Op::NE},
+                };
+
+                Op op = binaryOps.at((int) inst->getOp());
+
+                // 结果为指针时是地址计算，按64位进行
+                if (inst->getType()->isPointerType()) {
+                    if (op == Op::ADD) {
+                        op = Op::ADDP;
+                    } else if (op == Op::SUB) {
+                        op = Op::SUBP;
+                    }
+                }
+
+                int32_t src1 = use(inst->getOperand(0));
+                int32_t src2 = use(inst->getOperand(1));
+                codes.push_back({op, def(inst), src1, src2});
+                break;
+            }
+
+            case IRInstOperator::IRINST_OP_FUNC_CALL: {
+                Instanceof(callInst, FuncCallInstruction *, inst);
+
+                CallSite site;
+
+                Function * callee = module->findFunction(callInst->getCalledName());
+                if (!callee) {
+                    minic_log(LOG_ERROR, "函数(%s)没有定义", callInst->getCalledName().c_str());
+                    return false;
+                }
+
+                if (callee->isBuiltin()) {
+                    static const std::unordered_map<std::string, Builtin> builtins = {
+                        {"putint", Builtin::PUTINT},
+                        {"getint", Builtin::GETINT},
+                        {"putch", Builtin::PUTCH},
+                        {"getch", Builtin::GETCH},
+                        {"putarray", Builtin::PUTARRAY},
+                        {"getarray", Builtin::GETARRAY},
+                    };
+
+                    auto pIter = builtins.find(callee->getName());
+                    if (pIter == builtins.end()) {
+                        minic_log(LOG_ERROR, "内置函数(%s)不支持解释执行", callee->getName().c_str());
+                        return false;
+                    }
+                    site.builtin = pIter->second;
+                } else {
+                    site.callee = funcIndex[callee];
+                }
+
+                for (int32_t k = 0; k < callInst->getOperandsNum(); k++) {
+                    site.args.push_back(use(callInst->getOperand(k)));
+                }
+
+                int32_t dst = callInst->hasResultValue() ? def(inst) : -1;
+
+                codes.push_back({Op::CALL, dst, (int32_t) prepared.calls.size(), 0});
+                prepared.calls.push_back(std::move(site));
+                break;
+            }
+
+            default:
+                minic_log(LOG_ERROR,
+                          "函数(%s)中的指令(%d)不支持解释执行",
+                          func->getName().c_str(),
+                          (int) inst->getOp());
+                return false;
+        }
+
+        if (pendingStore != -1) {
+            codes.push_back({Op::STOREG, pendingStore, pendingSlot, 0});
+        }
+    }
+
+    // 没有exit指令时也能正常返回
+    codes.push_back({Op::RET, 0, -1, 0});
+
+    for (auto & fixup: fixups) {
+        int32_t target = -1;
+        if (fixup.target) {
+            auto pIter = labelByInst.find(fixup.target);
+            target = (pIter == labelByInst.end()) ? -1 : pIter->second;
+        } else {
+            auto pIter = labelByName.find(fixup.name);
+            target = (pIter == labelByName.end()) ? -1 : pIter->second;
+        }
+
+        if (target == -1) {
+            minic_log(LOG_ERROR,
+                      "函数(%s)中的跳转目标(%s)不存在",
+                      func->getName().c_str(),
+                      symbolName(fixup.name).data());
+            return false;
+        }
+
+        if (fixup.second) {
+            codes[fixup.code].src2 = target;
+        } else {
+            codes[fixup.code].dst = target;
+        }
+    }
+
+    auto wordIter = constIndex.find(4);
+    fuse(prepared, (wordIter == constIndex.end()) ? -1 : wordIter->second);
+
+    return true;
+}
+
+/// @brief 相邻的指令合并成超级指令，被合并的中间结果必须只在合并的指令中使用
+/// @param prepared 预处理后的函数
+/// @param wordSlot 常量4所在的槽位，没有时为-1
+void IRInterpreter::fuse(PreparedFunction & prepared, int32_t wordSlot)
+{
+    std::vector<Code> & codes = prepared.codes;
+
+    // 各槽位被读取的次数，以及哪些指令是跳转目标
+    std::vector<int32_t> reads(prepared.slotNum, 0);
+    std::vector<bool> isTarget(codes.size(), false);
+
+    for (auto & code: codes) {
+        switch (code.op) {
+            case Op::JMP:
+                isTarget[code.dst] = true;
+                break;
+            case Op::BC:
+                reads[code.src1]++;
+                isTarget[code.dst] = true;
+                isTarget[code.src2] = true;
+                break;
+            case Op::CALL:
+                for (auto slot: prepared.calls[code.src1].args) {
+                    reads[slot]++;
+                }
+                break;
+            case Op::RET:
+                if (code.src1 != -1) {
+                    reads[code.src1]++;
+                }
+                break;
+            case Op::LOADG:
+                break;
+            case Op::MOV:
+            case Op::LOAD:
+            case Op::STOREG:
+            case Op::NEG:
+                reads[code.src1]++;
+                break;
+            default:
+                reads[code.src1]++;
+                reads[code.src2]++;
+                break;
+        }
+    }
+
+    auto isCompare = [](Op op) { return (op >= Op::LT) && (op <= Op::NE); };
+
+    // 有结果写到dst槽位的指令
+    auto hasDst = [&isCompare](Op op) {
+        return (op == Op::MOV) || (op == Op::LOAD) || (op == Op::LOADG) || (op == Op::LDX) || (op == Op::CALL) ||
+               ((op >= Op::ADD) && (op <= Op::NEG)) || isCompare(op);
+    };
+
+    // 只被读一次的中间结果，合并后不再需要
+    auto once = [&reads](int32_t slot) { return (slot >= 0) && (reads[slot] == 1); };
+
+    std::vector<Code> out;
+    std::vector<bool> outTarget;
+    std::vector<int32_t> newIndex(codes.size());
+
+    // 已输出的最后n条指令与当前指令之间没有跳转目标，可以合并
+    auto fusible = [&out, &outTarget](size_t n) {
+        if (out.size() < n) {
+            return false;
+        }
+        for (size_t k = out.size() - n + 1; k < out.size(); k++) {
+            if (outTarget[k]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < codes.size(); i++) {
+
+        const Code & code = codes[i];
+
+        if (!isTarget[i] && fusible(1)) {
+
+            Code & last = out.back();
+
+            // %t = icmp lt a,b; bc %t, L1, L2 => blt a,b,L1,L2
+            if ((code.op == Op::BC) && isCompare(last.op) && (last.dst == code.src1) && once(code.src1)) {
+                Op op = (Op) ((int) Op::BLT + ((int) last.op - (int) Op::LT));
+                last = {op, code.dst, last.src1, last.src2, code.src2};
+                newIndex[i] = (int32_t) out.size() - 1;
+                continue;
+            }
+
+            // %t = add a,b; x = %t => x = add a,b
+            if ((code.op == Op::MOV) && hasDst(last.op) && (last.dst == code.src1) && once(code.src1)) {
+                last.dst = code.dst;
+                newIndex[i] = (int32_t) out.size() - 1;
+                continue;
+            }
+        }
+
+        if (!isTarget[i] && fusible(2)) {
+
+            Code & first = out[out.size() - 2];
+            Code & second = out.back();
+
+            // %t1 = mul i,4; %t2 = add base,%t1; x = *%t2 => x = base[i]
+            // %t1 = mul i,4; %t2 = add base,%t1; *%t2 = v => base[i] = v
+            bool isIndex = (wordSlot != -1) && (first.op == Op::MUL) && (second.op == Op::ADDP) &&
+                           ((first.src1 == wordSlot) || (first.src2 == wordSlot)) && once(first.dst) &&
+                           ((second.src1 == first.dst) || (second.src2 == first.dst)) && once(second.dst);
+
+            if (isIndex && ((code.op == Op::LOAD) || (code.op == Op::STORE)) && (code.src1 == second.dst)) {
+                int32_t index = (first.src2 == wordSlot) ? first.src1 : first.src2;
+                int32_t base = (second.src1 == first.dst) ? second.src2 : second.src1;
+
+                if (code.op == Op::LOAD) {
+                    first = {Op::LDX, code.dst, base, index, 0};
+                } else {
+                    first = {Op::STX, 0, base, index, code.src2};
+                }
+
+                out.pop_back();
+                outTarget.pop_back();
+                newIndex[i] = (int32_t) out.size() - 1;
+                continue;
+            }
+
+            // %t1 = @g; %t2 = add %t1,c; @g = %t2 => @g += c
+            if ((code.op == Op::STOREG) && (first.op == Op::LOADG) && (second.op == Op::ADD) &&
+                (first.src1 == code.dst) && (second.dst == code.src1) && once(first.dst) && once(second.dst) &&
+                ((second.src1 == first.dst) || (second.src2 == first.dst))) {
+                int32_t inc = (second.src1 == first.dst) ? second.src2 : second.src1;
+
+                first = {Op::ADDG, code.dst, inc, 0, 0};
+
+                out.pop_back();
+                outTarget.pop_back();
+                newIndex[i] = (int32_t) out.size() - 1;
+                continue;
+            }
+        }
+
+        newIndex[i] = (int32_t) out.size();
+        out.push_back(code);
+        outTarget.push_back(isTarget[i]);
+    }
+
+    // 跳转目标换成合并后的下标，跳转目标所在的指令都没有被合并掉
+    for (auto & code: out) {
+        if (code.op == Op::JMP) {
+            code.dst = newIndex[code.dst];
+        } else if (code.op == Op::BC) {
+            code.dst = newIndex[code.dst];
+            code.src2 = newIndex[code.src2];
+        } else if ((code.op >= Op::BLT) && (code.op <= Op::BNE)) {
+            code.dst = newIndex[code.dst];
+            code.src3 = newIndex[code.src3];
+        }
+    }
+
+    codes = std::move(out);
+}
+
+/// @brief 在内存栈中分配空间并清0
+/// @param size 字节数
+/// @return 地址，空间不足时为0
+uint32_t IRInterpreter::allocStack(uint32_t size)
+{
+    uint32_t addr = (memTop + 7) & ~7u;
+    if ((uint64_t) addr + size > MEM_LIMIT) {
+        return 0;
+    }
+
+    memTop = addr + size;
+    if (memory.size() < memTop) {
+        memory.resize(std::max<size_t>(memTop, memory.size() * 2));
+    }
+
+    memset(memory.data() + addr, 0, size);
+
+    return addr;
+}
+
+/// @brief 检查访问的地址是否有效，无效时报告错误
+/// @param addr 地址
+/// @return true：有效
+bool IRInterpreter::checkAddr(int64_t addr)
+{
+    if ((addr < MEM_RESERVED) || (addr + 4 > (int64_t) memTop)) {
+        runtimeError("访问了无效的内存地址" + std::to_string(addr));
+        return false;
+    }
+
+    return true;
+}
+
+/// @brief 读取32位整数
+/// @param addr 地址
+/// @return 值
+int32_t IRInterpreter::readWord(int64_t addr)
+{
+    int32_t val;
+    memcpy(&val, memory.data() + addr, sizeof(val));
+    return val;
+}
+
+/// @brief 写入32位整数
+/// @param addr 地址
+/// @param val 值
+void IRInterpreter::writeWord(int64_t addr, int32_t val)
+{
+    memcpy(memory.data() + addr, &val, sizeof(val));
+}
+
+/// @brief 报告运行时错误，并终止执行
+/// @param msg 错误信息
+void IRInterpreter::runtimeError(const std::string & msg)
+{
+    if (!failed) {
+        fflush(stdout);
+        minic_log(LOG_ERROR, "运行错误：%s", msg.c_str());
+    }
+
+    failed = true;
+}
+
+/// @brief 执行内置函数
+/// @param builtin 内置函数
+/// @param args 实参的值
+/// @return 返回值，void函数为0
+int64_t IRInterpreter::callBuiltin(Builtin builtin, const int64_t * args)
+{
+    switch (builtin) {
+        case Builtin::PUTINT:
+            printf("%d", (int32_t) args[0]);
+            return 0;
+
+        case Builtin::GETINT: {
+            int32_t val = 0;
+            if (scanf("%d", &val) != 1) {
+                val = 0;
+            }
+            return val;
+        }
+
+        case Builtin::PUTCH:
+            putchar((char) args[0]);
+            return 0;
+
+        case Builtin::GETCH: {
+            int ch = getchar();
+            return (ch == EOF) ? -1 : (char) ch;
+        }
+
+        case Builtin::PUTARRAY: {
+            int32_t n = (int32_t) args[0];
+            printf("%d:", n);
+            for (int32_t k = 0; k < n; k++) {
+                if (!checkAddr(args[1] + 4 * k)) {
+                    return 0;
+                }
+                printf(" %d", readWord(args[1] + 4 * k));
+            }
+            printf("\n");
+            return 0;
+        }
+
+        case Builtin::GETARRAY: {
+            int32_t n = 0;
+            if (scanf("%d", &n) != 1) {
+                return 0;
+            }
+            for (int32_t k = 0; k < n; k++) {
+                int32_t val = 0;
+                if (scanf("%d", &val) != 1) {
+                    val = 0;
+                }
+                if (!checkAddr(args[0] + 4 * k)) {
+                    return 0;
+                }
+                writeWord(args[0] + 4 * k, val);
+            }
+            return n;
+        }
+
+        default:
+            return 0;
+    }
+}
+
+/// @brief 执行预处理后的指令，直到main函数返回
+/// @param mainIndex main函数在funcs中的下标
+/// @param exitCode main函数的返回值
+/// @return true：成功，false：运行出错
+bool IRInterpreter::execute(int32_t mainIndex, int & exitCode)
+{
+    // 进入函数：分配槽位并用模板初始化，局部数组在内存栈中分配
+    auto enter = [this](int32_t index, int32_t retDst) {
+        PreparedFunction & callee = funcs[index];
+
+        size_t base = slots.size();
+        frames.push_back({index, 0, base, memTop, retDst});
+        slots.insert(slots.end(), callee.slotInit.begin(), callee.slotInit.end());
+
+        for (auto & [slot, size]: callee.arrays) {
+            uint32_t addr = allocStack(size);
+            if (addr == 0) {
+                runtimeError("栈空间不足");
+                return false;
+            }
+            slots[base + slot] = addr;
+        }
+
+        return true;
+    };
+
+    if (!enter(mainIndex, -1)) {
+        return false;
+    }
+
+    const PreparedFunction * fn = &funcs[mainIndex];
+    const Code * codes = fn->codes.data();
+    const Code * code = nullptr;
+    int64_t * r = slots.data();
+    int32_t pc = 0;
+
+    std::vector<int64_t> args;
+
+#if defined(__GNUC__)
+    // 按Op的顺序排列的处理代码地址，每条指令处理完直接跳转到下一条指令的处理代码
+    static const void * dispatchTable[] = {
+        &&L_MOV, &&L_LOAD, &&L_STORE, &&L_LOADG, &&L_STOREG, &&L_ADD, &&L_SUB, &&L_MUL,
+        &&L_DIV, &&L_MOD,  &&L_ADDP,  &&L_SUBP,  &&L_NEG,    &&L_LT,  &&L_LE,  &&L_GT,
+        &&L_GE,  &&L_EQ,   &&L_NE,    &&L_JMP,   &&L_BC,     &&L_CALL, &&L_RET, &&L_BLT,
+        &&L_BLE, &&L_BGT,  &&L_BGE,   &&L_BEQ,   &&L_BNE,    &&L_LDX, &&L_STX, &&L_ADDG,
+    };
+    static_assert(sizeof(dispatchTable) / sizeof(dispatchTable[0]) == (size_t) Op::ADDG + 1, "dispatch table");
+
+#define VM_CASE(name) L_##name:
+#define VM_NEXT()                                                                                                      \
+    code = &codes[pc++];                                                                                               \
+    goto * dispatchTable[(int) code->op]
+
+    VM_NEXT();
+    {
+#else
+#define VM_CASE(name) case Op::name:
+#define VM_NEXT() break
+
+    for (;;) {
+        code = &codes[pc++];
+        switch (code->op) {
+#endif
+
+        VM_CASE(MOV)
+        {
+            r[code->dst] = r[code->src1];
+            VM_NEXT();
+        }
+
+        VM_CASE(LOAD)
+        {
+            if (!checkAddr(r[code->src1])) {
+                return false;
+            }
+            r[code->dst] = readWord(r[code->src1]);
+            VM_NEXT();
+        }
+
+        VM_CASE(STORE)
+        {
+            if (!checkAddr(r[code->src1])) {
+                return false;
+            }
+            writeWord(r[code->src1], (int32_t) r[code->src2]);
+            VM_NEXT();
+        }
+
+        VM_CASE(LOADG)
+        {
+            r[code->dst] = readWord(code->src1);
+            VM_NEXT();
+        }
+
+        VM_CASE(STOREG)
+        {
+            writeWord(code->dst, (int32_t) r[code->src1]);
+            VM_NEXT();
+        }
+
+        VM_CASE(ADD)
+        {
+            r[code->dst] = (int32_t) ((uint32_t) r[code->src1] + (uint32_t) r[code->src2]);
+            VM_NEXT();
+        }
+
+        VM_CASE(SUB)
+        {
+            r[code->dst] = (int32_t) ((uint32_t) r[code->src1] - (uint32_t) r[code->src2]);
+            VM_NEXT();
+        }
+
+        VM_CASE(MUL)
+        {
+            r[code->dst] = (int32_t) ((uint32_t) r[code->src1] * (uint32_t) r[code->src2]);
+            VM_NEXT();
+        }
+
+        VM_CASE(DIV)
+        VM_CASE(MOD)
+        {
+            int32_t a = (int32_t) r[code->src1];
+            int32_t b = (int32_t) r[code->src2];
+            if (b == 0) {
+                runtimeError("除数为0");
+                return false;
+            }
+
+            // INT32_MIN / -1在C++中未定义，按补码回绕处理
+            if (b == -1) {
+                r[code->dst] = (code->op == Op::DIV) ? (int32_t) (0u - (uint32_t) a) : 0;
+            } else {
+                r[code->dst] = (code->op == Op::DIV) ? (a / b) : (a % b);
+            }
+            VM_NEXT();
+        }
+
+        VM_CASE(ADDP)
+        {
+            r[code->dst] = r[code->src1] + r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(SUBP)
+        {
+            r[code->dst] = r[code->src1] - r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(NEG)
+        {
+            r[code->dst] = (int32_t) (0u - (uint32_t) r[code->src1]);
+            VM_NEXT();
+        }
+
+        VM_CASE(LT)
+        {
+            r[code->dst] = r[code->src1] < r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(LE)
+        {
+            r[code->dst] = r[code->src1] <= r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(GT)
+        {
+            r[code->dst] = r[code->src1] > r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(GE)
+        {
+            r[code->dst] = r[code->src1] >= r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(EQ)
+        {
+            r[code->dst] = r[code->src1] == r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(NE)
+        {
+            r[code->dst] = r[code->src1] != r[code->src2];
+            VM_NEXT();
+        }
+
+        VM_CASE(JMP)
+        {
+            pc = code->dst;
+            VM_NEXT();
+        }
+
+        VM_CASE(BC)
+        {
+            pc = r[code->src1] ? code->dst : code->src2;
+            VM_NEXT();
+        }
+
+        VM_CASE(CALL)
+        {
+            const CallSite & site = fn->calls[code->src1];
+
+            args.clear();
+            for (auto slot: site.args) {
+                args.push_back(r[slot]);
+            }
+
+            if (site.callee == -1) {
+                int64_t ret = callBuiltin(site.builtin, args.data());
+                if (failed) {
+                    return false;
+                }
+                if (code->dst != -1) {
+                    r[code->dst] = ret;
+                }
+                VM_NEXT();
+            }
+
+            if (frames.size() >= MAX_CALL_DEPTH) {
+                runtimeError("函数调用层次过深");
+                return false;
+            }
+
+            // 保存返回位置后进入被调用函数，实参拷贝到被调用函数开头的槽位
+            frames.back().pc = pc;
+            if (!enter(site.callee, code->dst)) {
+                return false;
+            }
+
+            size_t base = frames.back().base;
+            for (size_t k = 0; k < args.size(); k++) {
+                slots[base + k] = args[k];
+            }
+
+            fn = &funcs[site.callee];
+            codes = fn->codes.data();
+            r = slots.data() + base;
+            pc = 0;
+            VM_NEXT();
+        }
+
+        VM_CASE(RET)
+        {
+            int64_t ret = (code->src1 != -1) ? r[code->src1] : 0;
+
+            Frame frame = frames.back();
+            frames.pop_back();
+            slots.resize(frame.base);
+            memTop = frame.memTop;
+
+            if (frames.empty()) {
+                exitCode = (int32_t) ret;
+                return true;
+            }
+
+            Frame & caller = frames.back();
+            fn = &funcs[caller.func];
+            codes = fn->codes.data();
+            r = slots.data() + caller.base;
+            pc = caller.pc;
+
+            if (frame.retDst != -1) {
+                r[frame.retDst] = ret;
+            }
+            VM_NEXT();
+        }
+
+        VM_CASE(BLT)
+        {
+            pc = (r[code->src1] < r[code->src2]) ? code->dst : code->src3;
+            VM_NEXT();
+        }
+
+        VM_CASE(BLE)
+        {
+            pc = (r[code->src1] <= r[code->src2]) ? code->dst : code->src3;
+            VM_NEXT();
+        }
+
+        VM_CASE(BGT)
+        {
+            pc = (r[code->src1] > r[code->src2]) ? code->dst : code->src3;
+            VM_NEXT();
+        }
+
+        VM_CASE(BGE)
+        {
+            pc = (r[code->src1] >= r[code->src2]) ? code->dst : code->src3;
+            VM_NEXT();
+        }
+
+        VM_CASE(BEQ)
+        {
+            pc = (r[code->src1] == r[code->src2]) ? code->dst : code->src3;
+            VM_NEXT();
+        }
+
+        VM_CASE(BNE)
+        {
+            pc = (r[code->src1] != r[code->src2]) ? code->dst : code->src3;
+            VM_NEXT();
+        }
+
+        VM_CASE(LDX)
+        {
+            int64_t addr = r[code->src1] + r[code->src2] * 4;
+            if (!checkAddr(addr)) {
+                return false;
+            }
+            r[code->dst] = readWord(addr);
+            VM_NEXT();
+        }
+
+        VM_CASE(STX)
+        {
+            int64_t addr = r[code->src1] + r[code->src2] * 4;
+            if (!checkAddr(addr)) {
+                return false;
+            }
+            writeWord(addr, (int32_t) r[code->src3]);
+            VM_NEXT();
+        }
+
+        VM_CASE(ADDG)
+        {
+            writeWord(code->dst, (int32_t) ((uint32_t) readWord(code->dst) + (uint32_t) r[code->src1]));
+            VM_NEXT();
+        }
+
+#if !defined(__GNUC__)
+        }
+#endif
+    }
+
+#undef VM_CASE
+#undef VM_NEXT
+
+    return false;
+}
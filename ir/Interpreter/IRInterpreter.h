@@ -0,0 +1,288 @@
+///
+/// @file IRInterpreter.h
+/// @brief DragonIR的解释执行器，直接执行内存中的Module
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "Module.h"
+
+///
+/// @brief DragonIR解释执行器
+///
+/// 执行前每个函数先翻译成基于寄存器的字节码：指令定长，Value*操作数都换成栈帧内的槽位下标，
+/// 常量放在槽位中由模板初始化，标签换成指令下标。之后把常见的指令序列合并成超级指令，
+/// 如比较后分支、数组元素的读写、全局变量的自增等。
+/// 执行时采用computed goto直接跳转到下一条指令的处理代码，不支持的编译器退化为switch分发。
+/// 内置函数putint/getint/putch/getch/putarray/getarray由解释器直接实现。
+///
+class IRInterpreter {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要执行的模块
+    ///
+    explicit IRInterpreter(Module * _module);
+
+    ///
+    /// @brief 执行main函数
+    /// @param exitCode main函数的返回值
+    /// @return true：成功，false：预处理或运行出错
+    ///
+    bool run(int & exitCode);
+
+protected:
+    ///
+    /// @brief 预处理后的操作码
+    ///
+    enum class Op : uint8_t {
+        MOV,      ///< dst = src1
+        LOAD,     ///< dst = *src1
+        STORE,    ///< *src1 = src2
+        LOADG,    ///< dst = 全局变量[src1]，src1为地址
+        STOREG,   ///< 全局变量[dst] = src1，dst为地址
+        ADD,      ///< 32位整数加
+        SUB,      ///< 32位整数减
+        MUL,      ///< 32位整数乘
+        DIV,      ///< 32位整数除
+        MOD,      ///< 32位整数求余
+        ADDP,     ///< 地址加
+        SUBP,     ///< 地址减
+        NEG,      ///< 32位整数求负
+        LT,       ///< 小于
+        LE,       ///< 小于等于
+        GT,       ///< 大于
+        GE,       ///< 大于等于
+        EQ,       ///< 等于
+        NE,       ///< 不等于
+        JMP,      ///< 跳转到dst
+        BC,       ///< src1非0跳转到dst，否则跳转到src2
+        CALL,     ///< 调用calls[src1]，返回值存到dst，dst为-1时没有返回值
+        RET,      ///< 返回src1，src1为-1时没有返回值
+
+        // 以下为超级指令，由fuse合并得到
+        BLT,      ///< src1 < src2时跳转到dst，否则跳转到src3
+        BLE,      ///< src1 <= src2时跳转到dst，否则跳转到src3
+        BGT,      ///< src1 > src2时跳转到dst，否则跳转到src3
+        BGE,      ///< src1 >= src2时跳转到dst，否则跳转到src3
+        BEQ,      ///< src1 == src2时跳转到dst，否则跳转到src3
+        BNE,      ///< src1 != src2时跳转到dst，否则跳转到src3
+        LDX,      ///< dst = src1[src2]，即读取地址src1 + src2 * 4
+        STX,      ///< src1[src2] = src3
+        ADDG,     ///< 全局变量[dst] += src1，dst为地址
+    };
+
+    ///
+    /// @brief 预处理后的定长指令，操作数为槽位下标
+    ///
+    struct Code {
+        Op op;
+        int32_t dst;
+        int32_t src1;
+        int32_t src2;
+        int32_t src3 = 0;
+    };
+
+    ///
+    /// @brief 内置函数
+    ///
+    enum class Builtin : uint8_t {
+        NONE,
+        PUTINT,
+        GETINT,
+        PUTCH,
+        GETCH,
+        PUTARRAY,
+        GETARRAY,
+    };
+
+    ///
+    /// @brief 函数调用点
+    ///
+    struct CallSite {
+        /// @brief 被调用的函数在funcs中的下标，内置函数为-1
+        int32_t callee = -1;
+
+        /// @brief 内置函数
+        Builtin builtin = Builtin::NONE;
+
+        /// @brief 实参所在的槽位
+        std::vector<int32_t> args;
+    };
+
+    ///
+    /// @brief 预处理后的函数
+    ///
+    struct PreparedFunction {
+        /// @brief 原函数
+        Function * func = nullptr;
+
+        /// @brief 槽位的个数
+        int32_t slotNum = 0;
+
+        /// @brief 槽位的初值，常量在这里给出
+        std::vector<int64_t> slotInit;
+
+        /// @brief 局部数组所在的槽位及其字节数，进入函数时在内存栈中分配
+        std::vector<std::pair<int32_t, uint32_t>> arrays;
+
+        /// @brief 指令序列
+        std::vector<Code> codes;
+
+        /// @brief 函数调用点
+        std::vector<CallSite> calls;
+    };
+
+    ///
+    /// @brief 调用栈的帧
+    ///
+    struct Frame {
+        /// @brief 函数在funcs中的下标
+        int32_t func;
+
+        /// @brief 返回后继续执行的指令下标
+        int32_t pc;
+
+        /// @brief 槽位的起始下标
+        size_t base;
+
+        /// @brief 进入函数前的内存栈顶
+        uint32_t memTop;
+
+        /// @brief 返回值保存到调用者的槽位，-1表示不需要
+        int32_t retDst;
+    };
+
+    ///
+    /// @brief 全局变量分配内存并设置初值
+    ///
+    void allocGlobals();
+
+    ///
+    /// @brief 函数预处理，操作数换成槽位下标，标签换成指令下标
+    /// @param func 函数
+    /// @param prepared 预处理的结果
+    /// @return true：成功，false：有不支持的指令
+    ///
+    bool prepare(Function * func, PreparedFunction & prepared);
+
+    ///
+    /// @brief 相邻的指令合并成超级指令，被合并的中间结果必须只在合并的指令中使用
+    /// @param prepared 预处理后的函数
+    /// @param wordSlot 常量4所在的槽位，没有时为-1
+    ///
+    void fuse(PreparedFunction & prepared, int32_t wordSlot);
+
+    ///
+    /// @brief 执行预处理后的指令，直到main函数返回
+    /// @param mainIndex main函数在funcs中的下标
+    /// @param exitCode main函数的返回值
+    /// @return true：成功，false：运行出错
+    ///
+    bool execute(int32_t mainIndex, int & exitCode);
+
+    ///
+    /// @brief 执行内置函数
+    /// @param builtin 内置函数
+    /// @param args 实参的值
+    /// @return 返回值，void函数为0
+    ///
+    int64_t callBuiltin(Builtin builtin, const int64_t * args);
+
+    ///
+    /// @brief 在内存栈中分配空间并清0
+    /// @param size 字节数
+    /// @return 地址，空间不足时为0
+    ///
+    uint32_t allocStack(uint32_t size);
+
+    ///
+    /// @brief 检查访问的地址是否有效，无效时报告错误
+    /// @param addr 地址
+    /// @return true：有效
+    ///
+    bool checkAddr(int64_t addr);
+
+    ///
+    /// @brief 读取32位整数
+    /// @param addr 地址
+    /// @return 值
+    ///
+    int32_t readWord(int64_t addr);
+
+    ///
+    /// @brief 写入32位整数
+    /// @param addr 地址
+    /// @param val 值
+    ///
+    void writeWord(int64_t addr, int32_t val);
+
+    ///
+    /// @brief 报告运行时错误，并终止执行
+    /// @param msg 错误信息
+    ///
+    void runtimeError(const std::string & msg);
+
+private:
+    ///
+    /// @brief 要执行的模块
+    ///
+    Module * module;
+
+    ///
+    /// @brief 预处理后的函数
+    ///
+    std::vector<PreparedFunction> funcs;
+
+    ///
+    /// @brief 函数到funcs下标的映射
+    ///
+    std::unordered_map<Function *, int32_t> funcIndex;
+
+    ///
+    /// @brief 全局变量的地址
+    ///
+    std::unordered_map<Value *, uint32_t> globalAddr;
+
+    ///
+    /// @brief 模拟的内存，地址即下标。开头保留一段使空指针无效，之后依次为全局变量与栈
+    ///
+    std::vector<uint8_t> memory;
+
+    ///
+    /// @brief 内存栈顶
+    ///
+    uint32_t memTop = 0;
+
+    ///
+    /// @brief 所有栈帧的槽位连续存放
+    ///
+    std::vector<int64_t> slots;
+
+    ///
+    /// @brief 调用栈
+    ///
+    std::vector<Frame> frames;
+
+    ///
+    /// @brief 是否发生了运行时错误
+    ///
+    bool failed = false;
+};
@@ -0,0 +1,1037 @@
+///
+/// @file IRParser.cpp
+/// @brief DragonIR文本的解析器，从Module::outputIR输出的文本重建Module
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <charconv>
+#include <cstdio>
+
+#include "Common.h"
+#include "IRParser.h"
+
+#include "ArrayParameterType.h"
+#include "ArrayType.h"
+#include "IntegerType.h"
+#include "PointerType.h"
+#include "VoidType.h"
+
+#include "FormalParam.h"
+#include "LocalVariable.h"
+
+#include "ArgInstruction.h"
+#include "BinaryInstruction.h"
+#include "BranchInstruction.h"
+#include "EntryInstruction.h"
+#include "ExitInstruction.h"
+#include "FuncCallInstruction.h"
+#include "GetElementPtrInstruction.h"
+#include "GotoInstruction.h"
+#include "LabelInstruction.h"
+#include "MoveInstruction.h"
+#include "NegInstruction.h"
+
+///
+/// @brief 是否是名字与整数之间的分隔符
+/// @param ch 字符
+/// @return true：分隔符
+///
+static bool isDelimiter(char ch)
+{
+    switch (ch) {
+        case ' ':
+        case '\t':
+        case '\r':
+        case ',':
+        case '(':
+        case ')':
+        case '[':
+        case ']':
+        case ':':
+        case ';':
+        case '=':
+        case '*':
+            return true;
+        default:
+            return false;
+    }
+}
+
+///
+/// @brief 二元运算的助记符
+///
+static const struct {
+    std::string_view name;
+    IRInstOperator op;
+} binaryOps[] = {
+    {"add", IRInstOperator::IRINST_OP_ADD_I},
+    {"sub", IRInstOperator::IRINST_OP_SUB_I},
+    {"mul", IRInstOperator::IRINST_OP_MUL_I},
+    {"div", IRInstOperator::IRINST_OP_DIV_I},
+    {"mod", IRInstOperator::IRINST_OP_MOD_I},
+};
+
+///
+/// @brief 比较运算的条件
+///
+static const struct {
+    std::string_view name;
+    IRInstOperator op;
+} compareOps[] = {
+    {"lt", IRInstOperator::IRINST_OP_LT_I},
+    {"le", IRInstOperator::IRINST_OP_LE_I},
+    {"gt", IRInstOperator::IRINST_OP_GT_I},
+    {"ge", IRInstOperator::IRINST_OP_GE_I},
+    {"eq", IRInstOperator::IRINST_OP_EQ_I},
+    {"ne", IRInstOperator::IRINST_OP_NE_I},
+};
+
+///
+/// @brief 构造函数
+/// @param _module 要填充的模块，应只含有内置函数
+///
+IRParser::IRParser(Module * _module) : module(_module)
+{}
+
+///
+/// @brief 解析DragonIR文件
+/// @param filePath 文件路径
+/// @return true：成功，false：文件不能读取或者有语法错误
+///
+bool IRParser::run(const std::string & filePath)
+{
+    FILE * fp = fopen(filePath.c_str(), "rb");
+    if (nullptr == fp) {
+        minic_log(LOG_ERROR, "IR文件(%s)打开失败", filePath.c_str());
+        return false;
+    }
+
+    // 整个文件一次读入，之后的词法单元都指向这块内存
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    text.resize(size > 0 ? (size_t) size : 0);
+    size_t readSize = text.empty() ? 0 : fread(&text[0], 1, text.size(), fp);
+    fclose(fp);
+
+    if (readSize != text.size()) {
+        minic_log(LOG_ERROR, "IR文件(%s)读取失败", filePath.c_str());
+        return false;
+    }
+
+    // 按行切分
+    std::string_view all(text);
+    size_t start = 0;
+    while (start < all.size()) {
+        size_t pos = all.find('\n', start);
+        if (pos == std::string_view::npos) {
+            pos = all.size();
+        }
+        lines.push_back(all.substr(start, pos - start));
+        start = pos + 1;
+    }
+
+    // 第一遍：全局变量与函数原型
+    if (!parseDeclarations()) {
+        return false;
+    }
+
+    // 第二遍：函数体
+    placeholder = module->newConstInt(0);
+
+    for (auto & body: bodies) {
+        if (!parseFunctionBody(body)) {
+            return false;
+        }
+    }
+
+    module->setCurrentFunction(nullptr);
+
+    return true;
+}
+
+///
+/// @brief 第一遍：全局变量与函数原型
+/// @return true：成功
+///
+bool IRParser::parseDeclarations()
+{
+    for (size_t index = 0; index < lines.size(); index++) {
+
+        setLine(index);
+
+        if (atEnd()) {
+            // 空行或者注释
+            continue;
+        }
+
+        if (accept("declare")) {
+            if (!parseGlobal()) {
+                return false;
+            }
+            continue;
+        }
+
+        if (!accept("define")) {
+            return error("只能是全局变量或者函数的定义");
+        }
+
+        Body body;
+        if (!parseFunctionHeader(body)) {
+            return false;
+        }
+
+        // 函数头的下一行必须为{，函数体到}所在的行结束
+        setLine(++index);
+        if (index >= lines.size() || !accept('{') || !atEnd()) {
+            return error("函数头之后应为{");
+        }
+
+        body.first = index + 1;
+
+        for (index++; index < lines.size(); index++) {
+            setLine(index);
+            if (accept('}') && atEnd()) {
+                break;
+            }
+        }
+
+        if (index >= lines.size()) {
+            setLine(body.first - 1);
+            return error("函数体缺少}");
+        }
+
+        body.last = index;
+        bodies.push_back(std::move(body));
+    }
+
+    return true;
+}
+
+///
+/// @brief 解析全局变量的declare语句
+/// @return true：成功
+///
+bool IRParser::parseGlobal()
+{
+    Type * type = parseType();
+    if (!type) {
+        return false;
+    }
+
+    std::string_view name = token();
+    if (name.size() < 2 || name[0] != '@') {
+        return error("全局变量名应以@开始");
+    }
+
+    std::vector<int32_t> dims;
+    if (!parseDims(dims)) {
+        return false;
+    }
+
+    Constant * initializer = nullptr;
+    if (accept('=')) {
+        // 只有标量全局变量才有初始值
+        std::string_view val = token();
+        int32_t intVal;
+        if (dims.size() || std::from_chars(val.data(), val.data() + val.size(), intVal).ptr != val.data() + val.size()) {
+            return error("全局变量的初始值应为整数");
+        }
+        initializer = module->newConstInt(intVal);
+    }
+
+    if (!atEnd()) {
+        return error("全局变量定义之后有多余的内容");
+    }
+
+    if (!dims.empty()) {
+        type = ArrayType::get(type, dims);
+    }
+
+    Value * var = module->newVarValue(type, std::string(name.substr(1)), initializer);
+    if (!var) {
+        return error("全局变量重复定义");
+    }
+
+    globals[name] = var;
+
+    return true;
+}
+
+///
+/// @brief 解析函数头，创建函数及其形参
+/// @param body 记录函数与形参的名字
+/// @return true：成功
+///
+bool IRParser::parseFunctionHeader(Body & body)
+{
+    Type * returnType = parseType();
+    if (!returnType) {
+        return false;
+    }
+
+    std::string_view name = token();
+    if (name.size() < 2 || name[0] != '@') {
+        return error("函数名应以@开始");
+    }
+
+    if (!accept('(')) {
+        return error("函数名之后应为(");
+    }
+
+    std::vector<FormalParam *> params;
+
+    while (!accept(')')) {
+
+        if (!params.empty() && !accept(',')) {
+            return error("形参之间应以,分隔");
+        }
+
+        Type * type = parseType();
+        if (!type) {
+            return false;
+        }
+
+        std::string_view paramName = token();
+        if (paramName.empty()) {
+            return error("形参缺少名字");
+        }
+
+        // 数组形参写成i32 %t1[0][30]的形式
+        std::vector<int32_t> dims;
+        if (!parseDims(dims)) {
+            return false;
+        }
+
+        if (!dims.empty()) {
+            type = new ArrayParameterType(type, dims);
+        }
+
+        FormalParam * param = new FormalParam(type, "");
+        param->setIRName(std::string(paramName));
+
+        params.push_back(param);
+        body.params.push_back(paramName);
+    }
+
+    if (!atEnd()) {
+        return error("函数头之后有多余的内容");
+    }
+
+    body.func = module->newFunction(std::string(name.substr(1)), returnType, params);
+    if (!body.func) {
+        for (auto param: params) {
+            delete param;
+        }
+        return error("函数重复定义");
+    }
+
+    return true;
+}
+
+///
+/// @brief 第二遍：解析函数体
+/// @param body 函数体的位置
+/// @return true：成功
+///
+bool IRParser::parseFunctionBody(const Body & body)
+{
+    curFunc = body.func;
+    lastLabel = nullptr;
+
+    module->setCurrentFunction(curFunc);
+
+    values.clear();
+    results.clear();
+    fixups.clear();
+
+    auto & params = curFunc->getParams();
+    for (size_t k = 0; k < params.size(); k++) {
+        values[body.params[k]] = params[k];
+    }
+
+    // 先找出哪些名字是指令的结果，即形如"名字 = 运算"的行，其declare语句不创建局部变量
+    for (size_t index = body.first; index < body.last; index++) {
+
+        setLine(index);
+
+        std::string_view name = token();
+        if (name.empty() || !accept('=')) {
+            continue;
+        }
+
+        if (accept("add") || accept("sub") || accept("mul") || accept("div") || accept("mod") || accept("icmp") ||
+            accept("neg") || accept("call") || accept("getelementptr")) {
+            results.emplace(name, nullptr);
+        }
+    }
+
+    for (size_t index = body.first; index < body.last; index++) {
+
+        setLine(index);
+
+        if (atEnd()) {
+            continue;
+        }
+
+        bool ok = accept("declare") ? parseLocal() : parseInst();
+        if (!ok) {
+            return false;
+        }
+    }
+
+    // 回填先使用后定义的指令结果
+    for (auto & fixup: fixups) {
+        auto pIter = values.find(fixup.name);
+        if (pIter == values.end()) {
+            setLine(fixup.line);
+            return error("值(" + std::string(fixup.name) + ")未定义");
+        }
+        fixup.inst->setOperand(fixup.pos, pIter->second);
+    }
+
+    return true;
+}
+
+///
+/// @brief 解析函数体内的declare语句
+/// @return true：成功
+///
+bool IRParser::parseLocal()
+{
+    Type * type = parseType();
+    if (!type) {
+        return false;
+    }
+
+    std::string_view name = token();
+    if (name.empty()) {
+        return error("declare缺少名字");
+    }
+
+    std::vector<int32_t> dims;
+    if (!parseDims(dims)) {
+        return false;
+    }
+
+    if (values.count(name)) {
+        return error("值(" + std::string(name) + ")重复定义");
+    }
+
+    // 指令的结果只登记类型，由指令创建
+    auto pIter = results.find(name);
+    if (pIter != results.end()) {
+        if (!dims.empty()) {
+            return error("指令的结果不能是数组");
+        }
+        pIter->second = type;
+        return atEnd() ? true : error("declare之后有多余的内容");
+    }
+
+    // 局部变量的注释为"; 作用域层级:源程序中的名字"
+    int32_t scopeLevel = 1;
+    std::string realName;
+
+    skipSpace();
+    if (cur < end && *cur == ';') {
+        cur++;
+        skipSpace();
+
+        const char * colon = cur;
+        while (colon < end && *colon != ':') {
+            colon++;
+        }
+
+        if (colon < end) {
+            (void) std::from_chars(cur, colon, scopeLevel);
+            cur = colon + 1;
+            std::string_view rest = token();
+            realName = std::string(rest);
+        }
+    } else if (!atEnd()) {
+        return error("declare之后有多余的内容");
+    }
+
+    if (!dims.empty()) {
+        type = ArrayType::get(type, dims);
+    }
+
+    LocalVariable * var = curFunc->newLocalVarValue(type, realName, scopeLevel);
+    var->setIRName(std::string(name));
+
+    values[name] = var;
+
+    return true;
+}
+
+///
+/// @brief 解析一条指令
+/// @return true：成功
+///
+bool IRParser::parseInst()
+{
+    pending.clear();
+
+    if (accept("entry")) {
+
+        addInst(new EntryInstruction(curFunc));
+
+    } else if (accept("exit")) {
+
+        Value * val = nullptr;
+        if (!atEnd()) {
+            val = operand(token(), 0);
+            if (!val) {
+                return false;
+            }
+        }
+
+        // 与IRGenerator一致，出口指令前的标签为出口标签，返回值所在的局部变量为返回值变量
+        if (lastLabel) {
+            curFunc->setExitLabel(lastLabel);
+        }
+        if (auto retVal = dynamic_cast<LocalVariable *>(val)) {
+            curFunc->setReturnValue(retVal);
+        }
+
+        addInst(new ExitInstruction(curFunc, val));
+
+    } else if (accept("br")) {
+
+        if (!accept("label")) {
+            return error("br之后应为label");
+        }
+
+        std::string_view target = token();
+        if (target.empty()) {
+            return error("br缺少目标标签");
+        }
+
+        addInst(new GotoInstruction(curFunc, intern(target)));
+
+    } else if (accept("bc")) {
+
+        Value * cond = operand(token(), 0);
+        if (!cond) {
+            return false;
+        }
+
+        std::string_view trueLabel, falseLabel;
+        if (accept(',') && accept("label")) {
+            trueLabel = token();
+        }
+        if (accept(',') && accept("label")) {
+            falseLabel = token();
+        }
+        if (trueLabel.empty() || falseLabel.empty()) {
+            return error("bc应为bc 条件, label 真出口, label 假出口");
+        }
+
+        addInst(new BranchInstruction(curFunc, cond, intern(trueLabel), intern(falseLabel)));
+
+    } else if (accept("call")) {
+
+        // 没有返回值的函数调用
+        if (!parseType()) {
+            return false;
+        }
+
+        std::string_view name = token();
+        Function * calledFunc = name.size() > 1 ? module->findFunction(std::string(name.substr(1))) : nullptr;
+        if (!calledFunc) {
+            return error("函数(" + std::string(name) + ")未定义");
+        }
+
+        return parseCall(calledFunc, std::string_view());
+
+    } else if (accept("arg")) {
+
+        Value * val = operand(token(), 0);
+        if (!val) {
+            return false;
+        }
+
+        addInst(new ArgInstruction(curFunc, val));
+
+    } else if (accept('*')) {
+
+        // 写内存：*指针 = 值
+        Value * dst = operand(token(), 0);
+        if (!dst) {
+            return false;
+        }
+        if (!accept('=')) {
+            return error("应为*指针 = 值");
+        }
+        Value * src = operand(token(), 1);
+        if (!src) {
+            return false;
+        }
+
+        addInst(new MoveInstruction(curFunc, dst, src));
+
+    } else {
+
+        std::string_view name = token();
+        if (name.empty()) {
+            return error("不能识别的指令");
+        }
+
+        if (accept(':')) {
+
+            // 标签
+            if (!atEnd()) {
+                return error("标签之后有多余的内容");
+            }
+
+            LabelInstruction * label = new LabelInstruction(curFunc, intern(name));
+            lastLabel = label;
+            addInst(label);
+
+            return true;
+        }
+
+        if (!accept('=')) {
+            return error("不能识别的指令");
+        }
+
+        if (!parseAssign(name)) {
+            return false;
+        }
+    }
+
+    return atEnd() ? true : error("指令之后有多余的内容");
+}
+
+///
+/// @brief 解析形如"名字 = ..."的指令
+/// @param name 赋值目标的名字
+/// @return true：成功
+///
+bool IRParser::parseAssign(std::string_view name)
+{
+    auto pIter = results.find(name);
+
+    if (pIter == results.end()) {
+
+        // 赋值：变量 = 值，或者读内存：变量 = *指针
+        Value * dst = operand(name, 0);
+        if (!dst) {
+            return false;
+        }
+
+        (void) accept('*');
+
+        Value * src = operand(token(), 1);
+        if (!src) {
+            return false;
+        }
+
+        addInst(new MoveInstruction(curFunc, dst, src));
+
+        return true;
+    }
+
+    if (values.count(name)) {
+        return error("指令的结果(" + std::string(name) + ")重复定义");
+    }
+
+    Type * type = pIter->second;
+
+    if (accept("call")) {
+
+        Type * callType = parseType();
+        if (!callType) {
+            return false;
+        }
+
+        std::string_view funcName = token();
+        Function * calledFunc = funcName.size() > 1 ? module->findFunction(std::string(funcName.substr(1))) : nullptr;
+        if (!calledFunc) {
+            return error("函数(" + std::string(funcName) + ")未定义");
+        }
+
+        if (!type) {
+            pIter->second = callType;
+        }
+
+        return parseCall(calledFunc, name);
+    }
+
+    if (!type) {
+        return error("指令的结果(" + std::string(name) + ")没有declare");
+    }
+
+    if (accept("neg")) {
+
+        Value * src = operand(token(), 0);
+        if (!src) {
+            return false;
+        }
+
+        Instruction * inst = new NegInstruction(curFunc, src, type);
+        inst->setIRName(std::string(name));
+        values[name] = inst;
+        addInst(inst);
+
+        return true;
+    }
+
+    if (accept("getelementptr")) {
+
+        PointerType * ptrType = dynamic_cast<PointerType *>(type);
+        if (!ptrType) {
+            return error("getelementptr的结果应为指针类型");
+        }
+
+        Value * base = operand(token(), 0);
+        if (!base) {
+            return false;
+        }
+
+        std::vector<Value *> indices;
+        while (accept('[')) {
+            Value * index = operand(token(), (int32_t) indices.size() + 1);
+            if (!index || !accept(']')) {
+                return index ? error("下标应以]结束") : false;
+            }
+            indices.push_back(index);
+        }
+
+        Instruction * inst = new GetElementPtrInstruction(curFunc, base, indices, ptrType);
+        inst->setIRName(std::string(name));
+        values[name] = inst;
+        addInst(inst);
+
+        return true;
+    }
+
+    // 二元运算与比较运算
+    IRInstOperator op = IRInstOperator::IRINST_OP_MAX;
+
+    if (accept("icmp")) {
+        std::string_view cond = token();
+        for (auto & cmp: compareOps) {
+            if (cmp.name == cond) {
+                op = cmp.op;
+                break;
+            }
+        }
+    } else {
+        std::string_view mnemonic = token();
+        for (auto & bin: binaryOps) {
+            if (bin.name == mnemonic) {
+                op = bin.op;
+                break;
+            }
+        }
+    }
+
+    if (op == IRInstOperator::IRINST_OP_MAX) {
+        return error("不能识别的运算");
+    }
+
+    Value * src1 = operand(token(), 0);
+    if (!src1) {
+        return false;
+    }
+    if (!accept(',')) {
+        return error("两个操作数之间应以,分隔");
+    }
+    Value * src2 = operand(token(), 1);
+    if (!src2) {
+        return false;
+    }
+
+    Instruction * inst = new BinaryInstruction(curFunc, op, src1, src2, type);
+    inst->setIRName(std::string(name));
+    values[name] = inst;
+    addInst(inst);
+
+    return true;
+}
+
+///
+/// @brief 解析call指令中函数名之后的实参列表
+/// @param calledFunc 被调用函数
+/// @param result 结果的名字，void函数为空串
+/// @return true：成功
+///
+bool IRParser::parseCall(Function * calledFunc, std::string_view result)
+{
+    if (!accept('(')) {
+        return error("函数名之后应为(");
+    }
+
+    std::vector<Value *> args;
+
+    while (!accept(')')) {
+
+        if (!args.empty() && !accept(',')) {
+            return error("实参之间应以,分隔");
+        }
+
+        // 实参写成"类型 值"，数组实参在值后附带维度，维度只是显示用，值本身已有类型
+        if (!parseType()) {
+            return false;
+        }
+
+        Value * arg = operand(token(), (int32_t) args.size());
+        if (!arg) {
+            return false;
+        }
+
+        std::vector<int32_t> dims;
+        if (!parseDims(dims)) {
+            return false;
+        }
+
+        args.push_back(arg);
+    }
+
+    // 与IRGenerator一致，统计函数调用与实参个数的最大值
+    curFunc->setExistFuncCall(true);
+    if (!calledFunc->getParams().empty() && (int32_t) args.size() > curFunc->getMaxFuncCallArgCnt()) {
+        curFunc->setMaxFuncCallArgCnt((int32_t) args.size());
+    }
+
+    Type * type = result.empty() ? VoidType::getType() : results[result];
+
+    Instruction * inst = new FuncCallInstruction(curFunc, calledFunc, args, type);
+
+    if (!result.empty()) {
+        inst->setIRName(std::string(result));
+        values[result] = inst;
+    }
+
+    addInst(inst);
+
+    return true;
+}
+
+///
+/// @brief 解析类型，包括i32、i1、void以及指针
+/// @return 类型，出错时为空指针
+///
+Type * IRParser::parseType()
+{
+    Type * type;
+
+    if (accept("i32")) {
+        type = IntegerType::getTypeInt();
+    } else if (accept("i1")) {
+        type = IntegerType::getTypeBool();
+    } else if (accept("void")) {
+        type = VoidType::getType();
+    } else {
+        error("不能识别的类型");
+        return nullptr;
+    }
+
+    while (accept('*')) {
+        type = const_cast<PointerType *>(PointerType::get(type));
+    }
+
+    return type;
+}
+
+///
+/// @brief 解析形如[2][3]的维度
+/// @param dims 维度
+/// @return true：成功
+///
+bool IRParser::parseDims(std::vector<int32_t> & dims)
+{
+    while (accept('[')) {
+
+        std::string_view val = token();
+
+        int32_t dim;
+        if (std::from_chars(val.data(), val.data() + val.size(), dim).ptr != val.data() + val.size() || val.empty() ||
+            dim < 0) {
+            return error("数组的维度应为非负整数");
+        }
+
+        if (!accept(']')) {
+            return error("数组的维度应以]结束");
+        }
+
+        dims.push_back(dim);
+    }
+
+    return true;
+}
+
+///
+/// @brief 获取操作数，先使用后定义的指令结果暂时用占位值代替，记录后在函数结束时回填
+/// @param name 名字或者整数常量
+/// @param pos 在指令中的操作数位置
+/// @return 值，出错时为空指针
+///
+Value * IRParser::operand(std::string_view name, int32_t pos)
+{
+    if (name.empty()) {
+        error("缺少操作数");
+        return nullptr;
+    }
+
+    if (name[0] == '-' || (name[0] >= '0' && name[0] <= '9')) {
+
+        int32_t intVal;
+        if (std::from_chars(name.data(), name.data() + name.size(), intVal).ptr != name.data() + name.size()) {
+            error("不能识别的整数(" + std::string(name) + ")");
+            return nullptr;
+        }
+
+        return module->newConstInt(intVal);
+    }
+
+    if (name[0] == '@') {
+
+        auto pIter = globals.find(name);
+        if (pIter == globals.end()) {
+            error("全局变量(" + std::string(name) + ")未定义");
+            return nullptr;
+        }
+
+        return pIter->second;
+    }
+
+    auto pIter = values.find(name);
+    if (pIter != values.end()) {
+        return pIter->second;
+    }
+
+    if (results.count(name)) {
+        // 指令的结果在后面定义，先占位
+        pending.emplace_back(pos, name);
+        return placeholder;
+    }
+
+    error("值(" + std::string(name) + ")未定义");
+    return nullptr;
+}
+
+///
+/// @brief 把指令加入当前函数，并登记该指令待回填的操作数
+/// @param inst 指令
+///
+void IRParser::addInst(Instruction * inst)
+{
+    for (auto & use: pending) {
+        fixups.push_back({inst, use.first, use.second, lineIndex});
+    }
+    pending.clear();
+
+    curFunc->getInterCode().addInst(inst);
+}
+
+///
+/// @brief 跳过空白
+///
+void IRParser::skipSpace()
+{
+    while (cur < end && (*cur == ' ' || *cur == '\t' || *cur == '\r')) {
+        cur++;
+    }
+}
+
+///
+/// @brief 当前行是否已经结束，分号开始的注释也算结束
+/// @return true：结束
+///
+bool IRParser::atEnd()
+{
+    skipSpace();
+    return cur >= end || *cur == ';';
+}
+
+///
+/// @brief 匹配一个字符
+/// @param ch 字符
+/// @return true：匹配并跳过
+///
+bool IRParser::accept(char ch)
+{
+    skipSpace();
+    if (cur < end && *cur == ch) {
+        cur++;
+        return true;
+    }
+    return false;
+}
+
+///
+/// @brief 匹配一个关键字，关键字后必须是分隔符
+/// @param word 关键字
+/// @return true：匹配并跳过
+///
+bool IRParser::accept(std::string_view word)
+{
+    skipSpace();
+
+    size_t len = word.size();
+    if ((size_t) (end - cur) < len || std::string_view(cur, len) != word) {
+        return false;
+    }
+
+    if (cur + len < end && !isDelimiter(cur[len])) {
+        return false;
+    }
+
+    cur += len;
+    return true;
+}
+
+///
+/// @brief 读取一个名字或者整数
+/// @return 词法单元，没有时为空
+///
+std::string_view IRParser::token()
+{
+    skipSpace();
+
+    const char * start = cur;
+    while (cur < end && !isDelimiter(*cur)) {
+        cur++;
+    }
+
+    return std::string_view(start, cur - start);
+}
+
+///
+/// @brief 当前行开始解析
+/// @param index 行号，从0开始
+///
+void IRParser::setLine(size_t index)
+{
+    lineIndex = index;
+
+    if (index < lines.size()) {
+        cur = lines[index].data();
+        end = cur + lines[index].size();
+    } else {
+        cur = end = nullptr;
+    }
+}
+
+///
+/// @brief 输出带行号的错误信息
+/// @param msg 错误信息
+/// @return 总是false
+///
+bool IRParser::error(const std::string & msg)
+{
+    minic_log(LOG_ERROR, "IR文件第%d行：%s", (int) lineIndex + 1, msg.c_str());
+    return false;
+}
@@ -0,0 +1,273 @@
+///
+/// @file IRParser.h
+/// @brief DragonIR文本的解析器，从Module::outputIR输出的文本重建Module
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "Function.h"
+#include "Module.h"
+
+///
+/// @brief DragonIR文本解析器
+///
+/// 手写的按行扫描的解析器，整个文件一次读入内存，词法单元都是指向缓冲区的string_view，
+/// 不使用正则表达式。第一遍创建全局变量与所有函数的原型，使得函数可以前向调用；
+/// 第二遍逐个函数解析declare语句与指令，重建LocalVariable、指令及其Use边。
+/// 指令的结果在declare中只有类型，先扫描函数体中的"名字 = 运算"确定哪些名字是指令的结果，
+/// 其余没有初始化的declare为局部变量。文本中先使用后定义的指令结果，在函数解析完毕后回填操作数。
+/// 标签都创建为有名字的Label指令，跳转按名字进行，保证重新输出的文本与输入一致。
+///
+class IRParser {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _module 要填充的模块，应只含有内置函数
+    ///
+    explicit IRParser(Module * _module);
+
+    ///
+    /// @brief 解析DragonIR文件
+    /// @param filePath 文件路径
+    /// @return true：成功，false：文件不能读取或者有语法错误
+    ///
+    bool run(const std::string & filePath);
+
+protected:
+    ///
+    /// @brief 待回填的操作数
+    ///
+    struct Fixup {
+        Instruction * inst;
+        int32_t pos;
+        std::string_view name;
+        size_t line;
+    };
+
+    ///
+    /// @brief 函数体的位置，第二遍解析时使用
+    ///
+    struct Body {
+        Function * func;
+        size_t first;
+        size_t last;
+        std::vector<std::string_view> params;
+    };
+
+    ///
+    /// @brief 第一遍：全局变量与函数原型
+    /// @return true：成功
+    ///
+    bool parseDeclarations();
+
+    ///
+    /// @brief 解析全局变量的declare语句
+    /// @return true：成功
+    ///
+    bool parseGlobal();
+
+    ///
+    /// @brief 解析函数头，创建函数及其形参
+    /// @param body 记录函数与形参的名字
+    /// @return true：成功
+    ///
+    bool parseFunctionHeader(Body & body);
+
+    ///
+    /// @brief 第二遍：解析函数体
+    /// @param body 函数体的位置
+    /// @return true：成功
+    ///
+    bool parseFunctionBody(const Body & body);
+
+    ///
+    /// @brief 解析函数体内的declare语句
+    /// @return true：成功
+    ///
+    bool parseLocal();
+
+    ///
+    /// @brief 解析一条指令
+    /// @return true：成功
+    ///
+    bool parseInst();
+
+    ///
+    /// @brief 解析形如"名字 = ..."的指令
+    /// @param name 赋值目标的名字
+    /// @return true：成功
+    ///
+    bool parseAssign(std::string_view name);
+
+    ///
+    /// @brief 解析call指令中函数名之后的实参列表
+    /// @param calledFunc 被调用函数
+    /// @param result 结果的名字，void函数为空串
+    /// @return true：成功
+    ///
+    bool parseCall(Function * calledFunc, std::string_view result);
+
+    ///
+    /// @brief 解析类型，包括i32、i1、void以及指针
+    /// @return 类型，出错时为空指针
+    ///
+    Type * parseType();
+
+    ///
+    /// @brief 解析形如[2][3]的维度
+    /// @param dims 维度
+    /// @return true：成功
+    ///
+    bool parseDims(std::vector<int32_t> & dims);
+
+    ///
+    /// @brief 获取操作数，先使用后定义的指令结果暂时用占位值代替，记录后在函数结束时回填
+    /// @param name 名字或者整数常量
+    /// @param pos 在指令中的操作数位置
+    /// @return 值，出错时为空指针
+    ///
+    Value * operand(std::string_view name, int32_t pos);
+
+    ///
+    /// @brief 把指令加入当前函数，并登记该指令待回填的操作数
+    /// @param inst 指令
+    ///
+    void addInst(Instruction * inst);
+
+    ///
+    /// @brief 跳过空白
+    ///
+    void skipSpace();
+
+    ///
+    /// @brief 当前行是否已经结束，分号开始的注释也算结束
+    /// @return true：结束
+    ///
+    bool atEnd();
+
+    ///
+    /// @brief 匹配一个字符
+    /// @param ch 字符
+    /// @return true：匹配并跳过
+    ///
+    bool accept(char ch);
+
+    ///
+    /// @brief 匹配一个关键字，关键字后必须是分隔符
+    /// @param word 关键字
+    /// @return true：匹配并跳过
+    ///
+    bool accept(std::string_view word);
+
+    ///
+    /// @brief 读取一个名字或者整数
+    /// @return 词法单元，没有时为空
+    ///
+    std::string_view token();
+
+    ///
+    /// @brief 当前行开始解析
+    /// @param index 行号，从0开始
+    ///
+    void setLine(size_t index);
+
+    ///
+    /// @brief 输出带行号的错误信息
+    /// @param msg 错误信息
+    /// @return 总是false
+    ///
+    bool error(const std::string & msg);
+
+private:
+    ///
+    /// @brief 要填充的模块
+    ///
+    Module * module;
+
+    ///
+    /// @brief 文件内容
+    ///
+    std::string text;
+
+    ///
+    /// @brief 每一行的内容，指向text
+    ///
+    std::vector<std::string_view> lines;
+
+    ///
+    /// @brief 当前行号，从0开始
+    ///
+    size_t lineIndex = 0;
+
+    ///
+    /// @brief 当前行中的位置
+    ///
+    const char * cur = nullptr;
+
+    ///
+    /// @brief 当前行的结束位置
+    ///
+    const char * end = nullptr;
+
+    ///
+    /// @brief 当前函数
+    ///
+    Function * curFunc = nullptr;
+
+    ///
+    /// @brief 当前函数中最近的标签，出口指令前的标签为出口标签
+    ///
+    Instruction * lastLabel = nullptr;
+
+    ///
+    /// @brief 全局变量，按IR名字查找
+    ///
+    std::unordered_map<std::string_view, Value *> globals;
+
+    ///
+    /// @brief 函数体，按函数的先后次序
+    ///
+    std::vector<Body> bodies;
+
+    ///
+    /// @brief 当前函数的形参、局部变量与指令结果，按IR名字查找
+    ///
+    std::unordered_map<std::string_view, Value *> values;
+
+    ///
+    /// @brief 当前函数中指令结果的名字与类型，declare时先登记
+    ///
+    std::unordered_map<std::string_view, Type *> results;
+
+    ///
+    /// @brief 当前指令中先使用后定义的操作数
+    ///
+    std::vector<std::pair<int32_t, std::string_view>> pending;
+
+    ///
+    /// @brief 当前函数中待回填的操作数
+    ///
+    std::vector<Fixup> fixups;
+
+    ///
+    /// @brief 先使用后定义时操作数的占位值
+    ///
+    Value * placeholder = nullptr;
+};
@@ -3,8 +3,8 @@
 /// @brief 整型类型类，可描述1位的bool类型或32位的int类型
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,23 +12,21 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>唯一实例改为首次使用时创建，与静态初始化的次序无关
 /// </table>
 ///
 
 #include "IntegerType.h"
 
-///
-/// @brief 唯一的VOID类型实例
-///
-IntegerType * IntegerType::oneInstanceBool = new IntegerType(1);
-IntegerType * IntegerType::oneInstanceInt = new IntegerType(32);
-
 ///
 /// @brief 获取类型bool
 /// @return VoidType*
 ///
 IntegerType * IntegerType::getTypeBool()
 {
+    // 局部静态变量的初始化是线程安全的，其它文件的静态初始化中也可使用
+    static IntegerType * oneInstanceBool = new IntegerType(1);
+
     return oneInstanceBool;
 }
 
@@ -38,5 +36,7 @@ IntegerType * IntegerType::getTypeBool()
 ///
 IntegerType * IntegerType::getTypeInt()
 {
+    static IntegerType * oneInstanceInt = new IntegerType(32);
+
     return oneInstanceInt;
 }
@@ -3,8 +3,8 @@
 /// @brief Label名称符号类
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>唯一实例改为首次使用时创建，与静态初始化的次序无关
 /// </table>
 ///
 
@@ -46,9 +47,4 @@ private:
     ///
     explicit LabelType() : Type(Type::LabelTyID)
     {}
-
-    ///
-    /// @brief 唯一的VOID类型实例
-    ///
-    static LabelType * oneInstance;
 };
@@ -33,8 +33,8 @@ User::User(Type * _type) : Value(_type)
 ///
 void User::setOperand(int32_t pos, Value * val)
 {
-    if (pos < (int32_t) uses.size()) {
-        uses[pos]->setUsee(val);
+    if (pos < (int32_t) operands.size()) {
+        operands[pos]->setUsee(val);
     }
 }
 
@@ -49,7 +49,7 @@ void User::addOperand(Value * val)
     auto use = new Use(val, this);
 
     // 增加到操作数中
-    uses.push_back(use);
+    operands.push_back(use);
 
     // 该val被使用
     val->addUse(use);
@@ -61,7 +61,7 @@ void User::addOperand(Value * val)
 ///
 void User::removeOperand(Value * val)
 {
-    for (auto & use: uses) {
+    for (auto & use: operands) {
         if (use->getUsee() == val) {
             // 找到了就删除这个Use
             use->remove();
@@ -78,11 +78,11 @@ void User::removeOperand(Value * val)
 void User::removeOperand(int pos)
 {
     // 检索并清除边，使得边的两头都会自动减少
-    if (pos < (int32_t) uses.size()) {
+    if (pos < (int32_t) operands.size()) {
 
-        // 必须先暂存后释放，不能直接delete uses[pos]
+        // 必须先暂存后释放，不能直接delete operands[pos]
         // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
-        Use * use = uses[pos];
+        Use * use = operands[pos];
         use->remove();
         delete use;
     }
@@ -94,9 +94,9 @@ void User::removeOperand(int pos)
 ///
 void User::removeOperandRaw(Use * use)
 {
-    auto pIter = std::find(uses.begin(), uses.end(), use);
-    if (pIter != uses.end()) {
-        uses.erase(pIter);
+    auto pIter = std::find(operands.begin(), operands.end(), use);
+    if (pIter != operands.end()) {
+        operands.erase(pIter);
     }
 }
 
@@ -106,8 +106,8 @@ void User::removeOperandRaw(Use * use)
 ///
 void User::removeUse(Use * use)
 {
-    auto pIter = std::find(uses.begin(), uses.end(), use);
-    if (pIter != uses.end()) {
+    auto pIter = std::find(operands.begin(), operands.end(), use);
+    if (pIter != operands.end()) {
         use->remove();
     }
 }
@@ -117,12 +117,12 @@ void User::removeUse(Use * use)
 ///
 void User::clearOperands()
 {
-    for (int32_t pos = 0; pos < (int32_t) uses.size();) {
+    for (int32_t pos = 0; pos < (int32_t) operands.size();) {
 
-        // 必须先暂存后释放，不能直接delete uses[pos]
+        // 必须先暂存后释放，不能直接delete operands[pos]
         // 这是因为use->remove会删除operands的元素，使得operands[pos]的对象不再是原来的对象
 
-        Use * use = uses[pos];
+        Use * use = operands[pos];
         use->remove();
         delete use;
     }
@@ -133,7 +133,7 @@ void User::clearOperands()
 ///
 std::vector<Use *> & User::getOperands()
 {
-    return uses;
+    return operands;
 }
 
 ///
@@ -143,7 +143,7 @@ std::vector<Use *> & User::getOperands()
 std::vector<Value *> User::getOperandsValue()
 {
     std::vector<Value *> operandsVec;
-    for (auto & use: uses) {
+    for (auto & use: operands) {
         operandsVec.emplace_back(use->getUsee());
     }
     return operandsVec;
@@ -155,7 +155,7 @@ std::vector<Value *> User::getOperandsValue()
 ///
 int32_t User::getOperandsNum()
 {
-    return (int32_t) uses.size();
+    return (int32_t) operands.size();
 }
 
 ///
@@ -165,8 +165,8 @@ int32_t User::getOperandsNum()
 ///
 Value * User::getOperand(int32_t pos)
 {
-    if (pos < (int32_t) uses.size()) {
-        return uses[pos]->getUsee();
+    if (pos < (int32_t) operands.size()) {
+        return operands[pos]->getUsee();
     }
 
     return nullptr;
@@ -106,4 +106,10 @@ public:
     /// @brief 清除所有的操作数
     ///
     void clearOperands();
+
+protected:
+    ///
+    /// @brief 操作数，即本User使用的Value的边。与Value::uses（使用本Value的边）分开存放
+    ///
+    std::vector<Use *> operands;
 };
\ No newline at end of file
@@ -3,8 +3,8 @@
 /// @brief 值操作类型，所有的变量、函数、常量都是Value
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>获取名字不再复制
 /// </table>
 ///
 
@@ -35,7 +36,7 @@ Value::~Value()
 
 /// @brief 获取名字
 /// @return 变量名
-std::string Value::getName() const
+const std::string & Value::getName() const
 {
     return name;
 }
@@ -125,6 +126,26 @@ bool Value::getMemoryAddr(int32_t * regId, int64_t * offset)
     return false;
 }
 
+///
+/// @brief 设置分配的寄存器编号，不能分配寄存器的Value忽略
+/// @param regId 寄存器编号
+///
+void Value::setRegId(int32_t regId)
+{
+    (void) regId;
+}
+
+///
+/// @brief 设置内存寻址的基址寄存器和偏移，不能分配栈空间的Value忽略
+/// @param regId 基址寄存器编号
+/// @param offset 偏移
+///
+void Value::setMemoryAddr(int32_t regId, int64_t offset)
+{
+    (void) regId;
+    (void) offset;
+}
+
 ///
 /// @brief 对该Value进行Load用的寄存器编号
 /// @return int32_t 寄存器编号
@@ -3,8 +3,8 @@
 /// @brief 值操作类型，所有的变量、函数、常量都是Value
 ///
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -12,6 +12,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>获取名字不再复制
 /// </table>
 ///
 #pragma once
@@ -58,7 +59,7 @@ public:
 
     /// @brief 获取名字
     /// @return 变量名
-    [[nodiscard]] virtual std::string getName() const;
+    [[nodiscard]] virtual const std::string & getName() const;
 
     ///
     /// @brief 设置名字
@@ -113,6 +114,19 @@ public:
     ///
     virtual bool getMemoryAddr(int32_t * regId = nullptr, int64_t * offset = nullptr);
 
+    ///
+    /// @brief 设置分配的寄存器编号，不能分配寄存器的Value忽略
+    /// @param regId 寄存器编号
+    ///
+    virtual void setRegId(int32_t regId);
+
+    ///
+    /// @brief 设置内存寻址的基址寄存器和偏移，不能分配栈空间的Value忽略
+    /// @param regId 基址寄存器编号
+    /// @param offset 偏移
+    ///
+    virtual void setMemoryAddr(int32_t regId, int64_t offset);
+
     ///
     /// @brief 对该Value进行Load用的寄存器编号
     /// @return int32_t 寄存器编号
@@ -9,8 +9,20 @@
  *
  */
 
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
 #include <string>
+#include <vector>
 #include <getopt.h>
 
 #ifdef _WIN32
@@ -22,12 +34,23 @@
 #include "Antlr4Executor.h"
 #include "CodeGenerator.h"
 #include "CodeGeneratorArm32.h"
+#include "CodeGeneratorArm32Obj.h"
+#include "CodeGeneratorC.h"
+#include "CodeGeneratorLlvm.h"
+#include "CodeGeneratorX86_64.h"
+#include "CodeGeneratorRiscv64.h"
 #include "FlexBisonExecutor.h"
 #include "FrontEndExecutor.h"
 #include "Graph.h"
 #include "IRGenerator.h"
+#include "IRBinaryReader.h"
+#include "IRBinaryWriter.h"
+#include "IRParser.h"
+#include "JitX86_64.h"
+#include "IRInterpreter.h"
 #include "RecursiveDescentExecutor.h"
 #include "Module.h"
+#include "WorkStealingPool.h"
 
 ///
 /// @brief 是否显示帮助信息
@@ -49,6 +72,16 @@ static bool gShowLineIR = false;
 ///
 static bool gShowASM = false;
 
+///
+/// @brief 不输出汇编，直接输出ELF目标文件，目前只支持ARM32
+///
+static bool gEmitObj = false;
+
+///
+/// @brief 不输出汇编，输出文本形式的LLVM IR，与目标CPU无关
+///
+static bool gEmitLlvm = false;
+
 ///
 /// @brief 输出中间IR，含汇编或者自定义IR等，默认输出线性IR
 ///
@@ -74,18 +107,53 @@ static bool gFrontEndRecursiveDescentParsing = false;
 ///
 static bool gAsmAlsoShowIR = false;
 
+///
+/// @brief 在输出汇编时是否进行基本块内的指令调度
+///
+static bool gInstSchedule = false;
+
+///
+/// @brief 直接解释执行线性IR，main函数的返回值作为程序的退出码
+///
+static bool gRunIR = false;
+
+///
+/// @brief 即时编译为x86-64机器码并直接执行，main函数的返回值作为程序的退出码
+///
+static bool gRunJit = false;
+
+///
+/// @brief 输入文件为DragonIR文本，不经过前端与IR产生
+///
+static bool gInputIR = false;
+
+///
+/// @brief 输出二进制形式的DragonIR，而不是文本
+///
+static bool gBinaryIR = false;
+
 /// @brief 优化的级别，即-O后面的数字，默认为0
 static int gOptLevel = 0;
 
 /// @brief 指定CPU目标架构，这里默认为ARM32
 static std::string gCPUTarget = "ARM32";
 
-/// @brief 输入源文件
-static std::string gInputFile;
+/// @brief 输入源文件，多于一个时按批量编译处理
+static std::vector<std::string> gInputFiles;
 
-/// @brief 输出文件，不同的选项输出的内容不同
+/// @brief 输出文件，不同的选项输出的内容不同；批量编译时为输出目录，可不指定
 static std::string gOutputFile;
 
+/// @brief 批量编译的源文件列表，可以是每行一个源文件的响应文件，也可以是目录
+static std::string gBatchList;
+
+/// @brief 并行的线程数，即-j后面的数字，0表示按CPU核数。
+/// 批量编译时同时编译多个源文件，只有一个源文件时ARM32汇编按函数并行产生
+static unsigned gJobs = 1;
+
+/// @brief Graphviz不能多个线程同时使用，并行编译时输出AST图片要加锁
+static std::mutex gGraphvizMutex;
+
 static struct option long_options[] = {
     {"help", no_argument, 0, 'h'},
     {"output", required_argument, 0, 'o'},
@@ -97,6 +165,15 @@ static struct option long_options[] = {
     {"optimize", required_argument, 0, 'O'},
     {"target", required_argument, 0, 't'},
     {"asmir", no_argument, 0, 'c'},
+    {"schedule", no_argument, 0, 's'},
+    {"run", no_argument, 0, 'R'},
+    {"jit", no_argument, 0, 'J'},
+    {"emit-obj", no_argument, 0, 'e'},
+    {"emit-llvm", no_argument, 0, 'l'},
+    {"input-ir", no_argument, 0, 'i'},
+    {"binary-ir", no_argument, 0, 'b'},
+    {"batch", required_argument, 0, 'B'},
+    {"jobs", required_argument, 0, 'j'},
     {0, 0, 0, 0}
 };
 
@@ -105,6 +182,13 @@ static struct option long_options[] = {
 static void showHelp(const std::string & exeName)
 {
     std::cout << exeName + " -S [--symbol] [-A | --antlr4 | -D | --recursive-descent] [-T | --ast | -I | --ir] [-o output | --output=output] source\n";
+    std::cout << exeName + " -S --emit-obj [-A | --antlr4 | -D | --recursive-descent] [-o output | --output=output] source\n";
+    std::cout << exeName + " -S --emit-llvm [-A | --antlr4 | -D | --recursive-descent] [-o output | --output=output] source\n";
+    std::cout << exeName + " -R [-A | --antlr4 | -D | --recursive-descent] source\n";
+    std::cout << exeName + " --jit [-A | --antlr4 | -D | --recursive-descent] source\n";
+    std::cout << exeName + " -S -I --binary-ir [-A | --antlr4 | -D | --recursive-descent] [-o output | --output=output] source\n";
+    std::cout << exeName + " -i [-S [-I | --ir] [-o output | --output=output] | -R | --jit] source.ir\n";
+    std::cout << exeName + " -S [options] [-j N | --jobs=N] [--batch=LIST] [-o outdir | --output=outdir] source...\n";
     std::cout << "Options:\n";
     std::cout << "  -h, --help                 Show this help message\n";
     std::cout << "  -o, --output=FILE          Specify output file\n";
@@ -114,8 +198,47 @@ static void showHelp(const std::string & exeName)
     std::cout << "  -A, --antlr4               Use Antlr4 for lexical and syntax analysis\n";
     std::cout << "  -D, --recursive-descent    Use recursive descent parsing\n";
     std::cout << "  -O, --optimize=LEVEL       Set optimization level\n";
-    std::cout << "  -t, --target=CPU           Specify target CPU architecture\n";
+    std::cout << "  -t, --target=CPU           Specify target CPU architecture: ARM32 (default), X86_64, RISCV64, C\n";
     std::cout << "  -c, --asmir                Show IR instructions as comments in assembly output\n";
+    std::cout << "  -s, --schedule             Schedule instructions within basic blocks (also enabled by -O1)\n";
+    std::cout << "  -R, --run                  Interpret the generated IR, exit code is the return value of main\n";
+    std::cout << "  -i, --input-ir             Read DragonIR (text or binary) instead of MiniC source\n";
+    std::cout << "      --binary-ir            Output DragonIR in the binary module format\n";
+    std::cout << "      --emit-obj             Output an ELF32 ARM object file instead of assembly\n";
+    std::cout << "      --emit-llvm            Output textual LLVM IR instead of assembly\n";
+    std::cout << "      --jit                  JIT compile to x86-64 machine code and run, exit code is the return value of main\n";
+    std::cout << "      --batch=LIST           Compile every source in LIST (a file with one source per line, or a directory)\n";
+    std::cout << "                             into its own output, -o gives the output directory\n";
+    std::cout << "  -j, --jobs=N               Use N threads, 0 uses all cores: compile N sources at once in batch mode,\n";
+    std::cout << "                             or generate ARM32 assembly for N functions at once for a single source\n";
+}
+
+/// @brief 是否批量编译，即指定了源文件列表或者多个源文件
+/// @return true：批量编译
+static bool isBatch()
+{
+    return !gBatchList.empty() || gInputFiles.size() > 1;
+}
+
+/// @brief 根据选项确定输出文件的扩展名
+/// @return 扩展名，含.
+static std::string outputSuffix()
+{
+    if (gShowAST) {
+        return ".png";
+    } else if (gShowLineIR && gBinaryIR) {
+        return ".irb";
+    } else if (gShowLineIR) {
+        return ".ir";
+    } else if (gEmitObj) {
+        return ".o";
+    } else if (gEmitLlvm) {
+        return ".ll";
+    } else if (gCPUTarget == "C") {
+        return ".c";
+    }
+
+    return ".s";
 }
 
 /// @brief 参数解析与有效性检查
@@ -133,8 +256,17 @@ static int ArgsAnalysis(int argc, char * argv[])
     // -o要求必须带有附加参数，指定输出的文件
     // -O要求必须带有附加整数，指明优化的级别
     // -t要求必须带有目标CPU，指明目标CPU的汇编
+    // -s指定时对汇编指令进行基本块内的指令调度
     // -c选项在输出汇编时有效，附带输出IR指令内容
-    const char options[] = "ho:STIADO:t:c";
+    // -R指定时不输出文件，直接解释执行产生的线性IR，此时可不指定-S
+    // -i指定时输入文件为DragonIR文本或二进制，跳过前端与IR产生，不能与-T同时使用
+    // --binary-ir只有长选项，在输出中间IR时有效，改为输出二进制形式的DragonIR
+    // --emit-obj只有长选项，在输出汇编时有效，改为不经过汇编器直接输出ARM32的ELF目标文件
+    // --emit-llvm只有长选项，在输出汇编时有效，改为输出文本形式的LLVM IR
+    // --jit只有长选项，与-R类似，但即时编译为x86-64机器码执行
+    // --batch只有长选项，批量编译列表中的源文件，指定多个源文件时也批量编译，-o指定输出目录
+    // -j要求必须带有附加整数，指定并行的线程数，批量编译时按源文件并行，否则ARM32汇编按函数并行
+    const char options[] = "ho:STIADO:t:csRij:";
     int option_index = 0;
 
     opterr = 1;
@@ -181,6 +313,42 @@ lb_check:
             case 'c':
                 gAsmAlsoShowIR = true;
                 break;
+            case 's':
+                gInstSchedule = true;
+                break;
+            case 'R':
+                gRunIR = true;
+                break;
+            case 'i':
+                gInputIR = true;
+                break;
+            case 'b':
+                gBinaryIR = true;
+                break;
+            case 'J':
+                gRunJit = true;
+                break;
+            case 'e':
+                gEmitObj = true;
+                break;
+            case 'l':
+                gEmitLlvm = true;
+                break;
+            case 'B':
+                gBatchList = optarg;
+                break;
+            case 'j': {
+                // 线程数必须是非负的十进制整数，0表示按CPU核数
+                char * end = nullptr;
+                errno = 0;
+                long jobs = std::strtol(optarg, &end, 10);
+                if ((end == optarg) || (*end != '\0') || (errno != 0) || (jobs < 0) || (jobs > INT32_MAX)) {
+                    minic_log(LOG_ERROR, "线程数(%s)不正确", optarg);
+                    return -1;
+                }
+                gJobs = (unsigned) jobs;
+                break;
+            }
             default:
                 return -1;
                 break; /* no break */
@@ -192,14 +360,8 @@ lb_check:
 
     if (argc >= 1) {
 
-        // 第一次设置
-        if (gInputFile.empty()) {
-
-            gInputFile = argv[0];
-        } else {
-            // 重复设置则出错
-            return -1;
-        }
+        // 多个源文件时批量编译
+        gInputFiles.push_back(argv[0]);
 
         if (argc > 1) {
             // 多余一个参数，则说明输入的源文件后仍然有参数要解析
@@ -208,37 +370,54 @@ lb_check:
         }
     }
 
-    // 必须指定要进行编译的输入文件
-    if (gInputFile.empty()) {
+    // 必须指定要进行编译的输入文件，批量编译时源文件也可来自列表
+    if (gInputFiles.empty() && gBatchList.empty()) {
         return -1;
     }
 
     // 显示符号信息，必须指定，可选抽象语法树、中间IR(DragonIR)等显示
-    if (!gShowSymbol) {
+    if (!gShowSymbol && !gRunIR && !gRunJit) {
         return -1;
     }
 
-    int flag = (int) gShowLineIR + (int) gShowAST;
+    int flag = (int) gShowLineIR + (int) gShowAST + (int) gRunIR + (int) gRunJit;
 
     if (0 == flag) {
         // 没有指定，则输出汇编指令
         gShowASM = true;
     } else if (flag != 1) {
-        // 线性中间IR、抽象语法树只能同时选择一个
+        // 线性中间IR、抽象语法树、解释执行只能同时选择一个
         return -1;
     }
 
-    // 没有指定输出文件则产生默认文件
-    if (gOutputFile.empty()) {
+    if (gInputIR && gShowAST) {
+        // DragonIR文本没有抽象语法树
+        return -1;
+    }
 
-        // 默认文件名
-        if (gShowAST) {
-            gOutputFile = "output.png";
-        } else if (gShowLineIR) {
-            gOutputFile = "output.ir";
-        } else {
-            gOutputFile = "output.s";
-        }
+    if (gRunIR || gRunJit) {
+        // 解释执行或即时编译执行不产生输出文件，其退出码只能对应一个源文件
+        return isBatch() ? -1 : 0;
+    }
+
+    if ((gEmitObj || gEmitLlvm) && !gShowASM) {
+        // 目标文件与LLVM IR只能替代汇编输出
+        return -1;
+    }
+
+    if (gBinaryIR && !gShowLineIR) {
+        // 二进制形式只能替代文本形式的中间IR
+        return -1;
+    }
+
+    if (gEmitObj && gEmitLlvm) {
+        // 目标文件与LLVM IR只能选择一个
+        return -1;
+    }
+
+    // 没有指定输出文件则产生默认文件，批量编译时输出文件与源文件同名
+    if (gOutputFile.empty() && !isBatch()) {
+        gOutputFile = "output" + outputSuffix();
     }
 
     return 0;
@@ -269,77 +448,146 @@ static int compile(std::string inputFile, std::string outputFile)
         // 3) 对线性IR进行优化：目前不支持
         // 4) 把线性IR转换成汇编
 
-        // 创建词法语法分析器
-        FrontEndExecutor * frontEndExecutor;
-        if (gFrontEndAntlr4) {
-            // Antlr4
-            frontEndExecutor = new Antlr4Executor(inputFile);
-        } else if (gFrontEndRecursiveDescentParsing) {
-            // 递归下降分析法
-            frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+        if (gInputIR) {
+
+            // 输入为DragonIR，跳过前端与IR产生，直接重建符号表
+            module = new Module(inputFile);
+
+            if (IRBinaryReader::isBinary(inputFile)) {
+                // 二进制形式，映射到内存后直接按表创建
+                IRBinaryReader irReader(module);
+                subResult = irReader.run(inputFile);
+            } else {
+                // 文本形式
+                IRParser irParser(module);
+                subResult = irParser.run(inputFile);
+            }
+
+            if (!subResult) {
+
+                // 输出错误信息
+                minic_log(LOG_ERROR, "IR文件解析错误");
+
+                break;
+            }
         } else {
-            // 默认为Flex+Bison
-            frontEndExecutor = new FlexBisonExecutor(inputFile);
-        }
 
-        // 前端执行：词法分析、语法分析后产生抽象语法树，其root为全局变量ast_root
-        subResult = frontEndExecutor->run();
-        if (!subResult) {
+            // 创建词法语法分析器
+            FrontEndExecutor * frontEndExecutor;
+            if (gFrontEndAntlr4) {
+                // Antlr4
+                frontEndExecutor = new Antlr4Executor(inputFile);
+            } else if (gFrontEndRecursiveDescentParsing) {
+                // 递归下降分析法
+                frontEndExecutor = new RecursiveDescentExecutor(inputFile);
+            } else {
+                // 默认为Flex+Bison
+                frontEndExecutor = new FlexBisonExecutor(inputFile);
+            }
 
-            minic_log(LOG_ERROR, "前端分析错误");
-            // 退出循环
-            break;
-        }
+            // 前端执行：词法分析、语法分析后产生抽象语法树，其root保存在执行器中
+            subResult = frontEndExecutor->run();
+            if (!subResult) {
+
+                minic_log(LOG_ERROR, "前端分析错误");
+
+                // 释放前端资源与已创建的AST节点，批量编译时后续源文件不受影响
+                delete frontEndExecutor;
+                free_ast(nullptr);
+
+                // 退出循环
+                break;
+            }
+
+            // 获取抽象语法树的根节点
+            ast_node * astRoot = frontEndExecutor->getASTRoot();
 
-        // 获取抽象语法树的根节点
-        ast_node * astRoot = frontEndExecutor->getASTRoot();
+            // 清理前端资源
+            delete frontEndExecutor;
 
-        // 清理前端资源
-        delete frontEndExecutor;
+            // 这里可进行非线性AST的优化
 
-        // 这里可进行非线性AST的优化
+            if (gShowAST) {
 
-        if (gShowAST) {
+                // 遍历抽象语法树，生成抽象语法树图片
+                {
+                    std::lock_guard<std::mutex> lock(gGraphvizMutex);
+                    OutputAST(astRoot, outputFile);
+                }
 
-            // 遍历抽象语法树，生成抽象语法树图片
-            OutputAST(astRoot, outputFile);
+                // 清理抽象语法树
+                free_ast(astRoot);
+
+                // 设置返回结果：正常
+                result = 0;
+
+                break;
+            }
+
+            // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
+            // 都需要遍历AST转换成线性IR指令
+
+            // 符号表，保存所有的变量以及函数等信息
+            module = new Module(inputFile);
+
+            // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
+            IRGenerator ast2IR(astRoot, module);
+            subResult = ast2IR.run();
+            if (!subResult) {
+
+                // 输出错误信息
+                minic_log(LOG_ERROR, "中间IR生成错误");
+
+                // 清理抽象语法树
+                free_ast(astRoot);
+
+                break;
+            }
 
             // 清理抽象语法树
             free_ast(astRoot);
+        }
 
-            // 设置返回结果：正常
-            result = 0;
+        if (gRunIR) {
+
+            // 直接解释执行内存中的线性IR，不需要汇编与模拟器
+            IRInterpreter interpreter(module);
+            if (!interpreter.run(result)) {
+                minic_log(LOG_ERROR, "IR解释执行错误");
+                result = -1;
+            }
 
             break;
         }
 
-        // 输出线性中间IR、计算器模拟解释执行、输出汇编指令
-        // 都需要遍历AST转换成线性IR指令
-
-        // 符号表，保存所有的变量以及函数等信息
-        module = new Module(inputFile);
+        if (gRunJit) {
 
-        // 遍历抽象语法树产生线性IR，相关信息保存到符号表中
-        IRGenerator ast2IR(astRoot, module);
-        subResult = ast2IR.run();
-        if (!subResult) {
-
-            // 输出错误信息
-            minic_log(LOG_ERROR, "中间IR生成错误");
+            // 复用x86-64后端的指令选择，编码成机器码后在进程内执行
+            JitX86_64 jit(module);
+            if (!jit.execute(result)) {
+                minic_log(LOG_ERROR, "JIT执行错误");
+                result = -1;
+            }
 
             break;
         }
 
-        // 清理抽象语法树
-        free_ast(astRoot);
-
         if (gShowLineIR) {
 
             // 对IR的名字重命名
             module->renameIR();
 
-            // 输出IR
-            module->outputIR(outputFile);
+            if (gBinaryIR) {
+                // 输出二进制形式的IR
+                IRBinaryWriter irWriter(module);
+                if (!irWriter.run(outputFile)) {
+                    minic_log(LOG_ERROR, "二进制IR产生错误");
+                    break;
+                }
+            } else {
+                // 输出IR
+                module->outputIR(outputFile);
+            }
 
             // 设置返回结果：正常
             result = 0;
@@ -362,11 +610,60 @@ static int compile(std::string inputFile, std::string outputFile)
 
             CodeGenerator * generator = nullptr;
 
-            if (gCPUTarget == "ARM32") {
+            if (gEmitLlvm) {
+                // 输出文本形式的LLVM IR，可由llc翻译成任意目标的汇编
+                generator = new CodeGeneratorLlvm(module);
+                if (!generator->run(outputFile)) {
+                    minic_log(LOG_ERROR, "LLVM IR产生错误");
+                    // 删除不完整的输出文件
+                    std::remove(outputFile.c_str());
+                    delete generator;
+                    break;
+                }
+            } else if (gEmitObj && (gCPUTarget != "ARM32")) {
+                // 集成汇编器目前只有ARM32
+                minic_log(LOG_ERROR, "目标CPU架构(%s)不支持直接输出目标文件", gCPUTarget.c_str());
+                break;
+            } else if (gEmitObj) {
+                // 不经过汇编器，直接输出ARM32的ELF目标文件
+                generator = new CodeGeneratorArm32Obj(module);
+                generator->setInstSchedule(gInstSchedule || (gOptLevel >= 1));
+                if (!generator->run(outputFile)) {
+                    minic_log(LOG_ERROR, "目标文件产生错误");
+                    // 删除不完整的目标文件
+                    std::remove(outputFile.c_str());
+                    delete generator;
+                    break;
+                }
+            } else if (gCPUTarget == "ARM32") {
                 // 输出面向ARM32的汇编指令
                 generator = new CodeGeneratorArm32(module);
                 generator->setShowLinearIR(gAsmAlsoShowIR);
+                generator->setInstSchedule(gInstSchedule || (gOptLevel >= 1));
+                // 批量编译时已按源文件并行，不再按函数并行
+                generator->setJobs(isBatch() ? 1 : gJobs);
+                generator->run(outputFile);
+            } else if (gCPUTarget == "X86_64") {
+                // 输出面向x86-64的汇编指令，可与lib/std.c一起用gcc汇编链接
+                generator = new CodeGeneratorX86_64(module);
+                generator->setShowLinearIR(gAsmAlsoShowIR);
+                generator->run(outputFile);
+            } else if (gCPUTarget == "RISCV64") {
+                // 输出面向RV64IM的汇编指令，采用线性扫描寄存器分配
+                generator = new CodeGeneratorRiscv64(module);
+                generator->setShowLinearIR(gAsmAlsoShowIR);
                 generator->run(outputFile);
+            } else if (gCPUTarget == "C") {
+                // 翻译回C语言源文件，可与lib/std.c一起由宿主的编译器编译
+                generator = new CodeGeneratorC(module);
+                generator->setShowLinearIR(gAsmAlsoShowIR);
+                if (!generator->run(outputFile)) {
+                    minic_log(LOG_ERROR, "C语言源文件产生错误");
+                    // 删除不完整的输出文件
+                    std::remove(outputFile.c_str());
+                    delete generator;
+                    break;
+                }
             } else {
                 // 不支持指定的CPU架构
                 minic_log(LOG_ERROR, "指定的目标CPU架构(%s)不支持", gCPUTarget.c_str());
@@ -389,6 +686,159 @@ static int compile(std::string inputFile, std::string outputFile)
     return result;
 }
 
+/// @brief 读取批量编译的源文件列表
+/// @param list 响应文件或者目录
+/// @param inputs 源文件列表
+/// @return true：成功，false：列表不能读取
+static bool readBatchList(const std::string & list, std::vector<std::string> & inputs)
+{
+    std::error_code ec;
+
+    if (std::filesystem::is_directory(list, ec)) {
+
+        // 目录下的所有源文件，按名字排序保证输出顺序稳定
+        const char * ext = gInputIR ? nullptr : ".c";
+        for (const auto & entry: std::filesystem::directory_iterator(list, ec)) {
+            if (entry.is_regular_file() && (!ext || entry.path().extension() == ext)) {
+                inputs.push_back(entry.path().string());
+            }
+        }
+        std::sort(inputs.begin(), inputs.end());
+
+        return !ec;
+    }
+
+    std::ifstream in(list);
+    if (!in) {
+        return false;
+    }
+
+    // 每行一个源文件，忽略空行与#开头的注释行
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t first = line.find_first_not_of(" \t\r");
+        if (first == std::string::npos || line[first] == '#') {
+            continue;
+        }
+        size_t last = line.find_last_not_of(" \t\r");
+        inputs.push_back(line.substr(first, last - first + 1));
+    }
+
+    return true;
+}
+
+/// @brief 文件的规范路径，用于判断两个路径是否指向同一个文件
+/// @param file 文件路径，可以还不存在
+/// @return 规范路径，./x.c、经过符号链接的路径等与x.c的相同
+static std::string canonicalPath(const std::filesystem::path & file)
+{
+    std::error_code ec;
+    std::filesystem::path result = std::filesystem::weakly_canonical(file, ec);
+    if (ec) {
+        result = std::filesystem::absolute(file, ec).lexically_normal();
+    }
+
+    return result.string();
+}
+
+/// @brief 批量编译，每个源文件产生各自的输出文件，最后输出每个文件的耗时
+/// 指定-j时多个源文件在工作窃取的线程池中并行编译，每个源文件的前端、Module、IRGenerator
+/// 与CodeGenerator都在执行它的线程内创建，互不共享
+/// @return 0：全部成功，-1：有源文件编译失败
+static int compileBatch()
+{
+    std::vector<std::string> inputs = gInputFiles;
+
+    if (!gBatchList.empty() && !readBatchList(gBatchList, inputs)) {
+        minic_log(LOG_ERROR, "批量编译的源文件列表(%s)不能读取", gBatchList.c_str());
+        return -1;
+    }
+
+    if (!gOutputFile.empty()) {
+        std::error_code ec;
+        std::filesystem::create_directories(gOutputFile, ec);
+    }
+
+    std::string suffix = outputSuffix();
+    std::vector<double> millis(inputs.size());
+    std::vector<int> results(inputs.size());
+    int failed = 0;
+
+    // 输出文件与源文件同名，扩展名按选项确定；分发前先全部确定，以便检查冲突
+    // 路径按规范形式比较，同一个文件的不同写法视为相同
+    std::vector<std::filesystem::path> outputs(inputs.size());
+    std::set<std::string> sources;
+    for (auto & input: inputs) {
+        sources.insert(canonicalPath(input));
+    }
+
+    std::map<std::string, std::vector<size_t>> owners;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        std::filesystem::path input(inputs[i]);
+        outputs[i] = gOutputFile.empty() ? input : gOutputFile / input.filename();
+        outputs[i].replace_extension(suffix);
+
+        // 输出文件不能覆盖任何一个源文件，已存在时还要排除硬链接
+        std::string output = canonicalPath(outputs[i]);
+        std::error_code ec;
+        if ((sources.count(output) != 0) || std::filesystem::equivalent(outputs[i], input, ec)) {
+            minic_log(LOG_ERROR, "源文件(%s)的输出文件(%s)是源文件", inputs[i].c_str(), outputs[i].string().c_str());
+            results[i] = -1;
+        } else {
+            owners[output].push_back(i);
+        }
+    }
+
+    // 不同目录下的同名源文件输出到同一个文件时，都不编译，避免相互覆盖
+    for (auto & [output, owner]: owners) {
+        if (owner.size() > 1) {
+            for (size_t i: owner) {
+                minic_log(LOG_ERROR, "源文件(%s)的输出文件(%s)与其它源文件的相同", inputs[i].c_str(), output.c_str());
+                results[i] = -1;
+            }
+        }
+    }
+
+    auto batchStart = std::chrono::steady_clock::now();
+
+    // 线程数不超过源文件的个数
+    WorkStealingPool pool(WorkStealingPool::clampThreads(gJobs, inputs.size()));
+    pool.parallelFor(inputs.size(), [&](size_t i) {
+
+        // 输出文件有冲突的源文件已判定失败
+        if (results[i] != 0) {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+
+        // 每个源文件使用各自的Module、IRGenerator与CodeGenerator，编号计数都从头开始
+        results[i] = compile(inputs[i], outputs[i].string());
+
+        auto stop = std::chrono::steady_clock::now();
+        millis[i] = std::chrono::duration<double, std::milli>(stop - start).count();
+    });
+
+    auto batchStop = std::chrono::steady_clock::now();
+
+    // 每个源文件的编译耗时，按输入的次序输出
+    double total = 0;
+    printf("%10s  %-6s  %s\n", "time(ms)", "result", "source");
+    for (size_t i = 0; i < inputs.size(); i++) {
+        printf("%10.3f  %-6s  %s\n", millis[i], results[i] == 0 ? "ok" : "FAIL", inputs[i].c_str());
+        total += millis[i];
+        if (results[i] != 0) {
+            failed++;
+        }
+    }
+    printf("%10.3f  %zu files, %d failed\n", total, inputs.size(), failed);
+    printf("%10.3f  wall time with %u threads\n",
+           std::chrono::duration<double, std::milli>(batchStop - batchStart).count(),
+           pool.size());
+
+    return failed == 0 ? 0 : -1;
+}
+
 /// @brief 主程序
 /// @param argc
 /// @param argv
@@ -421,8 +871,12 @@ int main(int argc, char * argv[])
         return 0;
     }
 
-    // 参数解析正确，进行编译处理，目前只支持一个文件的编译。
-    result = compile(gInputFile, gOutputFile);
+    // 参数解析正确，进行编译处理，批量编译时逐个编译列表中的源文件
+    if (isBatch()) {
+        result = compileBatch();
+    } else {
+        result = compile(gInputFiles[0], gOutputFile);
+    }
 
     return result;
 }
@@ -2,8 +2,8 @@
 /// @file Module.cpp
 /// @brief  符号表-模块类
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,6 +11,7 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>函数、全局变量与作用域的查找改为按驻留编号
 /// </table>
 ///
 #include "Module.h"
@@ -90,7 +91,7 @@ void Module::setCurrentFunction(Function * current)
 Function * Module::newFunction(std::string name, Type * returnType, std::vector<FormalParam *> params, bool builtin)
 {
     // 先根据函数名查找函数，若找到则出错
-    Function * tempFunc = findFunction(name);
+    Function * tempFunc = findFunction(intern(name));
     if (tempFunc) {
         // 函数已存在
         return nullptr;
@@ -118,9 +119,9 @@ Function * Module::newFunction(std::string name, Type * returnType, std::vector<
 }
 
 /// @brief 根据函数名查找函数信息
-/// @param name 函数名
+/// @param name 函数名的驻留编号
 /// @return 函数信息
-Function * Module::findFunction(std::string name)
+Function * Module::findFunction(Symbol name)
 {
     // 根据名字查找
     auto pIter = funcMap.find(name);
@@ -138,7 +139,7 @@ Function * Module::findFunction(std::string name)
 ///
 void Module::insertFunctionDirectly(Function * func)
 {
-    funcMap.insert({func->getName(), func});
+    funcMap.insert({intern(func->getName()), func});
     funcVector.emplace_back(func);
 }
 
@@ -147,7 +148,7 @@ void Module::insertFunctionDirectly(Function * func)
 /// @param val Value信息
 void Module::insertGlobalValueDirectly(GlobalVariable * val)
 {
-    globalVariableMap.emplace(val->getName(), val);
+    globalVariableMap.emplace(intern(val->getName()), val);
     globalVariableVector.push_back(val);
 }
 
@@ -201,12 +202,12 @@ ConstInt * Module::findConstInt(int32_t val)
 Value * Module::newVarValue(Type * type, std::string name, Constant* globalInitializer)
 {
     Value * retVal;
-    std::string varName;
+    Symbol sym = intern(name);
 
     // 若变量名有效，检查当前作用域中是否存在变量，如存在则语义错误
     // 反之，因无效需创建新的变量名，肯定不现在的不同，不需要查找
     if (!name.empty()) {
-        Value * tempValue = scopeStack->findCurrentScope(name);
+        Value * tempValue = scopeStack->findCurrentScope(sym);
         if (tempValue) {
             // 变量存在，语义错误
             minic_log(LOG_ERROR, "变量(%s)已经存在", name.c_str());
@@ -236,7 +237,7 @@ Value * Module::newVarValue(Type * type, std::string name, Constant* globalIniti
     }
 
     // 增加到作用域中
-    scopeStack->insertValue(retVal);
+    scopeStack->insertValue(sym, retVal);
 
     return retVal;
 }
@@ -244,9 +245,9 @@ Value * Module::newVarValue(Type * type, std::string name, Constant* globalIniti
 /// @brief 查找变量，会根据作用域栈进行逐级查找。
 /// ! 该函数只有在AST遍历生成线性IR中使用，其它地方不能使用
 ///
-/// @param name 变量ID
+/// @param name 变量ID的驻留编号
 /// @return 指针有效则找到，空指针未找到
-Value * Module::findVarValue(std::string name)
+Value * Module::findVarValue(Symbol name)
 {
     // 逐层级作用域查找
     Value * tempValue = scopeStack->findAllScope(name);
@@ -273,7 +274,7 @@ GlobalVariable * Module::newGlobalVariable(Type * type, std::string name, Consta
 /// @param name 变量名或者常量名
 /// @param create 变量查找不到时若为true则自动创建变量型Value，否则不创建
 /// @return 变量对应的值
-GlobalVariable * Module::findGlobalVariable(std::string name)
+GlobalVariable * Module::findGlobalVariable(Symbol name)
 {
     GlobalVariable * temp = nullptr;
 
@@ -2,8 +2,8 @@
 /// @file Module.h
 /// @brief 符号表-模块类
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-29
+/// @version 1.1
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,11 +11,13 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-29 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>函数、全局变量与作用域的查找改为按驻留编号
 /// </table>
 ///
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <vector>
 #include <unordered_map>
 
@@ -23,6 +25,7 @@
 #include "Type.h"
 #include "GlobalVariable.h"
 #include "Function.h"
+#include "StringInterner.h"
 
 class ScopeStack;
 
@@ -54,7 +57,7 @@ public:
     /// @return std::string 汇编代码字符串
     ///
     // 获取模块的名字
-    [[nodiscard]] std::string getName() const
+    [[nodiscard]] const std::string & getName() const
     {
         return name;
     }
@@ -85,10 +88,19 @@ public:
     Function *
     newFunction(std::string name, Type * returnType, std::vector<FormalParam *> params = {}, bool builtin = false);
 
+    /// @brief 根据函数名查找函数信息
+    /// @param name 函数名的驻留编号
+    /// @return 函数信息
+    Function * findFunction(Symbol name);
+
     /// @brief 根据函数名查找函数信息
     /// @param name 函数名
     /// @return 函数信息
-    Function * findFunction(std::string name);
+    Function * findFunction(std::string_view name)
+    {
+        // 没有驻留过的名字不会是函数名
+        return findFunction(StringInterner::instance().lookup(name));
+    }
 
     ///
     /// @brief 获取全局变量列表，用于外部遍历全局变量
@@ -119,9 +131,17 @@ public:
 
     /// @brief 查找变量（全局变量或局部变量），会根据作用域栈进行逐级查找。
     /// ! 该函数只有在AST遍历生成线性IR中使用，其它地方不能使用
+    /// @param name 变量ID的驻留编号
+    /// @return 指针有效则找到，空指针未找到
+    Value * findVarValue(Symbol name);
+
+    /// @brief 查找变量（全局变量或局部变量），会根据作用域栈进行逐级查找。
     /// @param name 变量ID
     /// @return 指针有效则找到，空指针未找到
-    Value * findVarValue(std::string name);
+    Value * findVarValue(std::string_view name)
+    {
+        return findVarValue(StringInterner::instance().lookup(name));
+    }
 
     /// @brief 清理Module中管理的所有信息资源
     void Delete();
@@ -151,9 +171,9 @@ protected:
     GlobalVariable * newGlobalVariable(Type * type, std::string name, Constant* initializer = nullptr);
 
     /// @brief 根据变量名获取当前符号（只管理全局变量）
-    /// \param name 变量名
+    /// \param name 变量名的驻留编号
     /// \return 变量对应的值
-    GlobalVariable * findGlobalVariable(std::string name);
+    GlobalVariable * findGlobalVariable(Symbol name);
 
     /// @brief 直接插入函数到符号表中，不考虑现有的表中是否存在
     /// @param func 函数对象
@@ -184,14 +204,14 @@ private:
     /// @brief 遍历抽象树过程中的当前处理函数
     Function * currentFunc = nullptr;
 
-    /// @brief 函数映射表，函数名-函数，便于检索
-    std::unordered_map<std::string, Function *> funcMap;
+    /// @brief 函数映射表，函数名的驻留编号-函数，便于检索
+    std::unordered_map<Symbol, Function *> funcMap;
 
     /// @brief  函数列表
     std::vector<Function *> funcVector;
 
-    /// @brief 变量名映射表，变量名-变量，只保存全局变量
-    std::unordered_map<std::string, GlobalVariable *> globalVariableMap;
+    /// @brief 变量名映射表，变量名的驻留编号-变量，只保存全局变量
+    std::unordered_map<Symbol, GlobalVariable *> globalVariableMap;
 
     /// @brief 只保存全局变量
     std::vector<GlobalVariable *> globalVariableVector;
@@ -2,8 +2,8 @@
 /// @file ScopeStack.cpp
 /// @brief 作用域栈管理
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-19
+/// @version 1.2
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,18 +11,58 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-19 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>变量名改为驻留编号
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>改为单个开放定址表加遮蔽链与撤销日志
 /// </table>
 ///
 #include "ScopeStack.h"
 
+///
+/// @brief 构造函数
+///
+ScopeStack::ScopeStack() : slots(256)
+{}
+
+///
+/// @brief 查找变量名的表项，不存在时返回空位置
+/// @param name 变量名的驻留编号，不能为0
+/// @return 表项
+///
+ScopeStack::Slot & ScopeStack::findSlot(Symbol name)
+{
+    size_t mask = slots.size() - 1;
+
+    // 驻留编号是连续的小整数，乘以黄金分割常数打散后线性探测
+    for (size_t pos = (name * 2654435769u) & mask;; pos = (pos + 1) & mask) {
+        Slot & slot = slots[pos];
+        if (slot.name == name || slot.name == 0) {
+            return slot;
+        }
+    }
+}
+
+///
+/// @brief 哈希表扩容一倍
+///
+void ScopeStack::grow()
+{
+    std::vector<Slot> oldSlots(slots.size() * 2);
+    oldSlots.swap(slots);
+
+    for (auto & slot: oldSlots) {
+        if (slot.name != 0) {
+            findSlot(slot.name) = slot;
+        }
+    }
+}
+
 ///
 /// @brief 进入作用域
 ///
 void ScopeStack::enterScope()
 {
     // 在栈顶新加入一层，没有变量
-    std::unordered_map<std::string, Value *> valueMap;
-    valueStack.emplace_back(valueMap);
+    scopeStart.push_back((int32_t) bindings.size());
 }
 
 ///
@@ -30,48 +70,85 @@ void ScopeStack::enterScope()
 ///
 void ScopeStack::leaveScope()
 {
-    valueStack.pop_back();
+    int32_t start = scopeStart.back();
+    scopeStart.pop_back();
+
+    // 按逆序撤销本层的绑定，恢复被遮蔽的外层变量
+    for (int32_t k = (int32_t) bindings.size() - 1; k >= start; k--) {
+        findSlot(bindings[k].name).top = bindings[k].shadowed;
+    }
+
+    bindings.resize(start);
 }
 
 ///
-/// @brief 向当前的作用域中加入变量
+/// @brief 向当前的作用域中加入变量，当前作用域中已有同名变量时不加入
+/// @param name 变量名的驻留编号，0表示没有名字的临时变量，不加入
 /// @param value 变量
 ///
-void ScopeStack::insertValue(Value * value)
+void ScopeStack::insertValue(Symbol name, Value * value)
 {
-    valueStack.back().insert(make_pair(value->getName(), value));
+    if (name == 0) {
+        return;
+    }
+
+    Slot * slot = &findSlot(name);
+    if (slot->name == 0) {
+
+        // 新的名字，装载因子超过1/2时先扩容
+        if ((slotCount + 1) * 2 > slots.size()) {
+            grow();
+            slot = &findSlot(name);
+        }
+
+        slot->name = name;
+        slotCount++;
+    }
+
+    int32_t level = getCurrentScopeLevel();
+    if (slot->top >= 0 && bindings[slot->top].level == level) {
+        // 当前作用域中已存在
+        return;
+    }
+
+    bindings.push_back({name, level, slot->top, value});
+    slot->top = (int32_t) bindings.size() - 1;
 }
 
 ///
 /// @brief 从当前的作用域中查找指定的变量名
-/// @param  name 变量名
+/// @param  name 变量名的驻留编号
 /// @return Value* 变量对象，若没有，则返回空指针
 ///
-Value * ScopeStack::findCurrentScope(std::string name)
+Value * ScopeStack::findCurrentScope(Symbol name)
 {
-    // 在栈顶的作用域中查找，即当前作用域
-    auto it = valueStack.back().find(name);
-    if (it != valueStack.back().end()) {
-        return it->second;
+    if (name == 0) {
+        return nullptr;
     }
+
+    // 最内层的绑定在当前作用域才是当前作用域的变量
+    int32_t top = findSlot(name).top;
+    if (top >= 0 && bindings[top].level == getCurrentScopeLevel()) {
+        return bindings[top].value;
+    }
+
     return nullptr;
 }
 
 ///
-/// @brief 逐层级遍历作用域检查变量是否存在
-/// @param  name 变量名
+/// @brief 查找变量，最内层的绑定即结果，与作用域的层数无关
+/// @param  name 变量名的驻留编号
 /// @return Value* 变量对象。若没有，则返回空指针
 ///
-Value * ScopeStack::findAllScope(std::string name)
+Value * ScopeStack::findAllScope(Symbol name)
 {
-    // 模拟栈操作，从栈顶开始查找
-    for (auto it = valueStack.rbegin(); it != valueStack.rend(); ++it) {
-        auto p = it->find(name);
-        if (p != it->end()) {
-            return p->second;
-        }
+    if (name == 0) {
+        return nullptr;
     }
-    return nullptr;
+
+    int32_t top = findSlot(name).top;
+
+    return top >= 0 ? bindings[top].value : nullptr;
 }
 
 ///
@@ -80,5 +157,5 @@ Value * ScopeStack::findAllScope(std::string name)
 ///
 int ScopeStack::getCurrentScopeLevel()
 {
-    return valueStack.size() - 1;
+    return (int) scopeStart.size() - 1;
 }
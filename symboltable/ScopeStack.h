@@ -2,8 +2,8 @@
 /// @file ScopeStack.h
 /// @brief 作用域栈管理
 /// @author zenglj (zenglj@live.com)
-/// @version 1.0
-/// @date 2024-09-19
+/// @version 1.2
+/// @date 2026-10-19
 ///
 /// @copyright Copyright (c) 2024
 ///
@@ -11,34 +11,47 @@
 /// <table>
 /// <tr><th>Date       <th>Version <th>Author  <th>Description
 /// <tr><td>2024-09-19 <td>1.0     <td>zenglj  <td>新建
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>变量名改为驻留编号
+/// <tr><td>2026-10-19 <td>1.2     <td>zenglj  <td>改为单个开放定址表加遮蔽链与撤销日志
 /// </table>
 ///
 #pragma once
 
-#include <unordered_map>
+#include <cstdint>
 #include <vector>
 
+#include "StringInterner.h"
 #include "Value.h"
 
 ///
-/// @brief 变量作用域管理类，内部通过栈来实现
+/// @brief 变量作用域管理类
+///
+/// 所有作用域共用一个按变量名驻留编号开放定址的哈希表，表项指向该名字最内层的绑定，
+/// 每个绑定记录被它遮蔽的外层绑定，形成遮蔽链。绑定按加入次序存放，同时作为撤销日志，
+/// 离开作用域时按逆序恢复被遮蔽的绑定。查找与作用域的深度无关，离开作用域与该层的变量个数成正比。
 ///
 class ScopeStack {
     // 作用域栈
 
 public:
     ///
-    /// @brief 向当前的作用域中加入变量
+    /// @brief 构造函数
+    ///
+    ScopeStack();
+
+    ///
+    /// @brief 向当前的作用域中加入变量，当前作用域中已有同名变量时不加入
+    /// @param name 变量名的驻留编号，0表示没有名字的临时变量，不加入
     /// @param value 变量
     ///
-    void insertValue(Value * value);
+    void insertValue(Symbol name, Value * value);
 
     ///
     /// @brief 从当前的作用域中查找指定的变量名
-    /// @param  name 变量名
+    /// @param  name 变量名的驻留编号
     /// @return Value* 变量对象，若没有，则返回空指针
     ///
-    Value * findCurrentScope(std::string name);
+    Value * findCurrentScope(Symbol name);
 
     ///
     /// @brief 获取当前的作用域栈的层号
@@ -48,10 +61,10 @@ public:
 
     ///
     /// @brief 逐层级遍历作用域检查变量是否存在
-    /// @param  name 变量名
+    /// @param  name 变量名的驻留编号
     /// @return Value* 变量对象。若没有，则返回空指针
     ///
-    Value * findAllScope(std::string name);
+    Value * findAllScope(Symbol name);
 
     ///
     /// @brief 进入作用域
@@ -65,7 +78,62 @@ public:
 
 protected:
     ///
-    /// @brief 变量作用域栈，最外层用vector来模拟栈，每一层用unordered_map来实现，变量名为key，变量为value
+    /// @brief 变量的绑定
+    ///
+    struct Binding {
+        /// @brief 变量名的驻留编号
+        Symbol name;
+
+        /// @brief 所在作用域的层号
+        int32_t level;
+
+        /// @brief 被遮蔽的外层同名绑定的下标，-1表示没有
+        int32_t shadowed;
+
+        /// @brief 变量
+        Value * value;
+    };
+
+    ///
+    /// @brief 哈希表的表项
+    ///
+    struct Slot {
+        /// @brief 变量名的驻留编号，0表示空位置
+        Symbol name = 0;
+
+        /// @brief 最内层绑定的下标，-1表示当前没有绑定
+        int32_t top = -1;
+    };
+
+    ///
+    /// @brief 查找变量名的表项，不存在时返回空位置
+    /// @param name 变量名的驻留编号，不能为0
+    /// @return 表项
+    ///
+    Slot & findSlot(Symbol name);
+
+    ///
+    /// @brief 哈希表扩容一倍
+    ///
+    void grow();
+
+    ///
+    /// @brief 开放定址的哈希表，大小为2的幂。名字一旦加入不再删除，没有绑定时top为-1
+    ///
+    std::vector<Slot> slots;
+
+    ///
+    /// @brief 哈希表中的名字个数
+    ///
+    uint32_t slotCount = 0;
+
+    ///
+    /// @brief 所有作用域中的绑定，按加入次序存放，即撤销日志
+    ///
+    std::vector<Binding> bindings;
+
+    ///
+    /// @brief 每层作用域的第一个绑定在bindings中的下标，栈的大小即作用域的层数
     ///
-    std::vector<std::unordered_map<std::string, Value *>> valueStack;
+    std::vector<int32_t> scopeStart;
 };
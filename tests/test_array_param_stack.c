@@ -0,0 +1,15 @@
+int x[4];
+
+int last(int a[], int b, int c, int d, int e) {
+    return e;
+}
+
+int sum(int a[], int b, int c, int d, int e, int f) {
+    return b + c + d + e * 10 + f * 100;
+}
+
+int main() {
+    putint(last(x, 2, 3, 4, 5));
+    putint(sum(x, 1, 2, 3, 4, 5));
+    return last(x, 2, 3, 4, 5);
+}
@@ -0,0 +1,152 @@
+///
+/// @file SkipBlankBench.cpp
+/// @brief 空白与注释跳过的性能对比程序，SIMD实现对比逐字符实现
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+/// 不参与minic的构建，在仓库根目录下手动编译运行：
+///
+///     g++ -O2 -std=c++17 -Iutils tools/SkipBlankBench.cpp utils/SkipBlank.cpp utils/MappedFile.cpp -o skipbench
+///     ./skipbench [源文件]
+///
+/// 不指定源文件时生成缩进较深且注释较多的MiniC源程序作为输入。
+/// 按词法分析的方式在输入上反复跳过空白与注释、再跳过一个字符，
+/// 检查两种实现得到的位置与行号相同后输出各自的吞吐量。
+///
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "MappedFile.h"
+#include "SkipBlank.h"
+
+/// @brief 跳过空白与注释的函数类型
+typedef const char * (*SkipFunc)(const char *, const char *, int64_t &);
+
+///
+/// @brief 生成缩进较深且注释较多的源程序
+/// @param lines 行数
+/// @return 源程序
+///
+static std::string generateSource(int lines)
+{
+    std::string src;
+
+    for (int i = 0; i < lines; i++) {
+        int depth = i % 8;
+        src.append((size_t) depth * 4, ' ');
+
+        switch (i % 4) {
+            case 0:
+                src += "// 注释：计算第" + std::to_string(i) + "项\n";
+                break;
+            case 1:
+                src += "a = a + " + std::to_string(i) + ";    /* 累加 */\n";
+                break;
+            case 2:
+                src += "/*\n";
+                src.append((size_t) depth * 4 + 1, ' ');
+                src += "* 多行注释 " + std::to_string(i) + "\n";
+                src.append((size_t) depth * 4 + 1, ' ');
+                src += "*/\n";
+                break;
+            default:
+                src += "\tif (a > b) {\n\n";
+                break;
+        }
+    }
+
+    return src;
+}
+
+///
+/// @brief 模拟词法分析扫描整个输入
+/// @param skip 跳过空白与注释的函数
+/// @param begin 输入的起始位置
+/// @param end 输入的结束位置
+/// @param newlines 统计的换行符个数
+/// @return 扫描的Token个数
+///
+static int64_t scan(SkipFunc skip, const char * begin, const char * end, int64_t & newlines)
+{
+    int64_t tokens = 0;
+
+    newlines = 0;
+    for (const char * p = begin; p < end; tokens++) {
+        p = skip(p, end, newlines);
+        if (p < end) {
+            // 其它字符与没有结束的注释都逐个字符前进
+            p++;
+        }
+    }
+
+    return tokens;
+}
+
+///
+/// @brief 测量吞吐量
+/// @param name 实现的名字
+/// @param skip 跳过空白与注释的函数
+/// @param src 输入
+/// @param tokens 扫描的Token个数
+/// @param newlines 统计的换行符个数
+///
+static void measure(const char * name, SkipFunc skip, std::string_view src, int64_t & tokens, int64_t & newlines)
+{
+    const int rounds = 20;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        tokens = scan(skip, src.data(), src.data() + src.size(), newlines);
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    double seconds = std::chrono::duration<double>(stop - start).count();
+    double mbPerSecond = (double) src.size() * rounds / seconds / (1024.0 * 1024.0);
+
+    printf("%-8s %10.1f MB/s  (tokens %lld, newlines %lld)\n",
+           name,
+           mbPerSecond,
+           (long long) tokens,
+           (long long) newlines);
+}
+
+int main(int argc, char * argv[])
+{
+    MappedFile file;
+    std::string generated;
+    std::string_view src;
+
+    if (argc > 1) {
+        if (!file.open(argv[1])) {
+            printf("Can't open file %s\n", argv[1]);
+            return 1;
+        }
+        src = file.view();
+    } else {
+        generated = generateSource(200000);
+        src = generated;
+    }
+
+    printf("input %.1f MB, selected implementation: %s\n", (double) src.size() / (1024.0 * 1024.0), skipBlankImplName());
+
+    int64_t scalarTokens, scalarNewlines, simdTokens, simdNewlines;
+    measure("scalar", skipBlankAndCommentScalar, src, scalarTokens, scalarNewlines);
+    measure(skipBlankImplName(), skipBlankAndComment, src, simdTokens, simdNewlines);
+
+    if (scalarTokens != simdTokens || scalarNewlines != simdNewlines) {
+        printf("mismatch between implementations\n");
+        return 1;
+    }
+
+    return 0;
+}
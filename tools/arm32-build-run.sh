@@ -10,13 +10,6 @@ elif [ $# -gt 0 ]; then
 	casename=$1
 fi
 
-OSKind=$(uname -s)
-OS3264=$(uname -m)
-LinuxDisID=$(lsb_release -i -s)
-LinuxRelease=$(lsb_release -r -s)
-
-IRRunToolPath="${rundir}/tools/IRCompiler/${OSKind}-${OS3264}/${LinuxDisID}-${LinuxRelease}/IRCompiler"
-
 echo "run host"
 
 # 使用clang进行编译直接运行
@@ -28,15 +21,10 @@ fi
 "${rundir}/tests/${casename}-0"
 printf "\n%d\n" $?
 
-echo "IRCompiler run"
-
-# 生成DragonIR
-if ! "${rundir}/cmake-build-debug/minic" -S -I -o "${rundir}/tests/${casename}.ir" "${rundir}/tests/${casename}.c"
-then
-	exit 1
-fi
+echo "minic IR run"
 
-"${IRRunToolPath}" -R "${rundir}/tests/${casename}.ir"
+# 生成DragonIR后直接解释执行，不依赖外部的IRCompiler
+"${rundir}/cmake-build-debug/minic" -R "${rundir}/tests/${casename}.c"
 
 printf "\n%d\n" $?
 
@@ -0,0 +1,81 @@
+///
+/// @file Arena.cpp
+/// @brief 按块分配、整体释放的内存池
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cstdlib>
+
+#include "Arena.h"
+
+Arena::Arena(size_t _chunkSize) : chunkSize(_chunkSize)
+{}
+
+Arena::~Arena()
+{
+    release();
+}
+
+void * Arena::allocateSlow(size_t size, size_t align)
+{
+    // 大对象单独占一块，避免浪费当前块的剩余空间
+    size_t need = sizeof(Chunk) + size + align;
+    size_t bytes = need > chunkSize / 4 ? need : chunkSize;
+
+    Chunk * chunk = static_cast<Chunk *>(malloc(bytes));
+    if (chunk == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    chunkCount++;
+
+    char * begin = reinterpret_cast<char *>(chunk + 1);
+    char * p = alignUp(begin, align);
+
+    if (bytes == chunkSize) {
+        // 新块作为当前块继续分配
+        chunk->next = chunks;
+        chunks = chunk;
+        cur = p + size;
+        end = reinterpret_cast<char *>(chunk) + bytes;
+    } else {
+        // 大对象的块插在当前块之后，当前块仍可继续分配
+        if (chunks) {
+            chunk->next = chunks->next;
+            chunks->next = chunk;
+        } else {
+            chunk->next = nullptr;
+            chunks = chunk;
+        }
+    }
+
+    return p;
+}
+
+void Arena::release()
+{
+    // 按创建的逆序析构
+    for (auto it = cleanups.rbegin(); it != cleanups.rend(); ++it) {
+        it->destroy(it->obj);
+    }
+    cleanups.clear();
+
+    while (chunks) {
+        Chunk * next = chunks->next;
+        free(chunks);
+        chunks = next;
+    }
+
+    cur = nullptr;
+    end = nullptr;
+    chunkCount = 0;
+}
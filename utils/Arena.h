@@ -0,0 +1,213 @@
+///
+/// @file Arena.h
+/// @brief 按块分配、整体释放的内存池
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///
+/// @brief 按块分配、整体释放的内存池
+///
+/// 从大块内存中顺序切分，单个对象不单独释放，release时整块归还。
+/// 需要析构的对象登记在清理表中，release时按创建的逆序析构；
+/// 可平凡析构的对象不登记，此时release只与块的个数有关。
+///
+class Arena {
+
+public:
+    ///
+    /// @brief 构造函数
+    /// @param _chunkSize 每次向系统申请的块大小
+    ///
+    explicit Arena(size_t _chunkSize = 64 * 1024);
+
+    ///
+    /// @brief 析构函数，释放所有的块
+    ///
+    ~Arena();
+
+    Arena(const Arena &) = delete;
+    Arena & operator=(const Arena &) = delete;
+
+    ///
+    /// @brief 分配内存
+    /// @param size 字节数
+    /// @param align 对齐字节数，须为2的幂
+    /// @return 内存的起始地址
+    ///
+    void * allocate(size_t size, size_t align = alignof(std::max_align_t))
+    {
+        char * p = alignUp(cur, align);
+        if (p + size > end || p < cur) {
+            return allocateSlow(size, align);
+        }
+
+        cur = p + size;
+        return p;
+    }
+
+    ///
+    /// @brief 在内存池中创建对象
+    /// @tparam T 对象的类型
+    /// @param args 构造函数的参数
+    /// @return 对象
+    ///
+    template <typename T, typename... Args>
+    T * create(Args &&... args)
+    {
+        T * obj = new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            cleanups.push_back({obj, [](void * p) { static_cast<T *>(p)->~T(); }});
+        }
+
+        return obj;
+    }
+
+    ///
+    /// @brief 析构登记的对象，归还所有的块，内存池可继续使用
+    ///
+    void release();
+
+    ///
+    /// @brief 已分配的块数
+    /// @return 块数
+    ///
+    size_t getChunkCount() const
+    {
+        return chunkCount;
+    }
+
+private:
+    ///
+    /// @brief 块头，块的内容紧随其后
+    ///
+    struct Chunk {
+        Chunk * next;
+    };
+
+    ///
+    /// @brief 需要析构的对象
+    ///
+    struct Cleanup {
+        void * obj;
+        void (*destroy)(void *);
+    };
+
+    ///
+    /// @brief 地址按对齐要求向上取整
+    /// @param p 地址
+    /// @param align 对齐字节数
+    /// @return 对齐后的地址
+    ///
+    static char * alignUp(char * p, size_t align)
+    {
+        return reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(p) + align - 1) & ~(uintptr_t) (align - 1));
+    }
+
+    ///
+    /// @brief 当前块不够时申请新块后分配
+    /// @param size 字节数
+    /// @param align 对齐字节数
+    /// @return 内存的起始地址
+    ///
+    void * allocateSlow(size_t size, size_t align);
+
+    ///
+    /// @brief 块大小
+    ///
+    size_t chunkSize;
+
+    ///
+    /// @brief 当前块中下一个可分配的位置
+    ///
+    char * cur = nullptr;
+
+    ///
+    /// @brief 当前块的结束位置
+    ///
+    char * end = nullptr;
+
+    ///
+    /// @brief 已分配的块，最新的在前
+    ///
+    Chunk * chunks = nullptr;
+
+    ///
+    /// @brief 已分配的块数
+    ///
+    size_t chunkCount = 0;
+
+    ///
+    /// @brief 需要析构的对象
+    ///
+    std::vector<Cleanup> cleanups;
+};
+
+///
+/// @brief 从内存池分配的STL分配器，deallocate不做任何事，内存随内存池整体释放
+/// @tparam T 元素类型
+///
+template <typename T>
+class ArenaAllocator {
+
+public:
+    typedef T value_type;
+
+    ///
+    /// @brief 构造函数
+    /// @param _arena 内存池
+    ///
+    explicit ArenaAllocator(Arena & _arena) : arena(&_arena)
+    {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> & other) : arena(other.arena)
+    {}
+
+    T * allocate(size_t n)
+    {
+        return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T *, size_t)
+    {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> & other) const
+    {
+        return arena == other.arena;
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> & other) const
+    {
+        return arena != other.arena;
+    }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+
+    ///
+    /// @brief 内存池
+    ///
+    Arena * arena;
+};
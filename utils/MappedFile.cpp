@@ -0,0 +1,132 @@
+///
+/// @file MappedFile.cpp
+/// @brief 只读映射到内存的文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cerrno>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define MAPPED_FILE_MMAP_SUPPORTED 1
+#endif
+
+#include "MappedFile.h"
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+bool MappedFile::open(const std::string & filePath)
+{
+    close();
+
+#ifdef MAPPED_FILE_MMAP_SUPPORTED
+    int fd = ::open(filePath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        ::close(fd);
+        return false;
+    }
+
+    if (!S_ISREG(st.st_mode) || (st.st_size == 0)) {
+        // 管道、字符设备等不能映射，大小也不可信；/proc下的文件大小为0但有内容。都改为读到缓冲区
+        bool result = readAll(fd);
+        ::close(fd);
+        return result;
+    }
+
+    void * addr = mmap(nullptr, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    base = static_cast<const char *>(addr);
+    length = (size_t) st.st_size;
+    mapped = true;
+
+    return true;
+#else
+    // 不支持mmap时整个读入
+    FILE * fp = fopen(filePath.c_str(), "rb");
+    if (nullptr == fp) {
+        return false;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long fileSize = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    if (fileSize < 0) {
+        fclose(fp);
+        return false;
+    }
+
+    buffer.resize((size_t) fileSize);
+    size_t readSize = fread(&buffer[0], 1, buffer.size(), fp);
+    fclose(fp);
+
+    base = buffer.data();
+    length = buffer.size();
+
+    return readSize == buffer.size();
+#endif
+}
+
+#ifdef MAPPED_FILE_MMAP_SUPPORTED
+bool MappedFile::readAll(int fd)
+{
+    char chunk[65536];
+
+    for (;;) {
+        ssize_t n = ::read(fd, chunk, sizeof(chunk));
+        if (n > 0) {
+            buffer.append(chunk, (size_t) n);
+        } else if (n == 0) {
+            break;
+        } else if (errno != EINTR) {
+            buffer.clear();
+            return false;
+        }
+    }
+
+    base = buffer.data();
+    length = buffer.size();
+
+    return true;
+}
+#endif
+
+void MappedFile::close()
+{
+#ifdef MAPPED_FILE_MMAP_SUPPORTED
+    if (mapped) {
+        munmap(const_cast<char *>(base), length);
+    }
+#endif
+
+    base = "";
+    length = 0;
+    mapped = false;
+    buffer.clear();
+}
@@ -0,0 +1,108 @@
+///
+/// @file MappedFile.h
+/// @brief 只读映射到内存的文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+///
+/// @brief 只读映射到内存的文件
+///
+/// 支持mmap的系统上把整个普通文件映射到内存，否则整个读入缓冲区。
+/// 管道、/dev/stdin等不是普通文件的输入也整个读入缓冲区。
+/// 词法分析直接用指针扫描其内容，不再逐字符调用fgetc。
+///
+class MappedFile {
+
+public:
+    MappedFile() = default;
+
+    ///
+    /// @brief 析构函数，解除文件映射
+    ///
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    ///
+    /// @brief 打开文件并映射到内存
+    /// @param filePath 文件路径
+    /// @return true：成功，false：文件不能打开或读取
+    ///
+    bool open(const std::string & filePath);
+
+    ///
+    /// @brief 解除文件映射
+    ///
+    void close();
+
+    ///
+    /// @brief 文件内容的起始地址，空文件时不能解引用
+    /// @return 起始地址
+    ///
+    const char * data() const
+    {
+        return base;
+    }
+
+    ///
+    /// @brief 文件大小
+    /// @return 字节数
+    ///
+    size_t size() const
+    {
+        return length;
+    }
+
+    ///
+    /// @brief 文件内容
+    /// @return 内容的视图
+    ///
+    std::string_view view() const
+    {
+        return std::string_view(base, length);
+    }
+
+private:
+    ///
+    /// @brief 把不能映射的文件从当前位置读到结束，放入缓冲区
+    /// @param fd 文件描述符
+    /// @return true：成功，false：读取出错
+    ///
+    bool readAll(int fd);
+
+    ///
+    /// @brief 文件内容的起始地址
+    ///
+    const char * base = "";
+
+    ///
+    /// @brief 文件大小
+    ///
+    size_t length = 0;
+
+    ///
+    /// @brief 是否是mmap映射的内存，否则为读入的缓冲区
+    ///
+    bool mapped = false;
+
+    ///
+    /// @brief 不支持mmap或不能映射时读入的文件内容
+    ///
+    std::string buffer;
+};
@@ -0,0 +1,268 @@
+///
+/// @file SkipBlank.cpp
+/// @brief 词法分析中空白与注释的快速跳过
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#include <immintrin.h>
+#define SKIP_BLANK_SIMD_SUPPORTED 1
+#endif
+
+#include "SkipBlank.h"
+
+///
+/// @brief 跳过空白与查找*的一组实现
+///
+struct SkipBlankKernel {
+
+    /// @brief 跳过连续的空白，返回第一个非空白的位置
+    const char * (*skipSpace)(const char * p, const char * end, int64_t & newlines);
+
+    /// @brief 查找第一个*，返回其位置，没有时返回end
+    const char * (*findStar)(const char * p, const char * end, int64_t & newlines);
+
+    /// @brief 实现的名字
+    const char * name;
+};
+
+/// @brief 逐字符跳过连续的空白
+static const char * skipSpaceScalar(const char * p, const char * end, int64_t & newlines)
+{
+    for (; p < end; p++) {
+        char c = *p;
+        if (c == '\n') {
+            newlines++;
+        } else if (c != ' ' && c != '\t') {
+            break;
+        }
+    }
+
+    return p;
+}
+
+/// @brief 逐字符查找*，并统计之前的换行符
+static const char * findStarScalar(const char * p, const char * end, int64_t & newlines)
+{
+    for (; p < end && *p != '*'; p++) {
+        newlines += (*p == '\n');
+    }
+
+    return p;
+}
+
+#ifdef SKIP_BLANK_SIMD_SUPPORTED
+
+/// @brief 一次判断16个字符跳过连续的空白
+static const char * skipSpaceSse2(const char * p, const char * end, int64_t & newlines)
+{
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+        __m128i isNewline = _mm_cmpeq_epi8(v, newline);
+        __m128i isBlank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)), isNewline);
+
+        uint32_t blankMask = (uint32_t) _mm_movemask_epi8(isBlank);
+        uint32_t newlineMask = (uint32_t) _mm_movemask_epi8(isNewline);
+
+        if (blankMask != 0xFFFF) {
+            // 第一个非空白字符之前的换行符
+            int n = __builtin_ctz(~blankMask);
+            newlines += __builtin_popcount(newlineMask & ((1u << n) - 1));
+            return p + n;
+        }
+
+        newlines += __builtin_popcount(newlineMask);
+        p += 16;
+    }
+
+    return skipSpaceScalar(p, end, newlines);
+}
+
+/// @brief 一次判断16个字符查找*，并统计之前的换行符
+static const char * findStarSse2(const char * p, const char * end, int64_t & newlines)
+{
+    const __m128i star = _mm_set1_epi8('*');
+    const __m128i newline = _mm_set1_epi8('\n');
+
+    while (end - p >= 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+
+        uint32_t starMask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(v, star));
+        uint32_t newlineMask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(v, newline));
+
+        if (starMask != 0) {
+            int n = __builtin_ctz(starMask);
+            newlines += __builtin_popcount(newlineMask & ((1u << n) - 1));
+            return p + n;
+        }
+
+        newlines += __builtin_popcount(newlineMask);
+        p += 16;
+    }
+
+    return findStarScalar(p, end, newlines);
+}
+
+/// @brief 一次判断32个字符跳过连续的空白
+__attribute__((target("avx2,popcnt,bmi"))) static const char *
+skipSpaceAvx2(const char * p, const char * end, int64_t & newlines)
+{
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i newline = _mm256_set1_epi8('\n');
+
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+        __m256i isNewline = _mm256_cmpeq_epi8(v, newline);
+        __m256i isBlank =
+            _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)), isNewline);
+
+        uint32_t blankMask = (uint32_t) _mm256_movemask_epi8(isBlank);
+        uint32_t newlineMask = (uint32_t) _mm256_movemask_epi8(isNewline);
+
+        if (blankMask != 0xFFFFFFFFu) {
+            int n = __builtin_ctz(~blankMask);
+            newlines += __builtin_popcount(newlineMask & ((1u << n) - 1));
+            return p + n;
+        }
+
+        newlines += __builtin_popcount(newlineMask);
+        p += 32;
+    }
+
+    return skipSpaceSse2(p, end, newlines);
+}
+
+/// @brief 一次判断32个字符查找*，并统计之前的换行符
+__attribute__((target("avx2,popcnt,bmi"))) static const char *
+findStarAvx2(const char * p, const char * end, int64_t & newlines)
+{
+    const __m256i star = _mm256_set1_epi8('*');
+    const __m256i newline = _mm256_set1_epi8('\n');
+
+    while (end - p >= 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+
+        uint32_t starMask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, star));
+        uint32_t newlineMask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, newline));
+
+        if (starMask != 0) {
+            int n = __builtin_ctz(starMask);
+            newlines += __builtin_popcount(newlineMask & ((1u << n) - 1));
+            return p + n;
+        }
+
+        newlines += __builtin_popcount(newlineMask);
+        p += 32;
+    }
+
+    return findStarSse2(p, end, newlines);
+}
+
+#endif
+
+/// @brief 按CPU的支持情况选择实现
+/// @return 实现
+static SkipBlankKernel selectKernel()
+{
+#ifdef SKIP_BLANK_SIMD_SUPPORTED
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt") && __builtin_cpu_supports("bmi")) {
+        return {skipSpaceAvx2, findStarAvx2, "avx2"};
+    }
+
+    return {skipSpaceSse2, findStarSse2, "sse2"};
+#else
+    return {skipSpaceScalar, findStarScalar, "scalar"};
+#endif
+}
+
+/// @brief 获取选择的实现，只在第一次调用时检测CPU
+/// @return 实现
+static const SkipBlankKernel & kernel()
+{
+    static const SkipBlankKernel selected = selectKernel();
+
+    return selected;
+}
+
+/// @brief 用指定的实现跳过空白与注释
+/// @param k 实现
+/// @param p 开始位置
+/// @param end 结束位置
+/// @param newlines 累加跳过的换行符个数
+/// @return 同skipBlankAndComment
+static const char * skipWith(const SkipBlankKernel & k, const char * p, const char * end, int64_t & newlines)
+{
+    for (;;) {
+
+        p = k.skipSpace(p, end, newlines);
+
+        if (end - p < 2 || p[0] != '/') {
+            return p;
+        }
+
+        if (p[1] == '/') {
+            // 单行注释到换行符为止，换行符留给下一轮当作空白跳过
+            const void * nl = memchr(p + 2, '\n', (size_t) (end - p - 2));
+            if (nl == nullptr) {
+                return p;
+            }
+
+            p = static_cast<const char *>(nl);
+        } else if (p[1] == '*') {
+            // 多行注释到第一个*/为止，没有结束时注释内的换行符不计入
+            int64_t inner = 0;
+            const char * q = p + 2;
+
+            for (;;) {
+                q = k.findStar(q, end, inner);
+                if (q == end) {
+                    return p;
+                }
+
+                q++;
+                if (q < end && *q == '/') {
+                    break;
+                }
+            }
+
+            newlines += inner;
+            p = q + 1;
+        } else {
+            return p;
+        }
+    }
+}
+
+const char * skipBlankAndComment(const char * p, const char * end, int64_t & newlines)
+{
+    return skipWith(kernel(), p, end, newlines);
+}
+
+const char * skipBlankAndCommentScalar(const char * p, const char * end, int64_t & newlines)
+{
+    static const SkipBlankKernel scalar = {skipSpaceScalar, findStarScalar, "scalar"};
+
+    return skipWith(scalar, p, end, newlines);
+}
+
+const char * skipBlankImplName()
+{
+    return kernel().name;
+}
@@ -0,0 +1,48 @@
+///
+/// @file SkipBlank.h
+/// @brief 词法分析中空白与注释的快速跳过
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <cstdint>
+
+///
+/// @brief 跳过连续的空白（空格、TAB与换行符）与注释，并统计其中的换行符个数
+///
+/// x86上按CPU的支持情况用AVX2一次判断32个字符或用SSE2一次判断16个字符，其它平台逐字符判断。
+/// 注释的规则与MiniC.l一致：//注释直到换行符（换行符不属于注释），/* */注释到第一个*/结束。
+/// 在[p, end)内没有结束的注释不跳过，停在注释的开头，由调用者决定如何处理，
+/// 这样在分块读入的缓冲区上使用时不会把跨越缓冲区末尾的注释截断。
+///
+/// @param p 开始位置
+/// @param end 结束位置，不要求以'\0'结尾
+/// @param newlines 累加跳过的换行符个数
+/// @return 第一个不是空白也不属于注释的位置，或者没有结束的注释的开头，或者end
+///
+const char * skipBlankAndComment(const char * p, const char * end, int64_t & newlines);
+
+///
+/// @brief 逐字符判断的skipBlankAndComment，结果与其完全相同，用于不支持SIMD的平台与性能对比
+/// @param p 开始位置
+/// @param end 结束位置
+/// @param newlines 累加跳过的换行符个数
+/// @return 同skipBlankAndComment
+///
+const char * skipBlankAndCommentScalar(const char * p, const char * end, int64_t & newlines);
+
+///
+/// @brief 获取skipBlankAndComment实际使用的实现
+/// @return "avx2"、"sse2"或者"scalar"
+///
+const char * skipBlankImplName();
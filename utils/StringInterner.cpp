@@ -0,0 +1,145 @@
+///
+/// @file StringInterner.cpp
+/// @brief 进程内唯一的字符串驻留表，相同的字符串对应相同的32位编号
+/// @author zenglj (zenglj@live.com)
+/// @version 1.1
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>增加不驻留的查找
+/// </table>
+///
+#include <cstring>
+#include <stdexcept>
+
+#include "StringInterner.h"
+
+StringInterner & StringInterner::instance()
+{
+    static StringInterner interner;
+
+    return interner;
+}
+
+StringInterner::StringInterner() : slots(1024, 0)
+{
+    // 编号0固定为空串，不放入哈希表，intern时单独判断
+    pages[0] = new std::string_view[PAGE_SIZE];
+    pages[0][0] = std::string_view("", 0);
+    hashes.push_back(0);
+    count.store(1, std::memory_order_release);
+}
+
+StringInterner::~StringInterner()
+{
+    for (auto page: pages) {
+        delete[] page;
+    }
+}
+
+uint32_t StringInterner::hash(std::string_view str)
+{
+    uint32_t h = 2166136261u;
+
+    for (char c: str) {
+        h = (h ^ (uint8_t) c) * 16777619u;
+    }
+
+    return h;
+}
+
+void StringInterner::grow()
+{
+    std::vector<Symbol> newSlots(slots.size() * 2, 0);
+    size_t mask = newSlots.size() - 1;
+
+    for (Symbol sym: slots) {
+        if (sym != 0) {
+            size_t pos = hashes[sym] & mask;
+            while (newSlots[pos] != 0) {
+                pos = (pos + 1) & mask;
+            }
+            newSlots[pos] = sym;
+        }
+    }
+
+    slots.swap(newSlots);
+}
+
+Symbol StringInterner::probe(std::string_view str, uint32_t h, size_t & pos) const
+{
+    size_t mask = slots.size() - 1;
+
+    // 线性探测，哈希值相同时再比较内容
+    for (pos = h & mask; slots[pos] != 0; pos = (pos + 1) & mask) {
+        Symbol sym = slots[pos];
+        if (hashes[sym] == h && this->str(sym) == str) {
+            return sym;
+        }
+    }
+
+    return 0;
+}
+
+Symbol StringInterner::lookup(std::string_view str)
+{
+    if (str.empty()) {
+        return 0;
+    }
+
+    uint32_t h = hash(str);
+    size_t pos;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return probe(str, h, pos);
+}
+
+Symbol StringInterner::intern(std::string_view str)
+{
+    if (str.empty()) {
+        return 0;
+    }
+
+    uint32_t h = hash(str);
+    size_t pos;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    Symbol sym = probe(str, h, pos);
+    if (sym != 0) {
+        return sym;
+    }
+
+    sym = count.load(std::memory_order_relaxed);
+    if ((sym >> PAGE_BITS) >= MAX_PAGES) {
+        throw std::length_error("too many interned strings");
+    }
+
+    // 复制内容，保留'\0'结尾便于传给C接口
+    char * copy = static_cast<char *>(storage.allocate(str.size() + 1, 1));
+    memcpy(copy, str.data(), str.size());
+    copy[str.size()] = '\0';
+
+    std::string_view *& page = pages[sym >> PAGE_BITS];
+    if (page == nullptr) {
+        page = new std::string_view[PAGE_SIZE];
+    }
+    page[sym & (PAGE_SIZE - 1)] = std::string_view(copy, str.size());
+
+    hashes.push_back(h);
+    slots[pos] = sym;
+    count.store(sym + 1, std::memory_order_release);
+
+    // 装载因子超过1/2时扩容
+    if ((size_t) (sym + 1) * 2 > slots.size()) {
+        grow();
+    }
+
+    return sym;
+}
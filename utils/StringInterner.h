@@ -0,0 +1,173 @@
+///
+/// @file StringInterner.h
+/// @brief 进程内唯一的字符串驻留表，相同的字符串对应相同的32位编号
+/// @author zenglj (zenglj@live.com)
+/// @version 1.1
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// <tr><td>2026-10-19 <td>1.1     <td>zenglj  <td>增加不驻留的查找
+/// </table>
+///
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "Arena.h"
+
+///
+/// @brief 驻留字符串的编号，0固定对应空串
+///
+typedef uint32_t Symbol;
+
+///
+/// @brief 字符串驻留表
+///
+/// 字符串内容复制到内存池后不再移动，编号与字符串在进程内一直有效。
+/// 驻留时加锁；编号到字符串的映射按页存放，页的位置不变，已得到的编号可不加锁查询。
+///
+class StringInterner {
+
+public:
+    ///
+    /// @brief 获取进程内唯一的驻留表
+    /// @return 驻留表
+    ///
+    static StringInterner & instance();
+
+    ///
+    /// @brief 驻留字符串，已存在时返回原编号
+    /// @param str 字符串
+    /// @return 编号
+    ///
+    Symbol intern(std::string_view str);
+
+    ///
+    /// @brief 查找已驻留的字符串，不存在时不驻留
+    /// @param str 字符串
+    /// @return 编号，没有驻留过时返回0
+    ///
+    Symbol lookup(std::string_view str);
+
+    ///
+    /// @brief 获取编号对应的字符串
+    /// @param sym 编号，必须是intern返回的编号
+    /// @return 字符串，以'\0'结尾
+    ///
+    std::string_view str(Symbol sym) const
+    {
+        return pages[sym >> PAGE_BITS][sym & (PAGE_SIZE - 1)];
+    }
+
+    ///
+    /// @brief 已驻留的字符串个数，含空串
+    /// @return 个数
+    ///
+    uint32_t size() const
+    {
+        return count.load(std::memory_order_acquire);
+    }
+
+    StringInterner(const StringInterner &) = delete;
+    StringInterner & operator=(const StringInterner &) = delete;
+
+private:
+    ///
+    /// @brief 构造函数，预先驻留空串
+    ///
+    StringInterner();
+
+    ///
+    /// @brief 析构函数
+    ///
+    ~StringInterner();
+
+    ///
+    /// @brief 字符串的哈希函数，FNV-1a
+    /// @param str 字符串
+    /// @return 哈希值
+    ///
+    static uint32_t hash(std::string_view str);
+
+    ///
+    /// @brief 哈希表扩容一倍并重新放置所有编号
+    ///
+    void grow();
+
+    ///
+    /// @brief 在哈希表中查找字符串，调用者须持有锁
+    /// @param str 字符串
+    /// @param h 字符串的哈希值
+    /// @param pos 返回找到的位置，或者可插入的空位置
+    /// @return 编号，没有找到时返回0
+    ///
+    Symbol probe(std::string_view str, uint32_t h, size_t & pos) const;
+
+    /// @brief 每页编号个数的位数
+    static constexpr uint32_t PAGE_BITS = 12;
+
+    /// @brief 每页的编号个数
+    static constexpr uint32_t PAGE_SIZE = 1u << PAGE_BITS;
+
+    /// @brief 最多的页数
+    static constexpr uint32_t MAX_PAGES = 1u << 12;
+
+    ///
+    /// @brief 编号到字符串的映射，按页分配
+    ///
+    std::string_view * pages[MAX_PAGES] = {};
+
+    ///
+    /// @brief 编号对应字符串的哈希值，扩容时不必重新计算
+    ///
+    std::vector<uint32_t> hashes;
+
+    ///
+    /// @brief 开放定址的哈希表，存放编号，0表示空位置
+    ///
+    std::vector<Symbol> slots;
+
+    ///
+    /// @brief 已驻留的字符串个数
+    ///
+    std::atomic<uint32_t> count{0};
+
+    ///
+    /// @brief 字符串内容的存储
+    ///
+    Arena storage;
+
+    ///
+    /// @brief 驻留时的互斥锁
+    ///
+    std::mutex mutex;
+};
+
+///
+/// @brief 驻留字符串
+/// @param str 字符串
+/// @return 编号
+///
+inline Symbol intern(std::string_view str)
+{
+    return StringInterner::instance().intern(str);
+}
+
+///
+/// @brief 获取编号对应的字符串
+/// @param sym 编号
+/// @return 字符串
+///
+inline std::string_view symbolName(Symbol sym)
+{
+    return StringInterner::instance().str(sym);
+}
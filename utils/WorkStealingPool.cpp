@@ -0,0 +1,165 @@
+///
+/// @file WorkStealingPool.cpp
+/// @brief 工作窃取的线程池，用于并行编译多个源文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#include <algorithm>
+
+#include "WorkStealingPool.h"
+
+unsigned WorkStealingPool::clampThreads(unsigned requested, size_t taskCount)
+{
+    unsigned cores = std::thread::hardware_concurrency();
+    if (cores == 0) {
+        cores = 1;
+    }
+
+    unsigned count = (requested == 0) ? cores : std::min(requested, cores * maxThreadsPerCore);
+
+    // 多出的线程没有任务可做
+    if (taskCount < count) {
+        count = (unsigned) std::max<size_t>(taskCount, 1);
+    }
+
+    return count;
+}
+
+WorkStealingPool::WorkStealingPool(unsigned threadCount)
+{
+    threadCount = clampThreads(threadCount, SIZE_MAX);
+
+    for (unsigned i = 0; i < threadCount; i++) {
+        queues.push_back(std::make_unique<WorkQueue>());
+    }
+
+    // 0号线程为调用parallelFor的线程，不用创建
+    for (unsigned i = 1; i < threadCount; i++) {
+        threads.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+
+    for (auto & thread: threads) {
+        thread.join();
+    }
+}
+
+void WorkStealingPool::parallelFor(size_t count, const std::function<void(size_t)> & task)
+{
+    if (count == 0) {
+        return;
+    }
+
+    // 单线程时直接按次序执行
+    if (threads.empty()) {
+        for (size_t i = 0; i < count; i++) {
+            task(i);
+        }
+        return;
+    }
+
+    // 先设置任务再放入队列，取到序号的线程一定能看到当前的任务
+    current = &task;
+    pending.store(count, std::memory_order_relaxed);
+
+    // 按序号连续分段放入各线程的队列，相邻的任务大小往往相近
+    size_t n = queues.size();
+    for (size_t q = 0; q < n; q++) {
+        std::lock_guard<std::mutex> lock(queues[q]->mutex);
+        for (size_t i = q * count / n; i < (q + 1) * count / n; i++) {
+            queues[q]->items.push_back(i);
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+    }
+    wake.notify_all();
+
+    drain(0);
+
+    // 其它线程可能还在执行最后窃取的任务
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return pending.load(std::memory_order_acquire) == 0; });
+    current = nullptr;
+}
+
+void WorkStealingPool::workerLoop(unsigned id)
+{
+    uint64_t seen = 0;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wake.wait(lock, [this, seen] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+        }
+
+        drain(id);
+    }
+}
+
+void WorkStealingPool::drain(unsigned id)
+{
+    size_t index;
+
+    while (take(id, index)) {
+
+        (*current)(index);
+
+        // 最后一个任务完成时唤醒调用parallelFor的线程，加锁避免唤醒丢失
+        if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            std::lock_guard<std::mutex> lock(mutex);
+            done.notify_all();
+        }
+    }
+}
+
+bool WorkStealingPool::take(unsigned id, size_t & index)
+{
+    // 自己的队列从队尾取
+    {
+        WorkQueue & own = *queues[id];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.items.empty()) {
+            index = own.items.back();
+            own.items.pop_back();
+            return true;
+        }
+    }
+
+    // 从其它线程的队头窃取，从下一个线程开始避免都去窃取同一个队列
+    size_t n = queues.size();
+    for (size_t k = 1; k < n; k++) {
+        WorkQueue & victim = *queues[(id + k) % n];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.items.empty()) {
+            index = victim.items.front();
+            victim.items.pop_front();
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,154 @@
+///
+/// @file WorkStealingPool.h
+/// @brief 工作窃取的线程池，用于并行编译多个源文件
+/// @author zenglj (zenglj@live.com)
+/// @version 1.0
+/// @date 2026-10-19
+///
+/// @copyright Copyright (c) 2024
+///
+/// @par 修改日志:
+/// <table>
+/// <tr><th>Date       <th>Version <th>Author  <th>Description
+/// <tr><td>2026-10-19 <td>1.0     <td>zenglj  <td>新做
+/// </table>
+///
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+///
+/// @brief 工作窃取的线程池
+///
+/// 每个线程有自己的任务队列，从队尾取自己的任务；自己的队列空了以后从其它线程的队头窃取，
+/// 耗时差别很大的任务也能让所有线程一直忙碌。调用parallelFor的线程也作为0号线程参与执行。
+///
+class WorkStealingPool {
+
+public:
+    ///
+    /// @brief 构造函数，创建threadCount-1个工作线程
+    /// @param threadCount 线程数，含调用parallelFor的线程，0表示按CPU核数，最多为CPU核数的maxThreadsPerCore倍
+    ///
+    explicit WorkStealingPool(unsigned threadCount);
+
+    ///
+    /// @brief 析构函数，通知工作线程退出并等待
+    ///
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool & operator=(const WorkStealingPool &) = delete;
+
+    ///
+    /// @brief 并行执行task(0)到task(count-1)，全部完成后返回
+    /// @param count 任务个数
+    /// @param task 任务，参数为任务的序号，不能抛出异常
+    ///
+    void parallelFor(size_t count, const std::function<void(size_t)> & task);
+
+    ///
+    /// @brief 确定实际使用的线程数，不超过任务个数，也不超过CPU核数的maxThreadsPerCore倍
+    /// @param requested 指定的线程数，0表示按CPU核数
+    /// @param taskCount 任务个数
+    /// @return 线程数，至少为1
+    ///
+    static unsigned clampThreads(unsigned requested, size_t taskCount);
+
+    ///
+    /// @brief 每个CPU核最多的线程数，再多只增加线程切换与内存的开销
+    ///
+    static constexpr unsigned maxThreadsPerCore = 4;
+
+    ///
+    /// @brief 线程数，含调用parallelFor的线程
+    /// @return 线程数
+    ///
+    unsigned size() const
+    {
+        return (unsigned) queues.size();
+    }
+
+private:
+    ///
+    /// @brief 一个线程的任务队列，存放任务的序号
+    ///
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<size_t> items;
+    };
+
+    ///
+    /// @brief 工作线程的主循环，等待新的一批任务
+    /// @param id 线程编号
+    ///
+    void workerLoop(unsigned id);
+
+    ///
+    /// @brief 执行当前批次的任务，直到所有队列都为空
+    /// @param id 线程编号
+    ///
+    void drain(unsigned id);
+
+    ///
+    /// @brief 取一个任务，先取自己队尾的，没有时从其它线程的队头窃取
+    /// @param id 线程编号
+    /// @param index 返回任务的序号
+    /// @return true：取到任务，false：所有队列都为空
+    ///
+    bool take(unsigned id, size_t & index);
+
+    ///
+    /// @brief 各线程的任务队列，0号为调用parallelFor的线程
+    ///
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+
+    ///
+    /// @brief 工作线程
+    ///
+    std::vector<std::thread> threads;
+
+    ///
+    /// @brief 当前批次的任务，取到任务序号后再读取
+    ///
+    const std::function<void(size_t)> * current = nullptr;
+
+    ///
+    /// @brief 当前批次没有完成的任务个数
+    ///
+    std::atomic<size_t> pending{0};
+
+    ///
+    /// @brief 批次编号，工作线程据此判断有新的任务
+    ///
+    uint64_t generation = 0;
+
+    ///
+    /// @brief 是否通知工作线程退出
+    ///
+    bool stopping = false;
+
+    ///
+    /// @brief 保护generation、stopping的锁
+    ///
+    std::mutex mutex;
+
+    ///
+    /// @brief 有新批次或退出时唤醒工作线程
+    ///
+    std::condition_variable wake;
+
+    ///
+    /// @brief 批次的任务全部完成时唤醒调用parallelFor的线程
+    ///
+    std::condition_variable done;
+};